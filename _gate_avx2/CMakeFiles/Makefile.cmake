@@ -0,0 +1,109 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/common/CMakeLists.txt"
+  "/root/repo/common/cmake/embree-config-default.cmake"
+  "/root/repo/common/cmake/embree-config-linux.cmake"
+  "/root/repo/common/cmake/embree-config-version.cmake"
+  "/root/repo/common/cmake/gcc.cmake"
+  "/root/repo/common/cmake/ispc.cmake"
+  "/root/repo/common/cmake/package.cmake"
+  "/root/repo/common/cmake/test.cmake"
+  "/root/repo/common/cmake/uninstall.cmake.in"
+  "/root/repo/common/lexers/CMakeLists.txt"
+  "/root/repo/common/simd/CMakeLists.txt"
+  "/root/repo/common/sys/CMakeLists.txt"
+  "/root/repo/common/tasking/CMakeLists.txt"
+  "/root/repo/include/embree2/rtcore.h"
+  "/root/repo/include/embree2/rtcore.isph"
+  "/root/repo/kernels/CMakeLists.txt"
+  "/root/repo/kernels/config.h.in"
+  "/root/repo/kernels/version.h.in"
+  "/root/repo/kernels/xeon/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "version.h"
+  "rtcore.h"
+  "rtcore.isph"
+  "embree-config.cmake"
+  "embree-config-default.cmake"
+  "embree-config-version.cmake"
+  "config.h"
+  "uninstall.cmake"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "common/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "common/sys/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "common/simd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "common/lexers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "common/tasking/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "kernels/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "kernels/xeon/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/UNINSTALL.dir/DependInfo.cmake"
+  "common/sys/CMakeFiles/sys.dir/DependInfo.cmake"
+  "common/simd/CMakeFiles/simd.dir/DependInfo.cmake"
+  "common/lexers/CMakeFiles/lexers.dir/DependInfo.cmake"
+  "kernels/xeon/CMakeFiles/embree.dir/DependInfo.cmake"
+  "kernels/xeon/CMakeFiles/embree_sse42.dir/DependInfo.cmake"
+  "kernels/xeon/CMakeFiles/embree_avx.dir/DependInfo.cmake"
+  "kernels/xeon/CMakeFiles/embree_avx2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/verify.dir/DependInfo.cmake"
+  "tests/CMakeFiles/benchmark.dir/DependInfo.cmake"
+  "tests/CMakeFiles/retrace.dir/DependInfo.cmake"
+  "tests/CMakeFiles/replay.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/UNINSTALL"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/UNINSTALL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,101 @@
+# This file will be configured to contain variables for CPack. These variables
+# should be set in the CMake list file of the project before CPack module is
+# included. The list of available CPACK_xxx variables and their associated
+# documentation may be obtained using
+#  cpack --help-variable-list
+#
+# Some variables are common to all generators (e.g. CPACK_PACKAGE_NAME)
+# and some are specific to a generator
+# (e.g. CPACK_NSIS_EXTRA_INSTALL_COMMANDS). The generator specific variables
+# usually begin with CPACK_<GENNAME>_xxxx.
+
+
+set(CPACK_BUILD_SOURCE_DIRS "/root/repo;/root/repo/_gate_avx2")
+set(CPACK_CMAKE_GENERATOR "Unix Makefiles")
+set(CPACK_COMPONENTS_ALL "devel;lib;examples;lib_xeonphi;examples_xeonphi")
+set(CPACK_COMPONENTS_ALL_SET_BY_USER "TRUE")
+set(CPACK_COMPONENT_DEVEL_DEPENDS "lib")
+set(CPACK_COMPONENT_DEVEL_DESCRIPTION "Header Files for C and ISPC required to develop applications with Embree.")
+set(CPACK_COMPONENT_DEVEL_DISPLAY_NAME "Development")
+set(CPACK_COMPONENT_EXAMPLES_DEPENDS "lib")
+set(CPACK_COMPONENT_EXAMPLES_DESCRIPTION "Tutorials demonstrating how to use Embree.")
+set(CPACK_COMPONENT_EXAMPLES_DISPLAY_NAME "Examples")
+set(CPACK_COMPONENT_EXAMPLES_XEONPHI_DEPENDS "lib_xeonphi")
+set(CPACK_COMPONENT_EXAMPLES_XEONPHI_DESCRIPTION "Tutorials demonstrating how to use Embree.
+For The Intel Xeon Phi coprocessor.")
+set(CPACK_COMPONENT_EXAMPLES_XEONPHI_NAME "Xeon Phi Examples")
+set(CPACK_COMPONENT_LIB_DESCRIPTION "The Embree library including documentation.")
+set(CPACK_COMPONENT_LIB_DISPLAY_NAME "Library")
+set(CPACK_COMPONENT_LIB_REQUIRED "ON")
+set(CPACK_COMPONENT_LIB_XEONPHI_DEPENDS "lib")
+set(CPACK_COMPONENT_LIB_XEONPHI_DESCRIPTION "The Embree library including documentation.
+For The Intel Xeon Phi coprocessor.")
+set(CPACK_COMPONENT_LIB_XEONPHI_NAME "Xeon Phi Library")
+set(CPACK_COMPONENT_UNSPECIFIED_HIDDEN "TRUE")
+set(CPACK_COMPONENT_UNSPECIFIED_REQUIRED "TRUE")
+set(CPACK_DEFAULT_PACKAGE_DESCRIPTION_FILE "/usr/share/cmake-3.25/Templates/CPack.GenericDescription.txt")
+set(CPACK_DEFAULT_PACKAGE_DESCRIPTION_SUMMARY "embree2 built using CMake")
+set(CPACK_DMG_SLA_USE_RESOURCE_FILE_LICENSE "ON")
+set(CPACK_GENERATOR "RPM")
+set(CPACK_INSTALL_CMAKE_PROJECTS "/root/repo/_gate_avx2;embree2;ALL;/")
+set(CPACK_INSTALL_PREFIX "/usr/local")
+set(CPACK_MODULE_PATH "/root/repo/common/cmake")
+set(CPACK_NSIS_DISPLAY_NAME "Embree 2.9.0")
+set(CPACK_NSIS_INSTALLER_ICON_CODE "")
+set(CPACK_NSIS_INSTALLER_MUI_ICON_CODE "")
+set(CPACK_NSIS_INSTALL_ROOT "$PROGRAMFILES")
+set(CPACK_NSIS_MENU_LINKS "share/doc/embree2/LICENSE.txt;LICENSE;share/doc/embree2/CHANGELOG.txt;CHANGELOG;share/doc/embree2/README.md;README.md;share/doc/embree2/readme.pdf;readme.pdf;bin/embree2/verify;verify;bin/embree2/benchmark;benchmark;bin/embree2/retrace;retrace;bin/embree2/replay;replay")
+set(CPACK_NSIS_PACKAGE_NAME "Embree 2.9.0")
+set(CPACK_NSIS_UNINSTALL_NAME "Uninstall")
+set(CPACK_OBJCOPY_EXECUTABLE "/usr/bin/objcopy")
+set(CPACK_OBJDUMP_EXECUTABLE "/usr/bin/objdump")
+set(CPACK_OUTPUT_CONFIG_FILE "/root/repo/_gate_avx2/CPackConfig.cmake")
+set(CPACK_PACKAGE_CONTACT "embree_support@intel.com")
+set(CPACK_PACKAGE_DEFAULT_LOCATION "/")
+set(CPACK_PACKAGE_DESCRIPTION_FILE "/usr/share/cmake-3.25/Templates/CPack.GenericDescription.txt")
+set(CPACK_PACKAGE_DESCRIPTION_SUMMARY "Embree: High Performance Ray Tracing Kernels")
+set(CPACK_PACKAGE_FILE_NAME "embree-2.9.0-1.x86_64")
+set(CPACK_PACKAGE_INSTALL_DIRECTORY "Embree 2.9.0")
+set(CPACK_PACKAGE_INSTALL_REGISTRY_KEY "Embree 2.9.0")
+set(CPACK_PACKAGE_NAME "Embree")
+set(CPACK_PACKAGE_RELOCATABLE "true")
+set(CPACK_PACKAGE_VENDOR "Intel Corporation")
+set(CPACK_PACKAGE_VERSION "2.9.0")
+set(CPACK_PACKAGE_VERSION_MAJOR "2")
+set(CPACK_PACKAGE_VERSION_MINOR "9")
+set(CPACK_PACKAGE_VERSION_PATCH "0")
+set(CPACK_READELF_EXECUTABLE "/usr/bin/readelf")
+set(CPACK_RESOURCE_FILE_LICENSE "/root/repo/LICENSE.txt")
+set(CPACK_RESOURCE_FILE_README "/root/repo/README.md")
+set(CPACK_RESOURCE_FILE_WELCOME "/usr/share/cmake-3.25/Templates/CPack.GenericWelcome.txt")
+set(CPACK_RPM_COMPONENT_INSTALL "ON")
+set(CPACK_RPM_PACKAGE_ARCHITECTURE "x86_64")
+set(CPACK_RPM_PACKAGE_GROUP "Development/Libraries")
+set(CPACK_RPM_PACKAGE_LICENSE "ASL 2.0")
+set(CPACK_RPM_PACKAGE_RELEASE "1")
+set(CPACK_RPM_PACKAGE_URL "http://embree.github.io/")
+set(CPACK_RPM_lib_POST_INSTALL_SCRIPT_FILE "/root/repo/common/cmake/rpm_ldconfig.sh")
+set(CPACK_RPM_lib_POST_UNINSTALL_SCRIPT_FILE "/root/repo/common/cmake/rpm_ldconfig.sh")
+set(CPACK_RPM_lib_xeonphi_POST_INSTALL_SCRIPT_FILE "/root/repo/common/cmake/rpm_ldconfig.sh")
+set(CPACK_RPM_lib_xeonphi_POST_UNINSTALL_SCRIPT_FILE "/root/repo/common/cmake/rpm_ldconfig.sh")
+set(CPACK_SET_DESTDIR "OFF")
+set(CPACK_SOURCE_GENERATOR "TBZ2;TGZ;TXZ;TZ")
+set(CPACK_SOURCE_OUTPUT_CONFIG_FILE "/root/repo/_gate_avx2/CPackSourceConfig.cmake")
+set(CPACK_SOURCE_RPM "OFF")
+set(CPACK_SOURCE_TBZ2 "ON")
+set(CPACK_SOURCE_TGZ "ON")
+set(CPACK_SOURCE_TXZ "ON")
+set(CPACK_SOURCE_TZ "ON")
+set(CPACK_SOURCE_ZIP "OFF")
+set(CPACK_SYSTEM_NAME "Linux")
+set(CPACK_THREADS "1")
+set(CPACK_TOPLEVEL_TAG "Linux")
+set(CPACK_WIX_SIZEOF_VOID_P "8")
+
+if(NOT CPACK_PROPERTIES_FILE)
+  set(CPACK_PROPERTIES_FILE "/root/repo/_gate_avx2/CPackProperties.cmake")
+endif()
+
+if(EXISTS ${CPACK_PROPERTIES_FILE})
+  include(${CPACK_PROPERTIES_FILE})
+endif()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/common/lexers/stringstream.cpp" "common/lexers/CMakeFiles/lexers.dir/stringstream.cpp.o" "gcc" "common/lexers/CMakeFiles/lexers.dir/stringstream.cpp.o.d"
+  "/root/repo/common/lexers/tokenstream.cpp" "common/lexers/CMakeFiles/lexers.dir/tokenstream.cpp.o" "gcc" "common/lexers/CMakeFiles/lexers.dir/tokenstream.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_avx2/common/sys/CMakeFiles/sys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
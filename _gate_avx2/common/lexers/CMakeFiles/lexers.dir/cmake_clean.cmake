@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../liblexers.a"
+  "../../liblexers.pdb"
+  "CMakeFiles/lexers.dir/stringstream.cpp.o"
+  "CMakeFiles/lexers.dir/stringstream.cpp.o.d"
+  "CMakeFiles/lexers.dir/tokenstream.cpp.o"
+  "CMakeFiles/lexers.dir/tokenstream.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lexers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../libsimd.a"
+  "../../libsimd.pdb"
+  "CMakeFiles/simd.dir/sse.cpp.o"
+  "CMakeFiles/simd.dir/sse.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
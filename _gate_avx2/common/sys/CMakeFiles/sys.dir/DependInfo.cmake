@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/common/sys/alloc.cpp" "common/sys/CMakeFiles/sys.dir/alloc.cpp.o" "gcc" "common/sys/CMakeFiles/sys.dir/alloc.cpp.o.d"
+  "/root/repo/common/sys/barrier.cpp" "common/sys/CMakeFiles/sys.dir/barrier.cpp.o" "gcc" "common/sys/CMakeFiles/sys.dir/barrier.cpp.o.d"
+  "/root/repo/common/sys/condition.cpp" "common/sys/CMakeFiles/sys.dir/condition.cpp.o" "gcc" "common/sys/CMakeFiles/sys.dir/condition.cpp.o.d"
+  "/root/repo/common/sys/filename.cpp" "common/sys/CMakeFiles/sys.dir/filename.cpp.o" "gcc" "common/sys/CMakeFiles/sys.dir/filename.cpp.o.d"
+  "/root/repo/common/sys/library.cpp" "common/sys/CMakeFiles/sys.dir/library.cpp.o" "gcc" "common/sys/CMakeFiles/sys.dir/library.cpp.o.d"
+  "/root/repo/common/sys/mutex.cpp" "common/sys/CMakeFiles/sys.dir/mutex.cpp.o" "gcc" "common/sys/CMakeFiles/sys.dir/mutex.cpp.o.d"
+  "/root/repo/common/sys/network.cpp" "common/sys/CMakeFiles/sys.dir/network.cpp.o" "gcc" "common/sys/CMakeFiles/sys.dir/network.cpp.o.d"
+  "/root/repo/common/sys/regression.cpp" "common/sys/CMakeFiles/sys.dir/regression.cpp.o" "gcc" "common/sys/CMakeFiles/sys.dir/regression.cpp.o.d"
+  "/root/repo/common/sys/string.cpp" "common/sys/CMakeFiles/sys.dir/string.cpp.o" "gcc" "common/sys/CMakeFiles/sys.dir/string.cpp.o.d"
+  "/root/repo/common/sys/sysinfo.cpp" "common/sys/CMakeFiles/sys.dir/sysinfo.cpp.o" "gcc" "common/sys/CMakeFiles/sys.dir/sysinfo.cpp.o.d"
+  "/root/repo/common/sys/thread.cpp" "common/sys/CMakeFiles/sys.dir/thread.cpp.o" "gcc" "common/sys/CMakeFiles/sys.dir/thread.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "../../libsys.a"
+  "../../libsys.pdb"
+  "CMakeFiles/sys.dir/alloc.cpp.o"
+  "CMakeFiles/sys.dir/alloc.cpp.o.d"
+  "CMakeFiles/sys.dir/barrier.cpp.o"
+  "CMakeFiles/sys.dir/barrier.cpp.o.d"
+  "CMakeFiles/sys.dir/condition.cpp.o"
+  "CMakeFiles/sys.dir/condition.cpp.o.d"
+  "CMakeFiles/sys.dir/filename.cpp.o"
+  "CMakeFiles/sys.dir/filename.cpp.o.d"
+  "CMakeFiles/sys.dir/library.cpp.o"
+  "CMakeFiles/sys.dir/library.cpp.o.d"
+  "CMakeFiles/sys.dir/mutex.cpp.o"
+  "CMakeFiles/sys.dir/mutex.cpp.o.d"
+  "CMakeFiles/sys.dir/network.cpp.o"
+  "CMakeFiles/sys.dir/network.cpp.o.d"
+  "CMakeFiles/sys.dir/regression.cpp.o"
+  "CMakeFiles/sys.dir/regression.cpp.o.d"
+  "CMakeFiles/sys.dir/string.cpp.o"
+  "CMakeFiles/sys.dir/string.cpp.o.d"
+  "CMakeFiles/sys.dir/sysinfo.cpp.o"
+  "CMakeFiles/sys.dir/sysinfo.cpp.o.d"
+  "CMakeFiles/sys.dir/thread.cpp.o"
+  "CMakeFiles/sys.dir/thread.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
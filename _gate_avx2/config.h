@@ -0,0 +1,17 @@
+/* #undef RTCORE_RAY_MASK */
+/* #undef RTCORE_STAT_COUNTERS */
+/* #undef RTCORE_BACKFACE_CULLING */
+#define RTCORE_INTERSECTION_FILTER
+#define RTCORE_INTERSECTION_FILTER_RESTORE
+#define RTCORE_BUFFER_STRIDE
+/* #undef RTCORE_ENABLE_RAYSTREAM_LOGGER */
+/* #undef RTCORE_RETURN_SUBDIV_NORMAL */
+/* #undef RTCORE_IGNORE_INVALID_RAYS */
+#define RTCORE_RAY_PACKETS
+/* #undef RTCORE_MEMKIND_ALLOCATOR */
+
+
+
+
+
+
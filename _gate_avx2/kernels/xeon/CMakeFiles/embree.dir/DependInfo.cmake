@@ -0,0 +1,91 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/common/tasking/taskscheduler_tbb.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/__/common/tasking/taskscheduler_tbb.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/__/common/tasking/taskscheduler_tbb.cpp.o.d"
+  "/root/repo/common/tasking/tasksys.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/__/common/tasking/tasksys.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/__/common/tasking/tasksys.cpp.o.d"
+  "/root/repo/kernels/algorithms/parallel_for.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/parallel_for.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/parallel_for.cpp.o.d"
+  "/root/repo/kernels/algorithms/parallel_for_for.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/parallel_for_for.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/parallel_for_for.cpp.o.d"
+  "/root/repo/kernels/algorithms/parallel_for_for_prefix_sum.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/parallel_for_for_prefix_sum.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/parallel_for_for_prefix_sum.cpp.o.d"
+  "/root/repo/kernels/algorithms/parallel_prefix_sum.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/parallel_prefix_sum.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/parallel_prefix_sum.cpp.o.d"
+  "/root/repo/kernels/algorithms/parallel_reduce.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/parallel_reduce.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/parallel_reduce.cpp.o.d"
+  "/root/repo/kernels/algorithms/pmap.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/pmap.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/pmap.cpp.o.d"
+  "/root/repo/kernels/algorithms/prefix.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/prefix.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/prefix.cpp.o.d"
+  "/root/repo/kernels/algorithms/pset.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/pset.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/pset.cpp.o.d"
+  "/root/repo/kernels/algorithms/sort.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/sort.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/algorithms/sort.cpp.o.d"
+  "/root/repo/kernels/common/acceln.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/acceln.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/acceln.cpp.o.d"
+  "/root/repo/kernels/common/accelset.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/accelset.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/accelset.cpp.o.d"
+  "/root/repo/kernels/common/buffer.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/buffer.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/buffer.cpp.o.d"
+  "/root/repo/kernels/common/device.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/device.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/device.cpp.o.d"
+  "/root/repo/kernels/common/geometry.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/geometry.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/geometry.cpp.o.d"
+  "/root/repo/kernels/common/globals.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/globals.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/globals.cpp.o.d"
+  "/root/repo/kernels/common/raystream_log.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/raystream_log.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/raystream_log.cpp.o.d"
+  "/root/repo/kernels/common/raystreams/raystreams.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/raystreams/raystreams.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/raystreams/raystreams.cpp.o.d"
+  "/root/repo/kernels/common/rtcore.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/rtcore.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/rtcore.cpp.o.d"
+  "/root/repo/kernels/common/rtcore_ispc.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/rtcore_ispc.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/rtcore_ispc.cpp.o.d"
+  "/root/repo/kernels/common/scene.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene.cpp.o.d"
+  "/root/repo/kernels/common/scene_bezier_curves.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_bezier_curves.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_bezier_curves.cpp.o.d"
+  "/root/repo/kernels/common/scene_geometry_instance.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_geometry_instance.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_geometry_instance.cpp.o.d"
+  "/root/repo/kernels/common/scene_instance.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_instance.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_instance.cpp.o.d"
+  "/root/repo/kernels/common/scene_line_segments.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_line_segments.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_line_segments.cpp.o.d"
+  "/root/repo/kernels/common/scene_quad_mesh.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_quad_mesh.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_quad_mesh.cpp.o.d"
+  "/root/repo/kernels/common/scene_subdiv_mesh.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_subdiv_mesh.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_subdiv_mesh.cpp.o.d"
+  "/root/repo/kernels/common/scene_subdiv_topology.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_subdiv_topology.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_subdiv_topology.cpp.o.d"
+  "/root/repo/kernels/common/scene_triangle_mesh.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_triangle_mesh.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_triangle_mesh.cpp.o.d"
+  "/root/repo/kernels/common/scene_user_geometry.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_user_geometry.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/scene_user_geometry.cpp.o.d"
+  "/root/repo/kernels/common/stat.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/stat.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/stat.cpp.o.d"
+  "/root/repo/kernels/common/state.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/state.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/state.cpp.o.d"
+  "/root/repo/kernels/common/subdiv/bezier_curve.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/subdiv/bezier_curve.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/subdiv/bezier_curve.cpp.o.d"
+  "/root/repo/kernels/common/subdiv/catmullclark_coefficients.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/subdiv/catmullclark_coefficients.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/subdiv/catmullclark_coefficients.cpp.o.d"
+  "/root/repo/kernels/common/subdiv/subdivpatch1base.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/subdiv/subdivpatch1base.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/subdiv/subdivpatch1base.cpp.o.d"
+  "/root/repo/kernels/common/subdiv/subdivpatch1base_eval.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/subdiv/subdivpatch1base_eval.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/subdiv/subdivpatch1base_eval.cpp.o.d"
+  "/root/repo/kernels/common/subdiv/tessellation_cache.cpp" "kernels/xeon/CMakeFiles/embree.dir/__/common/subdiv/tessellation_cache.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/__/common/subdiv/tessellation_cache.cpp.o.d"
+  "/root/repo/kernels/xeon/builders/primrefgen.cpp" "kernels/xeon/CMakeFiles/embree.dir/builders/primrefgen.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/builders/primrefgen.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh4_factory.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh4_factory.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh4_factory.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh8_factory.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh8_factory.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh8_factory.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_builder.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_builder.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_builder.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_builder_hair.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_builder_hair.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_builder_hair.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_builder_instancing.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_builder_instancing.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_builder_instancing.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_builder_morton.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_builder_morton.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_builder_morton.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_builder_sah.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_builder_sah.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_builder_sah.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_builder_subdiv.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_builder_subdiv.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_builder_subdiv.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_builder_twolevel.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_builder_twolevel.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_builder_twolevel.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_intersector1.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_intersector1.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_intersector1.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_intersector_hybrid.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_intersector_hybrid.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_intersector_hybrid.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_intersector_single.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_intersector_single.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_intersector_single.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_intersector_stream.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_intersector_stream.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_intersector_stream.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_refit.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_refit.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_refit.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_rotate.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_rotate.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_rotate.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_statistics.cpp" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_statistics.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/bvh/bvh_statistics.cpp.o.d"
+  "/root/repo/kernels/xeon/geometry/grid_soa.cpp" "kernels/xeon/CMakeFiles/embree.dir/geometry/grid_soa.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/geometry/grid_soa.cpp.o.d"
+  "/root/repo/kernels/xeon/geometry/instance_intersector.cpp" "kernels/xeon/CMakeFiles/embree.dir/geometry/instance_intersector.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/geometry/instance_intersector.cpp.o.d"
+  "/root/repo/kernels/xeon/geometry/instance_intersector1.cpp" "kernels/xeon/CMakeFiles/embree.dir/geometry/instance_intersector1.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/geometry/instance_intersector1.cpp.o.d"
+  "/root/repo/kernels/xeon/geometry/primitive.cpp" "kernels/xeon/CMakeFiles/embree.dir/geometry/primitive.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree.dir/geometry/primitive.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_avx2/libembree.so" "/root/repo/_gate_avx2/libembree.so.2.9.0"
+  "/root/repo/_gate_avx2/libembree.so.2" "/root/repo/_gate_avx2/libembree.so.2.9.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_avx2/kernels/xeon/CMakeFiles/embree_sse42.dir/DependInfo.cmake"
+  "/root/repo/_gate_avx2/kernels/xeon/CMakeFiles/embree_avx.dir/DependInfo.cmake"
+  "/root/repo/_gate_avx2/kernels/xeon/CMakeFiles/embree_avx2.dir/DependInfo.cmake"
+  "/root/repo/_gate_avx2/common/sys/CMakeFiles/sys.dir/DependInfo.cmake"
+  "/root/repo/_gate_avx2/common/simd/CMakeFiles/simd.dir/DependInfo.cmake"
+  "/root/repo/_gate_avx2/common/lexers/CMakeFiles/lexers.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,131 @@
+file(REMOVE_RECURSE
+  "../../libembree.pdb"
+  "../../libembree.so"
+  "../../libembree.so.2"
+  "../../libembree.so.2.9.0"
+  "CMakeFiles/embree.dir/__/__/common/tasking/taskscheduler_tbb.cpp.o"
+  "CMakeFiles/embree.dir/__/__/common/tasking/taskscheduler_tbb.cpp.o.d"
+  "CMakeFiles/embree.dir/__/__/common/tasking/tasksys.cpp.o"
+  "CMakeFiles/embree.dir/__/__/common/tasking/tasksys.cpp.o.d"
+  "CMakeFiles/embree.dir/__/algorithms/parallel_for.cpp.o"
+  "CMakeFiles/embree.dir/__/algorithms/parallel_for.cpp.o.d"
+  "CMakeFiles/embree.dir/__/algorithms/parallel_for_for.cpp.o"
+  "CMakeFiles/embree.dir/__/algorithms/parallel_for_for.cpp.o.d"
+  "CMakeFiles/embree.dir/__/algorithms/parallel_for_for_prefix_sum.cpp.o"
+  "CMakeFiles/embree.dir/__/algorithms/parallel_for_for_prefix_sum.cpp.o.d"
+  "CMakeFiles/embree.dir/__/algorithms/parallel_prefix_sum.cpp.o"
+  "CMakeFiles/embree.dir/__/algorithms/parallel_prefix_sum.cpp.o.d"
+  "CMakeFiles/embree.dir/__/algorithms/parallel_reduce.cpp.o"
+  "CMakeFiles/embree.dir/__/algorithms/parallel_reduce.cpp.o.d"
+  "CMakeFiles/embree.dir/__/algorithms/pmap.cpp.o"
+  "CMakeFiles/embree.dir/__/algorithms/pmap.cpp.o.d"
+  "CMakeFiles/embree.dir/__/algorithms/prefix.cpp.o"
+  "CMakeFiles/embree.dir/__/algorithms/prefix.cpp.o.d"
+  "CMakeFiles/embree.dir/__/algorithms/pset.cpp.o"
+  "CMakeFiles/embree.dir/__/algorithms/pset.cpp.o.d"
+  "CMakeFiles/embree.dir/__/algorithms/sort.cpp.o"
+  "CMakeFiles/embree.dir/__/algorithms/sort.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/acceln.cpp.o"
+  "CMakeFiles/embree.dir/__/common/acceln.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/accelset.cpp.o"
+  "CMakeFiles/embree.dir/__/common/accelset.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/buffer.cpp.o"
+  "CMakeFiles/embree.dir/__/common/buffer.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/device.cpp.o"
+  "CMakeFiles/embree.dir/__/common/device.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/geometry.cpp.o"
+  "CMakeFiles/embree.dir/__/common/geometry.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/globals.cpp.o"
+  "CMakeFiles/embree.dir/__/common/globals.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/raystream_log.cpp.o"
+  "CMakeFiles/embree.dir/__/common/raystream_log.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/raystreams/raystreams.cpp.o"
+  "CMakeFiles/embree.dir/__/common/raystreams/raystreams.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/rtcore.cpp.o"
+  "CMakeFiles/embree.dir/__/common/rtcore.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/rtcore_ispc.cpp.o"
+  "CMakeFiles/embree.dir/__/common/rtcore_ispc.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/scene.cpp.o"
+  "CMakeFiles/embree.dir/__/common/scene.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/scene_bezier_curves.cpp.o"
+  "CMakeFiles/embree.dir/__/common/scene_bezier_curves.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/scene_geometry_instance.cpp.o"
+  "CMakeFiles/embree.dir/__/common/scene_geometry_instance.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/scene_instance.cpp.o"
+  "CMakeFiles/embree.dir/__/common/scene_instance.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/scene_line_segments.cpp.o"
+  "CMakeFiles/embree.dir/__/common/scene_line_segments.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/scene_quad_mesh.cpp.o"
+  "CMakeFiles/embree.dir/__/common/scene_quad_mesh.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/scene_subdiv_mesh.cpp.o"
+  "CMakeFiles/embree.dir/__/common/scene_subdiv_mesh.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/scene_subdiv_topology.cpp.o"
+  "CMakeFiles/embree.dir/__/common/scene_subdiv_topology.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/scene_triangle_mesh.cpp.o"
+  "CMakeFiles/embree.dir/__/common/scene_triangle_mesh.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/scene_user_geometry.cpp.o"
+  "CMakeFiles/embree.dir/__/common/scene_user_geometry.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/stat.cpp.o"
+  "CMakeFiles/embree.dir/__/common/stat.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/state.cpp.o"
+  "CMakeFiles/embree.dir/__/common/state.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/subdiv/bezier_curve.cpp.o"
+  "CMakeFiles/embree.dir/__/common/subdiv/bezier_curve.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/subdiv/catmullclark_coefficients.cpp.o"
+  "CMakeFiles/embree.dir/__/common/subdiv/catmullclark_coefficients.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/subdiv/subdivpatch1base.cpp.o"
+  "CMakeFiles/embree.dir/__/common/subdiv/subdivpatch1base.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/subdiv/subdivpatch1base_eval.cpp.o"
+  "CMakeFiles/embree.dir/__/common/subdiv/subdivpatch1base_eval.cpp.o.d"
+  "CMakeFiles/embree.dir/__/common/subdiv/tessellation_cache.cpp.o"
+  "CMakeFiles/embree.dir/__/common/subdiv/tessellation_cache.cpp.o.d"
+  "CMakeFiles/embree.dir/builders/primrefgen.cpp.o"
+  "CMakeFiles/embree.dir/builders/primrefgen.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh4_factory.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh4_factory.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh8_factory.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh8_factory.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh_builder.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh_builder.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh_builder_hair.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh_builder_hair.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh_builder_instancing.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh_builder_instancing.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh_builder_morton.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh_builder_morton.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh_builder_sah.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh_builder_sah.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh_builder_subdiv.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh_builder_subdiv.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh_builder_twolevel.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh_builder_twolevel.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh_intersector1.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh_intersector1.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh_intersector_hybrid.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh_intersector_hybrid.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh_intersector_single.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh_intersector_single.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh_intersector_stream.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh_intersector_stream.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh_refit.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh_refit.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh_rotate.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh_rotate.cpp.o.d"
+  "CMakeFiles/embree.dir/bvh/bvh_statistics.cpp.o"
+  "CMakeFiles/embree.dir/bvh/bvh_statistics.cpp.o.d"
+  "CMakeFiles/embree.dir/geometry/grid_soa.cpp.o"
+  "CMakeFiles/embree.dir/geometry/grid_soa.cpp.o.d"
+  "CMakeFiles/embree.dir/geometry/instance_intersector.cpp.o"
+  "CMakeFiles/embree.dir/geometry/instance_intersector.cpp.o.d"
+  "CMakeFiles/embree.dir/geometry/instance_intersector1.cpp.o"
+  "CMakeFiles/embree.dir/geometry/instance_intersector1.cpp.o.d"
+  "CMakeFiles/embree.dir/geometry/primitive.cpp.o"
+  "CMakeFiles/embree.dir/geometry/primitive.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/embree.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
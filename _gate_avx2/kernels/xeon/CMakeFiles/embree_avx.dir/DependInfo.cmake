@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/kernels/common/raystreams/raystreams.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/__/common/raystreams/raystreams.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/__/common/raystreams/raystreams.cpp.o.d"
+  "/root/repo/kernels/common/scene_subdiv_mesh_avx.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/__/common/scene_subdiv_mesh_avx.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/__/common/scene_subdiv_mesh_avx.cpp.o.d"
+  "/root/repo/kernels/common/subdiv/subdivpatch1base_eval.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/__/common/subdiv/subdivpatch1base_eval.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/__/common/subdiv/subdivpatch1base_eval.cpp.o.d"
+  "/root/repo/kernels/xeon/builders/primrefgen.avx.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/builders/primrefgen.avx.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/builders/primrefgen.avx.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_builder.avx.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_builder.avx.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_builder.avx.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_builder_hair.avx.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_builder_hair.avx.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_builder_hair.avx.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_builder_instancing.avx.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_builder_instancing.avx.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_builder_instancing.avx.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_builder_morton.avx.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_builder_morton.avx.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_builder_morton.avx.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_builder_sah.avx.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_builder_sah.avx.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_builder_sah.avx.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_builder_subdiv.avx.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_builder_subdiv.avx.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_builder_subdiv.avx.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_builder_twolevel.avx.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_builder_twolevel.avx.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_builder_twolevel.avx.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_intersector1.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_intersector1.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_intersector1.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_intersector_hybrid.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_intersector_hybrid.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_intersector_hybrid.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_intersector_single.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_intersector_single.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_intersector_single.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_intersector_stream.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_intersector_stream.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_intersector_stream.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_refit.avx.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_refit.avx.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_refit.avx.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_rotate.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_rotate.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_rotate.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_statistics.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_statistics.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/bvh/bvh_statistics.cpp.o.d"
+  "/root/repo/kernels/xeon/geometry/grid_soa.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/geometry/grid_soa.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/geometry/grid_soa.cpp.o.d"
+  "/root/repo/kernels/xeon/geometry/instance_intersector.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/geometry/instance_intersector.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/geometry/instance_intersector.cpp.o.d"
+  "/root/repo/kernels/xeon/geometry/instance_intersector1.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/geometry/instance_intersector1.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/geometry/instance_intersector1.cpp.o.d"
+  "/root/repo/kernels/xeon/geometry/primitive.cpp" "kernels/xeon/CMakeFiles/embree_avx.dir/geometry/primitive.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_avx.dir/geometry/primitive.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,55 @@
+file(REMOVE_RECURSE
+  "../../libembree_avx.a"
+  "../../libembree_avx.pdb"
+  "CMakeFiles/embree_avx.dir/__/common/raystreams/raystreams.cpp.o"
+  "CMakeFiles/embree_avx.dir/__/common/raystreams/raystreams.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/__/common/scene_subdiv_mesh_avx.cpp.o"
+  "CMakeFiles/embree_avx.dir/__/common/scene_subdiv_mesh_avx.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/__/common/subdiv/subdivpatch1base_eval.cpp.o"
+  "CMakeFiles/embree_avx.dir/__/common/subdiv/subdivpatch1base_eval.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/builders/primrefgen.avx.cpp.o"
+  "CMakeFiles/embree_avx.dir/builders/primrefgen.avx.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/bvh/bvh.cpp.o"
+  "CMakeFiles/embree_avx.dir/bvh/bvh.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_builder.avx.cpp.o"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_builder.avx.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_builder_hair.avx.cpp.o"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_builder_hair.avx.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_builder_instancing.avx.cpp.o"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_builder_instancing.avx.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_builder_morton.avx.cpp.o"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_builder_morton.avx.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_builder_sah.avx.cpp.o"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_builder_sah.avx.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_builder_subdiv.avx.cpp.o"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_builder_subdiv.avx.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_builder_twolevel.avx.cpp.o"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_builder_twolevel.avx.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_intersector1.cpp.o"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_intersector1.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_intersector_hybrid.cpp.o"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_intersector_hybrid.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_intersector_single.cpp.o"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_intersector_single.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_intersector_stream.cpp.o"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_intersector_stream.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_refit.avx.cpp.o"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_refit.avx.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_rotate.cpp.o"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_rotate.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_statistics.cpp.o"
+  "CMakeFiles/embree_avx.dir/bvh/bvh_statistics.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/geometry/grid_soa.cpp.o"
+  "CMakeFiles/embree_avx.dir/geometry/grid_soa.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/geometry/instance_intersector.cpp.o"
+  "CMakeFiles/embree_avx.dir/geometry/instance_intersector.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/geometry/instance_intersector1.cpp.o"
+  "CMakeFiles/embree_avx.dir/geometry/instance_intersector1.cpp.o.d"
+  "CMakeFiles/embree_avx.dir/geometry/primitive.cpp.o"
+  "CMakeFiles/embree_avx.dir/geometry/primitive.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/embree_avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
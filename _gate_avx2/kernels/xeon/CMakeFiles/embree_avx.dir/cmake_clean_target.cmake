@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "../../libembree_avx.a"
+)
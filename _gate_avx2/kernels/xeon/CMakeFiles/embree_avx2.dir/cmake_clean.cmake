@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "../../libembree_avx2.a"
+  "../../libembree_avx2.pdb"
+  "CMakeFiles/embree_avx2.dir/__/common/raystreams/raystreams.cpp.o"
+  "CMakeFiles/embree_avx2.dir/__/common/raystreams/raystreams.cpp.o.d"
+  "CMakeFiles/embree_avx2.dir/__/common/subdiv/subdivpatch1base_eval.cpp.o"
+  "CMakeFiles/embree_avx2.dir/__/common/subdiv/subdivpatch1base_eval.cpp.o.d"
+  "CMakeFiles/embree_avx2.dir/bvh/bvh_intersector1.cpp.o"
+  "CMakeFiles/embree_avx2.dir/bvh/bvh_intersector1.cpp.o.d"
+  "CMakeFiles/embree_avx2.dir/bvh/bvh_intersector_hybrid.cpp.o"
+  "CMakeFiles/embree_avx2.dir/bvh/bvh_intersector_hybrid.cpp.o.d"
+  "CMakeFiles/embree_avx2.dir/bvh/bvh_intersector_single.cpp.o"
+  "CMakeFiles/embree_avx2.dir/bvh/bvh_intersector_single.cpp.o.d"
+  "CMakeFiles/embree_avx2.dir/bvh/bvh_intersector_stream.cpp.o"
+  "CMakeFiles/embree_avx2.dir/bvh/bvh_intersector_stream.cpp.o.d"
+  "CMakeFiles/embree_avx2.dir/geometry/grid_soa.cpp.o"
+  "CMakeFiles/embree_avx2.dir/geometry/grid_soa.cpp.o.d"
+  "CMakeFiles/embree_avx2.dir/geometry/instance_intersector.cpp.o"
+  "CMakeFiles/embree_avx2.dir/geometry/instance_intersector.cpp.o.d"
+  "CMakeFiles/embree_avx2.dir/geometry/instance_intersector1.cpp.o"
+  "CMakeFiles/embree_avx2.dir/geometry/instance_intersector1.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/embree_avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
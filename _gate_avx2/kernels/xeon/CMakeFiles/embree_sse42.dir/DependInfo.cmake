@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/kernels/common/subdiv/subdivpatch1base_eval.cpp" "kernels/xeon/CMakeFiles/embree_sse42.dir/__/common/subdiv/subdivpatch1base_eval.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_sse42.dir/__/common/subdiv/subdivpatch1base_eval.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_intersector1.cpp" "kernels/xeon/CMakeFiles/embree_sse42.dir/bvh/bvh_intersector1.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_sse42.dir/bvh/bvh_intersector1.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_intersector_hybrid.cpp" "kernels/xeon/CMakeFiles/embree_sse42.dir/bvh/bvh_intersector_hybrid.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_sse42.dir/bvh/bvh_intersector_hybrid.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_intersector_single.cpp" "kernels/xeon/CMakeFiles/embree_sse42.dir/bvh/bvh_intersector_single.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_sse42.dir/bvh/bvh_intersector_single.cpp.o.d"
+  "/root/repo/kernels/xeon/bvh/bvh_intersector_stream.cpp" "kernels/xeon/CMakeFiles/embree_sse42.dir/bvh/bvh_intersector_stream.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_sse42.dir/bvh/bvh_intersector_stream.cpp.o.d"
+  "/root/repo/kernels/xeon/geometry/grid_soa.cpp" "kernels/xeon/CMakeFiles/embree_sse42.dir/geometry/grid_soa.cpp.o" "gcc" "kernels/xeon/CMakeFiles/embree_sse42.dir/geometry/grid_soa.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../libembree_sse42.a"
+  "../../libembree_sse42.pdb"
+  "CMakeFiles/embree_sse42.dir/__/common/subdiv/subdivpatch1base_eval.cpp.o"
+  "CMakeFiles/embree_sse42.dir/__/common/subdiv/subdivpatch1base_eval.cpp.o.d"
+  "CMakeFiles/embree_sse42.dir/bvh/bvh_intersector1.cpp.o"
+  "CMakeFiles/embree_sse42.dir/bvh/bvh_intersector1.cpp.o.d"
+  "CMakeFiles/embree_sse42.dir/bvh/bvh_intersector_hybrid.cpp.o"
+  "CMakeFiles/embree_sse42.dir/bvh/bvh_intersector_hybrid.cpp.o.d"
+  "CMakeFiles/embree_sse42.dir/bvh/bvh_intersector_single.cpp.o"
+  "CMakeFiles/embree_sse42.dir/bvh/bvh_intersector_single.cpp.o.d"
+  "CMakeFiles/embree_sse42.dir/bvh/bvh_intersector_stream.cpp.o"
+  "CMakeFiles/embree_sse42.dir/bvh/bvh_intersector_stream.cpp.o.d"
+  "CMakeFiles/embree_sse42.dir/geometry/grid_soa.cpp.o"
+  "CMakeFiles/embree_sse42.dir/geometry/grid_soa.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/embree_sse42.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/benchmark.cpp" "tests/CMakeFiles/benchmark.dir/benchmark.cpp.o" "gcc" "tests/CMakeFiles/benchmark.dir/benchmark.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_avx2/common/sys/CMakeFiles/sys.dir/DependInfo.cmake"
+  "/root/repo/_gate_avx2/kernels/xeon/CMakeFiles/embree.dir/DependInfo.cmake"
+  "/root/repo/_gate_avx2/kernels/xeon/CMakeFiles/embree_sse42.dir/DependInfo.cmake"
+  "/root/repo/_gate_avx2/kernels/xeon/CMakeFiles/embree_avx.dir/DependInfo.cmake"
+  "/root/repo/_gate_avx2/kernels/xeon/CMakeFiles/embree_avx2.dir/DependInfo.cmake"
+  "/root/repo/_gate_avx2/common/simd/CMakeFiles/simd.dir/DependInfo.cmake"
+  "/root/repo/_gate_avx2/common/lexers/CMakeFiles/lexers.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../benchmark"
+  "../benchmark.pdb"
+  "CMakeFiles/benchmark.dir/benchmark.cpp.o"
+  "CMakeFiles/benchmark.dir/benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
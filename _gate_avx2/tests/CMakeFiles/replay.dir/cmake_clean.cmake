@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../replay"
+  "../replay.pdb"
+  "CMakeFiles/replay.dir/replay.cpp.o"
+  "CMakeFiles/replay.dir/replay.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/replay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
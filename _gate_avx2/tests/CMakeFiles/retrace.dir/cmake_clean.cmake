@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../retrace"
+  "../retrace.pdb"
+  "CMakeFiles/retrace.dir/retrace.cpp.o"
+  "CMakeFiles/retrace.dir/retrace.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/retrace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../verify"
+  "../verify.pdb"
+  "CMakeFiles/verify.dir/verify.cpp.o"
+  "CMakeFiles/verify.dir/verify.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/verify.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
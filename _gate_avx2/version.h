@@ -0,0 +1,5 @@
+#define __EMBREE_VERSION_MAJOR__ 2
+#define __EMBREE_VERSION_MINOR__ 9
+#define __EMBREE_VERSION_PATCH__ 0
+#define __EMBREE_VERSION_NUMBER__ 20900
+#define __EMBREE_VERSION__ "2.9.0"
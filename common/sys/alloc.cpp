@@ -16,6 +16,7 @@
 #include "config.h"
 #include "alloc.h"
 #include "intrinsics.h"
+#include "sysinfo.h"
 #if defined(TASKING_TBB)
 #  define TBB_IMPLEMENT_CPP0X 0
 #  define __TBB_NO_IMPLICIT_LINKAGE 1
@@ -43,9 +44,13 @@ namespace embree
     return ptr;
   }
 
-  void* os_reserve(size_t bytes)
+  void* os_reserve(size_t bytes, ssize_t numaNode)
   {
-    char* ptr = (char*) VirtualAlloc(nullptr,bytes,MEM_RESERVE,PAGE_READWRITE);
+    char* ptr = nullptr;
+    if (numaNode >= 0 && getNumberOfNumaNodes() > 1) 
+      ptr = (char*) VirtualAllocExNuma(GetCurrentProcess(),nullptr,bytes,MEM_RESERVE,PAGE_READWRITE,DWORD(numaNode));
+    else
+      ptr = (char*) VirtualAlloc(nullptr,bytes,MEM_RESERVE,PAGE_READWRITE);
     if (ptr == nullptr) throw std::bad_alloc();
     return ptr;
   }
@@ -68,6 +73,22 @@ namespace embree
     if (bytes == 0) return;
     VirtualFree(ptr,0,MEM_RELEASE);
   }
+
+  void* os_map_file(const char* filename, size_t bytes)
+  {
+    HANDLE file = CreateFileA(filename,GENERIC_READ|GENERIC_WRITE,FILE_SHARE_READ|FILE_SHARE_WRITE,nullptr,OPEN_ALWAYS,FILE_ATTRIBUTE_NORMAL,nullptr);
+    if (file == INVALID_HANDLE_VALUE) return nullptr;
+    HANDLE mapping = CreateFileMappingA(file,nullptr,PAGE_READWRITE,DWORD(uint64_t(bytes) >> 32),DWORD(bytes),nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) return nullptr;
+    void* ptr = MapViewOfFile(mapping,FILE_MAP_ALL_ACCESS,0,0,bytes);
+    CloseHandle(mapping);
+    return ptr;
+  }
+
+  void os_unmap_file(void* ptr, size_t bytes) {
+    if (ptr) UnmapViewOfFile(ptr);
+  }
 }
 #endif
 
@@ -78,9 +99,15 @@ namespace embree
 #if defined(__UNIX__)
 
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
+#if defined(__LINUX__)
+#include <sys/syscall.h>
+#endif
 
 #if defined(RTCORE_MEMKIND_ALLOCATOR)
 #include <hbwmalloc.h>
@@ -205,11 +232,25 @@ namespace embree
     return ptr;
   }
 
-  void* os_reserve(size_t bytes) 
+  void* os_reserve(size_t bytes, ssize_t numaNode) 
   {
-
     /* linux always allocates pages on demand, thus just call allocate */
-    return os_malloc(bytes);
+    void* ptr = os_malloc(bytes);
+
+#if defined(__LINUX__) && defined(SYS_mbind) && !defined(RTCORE_MEMKIND_ALLOCATOR)
+    /* prefer pages of the requested node, binding has to happen before the pages get touched */
+    if (numaNode >= 0 && numaNode < 1024 && getNumberOfNumaNodes() > 1)
+    {
+      const int MPOL_PREFERRED_ = 1;
+      const size_t bitsPerWord = 8*sizeof(unsigned long);
+      unsigned long nodeMask[1024/(8*sizeof(unsigned long))] = { 0 };
+      nodeMask[numaNode/bitsPerWord] = 1ul << (numaNode%bitsPerWord);
+      const size_t pageSize = isHugePageCandidate(bytes) ? PAGE_SIZE_2M : PAGE_SIZE_4K;
+      const size_t bytesAligned = (bytes+pageSize-1)&ssize_t(-pageSize);
+      syscall(SYS_mbind,ptr,bytesAligned,MPOL_PREFERRED_,nodeMask,1024,0); // failure only loses locality
+    }
+#endif
+    return ptr;
   }
 
   void os_commit (void* ptr, size_t bytes) {
@@ -255,6 +296,31 @@ namespace embree
     if (munmap(ptr,bytes) == -1)
       throw std::bad_alloc();
   }
+
+  void* os_map_file(const char* filename, size_t bytes)
+  {
+    int fd = open(filename,O_RDWR|O_CREAT,0644);
+    if (fd == -1) return nullptr;
+
+    /* grow file to requested size, never shrink an existing file */
+    struct stat st;
+    if (fstat(fd,&st) == -1 || (size_t(st.st_size) < bytes && ftruncate(fd,bytes) == -1)) {
+      close(fd);
+      return nullptr;
+    }
+
+    void* ptr = mmap(nullptr,bytes,PROT_READ|PROT_WRITE,MAP_SHARED,fd,0);
+    close(fd);
+    if (ptr == MAP_FAILED) return nullptr;
+    return ptr;
+  }
+
+  void os_unmap_file(void* ptr, size_t bytes) 
+  {
+    if (ptr == nullptr) return;
+    if (munmap(ptr,bytes) == -1)
+      throw std::bad_alloc();
+  }
 }
 
 #endif
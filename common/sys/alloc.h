@@ -86,11 +86,15 @@ namespace embree
 
   /*! allocates pages directly from OS */
   void* os_malloc (size_t bytes, const int additional_flags = 0);
-  void* os_reserve(size_t bytes);
+  void* os_reserve(size_t bytes, ssize_t numaNode = -1); //!< numaNode >= 0 prefers physical pages of that NUMA node
   void  os_commit (void* ptr, size_t bytes);
   size_t os_shrink (void* ptr, size_t bytesNew, size_t bytesOld);
   void  os_free   (void* ptr, size_t bytes);
 
+  /*! maps a file of the given size into memory, creating or growing the file as required, returns nullptr on failure */
+  void* os_map_file  (const char* filename, size_t bytes);
+  void  os_unmap_file(void* ptr, size_t bytes);
+
   /*! allocator that performs OS allocations */
   template<typename T>
     struct os_allocator
@@ -348,6 +348,17 @@ namespace embree
     if (hasISA(features,KNC)) v += "KNC ";
     return v;
   }
+
+  size_t getThreadNumaNode()
+  {
+    /* threads rarely migrate between sockets, thus the node is queried only once */
+    static __thread ssize_t threadNumaNode = -1;
+    if (unlikely(threadNumaNode == -1)) {
+      const size_t node = getNumaNode();
+      threadNumaNode = node < getNumberOfNumaNodes() ? node : 0;
+    }
+    return threadNumaNode;
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -395,6 +406,23 @@ namespace embree
     return nThreads;
   }
 
+  size_t getNumberOfNumaNodes()
+  {
+    static int nNodes = -1;
+    if (nNodes != -1) return nNodes;
+    ULONG highestNode = 0;
+    if (!GetNumaHighestNodeNumber(&highestNode)) highestNode = 0;
+    nNodes = highestNode+1;
+    return nNodes;
+  }
+
+  size_t getNumaNode()
+  {
+    UCHAR node = 0;
+    if (!GetNumaProcessorNode((UCHAR)GetCurrentProcessorNumber(),&node) || node == 0xFF) return 0;
+    return node;
+  }
+
   int getTerminalWidth() 
   {
     HANDLE handle = GetStdHandle(STD_OUTPUT_HANDLE);
@@ -421,6 +449,8 @@ namespace embree
 
 #include <stdio.h>
 #include <unistd.h>
+#include <dirent.h>
+#include <sys/syscall.h>
 
 namespace embree
 {
@@ -432,6 +462,34 @@ namespace embree
     if (bytes != -1) buf[bytes] = '\0';
     return std::string(buf);
   }
+
+  size_t getNumberOfNumaNodes()
+  {
+    static int nNodes = -1;
+    if (nNodes != -1) return nNodes;
+
+    /* node IDs may be sparse, thus use the largest node ID found */
+    int maxNode = 0;
+    if (DIR* dir = opendir("/sys/devices/system/node")) 
+    {
+      while (struct dirent* entry = readdir(dir)) {
+        int node = 0;
+        if (sscanf(entry->d_name,"node%d",&node) == 1 && node > maxNode) maxNode = node;
+      }
+      closedir(dir);
+    }
+    nNodes = maxNode+1;
+    return nNodes;
+  }
+
+  size_t getNumaNode()
+  {
+#if defined(SYS_getcpu)
+    unsigned cpu = 0, node = 0;
+    if (syscall(SYS_getcpu,&cpu,&node,nullptr) == 0) return node;
+#endif
+    return 0;
+  }
 }
 
 #endif
@@ -453,6 +511,14 @@ namespace embree
     if (_NSGetExecutablePath(buf, &size) != 0) return std::string();
     return std::string(buf);
   }
+
+  size_t getNumberOfNumaNodes() {
+    return 1;
+  }
+
+  size_t getNumaNode() {
+    return 0;
+  }
 }
 
 #endif
@@ -171,6 +171,15 @@ namespace embree
 
   /*! return the number of logical threads of the system */
   size_t getNumberOfLogicalThreads();
+
+  /*! return the number of NUMA nodes of the system */
+  size_t getNumberOfNumaNodes();
+
+  /*! returns the NUMA node of the processor the calling thread currently runs on */
+  size_t getNumaNode();
+
+  /*! returns the NUMA node of the calling thread, the node is determined once per thread */
+  size_t getThreadNumaNode();
   
   /*! returns the size of the terminal window in characters */
   int getTerminalWidth();
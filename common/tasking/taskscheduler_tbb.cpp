@@ -340,6 +340,15 @@ namespace embree
     return thread->scheduler->cancellingException == nullptr;
   }
 
+  __dllexport std::exception_ptr TaskSchedulerTBB::take_cancelling_exception() 
+  {
+    Thread* thread = TaskSchedulerTBB::thread();
+    if (thread == nullptr) return nullptr;
+    std::exception_ptr except = thread->scheduler->cancellingException;
+    thread->scheduler->cancellingException = nullptr;
+    return except;
+  }
+
   std::exception_ptr TaskSchedulerTBB::thread_loop(size_t threadIndex)
   {
     /* allocate thread structure */
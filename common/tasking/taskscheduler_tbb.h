@@ -367,6 +367,9 @@ namespace embree
     /* work on spawned subtasks and wait until all have finished */
     __dllexport static bool wait();
 
+    /* returns and clears the exception that cancelled the tasks of the current scheduler */
+    __dllexport static std::exception_ptr take_cancelling_exception();
+
     /* returns the index of the current thread */
     __dllexport static size_t threadIndex();
 
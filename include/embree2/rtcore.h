@@ -156,6 +156,11 @@ enum RTCParameter {
   RTC_CONFIG_VERSION_MINOR = 14,           //!< returns Embree minor version (read only)
   RTC_CONFIG_VERSION_PATCH = 15,           //!< returns Embree patch version (read only)
   RTC_CONFIG_VERSION = 16,                 //!< returns Embree version as integer (e.g. Embree v2.8.2 -> 20802) (read only)
+
+  RTC_STATISTICS = 17,                     //!< enables (1) or disables (0) gathering of runtime statistics (read and write)
+
+  RTC_MEMORY_BUDGET = 18,                  //!< maximal number of bytes the device may allocate, 0 for unlimited (read and write)
+  RTC_MEMORY_USED = 19,                    //!< number of bytes currently allocated by the device (read only)
 };
 
 /*! \brief Configures some parameters. 
@@ -174,6 +179,29 @@ RTCORE_API void rtcDeviceSetParameter1i(RTCDevice device, const RTCParameter par
 /*! \brief Reads some device parameter. */
 RTCORE_API ssize_t rtcDeviceGetParameter1i(RTCDevice device, const RTCParameter parm);
 
+/*! \brief Runtime statistics gathered when RTC_STATISTICS is enabled. */
+struct RTCStatistics
+{
+  size_t nodes;                    //!< number of inner nodes visited by all rays
+  size_t leaves;                   //!< number of leaves visited by all rays
+  size_t primitives;               //!< number of primitive blocks tested by all rays
+  size_t leafHits;                 //!< number of leaf visits that found a closer hit (or any hit for occlusion rays)
+  size_t filterCalls;              //!< number of invoked intersection and occlusion filter functions
+  size_t tessellationCacheHits;    //!< number of tessellation cache lookups that found a valid entry
+  size_t tessellationCacheMisses;  //!< number of tessellation cache lookups that required tessellation
+};
+
+/*! \brief Returns the runtime statistics.
+
+  Counters are kept per thread and are summed up by this function. As
+  the counters are process wide, the statistics include all rays
+  traced while any device has RTC_STATISTICS enabled. The result is
+  only exact if no rays are traced concurrently. */
+RTCORE_API void rtcDeviceGetStatistics(RTCDevice device, RTCStatistics* stats);
+
+/*! \brief Resets all runtime statistics counters to zero. */
+RTCORE_API void rtcDeviceClearStatistics(RTCDevice device);
+
 /*! \brief Error codes returned by the rtcGetError function. */
 enum RTCError {
   RTC_NO_ERROR = 0,          //!< No error has been recorded.
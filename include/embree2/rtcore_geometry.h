@@ -23,6 +23,12 @@
 /*! invalid geometry ID */
 #define RTC_INVALID_GEOMETRY_ID ((unsigned)-1)
 
+/*! maximal number of time steps of motion blurred triangle and quad meshes */
+#define RTC_MAX_TIME_STEPS 16
+
+/*! maximal nesting depth of natively traversed instances */
+#define RTC_MAX_INSTANCE_DEPTH 8
+
 /*! \brief Specifies the type of buffers when mapping buffers */
 enum RTCBufferType {
   RTC_INDEX_BUFFER         = 0x01000000,
@@ -45,6 +51,8 @@ enum RTCBufferType {
   RTC_VERTEX_CREASE_WEIGHT_BUFFER = 0x08000000,
 
   RTC_HOLE_BUFFER          = 0x09000001,
+
+  RTC_OPACITY_BUFFER       = 0x0A000000,
 };
 
 /*! \brief Supported types of matrix layout for functions involving matrices */
@@ -70,6 +78,32 @@ enum RTCBoundaryMode
   RTC_BOUNDARY_EDGE_AND_CORNER = 2     //!< boundary corner vertices are sharp vertices
 };
 
+/*! \brief Basis of the control points of hair curves */
+enum RTCCurveBasis
+{
+  RTC_BASIS_BEZIER = 0,                //!< cubic bezier curve (default)
+  RTC_BASIS_BSPLINE = 1,               //!< uniform cubic B-spline segment
+  RTC_BASIS_CATMULL_ROM = 2            //!< uniform Catmull-Rom spline segment
+};
+
+/*! \brief Opacity states of the micro triangles of an opacity micro map */
+enum RTCOpacityState
+{
+  RTC_OPACITY_TRANSPARENT = 0,         //!< hits are rejected without invoking the filter functions
+  RTC_OPACITY_OPAQUE = 1,              //!< hits are accepted without invoking the filter functions
+  RTC_OPACITY_UNKNOWN = 2              //!< hits are passed to the filter functions (also used for state 3)
+};
+
+/*! \brief Flags for SIMD displacement functions */
+enum RTCDisplacementFlags
+{
+  RTC_DISPLACEMENT_DEFAULT = 0,        //!< passes positions, normals, and u/v coordinates
+  RTC_DISPLACEMENT_DERIVATIVES = 1     //!< additionally passes the partial derivatives dPdu and dPdv
+};
+
+/*! \brief Handle of a subdivision mesh topology shared by multiple subdivision meshes */
+typedef struct __RTCSubdivTopology {}* RTCSubdivTopology;
+
 /*! Intersection filter function for single rays. */
 typedef void (*RTCFilterFunc)(void* ptr,           /*!< pointer to user data */
                               RTCRay& ray          /*!< intersection to filter */);
@@ -103,6 +137,41 @@ typedef void (*RTCDisplacementFunc)(void* ptr,           /*!< pointer to user da
                                     float* pz,           /*!< z coordinates of points to displace (source and target) */
                                     size_t N             /*!< number of points to displace */ );
 
+/*! \brief Grid of points passed to a SIMD displacement function. All
+ *  arrays are 64 bytes aligned and padded to a multiple of simdWidth
+ *  elements, the padding repeats the last point of the grid. */
+struct RTCDisplacementArguments
+{
+  void* ptr;            //!< pointer to user data of geometry
+  unsigned geomID;      //!< ID of geometry to displace
+  unsigned primID;      //!< ID of the patch to displace
+  size_t N;             //!< number of points of the grid
+  size_t simdWidth;     //!< native SIMD width of the calling kernel
+
+  const float* u;       //!< u coordinates of the patch (source)
+  const float* v;       //!< v coordinates of the patch (source)
+  const float* nx;      //!< x coordinates of normalized normal (source)
+  const float* ny;      //!< y coordinates of normalized normal (source)
+  const float* nz;      //!< z coordinates of normalized normal (source)
+  const float* dPdu_x;  //!< x coordinates of dPdu, NULL without RTC_DISPLACEMENT_DERIVATIVES (source)
+  const float* dPdu_y;  //!< y coordinates of dPdu, NULL without RTC_DISPLACEMENT_DERIVATIVES (source)
+  const float* dPdu_z;  //!< z coordinates of dPdu, NULL without RTC_DISPLACEMENT_DERIVATIVES (source)
+  const float* dPdv_x;  //!< x coordinates of dPdv, NULL without RTC_DISPLACEMENT_DERIVATIVES (source)
+  const float* dPdv_y;  //!< y coordinates of dPdv, NULL without RTC_DISPLACEMENT_DERIVATIVES (source)
+  const float* dPdv_z;  //!< z coordinates of dPdv, NULL without RTC_DISPLACEMENT_DERIVATIVES (source)
+  float* px;            //!< x coordinates of points to displace (source and target)
+  float* py;            //!< y coordinates of points to displace (source and target)
+  float* pz;            //!< z coordinates of points to displace (source and target)
+
+  float lower[3];       //!< optional lower bounds of the displaced grid (target), initialized to +inf
+  float upper[3];       //!< optional upper bounds of the displaced grid (target), initialized to -inf
+};
+
+/*! SIMD displacement mapping function. Gets invoked once per grid
+ *  and has to be thread safe, as multiple grids get displaced
+ *  concurrently. */
+typedef void (*RTCDisplacementFuncN)(RTCDisplacementArguments* args /*!< grid to displace */);
+
 /*! \brief Creates a new scene instance. 
 
   A scene instance contains a reference to a scene to instantiate and
@@ -110,7 +179,14 @@ typedef void (*RTCDisplacementFunc)(void* ptr,           /*!< pointer to user da
   will typically transform the ray with the inverse of the provided
   transformation and continue traversing the ray through the provided
   scene. If any geometry is hit, the instance ID (instID) member of
-  the ray will get set to the geometry ID of the instance. */
+  the ray will get set to the geometry ID of the instance.
+
+  Instances of static scenes created with the RTC_SCENE_INSTANCED flag
+  that only contain triangle meshes without motion blur and further
+  such instances are traversed natively by the instancing scene. This
+  avoids a callback per instance and supports nesting up to
+  RTC_MAX_INSTANCE_DEPTH instance levels. For nested instances the
+  instance ID member of the ray reports the innermost instance. */
 RTCORE_API unsigned rtcNewInstance (RTCScene target,                  //!< the scene the instance belongs to
                                     RTCScene source                   //!< the scene to instantiate
   );
@@ -129,6 +205,29 @@ RTCORE_API unsigned rtcNewInstance2 (RTCScene target,                  //!< the
                                      RTCScene source,                  //!< the scene to instantiate
                                      size_t numTimeSteps = 1);         //!< number of timesteps, one matrix per timestep
 
+/*! \brief Type of callback function that creates the geometry of a lazily instanced scene. */
+typedef void (*RTCLazyCreateFunc)(void* ptr, RTCScene scene);
+
+/*! \brief Creates a new lazy scene instance. 
+
+  A lazy instance behaves like a scene instance, but the instanced
+  scene must not get committed by the application. The instancing
+  scene is build using the specified object space bounds of the
+  instanced scene, and the first ray that reaches the instance commits
+  the instanced scene. If a create function is specified, this ray
+  first invokes it to create the geometry of the instanced scene. Rays
+  that reach the instance meanwhile wait for the create function and
+  join the build of the instanced scene. The geometry of the instanced
+  scene has to stay inside the specified bounds. All lazy instances of
+  a scene have to use the same create function and user pointer, and
+  the scene must not get instanced by non lazy instances. Lazy
+  instances are never traversed natively by the instancing scene. */
+RTCORE_API unsigned rtcNewLazyInstance (RTCScene target,                  //!< the scene the instance belongs to
+                                        RTCScene source,                  //!< the scene to instantiate lazily
+                                        const RTCBounds& bounds,          //!< object space bounds of the instanced scene
+                                        RTCLazyCreateFunc func = NULL,    //!< function creating the geometry of the instanced scene, or NULL
+                                        void* ptr = NULL);                //!< user pointer passed to the create function
+
 /*! \brief Sets transformation of the instance */
 RTCORE_API void rtcSetTransform (RTCScene scene,                          //!< scene handle
                                  unsigned geomID,                         //!< ID of geometry
@@ -147,14 +246,20 @@ RTCORE_API void rtcSetTransform2 (RTCScene scene,                         //!< s
 
 /*! \brief Creates a new triangle mesh. The number of triangles
   (numTriangles), number of vertices (numVertices), and number of time
-  steps (1 for normal meshes, and 2 for linear motion blur), have to
-  get specified. The triangle indices can be set be mapping and
-  writing to the index buffer (RTC_INDEX_BUFFER) and the triangle
-  vertices can be set by mapping and writing into the vertex buffer
-  (RTC_VERTEX_BUFFER). In case of linear motion blur, two vertex
-  buffers have to get filled (RTC_VERTEX_BUFFER0, RTC_VERTEX_BUFFER1),
-  one for each time step. The index buffer has the default layout of
-  three 32 bit integer indices for each triangle. An index points to
+  steps (1 for normal meshes, and 2 up to RTC_MAX_TIME_STEPS for
+  motion blur), have to get specified. The triangle indices can be set
+  be mapping and writing to the index buffer (RTC_INDEX_BUFFER) and
+  the triangle vertices can be set by mapping and writing into the
+  vertex buffer (RTC_VERTEX_BUFFER). In case of motion blur, one
+  vertex buffer has to get filled for each time step
+  (RTC_VERTEX_BUFFER0+i for time step i). The time steps are
+  distributed uniformly over the time range [0,1] and the motion
+  between two time steps is linear. If the motion blurred triangle
+  meshes of a scene use different numbers of time steps, a mesh whose
+  number of time segments does not evenly divide the largest number of
+  time segments is rendered slower, as its vertices get read from the
+  vertex buffers at intersection time. The index buffer has the default
+  layout of three 32 bit integer indices for each triangle. An index points to
   the ith vertex. The vertex buffer stores single precision x,y,z
   floating point coordinates aligned to 16 bytes. The value of the 4th
   float used for alignment can be arbitrary. */
@@ -168,13 +273,15 @@ RTCORE_API unsigned rtcNewTriangleMesh (RTCScene scene,                    //!<
 
 /*! \brief Creates a new quad mesh. The number of quads
   (numQuads), number of vertices (numVertices), and number of time
-  steps (1 for normal meshes, and 2 for linear motion blur), have to
-  get specified. The quad indices can be set be mapping and
-  writing to the index buffer (RTC_INDEX_BUFFER) and the quad
-  vertices can be set by mapping and writing into the vertex buffer
-  (RTC_VERTEX_BUFFER). In case of linear motion blur, two vertex
-  buffers have to get filled (RTC_VERTEX_BUFFER0, RTC_VERTEX_BUFFER1),
-  one for each time step. The index buffer has the default layout of
+  steps (1 for normal meshes, and 2 up to RTC_MAX_TIME_STEPS for
+  motion blur), have to get specified. The quad indices can be set be
+  mapping and writing to the index buffer (RTC_INDEX_BUFFER) and the
+  quad vertices can be set by mapping and writing into the vertex
+  buffer (RTC_VERTEX_BUFFER). In case of motion blur, one vertex
+  buffer has to get filled for each time step (RTC_VERTEX_BUFFER0+i
+  for time step i). The time steps are distributed uniformly over the
+  time range [0,1] and the motion between two time steps is
+  linear. The index buffer has the default layout of
   three 32 bit integer indices for each quad. An index points to
   the ith vertex. The vertex buffer stores single precision x,y,z
   floating point coordinates aligned to 16 bytes. The value of the 4th
@@ -251,6 +358,53 @@ RTCORE_API unsigned rtcNewSubdivisionMesh (RTCScene scene,                //!< t
                                            size_t numTimeSteps = 1        //!< number of motion blur time steps
   );
 
+/*! \brief Creates a new subdivision mesh topology. A topology
+  contains the face buffer (RTC_FACE_BUFFER), index buffer
+  (RTC_INDEX_BUFFER), hole buffer (RTC_HOLE_BUFFER), crease buffers,
+  and boundary mode of a subdivision mesh, and can get referenced by
+  many subdivision meshes of the same device that only differ in their
+  vertices and edge levels. The buffers have to get set using
+  rtcSetSubdivTopologyBuffer and are only accessed until
+  rtcCommitSubdivTopology returns, which calculates the half edge
+  structure of the topology once for all meshes that use it. */
+RTCORE_API RTCSubdivTopology rtcDeviceNewSubdivTopology (RTCDevice device,              //!< the device the topology belongs to
+                                                         size_t numFaces,               //!< number of faces
+                                                         size_t numEdges,               //!< number of edges
+                                                         size_t numVertices,            //!< number of vertices
+                                                         size_t numEdgeCreases,         //!< number of edge creases
+                                                         size_t numVertexCreases,       //!< number of vertex creases
+                                                         size_t numHoles                //!< number of holes
+  );
+
+/*! \brief Sets a buffer of a subdivision mesh topology. The layout
+ *  of the buffers is the same as for subdivision meshes. */
+RTCORE_API void rtcSetSubdivTopologyBuffer (RTCSubdivTopology topology, RTCBufferType type, 
+                                            const void* ptr, size_t byteOffset, size_t byteStride);
+
+/*! \brief Sets the boundary interpolation mode of a subdivision mesh topology. */
+RTCORE_API void rtcSetSubdivTopologyBoundaryMode (RTCSubdivTopology topology, RTCBoundaryMode mode);
+
+/*! \brief Calculates the half edge structure of a subdivision mesh
+ *  topology. A committed topology cannot get modified anymore. */
+RTCORE_API void rtcCommitSubdivTopology (RTCSubdivTopology topology);
+
+/*! \brief Releases the handle of a subdivision mesh topology. The
+ *  topology stays alive as long as some subdivision mesh references it. */
+RTCORE_API void rtcDeleteSubdivTopology (RTCSubdivTopology topology);
+
+/*! \brief Creates a new subdivision mesh that references a committed
+  topology. The number of faces, edges, and vertices are taken from the
+  topology, only the vertex buffers, user vertex buffers, and the level
+  buffer can get set for the mesh. All meshes that use the same
+  uniform tessellation rate share the half edges of the topology,
+  meshes with a level buffer or camera driven edge levels keep a copy
+  of the half edges to store their edge levels. */
+RTCORE_API unsigned rtcNewSubdivisionMeshWithTopology (RTCScene scene,                //!< the scene the mesh belongs to
+                                                       RTCGeometryFlags flags,        //!< geometry flags
+                                                       RTCSubdivTopology topology,    //!< the topology of the mesh
+                                                       size_t numTimeSteps = 1        //!< number of motion blur time steps
+  );
+
 /*! \brief Creates a new hair geometry, consisting of multiple hairs
   represented as cubic bezier curves with varying radii. The number of
   curves (numCurves), number of vertices (numVertices), and number of
@@ -281,6 +435,33 @@ RTCORE_API unsigned rtcNewHairGeometry (RTCScene scene,                    //!<
  *  optionally to set a different tessellation rate per edge.*/
 RTCORE_API void rtcSetTessellationRate (RTCScene scene, unsigned geomID, float tessellationRate);
 
+/*! Lets the edge levels of a subdivision mesh get calculated from a
+ *  camera during the build. Each edge is tessellated such that its
+ *  segments cover about pixelsPerEdge pixels of the image plane
+ *  spanned by the vx and vy pixel steps of the camera, estimated from
+ *  the length of the edge and the distance of its midpoint to the
+ *  camera position. The levels get recalculated at each commit that
+ *  modifies the vertices and take preference over the RTC_LEVEL_BUFFER
+ *  and the uniform tessellation rate. Passing NULL as camera disables
+ *  the camera driven edge levels again. */
+RTCORE_API void rtcSetTessellationCamera (RTCScene scene, unsigned geomID, const RTCCamera* camera, float pixelsPerEdge);
+
+/*! Sets the basis the control points of a hair geometry are specified
+ *  in. For B-spline and Catmull-Rom curves the index buffer references
+ *  the first of four consecutive control points of a segment like for
+ *  bezier curves, but adjacent segments of a strand share three of
+ *  their control points. */
+RTCORE_API void rtcSetCurveBasis (RTCScene scene, unsigned geomID, RTCCurveBasis basis);
+
+/*! Sets the subdivision level of the opacity micro map of a triangle
+ *  mesh. Each triangle is split into 4^level micro triangles on a
+ *  uniform barycentric grid, whose 2 bit RTCOpacityState values are
+ *  stored in the RTC_OPACITY_BUFFER. Hits on transparent or opaque
+ *  micro triangles are resolved without invoking the intersection and
+ *  occlusion filter functions. The level has to get set before the
+ *  opacity buffer is mapped or shared. */
+RTCORE_API void rtcSetOpacityMicroMapLevel (RTCScene scene, unsigned geomID, unsigned level);
+
 /*! \brief Creates a new line segment geometry, consisting of multiple
   segments with varying radii. The number of line segments (numSegments),
   number of vertices (numVertices), and number of time steps (1 for
@@ -355,6 +536,17 @@ RTCORE_API void rtcUpdate (RTCScene scene, unsigned geomID);
   some geometry as modified. */
 RTCORE_API void rtcUpdateBuffer (RTCScene scene, unsigned geomID, RTCBufferType type);
 
+/*! \brief Update range of specific geometry buffer. 
+
+  The rtcUpdateBufferRange function taggs only the num elements
+  starting at element offset of some geometry buffer as modified,
+  e.g. a range of vertices of a vertex buffer or a range of triangles
+  of an index buffer. Deformable triangle meshes then refit only those
+  parts of their hierarchy that contain triangles referencing modified
+  elements. For all other geometries the call behaves like
+  rtcUpdateBuffer. */
+RTCORE_API void rtcUpdateBufferRange (RTCScene scene, unsigned geomID, RTCBufferType type, size_t offset, size_t num);
+
 /*! \brief Disable geometry. 
 
   Disabled geometry is not hit by any ray. Disabling and enabling
@@ -365,6 +557,17 @@ RTCORE_API void rtcDisable (RTCScene scene, unsigned geomID);
 /*! \brief Sets the displacement function. */
 RTCORE_API void rtcSetDisplacementFunction (RTCScene scene, unsigned geomID, RTCDisplacementFunc func, RTCBounds* bounds);
 
+/*! \brief Sets the SIMD displacement function. 
+
+  The function gets called once for each grid of a subdivision patch
+  and replaces a displacement function set with
+  rtcSetDisplacementFunction. If the function writes tight bounds of
+  the displaced points into the lower and upper members of the
+  arguments, the implementation can use these bounds for the grid
+  instead of bounding the displaced points itself. Conservative
+  displacement bounds do not have to get specified. */
+RTCORE_API void rtcSetDisplacementFunctionN (RTCScene scene, unsigned geomID, RTCDisplacementFuncN func, RTCDisplacementFlags flags);
+
 /*! \brief Sets the intersection filter function for single rays. */
 RTCORE_API void rtcSetIntersectionFilterFunction (RTCScene scene, unsigned geomID, RTCFilterFunc func);
 
@@ -389,6 +592,17 @@ RTCORE_API void rtcSetOcclusionFilterFunction8 (RTCScene scene, unsigned geomID,
 /*! \brief Sets the occlusion filter function for ray packets of size 16. */
 RTCORE_API void rtcSetOcclusionFilterFunction16 (RTCScene scene, unsigned geomID, RTCFilterFunc16 func);
 
+/*! \brief Enables or disables batched filter invocation for single
+ *  rays. When enabled, single ray queries call the packet filter
+ *  function whose width matches the SIMD width of the primitive leaf
+ *  (4, 8, or 16) once per leaf, passing one candidate hit per packet
+ *  lane. The filter rejects a candidate by setting its geomID to
+ *  RTC_INVALID_GEOMETRY_ID, the closest accepted hit is then chosen
+ *  by Embree. Ray extensions stored behind the ray are not available
+ *  inside a batched filter call. If no packet filter of matching
+ *  width is set, the single ray filter is used as before. */
+RTCORE_API void rtcSetFilterBatching (RTCScene scene, unsigned geomID, bool enable);
+
 /*! Set pointer for user defined data per geometry. Invokations
  *  of the various user intersect and occluded functions get passed
  *  this data pointer when called. */
@@ -190,6 +190,48 @@ public:
   unsigned* instID;  //!< instance ID (optional)
 };
 
+/*! \brief Pinhole or thin lens camera for rtcIntersectCamera. The
+ *  unnormalized direction through the pixel (x,y) is
+ *  (x+pixelSample[0])*vx + (y+pixelSample[1])*vy + vz. */
+struct RTCCamera
+{
+  float org[3];         //!< position of the camera
+  float vx[3];          //!< step from one pixel to the next in x direction
+  float vy[3];          //!< step from one pixel to the next in y direction
+  float vz[3];          //!< vector from the camera position to the upper left corner of the image
+
+  float lensRadius;     //!< radius of the lens, 0 for a pinhole camera
+  float focalDistance;  //!< points at org+focalDistance*dir with unnormalized pixel direction dir are in focus
+  float lensSample[2];  //!< position on the unit square that gets mapped to the lens, used for all pixels of a call
+  float pixelSample[2]; //!< position inside the pixel, (0.5,0.5) for the pixel center
+
+  float tnear;          //!< Start of all ray segments
+  float tfar;           //!< End of all ray segments
+  float time;           //!< Time of all rays for motion blur
+  unsigned mask;        //!< Used to mask out objects during traversal
+};
+
+/*! \brief Framebuffer shaped output of rtcIntersectCamera. The hit
+ *  data of pixel (x,y) is stored at byte offset y*stride+4*x of
+ *  each buffer. */
+struct RTCCameraHits
+{
+  float* tfar;       //!< hit distance, tfar of the camera for missed pixels (optional)
+
+  float* Ngx;        //!< x coordinate of geometry normal (optional)
+  float* Ngy;        //!< y coordinate of geometry normal (optional)
+  float* Ngz;        //!< z coordinate of geometry normal (optional)
+
+  float* u;          //!< Barycentric u coordinate of hit (optional)
+  float* v;          //!< Barycentric v coordinate of hit (optional)
+
+  unsigned* geomID;  //!< geometry ID, RTC_INVALID_GEOMETRY_ID for missed pixels
+  unsigned* primID;  //!< primitive ID (optional)
+  unsigned* instID;  //!< instance ID (optional)
+
+  size_t stride;     //!< offset in bytes between two rows of pixels
+};
+
 /*! @} */
 
 #endif
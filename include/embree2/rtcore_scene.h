@@ -26,6 +26,8 @@ struct RTCRay4;
 struct RTCRay8;
 struct RTCRay16;
 struct RTCRaySOA;
+struct RTCCamera;
+struct RTCCameraHits;
 
 /*! scene flags */
 enum RTCSceneFlags 
@@ -39,6 +41,7 @@ enum RTCSceneFlags
   RTC_SCENE_COHERENT   = (1 << 9),    //!< optimize data structures for coherent rays
   RTC_SCENE_INCOHERENT = (1 << 10),    //!< optimize data structures for in-coherent rays (enabled by default)
   RTC_SCENE_HIGH_QUALITY = (1 << 11),  //!< create higher quality data structures
+  RTC_SCENE_INSTANCED  = (1 << 12),    //!< scene gets instanced, enables native traversal of its instances
 
   /* traversal algorithm flags */
   RTC_SCENE_ROBUST     = (1 << 16)     //!< use more robust traversal algorithms
@@ -59,7 +62,8 @@ enum RTCAlgorithmFlags
 /*! layout flags for ray streams */
 enum RTCRayNFlags
 {
-  RTC_RAYN_DEFAULT = (1 << 0)
+  RTC_RAYN_DEFAULT = (1 << 0),
+  RTC_RAYN_REORDER = (1 << 1)   //!< sorts the rays of the stream by direction and origin before tracing
 };
 
 
@@ -98,6 +102,52 @@ RTCORE_API void rtcCommit (RTCScene scene);
  *  coprocessor. */
 RTCORE_API void rtcCommitThread(RTCScene scene, unsigned int threadID, unsigned int numThreads);
 
+/*! \brief Type of callback function invoked when an asynchronous commit finished. */
+typedef void (*RTCCommitCompleteFunc)(void* ptr, RTCScene scene, RTCError error);
+
+/*! Commits the geometry of the scene without blocking the calling
+ *  thread. The build runs on the tasking system and the callback
+ *  function is invoked from a build thread when the commit
+ *  finished. For dynamic scenes that got committed before, the
+ *  previously committed acceleration structures stay traceable
+ *  during the build and are replaced right before the callback gets
+ *  invoked. The scene and its geometries must not get modified until
+ *  the callback got invoked, and the callback must not commit the
+ *  scene again. Any later commit or deletion of the scene waits for a
+ *  pending asynchronous commit to finish. Geometries deleted before
+ *  the commit get released once the commit finished. Acceleration
+ *  structures that reference the geometry buffers (e.g. index based
+ *  triangles, quads, and user geometries) always read the current
+ *  buffers of the geometry, thus rays traced during the build may
+ *  see the modified buffer content for such geometries. Applications
+ *  that require the exact previous state during the build have to
+ *  select acceleration structures that copy the geometry data, such
+ *  as the default triangle acceleration structures. */
+RTCORE_API void rtcCommitAsync (RTCScene scene, RTCCommitCompleteFunc func, void* ptr);
+
+/*! Evicts scenes lazily instanced by the scene that were not
+ *  reached by any ray since the previous call, least recently reached
+ *  scenes first, until the device uses at most maxBytes of memory
+ *  (see RTC_MEMORY_USED). Evicting a scene releases its geometry and
+ *  acceleration structures, the next ray reaching one of its lazy
+ *  instances creates and builds it again. Only scenes with a create
+ *  function get evicted. No rays must get traced through the scene
+ *  during this call. */
+RTCORE_API void rtcEvictLazyInstances (RTCScene scene, size_t maxBytes);
+
+/*! Stores the acceleration structures of a committed static scene
+ *  into a binary file. Scenes containing subdivision geometry, or
+ *  built using the bvh4.triangle4i acceleration structure cannot get
+ *  stored. */
+RTCORE_API void rtcSaveScene (RTCScene scene, const char* filename);
+
+/*! Commits a static scene by loading acceleration structures
+ *  previously stored using rtcSaveScene instead of building them. The
+ *  scene has to contain the same geometries as the stored scene and
+ *  has to get created with the same flags and Embree
+ *  configuration. This function can get used instead of rtcCommit. */
+RTCORE_API void rtcLoadScene (RTCScene scene, const char* filename);
+
 /*! Returns to AABB of the scene. rtcCommit has to get called
  *  previously to this function. */
 RTCORE_API void rtcGetBounds(RTCScene scene, RTCBounds& bounds_o);
@@ -129,7 +179,11 @@ RTCORE_API void rtcIntersect16 (const void* valid, RTCScene scene, RTCRay16& ray
 /*! Intersects a stream of N rays in AOS layout with the scene. This
  *  function can only be called for scenes with the RTC_INTERSECTN
  *  flag set. The stride specifies the offset between rays in
- *  bytes. */
+ *  bytes. If the RTC_RAYN_REORDER flag is set, the rays get sorted by
+ *  direction octant and a Morton code over their origin and
+ *  direction before traversal, which improves the performance for
+ *  incoherent streams. Results are always written back to the
+ *  original ray locations. */
 RTCORE_API void rtcIntersectN (RTCScene scene, RTCRay* rayN, const size_t N, const size_t stride, const size_t flags = RTC_RAYN_DEFAULT);
 
 /*! Intersects one or multiple streams of N rays in compact SOA layout
@@ -139,6 +193,15 @@ RTCORE_API void rtcIntersectN (RTCScene scene, RTCRay* rayN, const size_t N, con
  *  those. */
 RTCORE_API void rtcIntersectN_SOA (RTCScene scene, RTCRaySOA& rayN, const size_t N, const size_t streams, const size_t stride, const size_t flags = RTC_RAYN_DEFAULT);
 
+/*! Generates the primary rays of the pixels [x0,x0+width) x
+ *  [y0,y0+height) of the specified camera and intersects them with
+ *  the scene. The rays are generated internally in tiles of the
+ *  widest packet size supported by the CPU and enabled for the scene
+ *  (RTC_INTERSECT16, RTC_INTERSECT8, or RTC_INTERSECT4). Single rays
+ *  are used if only the RTC_INTERSECT1 flag is set. The hit data is
+ *  written to the framebuffer shaped output. */
+RTCORE_API void rtcIntersectCamera (RTCScene scene, const RTCCamera& camera, const unsigned x0, const unsigned y0, const unsigned width, const unsigned height, RTCCameraHits& hits);
+
 
 /*! Tests if a single ray is occluded by the scene. The ray has to be
  *  aligned to 16 bytes. This function can only be called for scenes
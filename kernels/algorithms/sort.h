@@ -368,7 +368,7 @@ namespace embree
     static const size_t MAX_TASKS = MAX_THREADS;
     static const size_t BITS = 8;
     static const size_t BUCKETS = (1 << BITS);
-    typedef unsigned int TyRadixCount[BUCKETS];
+    typedef size_t TyRadixCount[BUCKETS];
     
     ParallelRadixSort() 
       : radixCount(nullptr) {}
@@ -437,7 +437,7 @@ namespace embree
         const Key mask = BUCKETS-1;
         
         /* calculate total number of items for each bucket */
-        __aligned(64) unsigned int total[BUCKETS];
+        __aligned(64) size_t total[BUCKETS];
         for (size_t i=0; i<BUCKETS; i++)
           total[i] = 0;
         
@@ -446,7 +446,7 @@ namespace embree
             total[j] += parent->radixCount[i][j];
         
         /* calculate start offset of each bucket */
-        __aligned(64) unsigned int offset[BUCKETS];
+        __aligned(64) size_t offset[BUCKETS];
         offset[0] = 0;
         for (size_t i=1; i<BUCKETS; i++)    
           offset[i] = offset[i-1] + total[i-1];
@@ -36,6 +36,21 @@ namespace embree
     /*! clears the acceleration structure data */
     virtual void clear() = 0;
 
+    /*! stores the acceleration structure data into a binary stream */
+    virtual void save(std::ostream& file) {
+      throw_RTCError(RTC_INVALID_OPERATION,"acceleration structure cannot get stored");
+    }
+
+    /*! loads acceleration structure data previously stored with save */
+    virtual void load(std::istream& file) {
+      throw_RTCError(RTC_INVALID_OPERATION,"acceleration structure cannot get loaded");
+    }
+
+    /*! creates a copy of the acceleration structure data in memory of the specified NUMA node, returns nullptr if not supported */
+    virtual AccelData* replicate(size_t numaNode) {
+      return nullptr;
+    }
+
   public:
     BBox3fa bounds;
     Type type;
@@ -187,10 +202,10 @@ namespace embree
     struct Intersectors 
     {
       Intersectors() 
-        : ptr(nullptr) {}
+        : ptr(nullptr), replicas(nullptr) {}
 
       Intersectors (ErrorFunc error) 
-      : ptr(nullptr), intersector1(error), intersector4(error), intersector8(error), intersector16(error),intersectorN(error) {}
+      : ptr(nullptr), replicas(nullptr), intersector1(error), intersector4(error), intersector8(error), intersector16(error),intersectorN(error) {}
 
       void print(size_t ident) 
       {
@@ -237,8 +252,16 @@ namespace embree
         
       }
 
+      /*! returns the data to operate on, which is the replica local to the NUMA node of the calling thread if present */
+      __forceinline AccelData* local() const 
+      {
+        if (likely(replicas == nullptr)) return ptr;
+        return replicas[getThreadNumaNode()];
+      }
+
     public:
       AccelData* ptr;
+      AccelData** replicas; //!< optional per NUMA node replicas of ptr
       Intersector1 intersector1;
       Intersector4 intersector4;
       Intersector4 intersector4_filter;
@@ -269,6 +292,9 @@ namespace embree
 
     /*! makes the acceleration structure immutable */
     virtual void immutable () {}
+
+    /*! creates numReplicas copies of the acceleration structure, traversal uses the copy of the NUMA node it runs on */
+    virtual void createReplicas (size_t numReplicas) {}
     
     /*! build acceleration structure */
     virtual void build (size_t threadIndex, size_t threadCount) = 0;
@@ -276,32 +302,32 @@ namespace embree
     /*! Intersects a single ray with the scene. */
     __forceinline void intersect (RTCRay& ray) {
       assert(intersectors.intersector1.intersect);
-      intersectors.intersector1.intersect(intersectors.ptr,ray);
+      intersectors.intersector1.intersect(intersectors.local(),ray);
     }
 
     /*! Intersects a packet of 4 rays with the scene. */
     __forceinline void intersect4 (const void* valid, RTCRay4& ray) {
       assert(intersectors.intersector4.intersect);
-      intersectors.intersector4.intersect(valid,intersectors.ptr,ray);
+      intersectors.intersector4.intersect(valid,intersectors.local(),ray);
     }
 
     /*! Intersects a packet of 8 rays with the scene. */
     __forceinline void intersect8 (const void* valid, RTCRay8& ray) {
       assert(intersectors.intersector8.intersect);
-      intersectors.intersector8.intersect(valid,intersectors.ptr,ray);
+      intersectors.intersector8.intersect(valid,intersectors.local(),ray);
     }
 
     /*! Intersects a packet of 16 rays with the scene. */
     __forceinline void intersect16 (const void* valid, RTCRay16& ray) {
       assert(intersectors.intersector16.intersect);
-      intersectors.intersector16.intersect(valid,intersectors.ptr,ray);
+      intersectors.intersector16.intersect(valid,intersectors.local(),ray);
     }
 
     /*! Intersects a packet of N rays in SOA layout with the scene. */
     __forceinline void intersectN (RTCRay **rayN, const size_t N, const size_t flags) {
       //assert(intersectors.intersectorN.intersect);
       if (likely(intersectors.intersectorN.intersect))
-        intersectors.intersectorN.intersect(intersectors.ptr,rayN, N, flags);
+        intersectors.intersectorN.intersect(intersectors.local(),rayN, N, flags);
       else
         /* fallback path */
         for (size_t i=0;i<N;i++)
@@ -311,32 +337,32 @@ namespace embree
     /*! Tests if single ray is occluded by the scene. */
     __forceinline void occluded (RTCRay& ray) {
       assert(intersectors.intersector1.occluded);
-      intersectors.intersector1.occluded(intersectors.ptr,ray);
+      intersectors.intersector1.occluded(intersectors.local(),ray);
     }
     
     /*! Tests if a packet of 4 rays is occluded by the scene. */
     __forceinline void occluded4 (const void* valid, RTCRay4& ray) {
       assert(intersectors.intersector4.occluded);
-      intersectors.intersector4.occluded(valid,intersectors.ptr,ray);
+      intersectors.intersector4.occluded(valid,intersectors.local(),ray);
     }
 
     /*! Tests if a packet of 8 rays is occluded by the scene. */
     __forceinline void occluded8 (const void* valid, RTCRay8& ray) {
       assert(intersectors.intersector8.occluded);
-      intersectors.intersector8.occluded(valid,intersectors.ptr,ray);
+      intersectors.intersector8.occluded(valid,intersectors.local(),ray);
     }
 
     /*! Tests if a packet of 16 rays is occluded by the scene. */
     __forceinline void occluded16 (const void* valid, RTCRay16& ray) {
       assert(intersectors.intersector16.occluded);
-      intersectors.intersector16.occluded(valid,intersectors.ptr,ray);
+      intersectors.intersector16.occluded(valid,intersectors.local(),ray);
     }
 
     /*! Tests if a packet of N rays in SOA layout is occluded by the scene. */
     __forceinline void occludedN (RTCRay** rayN, const size_t N, const size_t flags) {
       //assert(intersectors.intersectorN.occluded);
       if(likely(intersectors.intersectorN.occluded))
-        intersectors.intersectorN.occluded(intersectors.ptr,rayN, N, flags);
+        intersectors.intersectorN.occluded(intersectors.local(),rayN, N, flags);
       else
         /* fallback path */
         for (size_t i=0;i<N;i++)
@@ -32,28 +32,70 @@ namespace embree
     }
 
     ~AccelInstance() {
+      clearReplicas();
       delete builder; builder = nullptr;
       delete accel;   accel = nullptr;
     }
 
   public:
     void build (size_t threadIndex, size_t threadCount) {
+      clearReplicas();
       if (builder) builder->build(threadIndex,threadCount);
       bounds = accel->bounds;
     }
 
+    void createReplicas (size_t numReplicas) 
+    {
+      clearReplicas();
+      if (numReplicas <= 1) return;
+
+      /* traversal falls back to the original data if any replica cannot get created */
+      for (size_t i=0; i<numReplicas; i++) {
+        AccelData* replica = accel->replicate(i % getNumberOfNumaNodes());
+        if (replica == nullptr) { clearReplicas(); return; }
+        replicas.push_back(replica);
+      }
+      intersectors.replicas = replicas.data();
+    }
+
+    void save(std::ostream& file) {
+      accel->save(file);
+    }
+
+    void load(std::istream& file) {
+      clearReplicas();
+      accel->load(file);
+      bounds = accel->bounds;
+    }
+
     void deleteGeometry(size_t geomID) {
       if (accel  ) accel->deleteGeometry(geomID);
       if (builder) builder->deleteGeometry(geomID);
     }
     
     void clear() {
+      clearReplicas();
       accel->clear();
       builder->clear();
     }
 
+    /*! returns the wrapped acceleration structure */
+    AccelData* getAccel() const {
+      return accel;
+    }
+
+  private:
+    void clearReplicas() 
+    {
+      intersectors.replicas = nullptr;
+      for (size_t i=0; i<replicas.size(); i++)
+        delete replicas[i];
+      replicas.clear();
+    }
+
   private:
     AccelData* accel;
     Builder* builder;
+    std::vector<AccelData*> replicas; //!< per NUMA node copies of accel
   };
 }
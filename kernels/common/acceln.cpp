@@ -131,6 +131,15 @@ namespace embree
     for (size_t i=0; i<accels.size(); i++)
       accels[i]->immutable();
   }
+
+  void AccelN::createReplicas(size_t numReplicas)
+  {
+    for (size_t i=0; i<accels.size(); i++)
+      accels[i]->createReplicas(numReplicas);
+
+    /* the intersectors of single accels got copied and have to get updated */
+    updateValidAccels();
+  }
   
   void AccelN::build (size_t threadIndex, size_t threadCount) 
   {
@@ -144,6 +153,32 @@ namespace embree
       });
 #endif
 
+    updateValidAccels();
+  }
+
+  void AccelN::save(std::ostream& file)
+  {
+    int numAccels = accels.size();
+    file.write((char*)&numAccels,sizeof(numAccels));
+    for (size_t i=0; i<accels.size(); i++)
+      accels[i]->save(file);
+  }
+
+  void AccelN::load(std::istream& file)
+  {
+    int numAccels = 0;
+    file.read((char*)&numAccels,sizeof(numAccels));
+    if (numAccels != accels.size())
+      throw_RTCError(RTC_INVALID_OPERATION,"stored acceleration structures do not match scene configuration");
+
+    for (size_t i=0; i<accels.size(); i++)
+      accels[i]->load(file);
+
+    updateValidAccels();
+  }
+
+  void AccelN::updateValidAccels()
+  {
     /* create list of non-empty acceleration structures */
     validAccels.clear();
     for (size_t i=0; i<accels.size(); i++) {
@@ -155,13 +190,7 @@ namespace embree
       intersectors = validAccels[0]->intersectors;
     }
     else 
-    {
-      intersectors.ptr = this;
-      intersectors.intersector1  = Intersector1(&intersect,&occluded,"AccelN::intersector1");
-      intersectors.intersector4  = Intersector4(&intersect4,&occluded4,"AccelN::intersector4");
-      intersectors.intersector8  = Intersector8(&intersect8,&occluded8,"AccelN::intersector8");
-      intersectors.intersector16 = Intersector16(&intersect16,&occluded16,"AccelN::intersector16");
-    }
+      intersectors = dispatchIntersectors();
     
     /*! calculate bounds */
     bounds = empty;
@@ -169,6 +198,18 @@ namespace embree
       bounds.extend(validAccels[i]->bounds);
   }
 
+  Accel::Intersectors AccelN::dispatchIntersectors()
+  {
+    /* intersectors that iterate over all valid acceleration structures */
+    Intersectors intersectors;
+    intersectors.ptr = this;
+    intersectors.intersector1  = Intersector1(&intersect,&occluded,"AccelN::intersector1");
+    intersectors.intersector4  = Intersector4(&intersect4,&occluded4,"AccelN::intersector4");
+    intersectors.intersector8  = Intersector8(&intersect8,&occluded8,"AccelN::intersector8");
+    intersectors.intersector16 = Intersector16(&intersect16,&occluded16,"AccelN::intersector16");
+    return intersectors;
+  }
+
   void AccelN::select(bool filter4, bool filter8, bool filter16, bool filterN)
   {
     for (size_t i=0; i<accels.size(); i++) 
@@ -186,5 +227,13 @@ namespace embree
     for (size_t i=0; i<accels.size(); i++) 
       accels[i]->clear();
   }
+
+  void AccelN::reset()
+  {
+    for (size_t i=0; i<accels.size(); i++)
+      delete accels[i];
+    accels.clear();
+    validAccels.clear();
+  }
 }
 
@@ -45,10 +45,16 @@ namespace embree
   public:
     void print(size_t ident);
     void immutable();
+    void createReplicas(size_t numReplicas);
     void build (size_t threadIndex, size_t threadCount);
+    void save(std::ostream& file);
+    void load(std::istream& file);
+    void updateValidAccels();
+    Intersectors dispatchIntersectors();
     void select(bool filter4, bool filter8, bool filter16, bool filterN);
     void deleteGeometry(size_t geomID);
     void clear ();
+    void reset ();
       
   public:
     darray_t<Accel*,16> accels;
@@ -149,7 +149,7 @@ namespace embree
     };
 
     FastAllocator (MemoryMonitorInterface* device) 
-      : device(device), growSize(defaultBlockSize), usedBlocks(nullptr), freeBlocks(nullptr), slotMask(0),
+      : device(device), numaNode(-1), growSize(defaultBlockSize), usedBlocks(nullptr), freeBlocks(nullptr), slotMask(0),
       thread_local_allocators(this), thread_local_allocators2(this), bytesUsed(0)
     {
       for (size_t i=0; i<MAX_THREAD_USED_BLOCK_SLOTS; i++)
@@ -170,6 +170,11 @@ namespace embree
       return thread_local_allocators2.get();
     }
 
+    /*! blocks get allocated on the specified NUMA node, -1 selects the node of the allocating thread */
+    void setNumaNode(ssize_t node) {
+      numaNode = node;
+    }
+
     /*! initializes the allocator */
     void init(size_t bytesAllocate, size_t bytesReserve = 0) 
     {     
@@ -280,7 +285,7 @@ namespace embree
 	      freeBlocks = nextFreeBlock;
 	    } else {
 	      growSize = min(2*growSize,size_t(maxAllocationSize+maxAlignment));
-	      usedBlocks = threadUsedBlocks[slot] = Block::create(device,growSize-maxAlignment, growSize-maxAlignment, usedBlocks);
+	      usedBlocks = threadUsedBlocks[slot] = Block::create(device,growSize-maxAlignment, growSize-maxAlignment, usedBlocks, getBlockNumaNode());
 	    }
 	  }
         }
@@ -297,6 +302,15 @@ namespace embree
       return freeBlocks->ptr();
     }
 
+    /* allocates a dedicated block of arbitrary size, used when loading a stored BVH */
+    void* mallocBlock(size_t bytes)
+    {
+      Lock<AtomicMutex> lock(mutex);
+      usedBlocks = Block::create(device,bytes,bytes,usedBlocks,getBlockNumaNode());
+      bytesUsed += bytes;
+      return usedBlocks->malloc(device,bytes,maxAlignment);
+    }
+
     size_t getAllocatedBytes() const 
     {
       size_t bytesAllocated = 0;
@@ -379,15 +393,24 @@ namespace embree
 
   private:
 
+    /*! returns the NUMA node new blocks get allocated on, blocks are
+     *  mostly accessed by the allocating thread during the build */
+    __forceinline ssize_t getBlockNumaNode() const 
+    {
+      if (numaNode >= 0) return numaNode;
+      if (getNumberOfNumaNodes() <= 1) return -1;
+      return getThreadNumaNode();
+    }
+
     struct Block 
     {
-      static Block* create(MemoryMonitorInterface* device, size_t bytesAllocate, size_t bytesReserve, Block* next = nullptr)
+      static Block* create(MemoryMonitorInterface* device, size_t bytesAllocate, size_t bytesReserve, Block* next = nullptr, ssize_t numaNode = -1)
       {
         const size_t sizeof_Header = offsetof(Block,data[0]);
         bytesAllocate = ((sizeof_Header+bytesAllocate+defaultBlockSize-1) & ~(defaultBlockSize-1)); // always consume full pages
         bytesReserve  = ((sizeof_Header+bytesReserve +defaultBlockSize-1) & ~(defaultBlockSize-1)); // always consume full pages
         if (device) device->memoryMonitor(bytesAllocate,false);
-        void* ptr = os_reserve(bytesReserve);
+        void* ptr = os_reserve(bytesReserve,numaNode);
         os_commit(ptr,bytesAllocate);
         return new (ptr) Block(bytesAllocate-sizeof_Header,bytesReserve-sizeof_Header,next);
       }
@@ -478,6 +501,7 @@ namespace embree
 
   private:
     MemoryMonitorInterface* device;
+    ssize_t numaNode;            //!< NUMA node to allocate blocks on, -1 for the node of the allocating thread
     AtomicMutex mutex;
     size_t slotMask;
     Block* volatile threadUsedBlocks[MAX_THREAD_USED_BLOCK_SLOTS];
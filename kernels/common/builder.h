@@ -22,6 +22,8 @@
 namespace embree
 {
 #define MODE_HIGH_QUALITY (1<<8)
+#define MODE_QUANTIZED    (1<<9)
+#define MODE_MORTON64     (1<<10)
 
   /*! virtual interface for all hierarchy builders */
   class Builder : public RefCount {
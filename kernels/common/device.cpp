@@ -81,9 +81,10 @@ namespace embree
   static MutexSys g_mutex;
   static std::map<Device*,size_t> g_cache_size_map;
   static std::map<Device*,size_t> g_num_threads_map;
+  static Device* g_persistent_cache_device = nullptr;
 
   Device::Device (const char* cfg, bool singledevice)
-    : State(singledevice)
+    : State(singledevice), bytesUsed(0)
   {
     /* initialize global state */
     init_globals();
@@ -94,9 +95,23 @@ namespace embree
       State::parseFile(FileName::homeFolder()+FileName(".embree" TOSTRING(__EMBREE_VERSION_MAJOR__)));
     State::verify();
     
+    /*! map persistent tessellation cache file */
+    if (State::tessellation_cache_file != "")
+    {
+      Lock<MutexSys> lock(g_mutex);
+      if (g_persistent_cache_device)
+        throw_RTCError(RTC_INVALID_OPERATION,"persistent tessellation cache already used by another device");
+      openPersistentTessellationCache(State::tessellation_cache_file,State::tessellation_cache_file_size);
+      g_persistent_cache_device = this;
+    }
+
     /*! set tessellation cache size */
     setCacheSize( State::tessellation_cache_size );
 
+    /*! enable runtime statistics */
+    if (State::statistics)
+      ThreadStat::enable(true);
+
     /*! enable some floating point exceptions to catch bugs */
     if (State::float_exceptions)
     {
@@ -148,6 +163,7 @@ namespace embree
 
     assert(rayStreamFilters.filterAOS);
     assert(rayStreamFilters.filterSOA);      
+    assert(rayStreamFilters.intersectCamera);
   }
 
   Device::~Device ()
@@ -160,6 +176,12 @@ namespace embree
 #endif
 #endif
     setCacheSize(0);
+    setStatistics(false);
+    if (g_persistent_cache_device == this) {
+      Lock<MutexSys> lock(g_mutex);
+      closePersistentTessellationCache();
+      g_persistent_cache_device = nullptr;
+    }
     exitTaskingSystem();
   }
 
@@ -328,10 +350,22 @@ namespace embree
 
   void Device::memoryMonitor(ssize_t bytes, bool post)
   {
-    if (State::memory_monitor_function && bytes != 0) {
+    if (bytes == 0) return;
+    const ssize_t used = atomic_add(&bytesUsed,bytes) + bytes;
+
+    /* reject allocations that would exceed the memory budget, builders react by degrading the acceleration structure */
+#if !defined(TASKING_LOCKSTEP)
+    if (State::memory_budget && bytes > 0 && size_t(used) > State::memory_budget) {
+      if (!post) atomic_add(&bytesUsed,-bytes); // post allocations stay accounted until they get freed
+      throw_RTCError(RTC_OUT_OF_MEMORY,"memory budget exceeded");
+    }
+#endif
+
+    if (State::memory_monitor_function) {
       if (!State::memory_monitor_function(bytes,post)) {
 #if !defined(TASKING_LOCKSTEP)
         if (bytes > 0) { // only throw exception when we allocate memory to never throw inside a destructor
+          if (!post) atomic_add(&bytesUsed,-bytes);
           throw_RTCError(RTC_OUT_OF_MEMORY,"memory monitor forced termination");
         }
 #endif
@@ -437,10 +471,19 @@ namespace embree
 #endif
   }
 
+  void Device::setStatistics(bool enable)
+  {
+    if (State::statistics == enable) return;
+    ThreadStat::enable(enable);
+    State::statistics = enable;
+  }
+
   void Device::setParameter1i(const RTCParameter parm, ssize_t val)
   {
     switch (parm) {
     case RTC_SOFTWARE_CACHE_SIZE: setCacheSize(val); break;
+    case RTC_STATISTICS         : setStatistics(val != 0); break;
+    case RTC_MEMORY_BUDGET      : State::memory_budget = val; break;
     default: throw_RTCError(RTC_INVALID_ARGUMENT, "unknown writable parameter"); break;
     };
   }
@@ -454,6 +497,11 @@ namespace embree
     case RTC_CONFIG_VERSION_PATCH: return __EMBREE_VERSION_PATCH__;
     case RTC_CONFIG_VERSION      : return __EMBREE_VERSION_NUMBER__;
 
+    case RTC_STATISTICS: return State::statistics;
+
+    case RTC_MEMORY_BUDGET: return State::memory_budget;
+    case RTC_MEMORY_USED  : return bytesUsed;
+
     case RTC_CONFIG_INTERSECT1: return 1;
     case RTC_CONFIG_INTERSECTN: return 1;
 
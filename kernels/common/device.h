@@ -53,7 +53,7 @@ namespace embree
     /*! processes error codes, do not call directly */
     void process_error(RTCError error, const char* str);
 
-    /*! invokes the memory monitor callback */
+    /*! tracks the memory usage, enforces the memory budget, and invokes the memory monitor callback */
     void memoryMonitor(ssize_t bytes, bool post);
 
     /*! sets the size of the software cache. */
@@ -65,6 +65,9 @@ namespace embree
     /*! returns some configuration */
     ssize_t getParameter1i(const RTCParameter parm);
 
+    /*! enables or disables gathering of runtime statistics */
+    void setStatistics(bool enable);
+
   private:
 
     /*! initializes the tasking system */
@@ -78,6 +81,7 @@ namespace embree
 
   public:
     bool singledevice;      //!< true if this is the device created implicitely through rtcInit
+    atomic_t bytesUsed;     //!< number of bytes currently allocated through this device
 
     InstanceFactory* instance_factory;
 
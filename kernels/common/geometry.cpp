@@ -26,7 +26,7 @@ namespace embree
       intersectionFilter4(nullptr), occlusionFilter4(nullptr), ispcIntersectionFilter4(false), ispcOcclusionFilter4(false), 
       intersectionFilter8(nullptr), occlusionFilter8(nullptr), ispcIntersectionFilter8(false), ispcOcclusionFilter8(false), 
       intersectionFilter16(nullptr), occlusionFilter16(nullptr), ispcIntersectionFilter16(false), ispcOcclusionFilter16(false), 
-      userPtr(nullptr)
+      filterBatching(false), userPtr(nullptr)
   {
     id = parent->add(this);
     parent->setModified();
@@ -205,6 +205,17 @@ namespace embree
     ispcOcclusionFilter16 = ispc;
   }
 
+  void Geometry::setFilterBatching (bool enable) 
+  { 
+    if (parent->isStatic() && parent->isBuild())
+      throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
+
+    if (type != TRIANGLE_MESH && type != QUAD_MESH && type != LINE_SEGMENTS && type != BEZIER_CURVES && type != SUBDIV_MESH) 
+      throw_RTCError(RTC_INVALID_OPERATION,"filter functions not supported for this geometry"); 
+
+    filterBatching = enable;
+  }
+
   void Geometry::interpolateN(const void* valid_i, const unsigned* primIDs, const float* u, const float* v, size_t numUVs, 
                               RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats)
   {
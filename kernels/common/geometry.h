@@ -22,6 +22,33 @@ namespace embree
 {
   class Scene;
 
+  /*! calculates the time segment containing the specified time in [0,1] and the local time inside that segment */
+  __forceinline int getTimeSegment(const float time, const float numTimeSegments, float& ftime)
+  {
+    const float timeScaled = time * numTimeSegments;
+    const float itimef = clamp(floor(timeScaled), 0.0f, numTimeSegments-1.0f);
+    ftime = timeScaled - itimef;
+    return int(itimef);
+  }
+
+  template<int K>
+  __forceinline vint<K> getTimeSegment(const vfloat<K>& time, const vfloat<K>& numTimeSegments, vfloat<K>& ftime)
+  {
+    const vfloat<K> timeScaled = time * numTimeSegments;
+    const vfloat<K> itimef = clamp(floor(timeScaled), vfloat<K>(zero), numTimeSegments-1.0f);
+    ftime = timeScaled - itimef;
+    return vint<K>(itimef);
+  }
+
+  /*! loads for each lane the float at byte offset ofs of the vertex the lane points to */
+  template<int K>
+  __forceinline vfloat<K> gatherVertexFloat(const char* const* vertex, const size_t ofs)
+  {
+    vfloat<K> v;
+    for (size_t k=0; k<K; k++) v[k] = *(const float*)(vertex[k]+ofs);
+    return v;
+  }
+
   /*! Base class all geometries are derived from */
   class Geometry
   {
@@ -43,7 +70,7 @@ namespace embree
     virtual void write(std::ofstream& file);
 
     /*! updates intersection filter function counts in scene */
-    void updateIntersectionFilters(bool enable);
+    virtual void updateIntersectionFilters(bool enable);
 
   public:
 
@@ -63,7 +90,7 @@ namespace embree
     __forceinline bool isModified() const { return numPrimitives && modified; }
 
     /*! clears modified flag */
-    __forceinline void clearModified() { modified = false; }
+    virtual void clearModified() { modified = false; }
 
     /*! test if this is a static geometry */
     __forceinline bool isStatic() const { return flags == RTC_GEOMETRY_STATIC; }
@@ -93,6 +120,16 @@ namespace embree
     virtual void updateBuffer (RTCBufferType type) {
       update(); // update everything for geometries not supporting this call
     }
+
+    /*! Update range of geometry buffer. */
+    virtual void updateBufferRange (RTCBufferType type, size_t offset, size_t num) {
+      updateBuffer(type); // update entire buffer for geometries not supporting this call
+    }
+
+    /*! Appends the IDs of all primitives modified since the last commit, returns false if all primitives have to be considered modified. */
+    virtual bool getModifiedPrimitives (std::vector<unsigned>& primIDs) {
+      return false;
+    }
     
     /*! Disable geometry. */
     virtual void disable ();
@@ -109,11 +146,26 @@ namespace embree
     /*! called if geometry is switching from enabled to disabled state */
     virtual void disabling() = 0;
 
+    /*! sets the subdivision level of the opacity micro map */
+    virtual void setOpacityMicroMapLevel(unsigned level) {
+      throw_RTCError(RTC_INVALID_OPERATION,"operation not supported for this geometry"); 
+    }
+
     /*! sets constant tessellation rate for the geometry */
     virtual void setTessellationRate(float N) {
       throw_RTCError(RTC_INVALID_OPERATION,"operation not supported for this geometry"); 
     }
 
+    /*! sets the camera used to calculate the tessellation rate of each edge */
+    virtual void setTessellationCamera(const RTCCamera* camera, float pixelsPerEdge) {
+      throw_RTCError(RTC_INVALID_OPERATION,"operation not supported for this geometry"); 
+    }
+
+    /*! sets the basis of the curve control points */
+    virtual void setCurveBasis(RTCCurveBasis basis) {
+      throw_RTCError(RTC_INVALID_OPERATION,"operation not supported for this geometry"); 
+    }
+
     /*! Set user data pointer. */
     virtual void setUserData (void* ptr);
       
@@ -166,6 +218,11 @@ namespace embree
       throw_RTCError(RTC_INVALID_OPERATION,"operation not supported for this geometry"); 
     }
 
+    /*! Set SIMD displacement function. */
+    virtual void setDisplacementFunctionN (RTCDisplacementFuncN filter, RTCDisplacementFlags flags) {
+      throw_RTCError(RTC_INVALID_OPERATION,"operation not supported for this geometry"); 
+    }
+
     /*! Set intersection filter function for single rays. */
     virtual void setIntersectionFilterFunction (RTCFilterFunc filter, bool ispc = false);
     
@@ -190,6 +247,9 @@ namespace embree
     /*! Set occlusion filter function for ray packets of size 16. */
     virtual void setOcclusionFilterFunction16 (RTCFilterFunc16 filter16, bool ispc = false);
 
+    /*! Enables batched invocation of the packet filter functions for single rays. */
+    virtual void setFilterBatching (bool enable);
+
     /*! for instances only */
   public:
     
@@ -198,6 +258,11 @@ namespace embree
       throw_RTCError(RTC_INVALID_OPERATION,"operation not supported for this geometry"); 
     }
 
+    /*! Returns the instanced scene if this is a scene instance */
+    virtual Scene* getInstancedScene() const {
+      return nullptr;
+    }
+
     /*! for user geometries only */
   public:
 
@@ -262,7 +327,7 @@ namespace embree
     unsigned id;               //!< internal geometry ID
     Type type;                 //!< geometry type 
     ssize_t numPrimitives;     //!< number of primitives of this geometry
-    unsigned numTimeSteps;     //!< number of time steps (1 or 2)
+    unsigned numTimeSteps;     //!< number of time steps
     RTCGeometryFlags flags;    //!< flags of geometry
     bool enabled;              //!< true if geometry is enabled
     bool modified;             //!< true if geometry is modified
@@ -291,6 +356,8 @@ namespace embree
 
     bool ispcIntersectionFilter16;
     bool ispcOcclusionFilter16;
+
+    bool filterBatching;  //!< single ray queries invoke the packet filters once per leaf
   };
 
 #if defined(__SSE__)
@@ -387,6 +387,22 @@ namespace embree
         }
     }
 
+    __forceinline Vec3fa getOrgByOffset(const size_t offset)
+    {
+      const float x = *(float* __restrict__ )((char*)orgx + offset);
+      const float y = *(float* __restrict__ )((char*)orgy + offset);
+      const float z = *(float* __restrict__ )((char*)orgz + offset);
+      return Vec3fa(x,y,z);
+    }
+
+    __forceinline Vec3fa getDirByOffset(const size_t offset)
+    {
+      const float x = *(float* __restrict__ )((char*)dirx + offset);
+      const float y = *(float* __restrict__ )((char*)diry + offset);
+      const float z = *(float* __restrict__ )((char*)dirz + offset);
+      return Vec3fa(x,y,z);
+    }
+
     __forceinline size_t getOctantByOffset(const size_t offset)
     {
       const float dx = *(float* __restrict__ )((char*)dirx + offset);
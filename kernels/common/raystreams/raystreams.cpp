@@ -1,18 +1,164 @@
 #include "raystreams.h"
 #include "../../common/scene.h"
+#include "../../algorithms/sort.h"
 
 
 namespace embree
 {
   static const size_t MAX_RAYS_PER_OCTANT = 8*sizeof(size_t);
 
+  /* number of rays that get sorted together in reorder mode */
+  static const size_t MAX_RAYS_PER_REORDER = 1024;
+
   namespace isa
   {
+    /*! sort key of a ray in reorder mode */
+    struct RayReorderKey
+    {
+      __forceinline RayReorderKey () {}
+
+      __forceinline RayReorderKey (const uint64_t key, const size_t id)
+        : key(key), id(id) {}
+
+      __forceinline bool operator<(const RayReorderKey& other) const { return key < other.key; }
+      __forceinline bool operator>(const RayReorderKey& other) const { return key > other.key; }
+
+      __forceinline unsigned int octant() const { return (unsigned int)(key >> 60); }
+
+    public:
+      uint64_t key; //!< octant followed by Morton code of origin and direction
+      size_t id;    //!< ray index for AOS streams, byte offset for SOA streams
+    };
+
+    /*! quantizes the origin relative to the origin bounds of all rays
+     *  and the normalized direction to 10 bits per dimension */
+    __forceinline uint64_t rayReorderKey(const Vec3fa& org, const Vec3fa& dir, const Vec3fa& lower, const Vec3fa& scale)
+    {
+      const unsigned int octantID = 
+        (dir.x < 0.0f ? 1 : 0) |
+        (dir.y < 0.0f ? 2 : 0) |
+        (dir.z < 0.0f ? 4 : 0);
+
+      const Vec3fa o = clamp((org-lower)*scale,Vec3fa(0.0f),Vec3fa(1023.0f));
+      const float len2 = dot(dir,dir);
+      const Vec3fa d = len2 > 0.0f ? clamp((dir*rsqrt(len2)+Vec3fa(1.0f))*511.5f,Vec3fa(0.0f),Vec3fa(1023.0f)) : Vec3fa(511.0f);
+      const unsigned int ocode = bitInterleave((unsigned int)o.x,(unsigned int)o.y,(unsigned int)o.z);
+      const unsigned int dcode = bitInterleave((unsigned int)d.x,(unsigned int)d.y,(unsigned int)d.z);
+      return ((uint64_t)octantID << 60) | ((uint64_t)ocode << 30) | (uint64_t)dcode;
+    }
+
+    __forceinline Vec3fa rayReorderScale(const BBox3fa& bounds)
+    {
+      const Vec3fa size = bounds.size();
+      return Vec3fa(size.x > 0.0f ? 1023.0f/size.x : 0.0f,
+                    size.y > 0.0f ? 1023.0f/size.y : 0.0f,
+                    size.z > 0.0f ? 1023.0f/size.z : 0.0f);
+    }
+
+    static void reorderAOS(Scene *scene, Ray* __restrict__ rayN, const size_t N, const size_t stride, const size_t flags, const bool intersect)
+    {
+      __aligned(64) RayReorderKey keys[MAX_RAYS_PER_REORDER];
+      __aligned(64) Ray* rays[MAX_RAYS_PER_OCTANT];
+
+      for (size_t start=0; start<N; start+=MAX_RAYS_PER_REORDER)
+      {
+        const size_t end = min(N,start+MAX_RAYS_PER_REORDER);
+
+        /* calculate origin bounds of all valid rays */
+        BBox3fa bounds = empty;
+        for (size_t i=start; i<end; i++) {
+          Ray &ray = *(Ray*)((char*)rayN + i * stride);
+          if (unlikely(ray.tnear > ray.tfar)) continue;
+          bounds.extend(ray.org);
+        }
+        const Vec3fa scale = rayReorderScale(bounds);
+
+        /* sort valid rays by octant, origin, and direction */
+        size_t numKeys = 0;
+        for (size_t i=start; i<end; i++) {
+          Ray &ray = *(Ray*)((char*)rayN + i * stride);
+          if (unlikely(ray.tnear > ray.tfar)) continue;
+          keys[numKeys++] = RayReorderKey(rayReorderKey(ray.org,ray.dir,bounds.lower,scale),i);
+        }
+        quicksort_insertionsort_ascending<RayReorderKey,16>(keys,0,ssize_t(numKeys)-1);
+
+        /* trace sorted rays in chunks of the same octant, results directly go to the original rays */
+        for (size_t i=0; i<numKeys;)
+        {
+          const unsigned int octantID = keys[i].octant();
+          size_t numRays = 0;
+          for (; i<numKeys && numRays<MAX_RAYS_PER_OCTANT && keys[i].octant() == octantID; i++)
+            rays[numRays++] = (Ray*)((char*)rayN + keys[i].id * stride);
+
+          if (intersect)
+            scene->intersectN((RTCRay**)rays,numRays,flags);
+          else
+            scene->occludedN((RTCRay**)rays,numRays,flags);
+        }
+      }
+    }
+
+    static void reorderSOA(Scene *scene, RaySOA& rayN, const size_t N, const size_t streams, const size_t stream_offset, const size_t flags, const bool intersect)
+    {
+      __aligned(64) RayReorderKey keys[MAX_RAYS_PER_REORDER];
+      __aligned(64) Ray rays[MAX_RAYS_PER_OCTANT];
+      __aligned(64) Ray *rays_ptr[MAX_RAYS_PER_OCTANT];
+
+      for (size_t i=0;i<MAX_RAYS_PER_OCTANT;i++)
+        rays_ptr[i] = &rays[i];
+
+      const size_t numTotal = N*streams;
+      for (size_t start=0; start<numTotal; start+=MAX_RAYS_PER_REORDER)
+      {
+        const size_t end = min(numTotal,start+MAX_RAYS_PER_REORDER);
+
+        /* calculate origin bounds of all valid rays */
+        BBox3fa bounds = empty;
+        for (size_t i=start; i<end; i++) {
+          const size_t offset = (i/N)*stream_offset + sizeof(float)*(i%N);
+          if (unlikely(!rayN.isValidByOffset(offset))) continue;
+          bounds.extend(rayN.getOrgByOffset(offset));
+        }
+        const Vec3fa scale = rayReorderScale(bounds);
+
+        /* sort valid rays by octant, origin, and direction */
+        size_t numKeys = 0;
+        for (size_t i=start; i<end; i++) {
+          const size_t offset = (i/N)*stream_offset + sizeof(float)*(i%N);
+          if (unlikely(!rayN.isValidByOffset(offset))) continue;
+          keys[numKeys++] = RayReorderKey(rayReorderKey(rayN.getOrgByOffset(offset),rayN.getDirByOffset(offset),bounds.lower,scale),offset);
+        }
+        quicksort_insertionsort_ascending<RayReorderKey,16>(keys,0,ssize_t(numKeys)-1);
+
+        /* trace sorted rays in chunks of the same octant and scatter results back */
+        for (size_t i=0; i<numKeys;)
+        {
+          const size_t first = i;
+          const unsigned int octantID = keys[i].octant();
+          size_t numRays = 0;
+          for (; i<numKeys && numRays<MAX_RAYS_PER_OCTANT && keys[i].octant() == octantID; i++)
+            rays[numRays++] = rayN.gatherByOffset(keys[i].id);
+
+          if (intersect)
+            scene->intersectN((RTCRay**)rays_ptr,numRays,flags);
+          else
+            scene->occludedN((RTCRay**)rays_ptr,numRays,flags);
+
+          for (size_t j=0; j<numRays; j++)
+            rayN.scatterByOffset(keys[first+j].id,rays[j],intersect);
+        }
+      }
+    }
 
 
     void RayStream::filterAOS(Scene *scene, RTCRay* _rayN, const size_t N, const size_t stride, const size_t flags, const bool intersect)
     {
       Ray* __restrict__ rayN = (Ray*)_rayN;
+      if (flags & RTC_RAYN_REORDER) {
+        reorderAOS(scene,rayN,N,stride,flags,intersect);
+        return;
+      }
+
       __aligned(64) Ray* octants[8][MAX_RAYS_PER_OCTANT];
       unsigned int rays_in_octant[8];
 
@@ -87,6 +233,11 @@ namespace embree
       size_t soffset = 0;
       RaySOA &rayN = *(RaySOA*)&_rayN;
 
+      if (flags & RTC_RAYN_REORDER) {
+        reorderSOA(scene,rayN,N,streams,stream_offset,flags,intersect);
+        return;
+      }
+
       for (size_t s=0;s<streams;s++,soffset+=stream_offset)
       {
         // todo: use SIMD width to compute octants
@@ -138,7 +289,163 @@ namespace embree
         }
     }
 
-    RayStreamFilterFuncs rayStreamFilters(RayStream::filterAOS,RayStream::filterSOA);
+    /*! camera data that is the same for all rays of a rtcIntersectCamera call */
+    struct CameraSetup
+    {
+      CameraSetup (const RTCCamera& camera)
+        : org(camera.org[0],camera.org[1],camera.org[2]),
+          vx(camera.vx[0],camera.vx[1],camera.vx[2]),
+          vy(camera.vy[0],camera.vy[1],camera.vy[2]),
+          vz(camera.vz[0],camera.vz[1],camera.vz[2]),
+          lensOffset(zero), scale(1.0f)
+      {
+        /* the lens sample is shared by all pixels, thus all rays start at the same point on the lens */
+        if (camera.lensRadius > 0.0f) 
+        {
+          const float r = camera.lensRadius*sqrtf(camera.lensSample[0]);
+          const float phi = float(two_pi)*camera.lensSample[1];
+          lensOffset = r*cosf(phi)*normalize(vx) + r*sinf(phi)*normalize(vy);
+          scale = camera.focalDistance;
+        }
+      }
+
+    public:
+      Vec3fa org;        //!< camera position
+      Vec3fa vx,vy,vz;   //!< image plane
+      Vec3fa lensOffset; //!< offset from the camera position to the sampled point on the lens
+      float scale;       //!< scale of the image plane to get to the plane in focus
+    };
+
+    template<typename T>
+      __forceinline void storeCameraHit(T* ptr, const size_t offset, const T value) {
+      if (ptr) *(T*)((char*)ptr + offset) = value;
+    }
+
+    __forceinline void storeCameraHit(RTCCameraHits& hits, const size_t x, const size_t y, const Ray& ray)
+    {
+      const size_t offset = y*hits.stride + x*sizeof(float);
+      storeCameraHit(hits.tfar,offset,ray.tfar);
+      storeCameraHit(hits.Ngx,offset,ray.Ng.x);
+      storeCameraHit(hits.Ngy,offset,ray.Ng.y);
+      storeCameraHit(hits.Ngz,offset,ray.Ng.z);
+      storeCameraHit(hits.u,offset,ray.u);
+      storeCameraHit(hits.v,offset,ray.v);
+      storeCameraHit(hits.geomID,offset,(unsigned)ray.geomID);
+      storeCameraHit(hits.primID,offset,(unsigned)ray.primID);
+      storeCameraHit(hits.instID,offset,(unsigned)ray.instID);
+    }
+
+    static void intersectCamera1(Scene *scene, const RTCCamera& camera, const unsigned x0, const unsigned y0, const unsigned width, const unsigned height, RTCCameraHits& hits)
+    {
+      const CameraSetup cam(camera);
+      for (unsigned y=y0; y<y0+height; y++)
+      {
+        for (unsigned x=x0; x<x0+width; x++)
+        {
+          const float fx = float(x)+camera.pixelSample[0];
+          const float fy = float(y)+camera.pixelSample[1];
+          const Vec3fa dir = cam.scale*(fx*cam.vx + fy*cam.vy + cam.vz) - cam.lensOffset;
+          __aligned(16) Ray ray(cam.org+cam.lensOffset,normalize(dir),camera.tnear,camera.tfar,camera.time,camera.mask);
+          scene->intersect((RTCRay&)ray);
+          storeCameraHit(hits,x,y,ray);
+        }
+      }
+    }
+
+#if !defined(__MIC__)
+
+    __forceinline void intersectPacket(Scene* scene, const vint4& valid, Ray4& ray) { scene->intersect4(&valid,(RTCRay4&)ray); }
+#if defined(__AVX__)
+    __forceinline void intersectPacket(Scene* scene, const vint8& valid, Ray8& ray) { scene->intersect8(&valid,(RTCRay8&)ray); }
+#endif
+#if defined(__AVX512F__)
+    __forceinline void intersectPacket(Scene* scene, const vint16& valid, Ray16& ray) { scene->intersect16(&valid,(RTCRay16&)ray); }
+#endif
+
+    template<int K>
+      __forceinline void storeCameraHit(RTCCameraHits& hits, const size_t x, const size_t y, const RayK<K>& ray, const size_t k)
+    {
+      const size_t offset = y*hits.stride + x*sizeof(float);
+      storeCameraHit(hits.tfar,offset,ray.tfar[k]);
+      storeCameraHit(hits.Ngx,offset,ray.Ng.x[k]);
+      storeCameraHit(hits.Ngy,offset,ray.Ng.y[k]);
+      storeCameraHit(hits.Ngz,offset,ray.Ng.z[k]);
+      storeCameraHit(hits.u,offset,ray.u[k]);
+      storeCameraHit(hits.v,offset,ray.v[k]);
+      storeCameraHit(hits.geomID,offset,(unsigned)ray.geomID[k]);
+      storeCameraHit(hits.primID,offset,(unsigned)ray.primID[k]);
+      storeCameraHit(hits.instID,offset,(unsigned)ray.instID[k]);
+    }
+
+    /*! traces the image in tiles of W x K/W pixels, one packet per tile */
+    template<int K, int W>
+      static void intersectCameraK(Scene *scene, const RTCCamera& camera, const unsigned x0, const unsigned y0, const unsigned width, const unsigned height, RTCCameraHits& hits)
+    {
+      const CameraSetup cam(camera);
+      const unsigned x1 = x0+width, y1 = y0+height;
+
+      vfloat<K> laneX, laneY;
+      for (size_t i=0; i<K; i++) {
+        laneX[i] = float(i%W);
+        laneY[i] = float(i/W);
+      }
+      const Vec3<vfloat<K>> org(cam.org.x+cam.lensOffset.x,cam.org.y+cam.lensOffset.y,cam.org.z+cam.lensOffset.z);
+
+      for (unsigned y=y0; y<y1; y+=K/W)
+      {
+        for (unsigned x=x0; x<x1; x+=W)
+        {
+          const vfloat<K> px = vfloat<K>(float(x)) + laneX;
+          const vfloat<K> py = vfloat<K>(float(y)) + laneY;
+          const vbool<K> valid = (px < vfloat<K>(float(x1))) & (py < vfloat<K>(float(y1)));
+
+          /* generate the rays of the tile directly in packet layout */
+          const vfloat<K> fx = px + vfloat<K>(camera.pixelSample[0]);
+          const vfloat<K> fy = py + vfloat<K>(camera.pixelSample[1]);
+          Vec3<vfloat<K>> dir;
+          dir.x = cam.scale*(fx*cam.vx.x + fy*cam.vy.x + cam.vz.x) - cam.lensOffset.x;
+          dir.y = cam.scale*(fx*cam.vx.y + fy*cam.vy.y + cam.vz.y) - cam.lensOffset.y;
+          dir.z = cam.scale*(fx*cam.vx.z + fy*cam.vy.z + cam.vz.z) - cam.lensOffset.z;
+          const vfloat<K> rcpLength = rsqrt(dir.x*dir.x + dir.y*dir.y + dir.z*dir.z);
+          dir.x *= rcpLength; dir.y *= rcpLength; dir.z *= rcpLength;
+
+          RayK<K> ray(org,dir,vfloat<K>(camera.tnear),vfloat<K>(camera.tfar),vfloat<K>(camera.time),vint<K>(camera.mask));
+          const vint<K> vvalid = select(valid,vint<K>(-1),vint<K>(zero));
+          intersectPacket(scene,vvalid,ray);
+
+          /* write hits to the framebuffer */
+          for (size_t m=movemask(valid), i=__bsf(m); m!=0; m=__btc(m,i), i=__bsf(m))
+            storeCameraHit(hits,x+i%W,y+i/W,ray,i);
+        }
+      }
+    }
+
+#endif
+
+    void RayStream::intersectCamera(Scene *scene, const RTCCamera& camera, const unsigned x0, const unsigned y0, const unsigned width, const unsigned height, RTCCameraHits& hits)
+    {
+#if defined(__AVX512F__)
+      if (scene->aflags & RTC_INTERSECT16) {
+        intersectCameraK<16,4>(scene,camera,x0,y0,width,height,hits);
+        return;
+      }
+#endif
+#if defined(__AVX__)
+      if (scene->aflags & RTC_INTERSECT8) {
+        intersectCameraK<8,4>(scene,camera,x0,y0,width,height,hits);
+        return;
+      }
+#endif
+#if !defined(__MIC__)
+      if (scene->aflags & RTC_INTERSECT4) {
+        intersectCameraK<4,2>(scene,camera,x0,y0,width,height,hits);
+        return;
+      }
+#endif
+      intersectCamera1(scene,camera,x0,y0,width,height,hits);
+    }
+
+    RayStreamFilterFuncs rayStreamFilters(RayStream::filterAOS,RayStream::filterSOA,RayStream::intersectCamera);
 
   };
 };
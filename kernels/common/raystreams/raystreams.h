@@ -18,6 +18,7 @@
 
 #include "../../common/default.h"
 #include "../../common/ray.h"
+#include "../../../include/embree2/rtcore_ray.h"
 
 namespace embree
 {
@@ -38,24 +39,35 @@ namespace embree
                                  const size_t flags, 
                                  const bool intersect);
 
+  typedef void (*intersectCamera_func)(Scene *scene, 
+                                       const RTCCamera& camera, 
+                                       const unsigned x0, 
+                                       const unsigned y0, 
+                                       const unsigned width, 
+                                       const unsigned height, 
+                                       RTCCameraHits& hits);
+
   struct RayStreamFilterFuncs
   {
     RayStreamFilterFuncs()
-    : filterAOS(nullptr), filterSOA(nullptr) {}
+    : filterAOS(nullptr), filterSOA(nullptr), intersectCamera(nullptr) {}
 
     RayStreamFilterFuncs(void (*ptr) ()) {
       filterAOS = (filterAOS_func) filterAOS;
       filterSOA = (filterSOA_func) filterSOA;
+      intersectCamera = (intersectCamera_func) intersectCamera;
     }
 
-    RayStreamFilterFuncs(filterAOS_func aos, filterSOA_func soa) { 
+    RayStreamFilterFuncs(filterAOS_func aos, filterSOA_func soa, intersectCamera_func camera) { 
       filterAOS = aos;
       filterSOA = soa;
+      intersectCamera = camera;
     }
 
   public:
     filterAOS_func filterAOS;
     filterSOA_func filterSOA;
+    intersectCamera_func intersectCamera;
   };
   
 
@@ -68,6 +80,8 @@ namespace embree
       static void filterAOS(Scene *scene, RTCRay* rayN, const size_t N, const size_t stride, const size_t flags, const bool intersect);
 
       static void filterSOA(Scene *scene, RTCRaySOA& rayN, const size_t N, const size_t streams, const size_t offset, const size_t flags, const bool intersect);
+
+      static void intersectCamera(Scene *scene, const RTCCamera& camera, const unsigned x0, const unsigned y0, const unsigned width, const unsigned height, RTCCameraHits& hits);
     
     };
   }
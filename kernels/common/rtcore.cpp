@@ -22,6 +22,7 @@
 
 #include "device.h"
 #include "scene.h"
+#include "scene_subdiv_topology.h"
 #include "raystream_log.h"
 #include "raystreams/raystreams.h"
 
@@ -116,6 +117,35 @@ namespace embree
     return 0;
   }
 
+  RTCORE_API void rtcDeviceGetStatistics(RTCDevice hdevice, RTCStatistics* stats)
+  {
+    Device* device = (Device*) hdevice;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcDeviceGetStatistics);
+    RTCORE_VERIFY_HANDLE(hdevice);
+    RTCORE_VERIFY_HANDLE(stats);
+    ThreadStat::Counters cntrs;
+    ThreadStat::gather(cntrs);
+    stats->nodes = cntrs.nodes;
+    stats->leaves = cntrs.leaves;
+    stats->primitives = cntrs.prims;
+    stats->leafHits = cntrs.leafHits;
+    stats->filterCalls = cntrs.filterCalls;
+    stats->tessellationCacheHits = cntrs.tessCacheHits;
+    stats->tessellationCacheMisses = cntrs.tessCacheMisses;
+    RTCORE_CATCH_END(device);
+  }
+
+  RTCORE_API void rtcDeviceClearStatistics(RTCDevice hdevice)
+  {
+    Device* device = (Device*) hdevice;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcDeviceClearStatistics);
+    RTCORE_VERIFY_HANDLE(hdevice);
+    ThreadStat::clear();
+    RTCORE_CATCH_END(device);
+  }
+
   RTCORE_API RTCError rtcGetError()
   {
     RTCORE_CATCH_BEGIN;
@@ -232,12 +262,42 @@ namespace embree
     RayStreamLogger::rayStreamLogger.dumpGeometry(scene);
 #endif
 
+    /* wait for pending asynchronous commit */
+    scene->finishAsyncCommit();
+
     /* perform scene build */
     scene->build(0,0);
     
     RTCORE_CATCH_END(scene->device);
   }
 
+  RTCORE_API void rtcCommitAsync (RTCScene hscene, RTCCommitCompleteFunc func, void* ptr) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcCommitAsync);
+    RTCORE_VERIFY_HANDLE(hscene);
+
+#if defined(RTCORE_ENABLE_RAYSTREAM_LOGGER)
+    RayStreamLogger::rayStreamLogger.dumpGeometry(scene);
+#endif
+
+    /* schedule scene build */
+    scene->commitAsync(func,ptr);
+    
+    RTCORE_CATCH_END(scene->device);
+  }
+
+  RTCORE_API void rtcEvictLazyInstances (RTCScene hscene, size_t maxBytes) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcEvictLazyInstances);
+    RTCORE_VERIFY_HANDLE(hscene);
+    scene->evictLazyInstances(maxBytes);
+    RTCORE_CATCH_END(scene->device);
+  }
+
   RTCORE_API void rtcCommitThread(RTCScene hscene, unsigned int threadID, unsigned int numThreads) 
   {
     Scene* scene = (Scene*) hscene;
@@ -259,6 +319,9 @@ namespace embree
     _mm_setcsr(mxcsr | /* FTZ */ (1<<15) | /* DAZ */ (1<<6));
 #endif
     
+    /* wait for pending asynchronous commit */
+    scene->finishAsyncCommit();
+
      /* perform scene build */
     scene->build(threadID,numThreads);
 
@@ -270,6 +333,28 @@ namespace embree
     RTCORE_CATCH_END(scene->device);
   }
 
+  RTCORE_API void rtcSaveScene (RTCScene hscene, const char* filename) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSaveScene);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_HANDLE(filename);
+    scene->save(filename);
+    RTCORE_CATCH_END(scene->device);
+  }
+
+  RTCORE_API void rtcLoadScene (RTCScene hscene, const char* filename) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcLoadScene);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_HANDLE(filename);
+    scene->load(filename);
+    RTCORE_CATCH_END(scene->device);
+  }
+
   RTCORE_API void rtcGetBounds(RTCScene hscene, RTCBounds& bounds_o)
   {
     Scene* scene = (Scene*) hscene;
@@ -466,6 +551,24 @@ namespace embree
     RTCORE_CATCH_END(scene->device);
   }
 
+  RTCORE_API void rtcIntersectCamera (RTCScene hscene, const RTCCamera& camera, const unsigned x0, const unsigned y0, const unsigned width, const unsigned height, RTCCameraHits& hits) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcIntersectCamera);
+#if defined(DEBUG)
+    RTCORE_VERIFY_HANDLE(hscene);
+    if (scene->isModified()) throw_RTCError(RTC_INVALID_OPERATION,"scene got not committed");
+#endif
+    if (hits.geomID == nullptr) throw_RTCError(RTC_INVALID_ARGUMENT,"hits.geomID is required");
+    if (hits.stride & 0x03) throw_RTCError(RTC_INVALID_ARGUMENT,"hits.stride not aligned to 4 bytes");
+    STAT3(normal.travs,1,width*height,width*height);
+
+    scene->device->rayStreamFilters.intersectCamera(scene,camera,x0,y0,width,height,hits);
+
+    RTCORE_CATCH_END(scene->device);
+  }
+
 
 
 #endif
@@ -694,6 +797,24 @@ namespace embree
     return -1;
   }
 
+  RTCORE_API unsigned rtcNewLazyInstance (RTCScene htarget, RTCScene hsource, const RTCBounds& bounds, RTCLazyCreateFunc func, void* ptr) 
+  {
+    Scene* target = (Scene*) htarget;
+    Scene* source = (Scene*) hsource;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcNewLazyInstance);
+    RTCORE_VERIFY_HANDLE(htarget);
+    RTCORE_VERIFY_HANDLE(hsource);
+    if (target->device != source->device) throw_RTCError(RTC_INVALID_OPERATION,"scenes do not belong to the same device");
+    if (target == source) throw_RTCError(RTC_INVALID_OPERATION,"scene cannot instance itself");
+    const BBox3fa box(Vec3fa(bounds.lower_x,bounds.lower_y,bounds.lower_z),Vec3fa(bounds.upper_x,bounds.upper_y,bounds.upper_z));
+    if (!(box.lower.x <= box.upper.x && box.lower.y <= box.upper.y && box.lower.z <= box.upper.z))
+      throw_RTCError(RTC_INVALID_ARGUMENT,"invalid bounds");
+    return target->newLazyInstance(source,box,func,ptr);
+    RTCORE_CATCH_END(target->device);
+    return -1;
+  }
+
   /*RTCORE_API unsigned rtcNewGeometryInstance (RTCScene hscene, unsigned geomID) 
   {
     Scene* scene = (Scene*) hscene;
@@ -843,6 +964,73 @@ namespace embree
     return -1;
   }
 
+  RTCORE_API RTCSubdivTopology rtcDeviceNewSubdivTopology (RTCDevice hdevice, size_t numFaces, size_t numEdges, size_t numVertices, 
+                                                           size_t numEdgeCreases, size_t numVertexCreases, size_t numHoles) 
+  {
+    Device* device = (Device*) hdevice;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcDeviceNewSubdivTopology);
+    RTCORE_VERIFY_HANDLE(hdevice);
+    SubdivTopology* topology = new SubdivTopology(device,numFaces,numEdges,numVertices,numEdgeCreases,numVertexCreases,numHoles);
+    topology->refInc();
+    return (RTCSubdivTopology) topology;
+    RTCORE_CATCH_END(device);
+    return nullptr;
+  }
+
+  RTCORE_API void rtcSetSubdivTopologyBuffer (RTCSubdivTopology htopology, RTCBufferType type, const void* ptr, size_t offset, size_t stride) 
+  {
+    SubdivTopology* topology = (SubdivTopology*) htopology;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetSubdivTopologyBuffer);
+    RTCORE_VERIFY_HANDLE(htopology);
+    topology->setBuffer(type,(void*)ptr,offset,stride);
+    RTCORE_CATCH_END(topology->device);
+  }
+
+  RTCORE_API void rtcSetSubdivTopologyBoundaryMode (RTCSubdivTopology htopology, RTCBoundaryMode mode) 
+  {
+    SubdivTopology* topology = (SubdivTopology*) htopology;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetSubdivTopologyBoundaryMode);
+    RTCORE_VERIFY_HANDLE(htopology);
+    topology->setBoundaryMode(mode);
+    RTCORE_CATCH_END(topology->device);
+  }
+
+  RTCORE_API void rtcCommitSubdivTopology (RTCSubdivTopology htopology) 
+  {
+    SubdivTopology* topology = (SubdivTopology*) htopology;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcCommitSubdivTopology);
+    RTCORE_VERIFY_HANDLE(htopology);
+    topology->commit();
+    RTCORE_CATCH_END(topology->device);
+  }
+
+  RTCORE_API void rtcDeleteSubdivTopology (RTCSubdivTopology htopology) 
+  {
+    SubdivTopology* topology = (SubdivTopology*) htopology;
+    Device* device = topology ? topology->device : nullptr;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcDeleteSubdivTopology);
+    RTCORE_VERIFY_HANDLE(htopology);
+    topology->refDec();
+    RTCORE_CATCH_END(device);
+  }
+
+  RTCORE_API unsigned rtcNewSubdivisionMeshWithTopology (RTCScene hscene, RTCGeometryFlags flags, RTCSubdivTopology htopology, size_t numTimeSteps) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcNewSubdivisionMeshWithTopology);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_HANDLE(htopology);
+    return scene->newSubdivisionMesh(flags,(SubdivTopology*)htopology,numTimeSteps);
+    RTCORE_CATCH_END(scene->device);
+    return -1;
+  }
+
   RTCORE_API void rtcSetMask (RTCScene hscene, unsigned geomID, int mask) 
   {
     Scene* scene = (Scene*) hscene;
@@ -932,6 +1120,17 @@ namespace embree
     RTCORE_CATCH_END(scene->device);
   }
 
+  RTCORE_API void rtcUpdateBufferRange (RTCScene hscene, unsigned geomID, RTCBufferType type, size_t offset, size_t num) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcUpdateBufferRange);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_GEOMID(geomID);
+    scene->get_locked(geomID)->updateBufferRange(type,offset,num);
+    RTCORE_CATCH_END(scene->device);
+  }
+
   RTCORE_API void rtcDisable (RTCScene hscene, unsigned geomID) 
   {
     Scene* scene = (Scene*) hscene;
@@ -965,6 +1164,39 @@ namespace embree
     RTCORE_CATCH_END(scene->device);
   }
 
+  RTCORE_API void rtcSetTessellationCamera (RTCScene hscene, unsigned geomID, const RTCCamera* camera, float pixelsPerEdge)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetTessellationCamera);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_GEOMID(geomID);
+    scene->get_locked(geomID)->setTessellationCamera(camera,pixelsPerEdge);
+    RTCORE_CATCH_END(scene->device);
+  }
+
+  RTCORE_API void rtcSetCurveBasis (RTCScene hscene, unsigned geomID, RTCCurveBasis basis)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetCurveBasis);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_GEOMID(geomID);
+    scene->get_locked(geomID)->setCurveBasis(basis);
+    RTCORE_CATCH_END(scene->device);
+  }
+
+  RTCORE_API void rtcSetOpacityMicroMapLevel (RTCScene hscene, unsigned geomID, unsigned level)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetOpacityMicroMapLevel);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_GEOMID(geomID);
+    scene->get_locked(geomID)->setOpacityMicroMapLevel(level);
+    RTCORE_CATCH_END(scene->device);
+  }
+
   RTCORE_API void rtcSetUserData (RTCScene hscene, unsigned geomID, void* ptr) 
   {
     Scene* scene = (Scene*) hscene;
@@ -1021,6 +1253,17 @@ namespace embree
     RTCORE_CATCH_END(scene->device);
   }
 
+  RTCORE_API void rtcSetDisplacementFunctionN (RTCScene hscene, unsigned geomID, RTCDisplacementFuncN func, RTCDisplacementFlags flags)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetDisplacementFunctionN);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_GEOMID(geomID);
+    scene->get_locked(geomID)->setDisplacementFunctionN(func,flags);
+    RTCORE_CATCH_END(scene->device);
+  }
+
   RTCORE_API void rtcSetIntersectFunction (RTCScene hscene, unsigned geomID, RTCIntersectFunc intersect) 
   {
     Scene* scene = (Scene*) hscene;
@@ -1205,6 +1448,17 @@ namespace embree
   }
 #endif
 
+  RTCORE_API void rtcSetFilterBatching (RTCScene hscene, unsigned geomID, bool enable) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetFilterBatching);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_GEOMID(geomID);
+    scene->get_locked(geomID)->setFilterBatching(enable);
+    RTCORE_CATCH_END(scene->device);
+  }
+
   RTCORE_API void rtcInterpolate(RTCScene hscene, unsigned geomID, unsigned primID, float u, float v, 
                                  RTCBufferType buffer,
                                  float* P, float* dPdu, float* dPdv, size_t numFloats)
@@ -64,6 +64,14 @@ namespace embree
     return rtcDeviceGetParameter1i(device,parm);
   }
 
+  extern "C" void ispcDeviceGetStatistics(RTCDevice device, RTCStatistics* stats) {
+    rtcDeviceGetStatistics(device,stats);
+  }
+
+  extern "C" void ispcDeviceClearStatistics(RTCDevice device) {
+    rtcDeviceClearStatistics(device);
+  }
+
   extern "C" RTCError ispcGetError() {
     return rtcGetError();
   }
@@ -116,6 +124,22 @@ namespace embree
     return rtcCommitThread(scene,threadID,numThreads);
   }
 
+  extern "C" void ispcCommitAsync (RTCScene scene, void* func, void* ptr) {
+    return rtcCommitAsync(scene,(RTCCommitCompleteFunc)func,ptr);
+  }
+
+  extern "C" void ispcEvictLazyInstances (RTCScene scene, size_t maxBytes) {
+    rtcEvictLazyInstances(scene,maxBytes);
+  }
+
+  extern "C" void ispcSaveScene (RTCScene scene, const char* filename) {
+    rtcSaveScene(scene,filename);
+  }
+
+  extern "C" void ispcLoadScene (RTCScene scene, const char* filename) {
+    rtcLoadScene(scene,filename);
+  }
+
   extern "C" void ispcGetBounds(RTCScene scene, RTCBounds& bounds_o) {
     rtcGetBounds(scene,bounds_o);
   }
@@ -145,6 +169,11 @@ namespace embree
   {
     rtcIntersectN_SOA(scene,rayN,N,streams,offset,flags);
   }
+
+  extern "C" void ispcIntersectCamera (RTCScene scene, const RTCCamera& camera, const unsigned x0, const unsigned y0, const unsigned width, const unsigned height, RTCCameraHits& hits)
+  {
+    rtcIntersectCamera(scene,camera,x0,y0,width,height,hits);
+  }
   
   extern "C" void ispcOccluded1 (RTCScene scene, RTCRay& ray) {
     rtcOccluded(scene,ray);
@@ -184,6 +213,10 @@ namespace embree
     return rtcNewInstance2(target,source,numTimeSteps);
   }
 
+  extern "C" unsigned ispcNewLazyInstance (RTCScene target, RTCScene source, const RTCBounds& bounds, void* func, void* ptr) {
+    return rtcNewLazyInstance(target,source,bounds,(RTCLazyCreateFunc)func,ptr);
+  }
+
   /*extern "C" unsigned ispcNewGeometryInstance (RTCScene scene, unsigned geomID) {
     return rtcNewGeometryInstance(scene,geomID);
     }*/
@@ -226,6 +259,32 @@ namespace embree
     return rtcNewSubdivisionMesh(scene,flags,numFaces,numEdges,numVertices,numEdgeCreases,numVertexCreases,numHoles,numTimeSteps);
   }
 
+  extern "C" RTCSubdivTopology ispcNewSubdivTopology (RTCDevice device, size_t numFaces, size_t numEdges, size_t numVertices, 
+                                                      size_t numEdgeCreases, size_t numVertexCreases, size_t numHoles) 
+  {
+    return rtcDeviceNewSubdivTopology(device,numFaces,numEdges,numVertices,numEdgeCreases,numVertexCreases,numHoles);
+  }
+
+  extern "C" void ispcSetSubdivTopologyBuffer(RTCSubdivTopology topology, RTCBufferType type, const void* ptr, size_t offset, size_t stride) {
+    rtcSetSubdivTopologyBuffer(topology,type,ptr,offset,stride);
+  }
+
+  extern "C" void ispcSetSubdivTopologyBoundaryMode (RTCSubdivTopology topology, RTCBoundaryMode mode) {
+    rtcSetSubdivTopologyBoundaryMode(topology,mode);
+  }
+
+  extern "C" void ispcCommitSubdivTopology (RTCSubdivTopology topology) {
+    rtcCommitSubdivTopology(topology);
+  }
+
+  extern "C" void ispcDeleteSubdivTopology (RTCSubdivTopology topology) {
+    rtcDeleteSubdivTopology(topology);
+  }
+
+  extern "C" unsigned ispcNewSubdivisionMeshWithTopology (RTCScene scene, RTCGeometryFlags flags, RTCSubdivTopology topology, size_t numTimeSteps) {
+    return rtcNewSubdivisionMeshWithTopology(scene,flags,topology,numTimeSteps);
+  }
+
   extern "C" void ispcSetRayMask (RTCScene scene, unsigned geomID, int mask) {
     rtcSetMask(scene,geomID,mask);
   }
@@ -257,6 +316,10 @@ namespace embree
   extern "C" void ispcUpdateBuffer (RTCScene scene, unsigned geomID, RTCBufferType type) {
     rtcUpdateBuffer(scene,geomID,type);
   }
+
+  extern "C" void ispcUpdateBufferRange (RTCScene scene, unsigned geomID, RTCBufferType type, size_t offset, size_t num) {
+    rtcUpdateBufferRange(scene,geomID,type,offset,num);
+  }
   
   extern "C" void ispcDisable (RTCScene scene, unsigned geomID) {
     rtcDisable(scene,geomID);
@@ -269,6 +332,18 @@ namespace embree
   extern "C" void ispcSetTessellationRate (RTCScene hscene, unsigned geomID, float tessellationRate) {
     rtcSetTessellationRate(hscene,geomID,tessellationRate);
   }
+
+  extern "C" void ispcSetTessellationCamera (RTCScene hscene, unsigned geomID, const RTCCamera* camera, float pixelsPerEdge) {
+    rtcSetTessellationCamera(hscene,geomID,camera,pixelsPerEdge);
+  }
+
+  extern "C" void ispcSetCurveBasis (RTCScene hscene, unsigned geomID, RTCCurveBasis basis) {
+    rtcSetCurveBasis(hscene,geomID,basis);
+  }
+
+  extern "C" void ispcSetOpacityMicroMapLevel (RTCScene hscene, unsigned geomID, unsigned level) {
+    rtcSetOpacityMicroMapLevel(hscene,geomID,level);
+  }
     
   extern "C" void ispcSetUserData (RTCScene hscene, unsigned geomID, void* ptr) 
   {
@@ -477,6 +552,10 @@ namespace embree
     RTCORE_CATCH_END(scene->device);
   }
 
+  extern "C" void ispcSetFilterBatching (RTCScene hscene, unsigned geomID, bool enable) {
+    rtcSetFilterBatching(hscene,geomID,enable);
+  }
+
   extern "C" void ispcSetDisplacementFunction (RTCScene hscene, unsigned int geomID, void* func, RTCBounds* bounds)
   {
     Scene* scene = (Scene*) hscene;
@@ -487,6 +566,17 @@ namespace embree
     ((Scene*)scene)->get_locked(geomID)->setDisplacementFunction((RTCDisplacementFunc)func,bounds);
     RTCORE_CATCH_END(scene->device);
   }
+
+  extern "C" void ispcSetDisplacementFunctionN (RTCScene hscene, unsigned int geomID, void* func, RTCDisplacementFlags flags)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetDisplacementFunctionN);
+    RTCORE_VERIFY_HANDLE(scene);
+    RTCORE_VERIFY_GEOMID(geomID);
+    ((Scene*)scene)->get_locked(geomID)->setDisplacementFunctionN((RTCDisplacementFuncN)func,flags);
+    RTCORE_CATCH_END(scene->device);
+  }
   
   extern "C" void ispcInterpolateN(RTCScene scene, unsigned int geomID, 
                                    const void* valid, const unsigned int* primIDs, const float* u, const float* v, size_t numUVs, 
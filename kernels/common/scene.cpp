@@ -15,6 +15,8 @@
 // ======================================================================== //
 
 #include "scene.h"
+#include "scene_subdiv_topology.h"
+#include "version.h"
 
 #if !defined(__MIC__)
 #include "../xeon/bvh/bvh4_factory.h"
@@ -39,11 +41,15 @@ namespace embree
 /* number of created scene */
   AtomicCounter Scene::numScenes = 0;
 
+  /* number of eviction rounds of lazily instanced scenes */
+  AtomicCounter Scene::lazyEvictions = 0;
+
   Scene::Scene (Device* device, RTCSceneFlags sflags, RTCAlgorithmFlags aflags)
     : device(device), 
       Accel(AccelData::TY_UNKNOWN),
-      flags(sflags), aflags(aflags), numMappedBuffers(0), is_build(false), modified(true), 
-      needTriangleIndices(false), needTriangleVertices(false), 
+      flags(sflags), accelFlags(sflags), aflags(aflags), numMappedBuffers(0), is_build(false), modified(true), 
+      nativeTriangleAccel(nullptr), nativeInstanceAccel(nullptr), nativeInstanceable(false), nativeInstanceDepth(0),
+      needTriangleIndices(false), needTriangleVertices(false), needCompressedTriangles(false), 
       needQuadIndices(false), needQuadVertices(false), 
       needBezierIndices(false), needBezierVertices(false),
       needLineIndices(false), needLineVertices(false),
@@ -51,7 +57,9 @@ namespace embree
       numIntersectionFilters4(0), numIntersectionFilters8(0), numIntersectionFilters16(0),numIntersectionFiltersN(0),
       commitCounter(0), commitCounterSubdiv(0), 
       progress_monitor_function(nullptr), progress_monitor_ptr(nullptr), progress_monitor_counter(0),
-      progressInterface(this)
+      progressInterface(this),
+      prevAccels(nullptr), asyncCommitThread(nullptr), asyncCommitFunc(nullptr), asyncCommitPtr(nullptr), asyncIntersectors(nullptr), asyncNumDeletedGeometries(0),
+      lazy(false), lazyCreate(nullptr), lazyCreatePtr(nullptr), lazyState(LAZY_VALID), lazyReached(true), lazyLastReached(0)
   {
 #if defined(TASKING_LOCKSTEP) 
     lockstep_scheduler.taskBarrier.init(MAX_THREADS);
@@ -141,6 +149,18 @@ namespace embree
     else throw_RTCError(RTC_INVALID_ARGUMENT,"unknown accel "+device->tri_accel);
     
 #else
+    createAccels();
+#endif
+
+    /* increment number of scenes */
+    numScenes++;
+  }
+
+#if !defined(__MIC__)
+
+  void Scene::createAccels()
+  {
+    accelFlags = flags;
     createTriangleAccel();
     createTriangleMBAccel();
     createQuadAccel();
@@ -150,16 +170,35 @@ namespace embree
     createHairMBAccel();
     createLineAccel();
     createLineMBAccel();
-    accels.add(device->bvh4_factory->BVH4InstancedBVH4Triangle4ObjectSplit(this));
+    accels.add(nativeInstanceAccel = device->bvh4_factory->BVH4InstancedBVH4Triangle4ObjectSplit(this));
     accels.add(device->bvh4_factory->BVH4UserGeometry(this)); // has to be the last as the instID field of a hit instance is not invalidated by other hit geometry
     accels.add(device->bvh4_factory->BVH4UserGeometryMB(this)); // has to be the last as the instID field of a hit instance is not invalidated by other hit geometry
-#endif
-
-    /* increment number of scenes */
-    numScenes++;
   }
 
-#if !defined(__MIC__)
+  bool Scene::degradeAccels()
+  {
+    /* explicitly selected acceleration structures are never changed */
+    if (device->tri_accel != "default" || device->quad_accel != "default" || device->hair_accel != "default" || device->line_accel != "default")
+      return false;
+
+    /* first drop spatial splits, then switch to the compact index based layouts */
+    RTCSceneFlags degradedFlags = accelFlags;
+    if      ( embree::isHighQuality(accelFlags)) degradedFlags = (RTCSceneFlags) (accelFlags & ~RTC_SCENE_HIGH_QUALITY);
+    else if (!embree::isCompact(accelFlags))     degradedFlags = (RTCSceneFlags) (accelFlags |  RTC_SCENE_COMPACT);
+    else return false;
+
+    if (device->verbosity(1)) 
+      std::cout << "memory budget exceeded, rebuilding scene with flags: compact = " << embree::isCompact(degradedFlags) << " high quality = " << embree::isHighQuality(degradedFlags) << std::endl;
+
+    /* the degraded flags only select the acceleration structures, the scene keeps the flags of the application */
+    const RTCSceneFlags sceneFlags = flags;
+    flags = degradedFlags;
+    accels.reset();
+    nativeTriangleAccel = nativeInstanceAccel = nullptr;
+    createAccels();
+    flags = sceneFlags;
+    return true;
+  }
 
   void Scene::createTriangleAccel()
   {
@@ -169,6 +208,14 @@ namespace embree
         int mode =  2*(int)isCompact() + 1*(int)isRobust(); 
         switch (mode) {
         case /*0b00*/ 0: 
+          /* instanced scenes use a BVH4 the instancing BVH can directly link to */
+          if (isInstanced()) 
+          {
+            if (isHighQuality()) nativeTriangleAccel = device->bvh4_factory->BVH4Triangle4SpatialSplit(this);
+            else                 nativeTriangleAccel = device->bvh4_factory->BVH4Triangle4ObjectSplit(this);
+            accels.add(nativeTriangleAccel);
+            break;
+          }
 #if defined (__TARGET_AVX__)
           if (device->hasISA(AVX))
 	  {
@@ -202,10 +249,12 @@ namespace embree
     else if (device->tri_accel == "bvh4.triangle4")       accels.add(device->bvh4_factory->BVH4Triangle4(this));
     else if (device->tri_accel == "bvh4.triangle4v")      accels.add(device->bvh4_factory->BVH4Triangle4v(this));
     else if (device->tri_accel == "bvh4.triangle4i")      accels.add(device->bvh4_factory->BVH4Triangle4i(this));
+    else if (device->tri_accel == "bvh4.triangle4c")      accels.add(device->bvh4_factory->BVH4Triangle4c(this));
 
 #if defined (__TARGET_AVX__)
     else if (device->tri_accel == "bvh4.triangle8")       accels.add(device->bvh4_factory->BVH4Triangle8(this));
     else if (device->tri_accel == "bvh8.triangle4")       accels.add(device->bvh8_factory->BVH8Triangle4(this));
+    else if (device->tri_accel == "bvh8.triangle4.compressed") accels.add(device->bvh8_factory->BVH8Triangle4Compressed(this));
     else if (device->tri_accel == "bvh8.triangle8")       accels.add(device->bvh8_factory->BVH8Triangle8(this));
 #endif
     else throw_RTCError(RTC_INVALID_ARGUMENT,"unknown triangle acceleration structure "+device->tri_accel);
@@ -330,9 +379,11 @@ namespace embree
     else if (device->hair_accel == "bvh4.bezier1i"    ) accels.add(device->bvh4_factory->BVH4Bezier1i(this));
     else if (device->hair_accel == "bvh4obb.bezier1v" ) accels.add(device->bvh4_factory->BVH4OBBBezier1v(this,false));
     else if (device->hair_accel == "bvh4obb.bezier1i" ) accels.add(device->bvh4_factory->BVH4OBBBezier1i(this,false));
+    else if (device->hair_accel == "bvh4obb.bezier4v" ) accels.add(device->bvh4_factory->BVH4OBBBezier4v(this,false));
 #if defined (__TARGET_AVX__)
     else if (device->hair_accel == "bvh8obb.bezier1v" ) accels.add(device->bvh8_factory->BVH8OBBBezier1v(this,false));
     else if (device->hair_accel == "bvh8obb.bezier1i" ) accels.add(device->bvh8_factory->BVH8OBBBezier1i(this,false));
+    else if (device->hair_accel == "bvh8obb.bezier8v" ) accels.add(device->bvh8_factory->BVH8OBBBezier8v(this,false));
 #endif
     else throw_RTCError(RTC_INVALID_ARGUMENT,"unknown hair acceleration structure "+device->hair_accel);
   }
@@ -436,6 +487,8 @@ namespace embree
 
   Scene::~Scene () 
   {
+    finishAsyncCommit();
+
     for (size_t i=0; i<geometries.size(); i++)
       delete geometries[i];
 
@@ -462,6 +515,25 @@ namespace embree
     return geom->id;
   }
   
+  unsigned Scene::newLazyInstance (Scene* scene, const BBox3fa& bounds, RTCLazyCreateFunc func, void* ptr) 
+  {
+    /* all lazy instances of a scene share its build state, thus they have to use the same create function */
+    if (scene->lazy && (scene->lazyCreate != func || scene->lazyCreatePtr != ptr))
+      throw_RTCError(RTC_INVALID_OPERATION,"scene is already lazily instanced with a different create function");
+
+    if (!scene->lazy) {
+      scene->lazyCreate = func;
+      scene->lazyCreatePtr = ptr;
+      scene->lazyState = LAZY_INVALID;
+      scene->lazy = true;
+    }
+
+    Instance* instance = new Instance(this,scene,1);
+    instance->lazy = true;
+    instance->lazyBounds = bounds;
+    return instance->id;
+  }
+  
   unsigned Scene::newGeometryInstance (Geometry* geom) {
     Geometry* instance = new GeometryInstance(this,geom);
     return instance->id;
@@ -474,10 +546,17 @@ namespace embree
       return -1;
     }
 
+#if defined(__MIC__)
     if (numTimeSteps == 0 || numTimeSteps > 2) {
       throw_RTCError(RTC_INVALID_OPERATION,"only 1 or 2 time steps supported");
       return -1;
     }
+#else
+    if (numTimeSteps == 0 || numTimeSteps > RTC_MAX_TIME_STEPS) {
+      throw_RTCError(RTC_INVALID_OPERATION,"only 1 to RTC_MAX_TIME_STEPS time steps supported");
+      return -1;
+    }
+#endif
     
     Geometry* geom = new TriangleMesh(this,gflags,numTriangles,numVertices,numTimeSteps);
     return geom->id;
@@ -490,10 +569,17 @@ namespace embree
       return -1;
     }
 
+#if defined(__MIC__)
     if (numTimeSteps == 0 || numTimeSteps > 2) {
       throw_RTCError(RTC_INVALID_OPERATION,"only 1 or 2 time steps supported");
       return -1;
     }
+#else
+    if (numTimeSteps == 0 || numTimeSteps > RTC_MAX_TIME_STEPS) {
+      throw_RTCError(RTC_INVALID_OPERATION,"only 1 to RTC_MAX_TIME_STEPS time steps supported");
+      return -1;
+    }
+#endif
     
     Geometry* geom = new QuadMesh(this,gflags,numQuads,numVertices,numTimeSteps);
     return geom->id;
@@ -521,6 +607,39 @@ namespace embree
     return geom->id;
   }
 
+  unsigned Scene::newSubdivisionMesh (RTCGeometryFlags gflags, SubdivTopology* topology, size_t numTimeSteps) 
+  {
+    if (isStatic() && (gflags != RTC_GEOMETRY_STATIC)) {
+      throw_RTCError(RTC_INVALID_OPERATION,"static scenes can only contain static geometries");
+      return -1;
+    }
+
+    if (numTimeSteps == 0 || numTimeSteps > 2) {
+      throw_RTCError(RTC_INVALID_OPERATION,"only 1 or 2 time steps supported");
+      return -1;
+    }
+
+    if (topology->device != device) {
+      throw_RTCError(RTC_INVALID_ARGUMENT,"topology belongs to a different device");
+      return -1;
+    }
+
+    if (!topology->isCommitted()) {
+      throw_RTCError(RTC_INVALID_OPERATION,"topology has to get committed first");
+      return -1;
+    }
+
+    const size_t numFaces = topology->numFaces, numEdges = topology->numEdges, numVertices = topology->numVertices;
+    Geometry* geom = nullptr;
+#if defined(__TARGET_AVX__)
+    if (device->hasISA(AVX))
+      geom = new SubdivMeshAVX(this,gflags,numFaces,numEdges,numVertices,0,0,0,numTimeSteps,topology);
+    else 
+#endif
+      geom = new SubdivMesh(this,gflags,numFaces,numEdges,numVertices,0,0,0,numTimeSteps,topology);
+    return geom->id;
+  }
+
 
   unsigned Scene::newBezierCurves (RTCGeometryFlags gflags, size_t numCurves, size_t numVertices, size_t numTimeSteps) 
   {
@@ -579,29 +698,60 @@ namespace embree
       throw_RTCError(RTC_INVALID_OPERATION,"invalid geometry ID");
 
     Geometry* geometry = geometries[geomID];
-    if (geometry == nullptr)
+    if (geometry == nullptr || std::find(deletedGeometries.begin(),deletedGeometries.end(),geomID) != deletedGeometries.end())
       throw_RTCError(RTC_INVALID_OPERATION,"invalid geometry");
     
+    /* the geometry gets released at the next commit, as an
+     * asynchronous commit keeps tracing the previous acceleration
+     * structures which may reference it until the build finished */
     geometry->disable();
-    accels.deleteGeometry(geomID);
-    usedIDs.push_back(geomID);
-    geometries[geomID] = nullptr;
-    delete geometry;
+    deletedGeometries.push_back(geomID);
+  }
+
+  void Scene::releaseDeletedGeometries(size_t num)
+  {
+    Lock<AtomicMutex> lock(geometriesMutex);
+
+    for (size_t i=0; i<num; i++)
+    {
+      const size_t geomID = deletedGeometries[i];
+      accels.deleteGeometry(geomID);
+      usedIDs.push_back(geomID);
+      delete geometries[geomID];
+      geometries[geomID] = nullptr;
+    }
+    deletedGeometries.erase(deletedGeometries.begin(),deletedGeometries.begin()+num);
   }
 
   void Scene::updateInterface()
   {
+    /* enable only algorithms choosen by application */
+    Accel::Intersectors newIntersectors = accels.intersectors;
+    if ((aflags & RTC_INTERSECT1) == 0) newIntersectors.intersector1 = Accel::Intersector1(&invalid_rtcIntersect1);
+    if ((aflags & RTC_INTERSECT4) == 0) newIntersectors.intersector4 = Accel::Intersector4(&invalid_rtcIntersect4);
+    if ((aflags & RTC_INTERSECT8) == 0) newIntersectors.intersector8 = Accel::Intersector8(&invalid_rtcIntersect8);
+    if ((aflags & RTC_INTERSECT16) == 0) newIntersectors.intersector16 = Accel::Intersector16(&invalid_rtcIntersect16);
+    if ((aflags & RTC_INTERSECTN) == 0) newIntersectors.intersectorN = Accel::IntersectorN(&invalid_rtcIntersectN);
+
+    /* during an asynchronous commit the scene may still get traced
+     * through the previous acceleration structures, thus publish the
+     * new intersectors by swapping the pointer rays get forwarded
+     * through, they get installed directly once the commit finished */
+    if (asyncIntersectors) 
+    {
+      bounds = accels.bounds;
+      publishCompressedTriangleMeshes();
+      asyncIntersectorsBuffer[1] = newIntersectors;
+      __memory_barrier();
+      asyncIntersectors = &asyncIntersectorsBuffer[1];
+      commitCounter++;
+      return;
+    }
+
     /* update bounds */
     is_build = true;
     bounds = accels.bounds;
-    intersectors = accels.intersectors;
-
-    /* enable only algorithms choosen by application */
-    if ((aflags & RTC_INTERSECT1) == 0) intersectors.intersector1 = Accel::Intersector1(&invalid_rtcIntersect1);
-    if ((aflags & RTC_INTERSECT4) == 0) intersectors.intersector4 = Accel::Intersector4(&invalid_rtcIntersect4);
-    if ((aflags & RTC_INTERSECT8) == 0) intersectors.intersector8 = Accel::Intersector8(&invalid_rtcIntersect8);
-    if ((aflags & RTC_INTERSECT16) == 0) intersectors.intersector16 = Accel::Intersector16(&invalid_rtcIntersect16);
-    if ((aflags & RTC_INTERSECTN) == 0) intersectors.intersectorN = Accel::IntersectorN(&invalid_rtcIntersectN);
+    intersectors = newIntersectors;
 
     /* update commit counter */
     commitCounter++;
@@ -613,19 +763,266 @@ namespace embree
 #endif
   }
 
+  void Scene::updateNativeInstances()
+  {
+#if !defined(__MIC__)
+    /* instances of this scene can get traversed natively if this scene
+     * is static, uses a BVH4 over Triangle4 primitives, and contains
+     * only triangle meshes without motion blur and native instances */
+    nativeInstances.clear();
+    nativeInstanceable = isStatic() && nativeTriangleAccel != nullptr;
+    nativeInstanceDepth = 0;
+
+    for (size_t i=0; i<geometries.size(); i++) 
+    {
+      Geometry* geom = geometries[i];
+      if (geom == nullptr || !geom->isEnabled()) continue;
+
+      /* instances of natively instanceable scenes get linked into the instancing BVH */
+      Scene* object = geom->getInstancedScene();
+      if (object) 
+      {
+        Instance* instance = (Instance*) geom;
+        instance->native = !instance->lazy && instance->numTimeSteps == 1 && object->nativeInstanceable && object->nativeInstanceDepth < RTC_MAX_INSTANCE_DEPTH;
+        if (instance->native) {
+          nativeInstances.push_back(instance);
+          nativeInstanceDepth = max(nativeInstanceDepth,object->nativeInstanceDepth+1);
+          continue;
+        }
+      }
+
+      if (geom->getType() != Geometry::TRIANGLE_MESH || geom->numTimeSteps != 1)
+        nativeInstanceable = false;
+    }
+#endif
+  }
+
+  void Scene::compressTriangleMeshes()
+  {
+    if (!needCompressedTriangles) return;
+
+    for (size_t i=0; i<geometries.size(); i++) 
+    {
+      TriangleMesh* mesh = getSafe<TriangleMesh>(i);
+      if (mesh == nullptr || !mesh->isEnabled()) continue;
+      if (mesh->isModified() || !mesh->hasCompressedTriangles())
+        mesh->compressTriangles();
+    }
+
+    /* during an asynchronous commit the encoding gets published together with the acceleration structures */
+    if (prevAccels == nullptr)
+      publishCompressedTriangleMeshes();
+  }
+
+  void Scene::publishCompressedTriangleMeshes()
+  {
+    if (!needCompressedTriangles) return;
+
+    for (size_t i=0; i<geometries.size(); i++) 
+    {
+      TriangleMesh* mesh = getSafe<TriangleMesh>(i);
+      if (mesh == nullptr || !mesh->isEnabled()) continue;
+      mesh->publishCompressedTriangles();
+    }
+  }
+
+  void Scene::lazyCommit()
+  {
+    /* the first ray creates the geometry of the scene, rays arriving meanwhile wait for it */
+    if (atomic_cmpxchg(&lazyState,LAZY_INVALID,LAZY_CREATE) == LAZY_INVALID)
+    {
+      if (lazyCreate) lazyCreate(lazyCreatePtr,(RTCScene)this);
+      __memory_barrier();
+      lazyState = LAZY_COMMIT;
+    }
+    while (lazyState == LAZY_CREATE)
+      __pause_cpu();
+
+    /* rays waiting for a creation that failed miss the scene */
+    if (lazyState != LAZY_COMMIT) 
+      return;
+
+    /* all rays join the build, rays arriving after the build finished take its fast path */
+    bool failed = false;
+    try {
+      build(0,0);
+    } catch (std::bad_alloc&) {
+      device->process_error(RTC_OUT_OF_MEMORY,"out of memory");
+      failed = true;
+    } catch (rtcore_error& e) {
+      device->process_error(e.error,e.what());
+      failed = true;
+    }
+    __memory_barrier();
+
+    /* joining rays return before the failing ray got its exception, thus the scene is only valid if the build finished */
+    if (!failed) {
+      if (!isModified()) atomic_cmpxchg(&lazyState,LAZY_COMMIT,LAZY_VALID);
+      return;
+    }
+
+    /* a single failing ray releases the created geometry, such that the next ray reaching the scene creates it again */
+    if (atomic_cmpxchg(&lazyState,LAZY_COMMIT,LAZY_CREATE) != LAZY_COMMIT)
+      return;
+    lazyRelease();
+    __memory_barrier();
+    lazyState = LAZY_INVALID;
+  }
+
+  void Scene::lazyRelease()
+  {
+    Lock<MutexSys> buildLock(buildMutex);
+    Lock<AtomicMutex> lock(geometriesMutex);
+
+    /* the failed build cleared the acceleration structures, thus rays still traversing them reach no geometry */
+    is_build = false;
+    for (size_t i=0; i<geometries.size(); i++)
+    {
+      Geometry* geometry = geometries[i];
+      if (geometry == nullptr) continue;
+      accels.deleteGeometry(i);
+      geometry->disable();
+      delete geometry;
+    }
+    geometries.clear();
+    usedIDs.clear();
+    setModified();
+  }
+
+  void Scene::evict()
+  {
+    Lock<AtomicMutex> lock(geometriesMutex);
+
+    /* static scenes accept new geometry again until the next build */
+    is_build = false;
+    for (size_t i=0; i<geometries.size(); i++)
+    {
+      Geometry* geometry = geometries[i];
+      if (geometry == nullptr) continue;
+      geometry->disable();
+      delete geometry;
+    }
+    geometries.clear();
+    usedIDs.clear();
+
+    /* builders of static scenes got released after the build, thus the acceleration structures get recreated */
+#if !defined(__MIC__)
+    accels.reset();
+    nativeTriangleAccel = nativeInstanceAccel = nullptr;
+    createAccels();
+#else
+    accels.clear();
+#endif
+    intersectors = Accel::Intersectors(missing_rtcCommit);
+    setModified();
+    lazyState = LAZY_INVALID;
+  }
+
+  void Scene::evictLazyInstances(size_t maxBytes)
+  {
+    const size_t round = ++lazyEvictions;
+
+    /* gather the lazily instanced scenes, a scene can be referenced by multiple instances */
+    std::vector<Scene*> scenes;
+    for (size_t i=0; i<geometries.size(); i++)
+    {
+      Geometry* geom = geometries[i];
+      if (geom == nullptr || geom->getInstancedScene() == nullptr) continue;
+      if (((Instance*)geom)->lazy) scenes.push_back(geom->getInstancedScene());
+    }
+    std::sort(scenes.begin(),scenes.end());
+    scenes.erase(std::unique(scenes.begin(),scenes.end()),scenes.end());
+
+    /* scenes reached since the last eviction stay resident, only scenes that can get created again are evicted */
+    std::vector<Scene*> candidates;
+    for (size_t i=0; i<scenes.size(); i++)
+    {
+      Scene* scene = scenes[i];
+      if (scene->lazyReached) {
+        scene->lazyReached = false;
+        scene->lazyLastReached = round;
+      }
+      else if (scene->lazyCreate && scene->lazyState == LAZY_VALID)
+        candidates.push_back(scene);
+    }
+
+    /* evict least recently reached scenes first */
+    std::stable_sort(candidates.begin(),candidates.end(),[] (const Scene* a, const Scene* b) { return a->lazyLastReached < b->lazyLastReached; });
+    for (size_t i=0; i<candidates.size() && size_t(device->bytesUsed) > maxBytes; i++)
+    {
+      if (device->verbosity(2))
+        std::cout << "evicting lazily instanced scene " << candidates[i] << std::endl;
+      candidates[i]->evict();
+    }
+  }
+
+  /*! returns true if the exception reports that memory got exhausted */
+  static bool isOutOfMemory(const std::exception_ptr& except)
+  {
+    try {
+      std::rethrow_exception(except);
+    }
+    catch (const rtcore_error& e) {
+      return e.error == RTC_OUT_OF_MEMORY;
+    }
+    catch (const std::bad_alloc&) {
+      return true;
+    }
+    catch (...) {
+      return false;
+    }
+  }
+
   void Scene::build_task ()
   {
     progress_monitor_counter = 0;
 
+    /* deleted geometries are released after an asynchronous commit finished */
+    if (prevAccels == nullptr) 
+      releaseDeletedGeometries(deletedGeometries.size());
+
+    /* a previous build may have degraded the acceleration structures, thus try the configuration of the scene again */
+    if (accelFlags != flags) {
+      accels.reset();
+      nativeTriangleAccel = nativeInstanceAccel = nullptr;
+      createAccels();
+    }
+
+    /* link instances of natively instanceable scenes into the instancing BVH */
+    updateNativeInstances();
+
+    /* encode triangle indices for accels that decode them during traversal */
+    compressTriangleMeshes();
+
     /* select fast code path if no intersection filter is present */
     accels.select(numIntersectionFilters4,numIntersectionFilters8,numIntersectionFilters16,numIntersectionFiltersN);
   
-    /* build all hierarchies of this scene */
-    accels.build(0,0);
+    /* build all hierarchies of this scene, under a memory budget retry with less memory hungry structures */
+    while (true)
+    {
+      std::exception_ptr except = nullptr;
+      try {
+        accels.build(0,0);
+      } catch (...) {
+        except = std::current_exception();
+      }
+#if defined(TASKING_TBB_INTERNAL)
+      /* exceptions of build tasks only cancel the remaining tasks, thus fetch the original exception */
+      std::exception_ptr cancelled = TaskSchedulerTBB::take_cancelling_exception();
+      if (cancelled) except = cancelled;
+#endif
+      if (except == nullptr) break;
+      if (!device->memory_budget || !isOutOfMemory(except) || !degradeAccels())
+        std::rethrow_exception(except);
+      updateNativeInstances();
+      accels.select(numIntersectionFilters4,numIntersectionFilters8,numIntersectionFilters16,numIntersectionFiltersN);
+    }
     
     /* make static geometry immutable */
     if (isStatic()) 
     {
+      /* static scenes are read-only after commit, thus traversal can operate on NUMA node local copies */
+      if (device->numa_replication) accels.createReplicas(max(getNumberOfNumaNodes(),device->numa_replication));
       accels.immutable();
       for (size_t i=0; i<geometries.size(); i++)
         if (geometries[i]) geometries[i]->immutable();
@@ -674,6 +1071,16 @@ namespace embree
       return;
     }
 
+    /* deleted geometries are released after an asynchronous commit finished */
+    if (prevAccels == nullptr) 
+      releaseDeletedGeometries(deletedGeometries.size());
+
+    /* link instances of natively instanceable scenes into the instancing BVH */
+    updateNativeInstances();
+
+    /* encode triangle indices for accels that decode them during traversal */
+    compressTriangleMeshes();
+
     /* select fast code path if no intersection filter is present */
     accels.select(numIntersectionFilters4,numIntersectionFilters8,numIntersectionFilters16,numIntersectionFiltersN);
 
@@ -693,6 +1100,8 @@ namespace embree
     /* make static geometry immutable */
     if (isStatic()) 
     {
+      /* static scenes are read-only after commit, thus traversal can operate on NUMA node local copies */
+      if (device->numa_replication) accels.createReplicas(max(getNumberOfNumaNodes(),device->numa_replication));
       accels.immutable();
       for (size_t i=0; i<geometries.size(); i++)
         if (geometries[i]) geometries[i]->immutable();
@@ -763,6 +1172,7 @@ namespace embree
       scheduler->spawn_root([&]() { build_task(); this->scheduler = nullptr; }, 1, threadCount == 0);
     }
     catch (...) {
+      this->scheduler = nullptr;
       accels.clear();
       updateInterface();
       throw;
@@ -864,6 +1274,124 @@ namespace embree
   }
 #endif
 
+  static void asyncCommitThreadFunc(void* ptr)
+  {
+    Scene* scene = (Scene*) ptr;
+    RTCError error = RTC_NO_ERROR;
+    try {
+      scene->build(0,0);
+    } catch (std::bad_alloc&) {
+      scene->device->process_error(error = RTC_OUT_OF_MEMORY,"out of memory");
+    } catch (rtcore_error& e) {
+      scene->device->process_error(error = e.error,e.what());
+    } catch (std::exception& e) {
+      scene->device->process_error(error = RTC_UNKNOWN_ERROR,e.what());
+    } catch (...) {
+      scene->device->process_error(error = RTC_UNKNOWN_ERROR,"unknown exception caught");
+    }
+    if (scene->asyncCommitFunc)
+      scene->asyncCommitFunc(scene->asyncCommitPtr,(RTCScene)scene,error);
+  }
+
+  /* intersectors of a scene during an asynchronous commit, they
+   * forward to the intersectors of the published acceleration
+   * structures, which get swapped by a single pointer store */
+  static void asyncIntersect (void* ptr, RTCRay& ray) {
+    Accel::Intersectors* i = ((Scene*)(AccelData*)ptr)->asyncIntersectors; i->intersector1.intersect(i->local(),ray);
+  }
+  static void asyncIntersect4 (const void* valid, void* ptr, RTCRay4& ray) {
+    Accel::Intersectors* i = ((Scene*)(AccelData*)ptr)->asyncIntersectors; i->intersector4.intersect(valid,i->local(),ray);
+  }
+  static void asyncIntersect8 (const void* valid, void* ptr, RTCRay8& ray) {
+    Accel::Intersectors* i = ((Scene*)(AccelData*)ptr)->asyncIntersectors; i->intersector8.intersect(valid,i->local(),ray);
+  }
+  static void asyncIntersect16 (const void* valid, void* ptr, RTCRay16& ray) {
+    Accel::Intersectors* i = ((Scene*)(AccelData*)ptr)->asyncIntersectors; i->intersector16.intersect(valid,i->local(),ray);
+  }
+  static void asyncIntersectN (void* ptr, RTCRay** rayN, const size_t N, const size_t flags) {
+    Accel::Intersectors* i = ((Scene*)(AccelData*)ptr)->asyncIntersectors; i->intersectorN.intersect(i->local(),rayN,N,flags);
+  }
+  static void asyncOccluded (void* ptr, RTCRay& ray) {
+    Accel::Intersectors* i = ((Scene*)(AccelData*)ptr)->asyncIntersectors; i->intersector1.occluded(i->local(),ray);
+  }
+  static void asyncOccluded4 (const void* valid, void* ptr, RTCRay4& ray) {
+    Accel::Intersectors* i = ((Scene*)(AccelData*)ptr)->asyncIntersectors; i->intersector4.occluded(valid,i->local(),ray);
+  }
+  static void asyncOccluded8 (const void* valid, void* ptr, RTCRay8& ray) {
+    Accel::Intersectors* i = ((Scene*)(AccelData*)ptr)->asyncIntersectors; i->intersector8.occluded(valid,i->local(),ray);
+  }
+  static void asyncOccluded16 (const void* valid, void* ptr, RTCRay16& ray) {
+    Accel::Intersectors* i = ((Scene*)(AccelData*)ptr)->asyncIntersectors; i->intersector16.occluded(valid,i->local(),ray);
+  }
+  static void asyncOccludedN (void* ptr, RTCRay** rayN, const size_t N, const size_t flags) {
+    Accel::Intersectors* i = ((Scene*)(AccelData*)ptr)->asyncIntersectors; i->intersectorN.occluded(i->local(),rayN,N,flags);
+  }
+
+  void Scene::commitAsync (RTCCommitCompleteFunc func, void* ptr)
+  {
+    finishAsyncCommit();
+    Lock<MutexSys> lock(asyncCommitMutex);
+
+#if !defined(__MIC__)
+    /* build dynamic scenes into fresh acceleration structures and
+     * trace the previously committed ones until the build finished,
+     * static scenes cannot get rebuild and are build in place */
+    if (isBuild() && isModified() && !isStatic() && ready())
+    {
+      prevAccels = new AccelN;
+      for (size_t i=0; i<accels.accels.size(); i++)
+        prevAccels->add(accels.accels[i]);
+      prevAccels->updateValidAccels();
+
+      accels.accels.clear();
+      accels.validAccels.clear();
+      nativeTriangleAccel = nativeInstanceAccel = nullptr;
+      createAccels();
+
+      /* the committed intersectors keep operating on the previous acceleration structures */
+      asyncIntersectorsBuffer[0] = intersectors;
+      if (asyncIntersectorsBuffer[0].ptr == &accels) asyncIntersectorsBuffer[0].ptr = prevAccels;
+      asyncIntersectors = &asyncIntersectorsBuffer[0];
+      asyncNumDeletedGeometries = deletedGeometries.size();
+
+      intersectors = Accel::Intersectors();
+      intersectors.ptr = this;
+      intersectors.intersector1  = Accel::Intersector1 (&asyncIntersect,  &asyncOccluded,  "Scene::asyncIntersector1");
+      intersectors.intersector4  = Accel::Intersector4 (&asyncIntersect4, &asyncOccluded4, "Scene::asyncIntersector4");
+      intersectors.intersector8  = Accel::Intersector8 (&asyncIntersect8, &asyncOccluded8, "Scene::asyncIntersector8");
+      intersectors.intersector16 = Accel::Intersector16(&asyncIntersect16,&asyncOccluded16,"Scene::asyncIntersector16");
+      intersectors.intersectorN  = Accel::IntersectorN (&asyncIntersectN, &asyncOccludedN, "Scene::asyncIntersectorN");
+    }
+#endif
+
+    asyncCommitFunc = func;
+    asyncCommitPtr = ptr;
+    asyncCommitThread = createThread(asyncCommitThreadFunc,this);
+  }
+
+  void Scene::finishAsyncCommit ()
+  {
+    Lock<MutexSys> lock(asyncCommitMutex);
+    if (asyncCommitThread) {
+      join(asyncCommitThread);
+      asyncCommitThread = nullptr;
+    }
+    /* the previous acceleration structures are no longer traced,
+     * thus install the new intersectors directly again */
+    if (prevAccels) {
+      if (asyncIntersectors != &asyncIntersectorsBuffer[1]) // build failed before swapping
+        accels.clear();
+      asyncIntersectors = nullptr;
+      updateInterface();
+      delete prevAccels; 
+      prevAccels = nullptr;
+
+      /* geometries deleted after the commit started may still be referenced by the current acceleration structures */
+      releaseDeletedGeometries(asyncNumDeletedGeometries);
+      asyncNumDeletedGeometries = 0;
+    }
+  }
+
   void Scene::write(std::ofstream& file)
   {
     int magick = 0x35238765LL;
@@ -876,6 +1404,120 @@ namespace embree
     }
   }
 
+  /*! writes or verifies a signature of all geometries the stored acceleration structures refer to */
+  static void writeGeometrySignature(std::ostream& file, Scene* scene)
+  {
+    int numGeometries = scene->size();
+    file.write((char*)&numGeometries,sizeof(numGeometries));
+    for (size_t i=0; i<scene->size(); i++) 
+    {
+      Geometry* geom = scene->get(i);
+      int sig[3] = { -1, 0, 0 };
+      if (geom && geom->isEnabled()) {
+        sig[0] = geom->getType();
+        sig[1] = geom->numTimeSteps;
+        sig[2] = geom->size();
+      }
+      file.write((char*)sig,sizeof(sig));
+    }
+  }
+
+  static bool verifyGeometrySignature(std::istream& file, Scene* scene)
+  {
+    int numGeometries = 0;
+    file.read((char*)&numGeometries,sizeof(numGeometries));
+    if (!file.good() || numGeometries != scene->size()) return false;
+    for (size_t i=0; i<scene->size(); i++) 
+    {
+      Geometry* geom = scene->get(i);
+      int sig[3] = { -1, 0, 0 };
+      file.read((char*)sig,sizeof(sig));
+      if (geom && geom->isEnabled()) {
+        if (sig[0] != geom->getType()) return false;
+        if (sig[1] != geom->numTimeSteps) return false;
+        if (sig[2] != geom->size()) return false;
+      } 
+      else if (sig[0] != -1) return false;
+    }
+    return file.good();
+  }
+
+  static const int accelMagick = 0x45524231;
+
+  void Scene::save(const std::string& fileName)
+  {
+    finishAsyncCommit();
+    Lock<MutexSys> lock(buildMutex);
+    if (isModified()) 
+      throw_RTCError(RTC_INVALID_OPERATION,"scene got not committed");
+
+    std::ofstream file(fileName.c_str(),std::ios::binary);
+    if (!file.is_open()) 
+      throw_RTCError(RTC_INVALID_OPERATION,"cannot open file "+fileName);
+
+    int magick = accelMagick;
+    file.write((char*)&magick,sizeof(magick));
+    int version = __EMBREE_VERSION_NUMBER__;
+    file.write((char*)&version,sizeof(version));
+    writeGeometrySignature(file,this);
+    accels.save(file);
+
+    if (!file.good())
+      throw_RTCError(RTC_UNKNOWN_ERROR,"error writing file "+fileName);
+  }
+
+  void Scene::load(const std::string& fileName)
+  {
+    finishAsyncCommit();
+    Lock<MutexSys> lock(buildMutex);
+    if (!isStatic())
+      throw_RTCError(RTC_INVALID_OPERATION,"only static scenes can get loaded");
+    if (!ready()) 
+      throw_RTCError(RTC_INVALID_OPERATION,"not all buffers are unmapped");
+
+    std::ifstream file(fileName.c_str(),std::ios::binary);
+    if (!file.is_open()) 
+      throw_RTCError(RTC_INVALID_OPERATION,"cannot open file "+fileName);
+
+    int magick = 0, version = 0;
+    file.read((char*)&magick,sizeof(magick));
+    file.read((char*)&version,sizeof(version));
+    if (magick != accelMagick || version != __EMBREE_VERSION_NUMBER__)
+      throw_RTCError(RTC_INVALID_OPERATION,"invalid file "+fileName);
+    if (!verifyGeometrySignature(file,this))
+      throw_RTCError(RTC_INVALID_OPERATION,"geometries do not match stored scene");
+
+    /* encode triangle indices for accels that decode them during traversal */
+    compressTriangleMeshes();
+
+    /* select fast code path if no intersection filter is present */
+    accels.select(numIntersectionFilters4,numIntersectionFilters8,numIntersectionFilters16,numIntersectionFiltersN);
+
+    try {
+      accels.load(file);
+    }
+    catch (...) {
+      accels.clear();
+      updateInterface();
+      throw;
+    }
+
+    /* stored scenes contain no native instances, thus instances of such a scene cannot get traversed natively */
+    nativeInstanceable = false;
+
+    /* stored scenes are static, thus make geometry immutable */
+    if (device->numa_replication) accels.createReplicas(max(getNumberOfNumaNodes(),device->numa_replication));
+    accels.immutable();
+    for (size_t i=0; i<geometries.size(); i++) {
+      if (!geometries[i]) continue;
+      geometries[i]->immutable();
+      if (geometries[i]->isEnabled()) geometries[i]->clearModified();
+    }
+
+    updateInterface();
+    setModified(false);
+  }
+
   void Scene::setProgressMonitorFunction(RTCProgressMonitorFunc func, void* ptr) 
   {
     static MutexSys mutex;
@@ -43,6 +43,7 @@ namespace embree
   __forceinline bool isCoherent  (RTCSceneFlags flags) { return flags & RTC_SCENE_COHERENT; }
   __forceinline bool isIncoherent(RTCSceneFlags flags) { return flags & RTC_SCENE_INCOHERENT; }
   __forceinline bool isHighQuality(RTCSceneFlags flags) { return flags & RTC_SCENE_HIGH_QUALITY; }
+  __forceinline bool isInstanced (RTCSceneFlags flags) { return flags & RTC_SCENE_INSTANCED; }
   __forceinline bool isInterpolatable(RTCAlgorithmFlags flags) { return flags & RTC_INTERPOLATE; }
 
   /*! Base class all scenes are derived from */
@@ -66,7 +67,7 @@ namespace embree
         if (geom == nullptr) return nullptr;
         if (!all && !geom->isEnabled()) return nullptr;
         if (geom->getType() != Ty::geom_type) return nullptr;
-        if (geom->numTimeSteps != timeSteps) return nullptr;
+        if ((geom->numTimeSteps == 1) != (timeSteps == 1)) return nullptr; // timeSteps=2 selects all motion blurred geometries
         return (Ty*) geom;
       }
 
@@ -92,6 +93,17 @@ namespace embree
         }
         return ret;
       }
+
+      __forceinline size_t maxTimeSegments()
+      {
+        size_t ret = 1;
+        for (size_t i=0; i<scene->size(); i++) {
+          Ty* mesh = at(i);
+          if (mesh == nullptr) continue;
+          ret = max(ret,size_t(mesh->numTimeSteps-1));
+        }
+        return ret;
+      }
       
     private:
       Scene* scene;
@@ -113,6 +125,12 @@ namespace embree
     void createLineMBAccel();
     void createSubdivAccel();
 
+    /*! creates all acceleration structures of the scene */
+    void createAccels();
+
+    /*! recreates the acceleration structures using a less memory hungry configuration, returns false if no such configuration exists */
+    bool degradeAccels();
+
     /*! Scene destruction */
     ~Scene ();
     
@@ -125,6 +143,9 @@ namespace embree
     /*! Creates a new scene instance. */
     unsigned int newInstance (Scene* scene, size_t numTimeSteps);
 
+    /*! Creates a new lazy scene instance with user specified object space bounds. */
+    unsigned int newLazyInstance (Scene* scene, const BBox3fa& bounds, RTCLazyCreateFunc func, void* ptr);
+
     /*! Creates a new geometry instance. */
     unsigned int newGeometryInstance (Geometry* geom);
 
@@ -143,18 +164,62 @@ namespace embree
     /*! Creates a new subdivision mesh. */
     unsigned int newSubdivisionMesh (RTCGeometryFlags flags, size_t numFaces, size_t numEdges, size_t numVertices, size_t numEdgeCreases, size_t numVertexCreases, size_t numHoles, size_t numTimeSteps);
 
+    /*! Creates a new subdivision mesh that references a shared topology. */
+    unsigned int newSubdivisionMesh (RTCGeometryFlags flags, SubdivTopology* topology, size_t numTimeSteps);
+
     /*! deletes some geometry */
     void deleteGeometry(size_t geomID);
 
+    /*! releases the first num geometries deleted since the last commit */
+    void releaseDeletedGeometries(size_t num);
+
     /*! Builds acceleration structure for the scene. */
     void build (size_t threadIndex, size_t threadCount);
     void build_task ();
 
+    /*! builds the scene on a separate thread, previously committed acceleration structures stay traceable during the build */
+    void commitAsync (RTCCommitCompleteFunc func, void* ptr);
+
+    /*! waits for a pending asynchronous commit to finish */
+    void finishAsyncCommit ();
+
     /*! stores scene into binary file */
     void write(std::ofstream& file);
 
+    /*! stores the acceleration structures of a committed scene into a binary file */
+    void save(const std::string& fileName);
+
+    /*! commits the scene by loading acceleration structures previously stored with save */
+    void load(const std::string& fileName);
+
     void updateInterface();
 
+    /*! decides which instances get traversed natively, has to get called before the acceleration structures get build */
+    void updateNativeInstances();
+
+    /*! encodes the index buffers of modified triangle meshes for accels that decode triangles on the fly */
+    void compressTriangleMeshes();
+
+    /*! makes traversal decode the triangles from the most recently encoded index buffers */
+    void publishCompressedTriangleMeshes();
+
+    /*! creates and builds a lazily instanced scene, has to get called by each ray reaching one of its lazy instances */
+    __forceinline void lazyBuild() 
+    {
+      if (unlikely(!lazyReached)) lazyReached = true;
+      if (unlikely(lazyState != LAZY_VALID)) lazyCommit();
+    }
+    void lazyCommit();
+
+    /*! releases the geometry of a lazily instanced scene after its build failed */
+    void lazyRelease();
+
+    /*! releases the geometry and acceleration structures of a lazily instanced scene, the next ray reaching the scene creates them again */
+    void evict();
+
+    /*! evicts lazily instanced scenes not reached since the previous call until the device uses at most maxBytes of memory */
+    void evictLazyInstances(size_t maxBytes);
+
     /*! build task */
 #if defined(TASKING_LOCKSTEP)
     TASK_RUN_FUNCTION(Scene,task_build_parallel);
@@ -194,6 +259,7 @@ namespace embree
       Lock<AtomicMutex> lock(geometriesMutex);
       Geometry *g = geometries[i]; 
       assert(i < geometries.size()); 
+      if (std::find(deletedGeometries.begin(),deletedGeometries.end(),i) != deletedGeometries.end()) return nullptr; // deleted but not yet released
       return g; 
     }
 
@@ -283,6 +349,7 @@ namespace embree
     __forceinline bool isCoherent() const { return embree::isCoherent(flags); }
     __forceinline bool isRobust() const { return embree::isRobust(flags); }
     __forceinline bool isHighQuality() const { return embree::isHighQuality(flags); }
+    __forceinline bool isInstanced() const { return embree::isInstanced(flags); }
     __forceinline bool isInterpolatable() const { return embree::isInterpolatable(aflags); }
 
     /* test if scene got already build */
@@ -301,9 +368,11 @@ namespace embree
     atomic_t commitCounterSubdiv;
     atomic_t numMappedBuffers;         //!< number of mapped buffers
     RTCSceneFlags flags;
+    RTCSceneFlags accelFlags;          //!< flags the acceleration structures got created with, less memory hungry than flags after a degraded build
     RTCAlgorithmFlags aflags;
     bool needTriangleIndices; 
     bool needTriangleVertices; 
+    bool needCompressedTriangles;
     bool needQuadIndices; 
     bool needQuadVertices; 
     bool needBezierIndices;
@@ -316,6 +385,34 @@ namespace embree
     MutexSys buildMutex;
     AtomicMutex geometriesMutex;
     bool modified;                   //!< true if scene got modified
+
+  public:
+    AccelN* prevAccels;              //!< previously committed acceleration structures traced during an asynchronous commit
+    thread_t asyncCommitThread;      //!< thread performing the asynchronous commit
+    RTCCommitCompleteFunc asyncCommitFunc; //!< callback invoked when the asynchronous commit finished
+    void* asyncCommitPtr;            //!< user pointer passed to the callback
+    MutexSys asyncCommitMutex;
+    Accel::Intersectors asyncIntersectorsBuffer[2]; //!< intersectors of the previous and of the new acceleration structures
+    Accel::Intersectors* volatile asyncIntersectors; //!< intersectors rays get forwarded to during an asynchronous commit
+    std::vector<size_t> deletedGeometries; //!< geometries deleted since the last commit, released when no longer traced
+    size_t asyncNumDeletedGeometries;      //!< number of deleted geometries the asynchronous commit releases
+
+  public:
+    Accel* nativeTriangleAccel;      //!< BVH4 over Triangle4 primitives traversed natively by instances of this scene
+    Accel* nativeInstanceAccel;      //!< instancing BVH4 traversed natively by instances of this scene
+    std::vector<Instance*> nativeInstances; //!< instances traversed natively by the instancing BVH
+    bool nativeInstanceable;         //!< true if instances of this scene can get traversed natively
+    size_t nativeInstanceDepth;      //!< maximal number of nested native instance levels of this scene
+
+  public:
+    enum LazyState { LAZY_VALID = 0, LAZY_INVALID = 1, LAZY_CREATE = 2, LAZY_COMMIT = 3 };
+    bool lazy;                       //!< true if the scene is instanced by lazy instances
+    RTCLazyCreateFunc lazyCreate;    //!< creates the geometry of the lazily instanced scene
+    void* lazyCreatePtr;             //!< user pointer passed to lazyCreate
+    volatile int32_t lazyState;      //!< build state of the lazily instanced scene
+    volatile bool lazyReached;       //!< true if a ray reached the scene since the last eviction
+    size_t lazyLastReached;          //!< eviction round the scene was reached the last time
+    static AtomicCounter lazyEvictions; //!< number of eviction rounds
     
     /*! global lock step task scheduler */
 #if defined(TASKING_LOCKSTEP)
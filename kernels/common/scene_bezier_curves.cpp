@@ -21,7 +21,7 @@
 namespace embree
 {
   BezierCurves::BezierCurves (Scene* parent, RTCGeometryFlags flags, size_t numPrimitives, size_t numVertices, size_t numTimeSteps) 
-    : Geometry(parent,BEZIER_CURVES,numPrimitives,numTimeSteps,flags), tessellationRate(4)
+    : Geometry(parent,BEZIER_CURVES,numPrimitives,numTimeSteps,flags), tessellationRate(4), basis(RTC_BASIS_BEZIER)
   {
     curves.init(parent->device,numPrimitives,sizeof(int));
     for (size_t i=0; i<numTimeSteps; i++) {
@@ -132,6 +132,18 @@ namespace embree
     tessellationRate = clamp((int)N,1,16);
   }
 
+  void BezierCurves::setCurveBasis(RTCCurveBasis basis)
+  {
+    if (parent->isStatic() && parent->isBuild()) 
+      throw_RTCError(RTC_INVALID_OPERATION,"static geometries cannot get modified");
+
+    if (basis != RTC_BASIS_BEZIER && basis != RTC_BASIS_BSPLINE && basis != RTC_BASIS_CATMULL_ROM)
+      throw_RTCError(RTC_INVALID_ARGUMENT,"unknown curve basis");
+
+    this->basis = basis;
+    Geometry::update();
+  }
+
   void BezierCurves::immutable () 
   {
     const bool freeIndices = !parent->needBezierIndices;
@@ -193,13 +205,91 @@ namespace embree
       const vfloatx p2 = vfloatx::loadu(valid,(float*)&src[(curve+2)*stride+ofs]);
       const vfloatx p3 = vfloatx::loadu(valid,(float*)&src[(curve+3)*stride+ofs]);
       
-      const BezierCurveT<vfloatx> bezier(p0,p1,p2,p3,0.0f,1.0f,0);
+      BezierCurveT<vfloatx> bezier(p0,p1,p2,p3,0.0f,1.0f,0);
+      convertToBezier(basis,bezier.v0,bezier.v1,bezier.v2,bezier.v3);
       if (P      ) vfloatx::storeu(valid,P+i,      bezier.eval(u));
       if (dPdu   ) vfloatx::storeu(valid,dPdu+i,   bezier.eval_du(u));
       if (ddPdudu) vfloatx::storeu(valid,ddPdudu+i,bezier.eval_dudu(u));
     }
   }
 
+  void BezierCurves::interpolateN(const void* valid_i, const unsigned* primIDs, const float* u, const float* v, size_t numUVs, 
+                                  RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats)
+  {
+    /* test if interpolation is enabled */
+#if defined(DEBUG)
+    if ((parent->aflags & RTC_INTERPOLATE) == 0) 
+      throw_RTCError(RTC_INVALID_OPERATION,"rtcInterpolate can only get called when RTC_INTERPOLATE is enabled for the scene");
+#endif
+
+    /* calculate base pointer and stride */
+    assert((buffer >= RTC_VERTEX_BUFFER0 && buffer <= RTC_VERTEX_BUFFER1) ||
+           (buffer >= RTC_USER_VERTEX_BUFFER0 && buffer <= RTC_USER_VERTEX_BUFFER1));
+    const char* src = nullptr; 
+    size_t stride = 0;
+    if (buffer >= RTC_USER_VERTEX_BUFFER0) {
+      src    = userbuffers[buffer&0xFFFF]->getPtr();
+      stride = userbuffers[buffer&0xFFFF]->getStride();
+    } else {
+      src    = vertices[buffer&0xFFFF].getPtr();
+      stride = vertices[buffer&0xFFFF].getStride();
+    }
+    const int* valid = (const int*) valid_i;
+
+    for (size_t i=0; i<numUVs; i+=VSIZEX)
+    {
+      /* gather the vertices of a block of hits, lanes of invalid hits load the first vertex of the buffer */
+      vboolx valid1 = false;
+      vfloatx uu = zero, vv = zero;
+      const char* p0[VSIZEX], *p1[VSIZEX], *p2[VSIZEX], *p3[VSIZEX];
+      for (size_t k=0; k<VSIZEX; k++)
+      {
+        p0[k] = src; p1[k] = src; p2[k] = src; p3[k] = src;
+        if (i+k >= numUVs || (valid && !valid[i+k])) continue;
+        const size_t curve = curves[primIDs[i+k]];
+        p0[k] = src+(curve+0)*stride; p1[k] = src+(curve+1)*stride; p2[k] = src+(curve+2)*stride; p3[k] = src+(curve+3)*stride;
+        uu[k] = u[i+k]; vv[k] = v[i+k];
+        set(valid1,k);
+      }
+      if (none(valid1)) continue;
+
+      /* interpolate each component for all hits of the block in parallel */
+      for (size_t j=0; j<numFloats; j++)
+      {
+        const size_t ofs = j*sizeof(float);
+        const vfloatx v0 = gatherVertexFloat<VSIZEX>(p0,ofs);
+        const vfloatx v1 = gatherVertexFloat<VSIZEX>(p1,ofs);
+        const vfloatx v2 = gatherVertexFloat<VSIZEX>(p2,ofs);
+        const vfloatx v3 = gatherVertexFloat<VSIZEX>(p3,ofs);
+        BezierCurveT<vfloatx> bezier(v0,v1,v2,v3,0.0f,1.0f,0);
+        convertToBezier(basis,bezier.v0,bezier.v1,bezier.v2,bezier.v3);
+        const vfloatx t0 = 1.0f-uu, t1 = uu;
+        if (P) {
+          const vfloatx p10 = bezier.v0*t0 + bezier.v1*t1;
+          const vfloatx p11 = bezier.v1*t0 + bezier.v2*t1;
+          const vfloatx p12 = bezier.v2*t0 + bezier.v3*t1;
+          const vfloatx p20 = p10*t0 + p11*t1;
+          const vfloatx p21 = p11*t0 + p12*t1;
+          vfloatx::storeu(valid1,P+j*numUVs+i,p20*t0 + p21*t1);
+        }
+        if (dPdu) {
+          const vfloatx B0 = -3.0f*(t0*t0);
+          const vfloatx B1 = -6.0f*(t0*t1) + 3.0f*(t0*t0);
+          const vfloatx B2 = +6.0f*(t0*t1) - 3.0f*(t1*t1);
+          const vfloatx B3 = +3.0f*(t1*t1);
+          vfloatx::storeu(valid1,dPdu+j*numUVs+i,B0*bezier.v0 + B1*bezier.v1 + B2*bezier.v2 + B3*bezier.v3);
+        }
+        if (ddPdudu) {
+          const vfloatx C0 = 6.0f*t0;
+          const vfloatx C1 = 6.0f*t1 - 12.0f*t0;
+          const vfloatx C2 = 6.0f*t0 - 12.0f*t1;
+          const vfloatx C3 = 6.0f*t1;
+          vfloatx::storeu(valid1,ddPdudu+j*numUVs+i,C0*bezier.v0 + C1*bezier.v1 + C2*bezier.v2 + C3*bezier.v3);
+        }
+      }
+    }
+  }
+
   void BezierCurves::write(std::ofstream& file)
   {
     int type = BEZIER_CURVES;
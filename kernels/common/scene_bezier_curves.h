@@ -20,6 +20,7 @@
 #include "geometry.h"
 #include "primref.h"
 #include "buffer.h"
+#include "subdiv/bezier_curve.h"
 
 namespace embree
 {
@@ -47,8 +48,10 @@ namespace embree
     void immutable ();
     bool verify ();
     void interpolate(unsigned primID, float u, float v, RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats);
+    void interpolateN(const void* valid_i, const unsigned* primIDs, const float* u, const float* v, size_t numUVs, 
+                      RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats);
     void setTessellationRate(float N);
-    // FIXME: implement interpolateN
+    void setCurveBasis(RTCCurveBasis basis);
 
   public:
     
@@ -76,6 +79,17 @@ namespace embree
     __forceinline float radius(size_t i, size_t j = 0) const {
       return vertices[j][i].w;
     }
+
+    /*! gathers the bezier control points of the curve starting at the i'th vertex of the j'th timestep */
+    __forceinline void gather(Vec3fa& p0, Vec3fa& p1, Vec3fa& p2, Vec3fa& p3, size_t i, size_t j = 0) const
+    {
+      p0 = vertex(i+0,j);
+      p1 = vertex(i+1,j);
+      p2 = vertex(i+2,j);
+      p3 = vertex(i+3,j);
+      if (unlikely(basis != RTC_BASIS_BEZIER))
+        convertToBezier(basis,p0,p1,p2,p3);
+    }
     
     /*! check if the i'th primitive is valid */
     __forceinline bool valid(size_t i, BBox3fa* bbox = nullptr) const 
@@ -109,33 +123,21 @@ namespace embree
     /*! calculates bounding box of i'th bezier curve */
     __forceinline BBox3fa bounds(size_t i, size_t j = 0) const 
     {
-      const int index = curve(i);
-      const float r0 = radius(index+0,j);
-      const float r1 = radius(index+1,j);
-      const float r2 = radius(index+2,j);
-      const float r3 = radius(index+3,j);
-      const Vec3fa v0 = vertex(index+0,j);
-      const Vec3fa v1 = vertex(index+1,j);
-      const Vec3fa v2 = vertex(index+2,j);
-      const Vec3fa v3 = vertex(index+3,j);
+      Vec3fa v0,v1,v2,v3; gather(v0,v1,v2,v3,curve(i),j);
       const BBox3fa b = merge(BBox3fa(v0),BBox3fa(v1),BBox3fa(v2),BBox3fa(v3));
-      return enlarge(b,Vec3fa(max(r0,r1,r2,r3)));
+      return enlarge(b,Vec3fa(max(v0.w,v1.w,v2.w,v3.w)));
     }
     
     /*! calculates bounding box of i'th bezier curve */
     __forceinline BBox3fa bounds(const AffineSpace3fa& space, size_t i, size_t j = 0) const 
     {
-      const int index = curve(i);
-      const float r0 = radius(index+0,j);
-      const float r1 = radius(index+1,j);
-      const float r2 = radius(index+2,j);
-      const float r3 = radius(index+3,j);
-      const Vec3fa v0 = xfmPoint(space,vertex(index+0,j));
-      const Vec3fa v1 = xfmPoint(space,vertex(index+1,j));
-      const Vec3fa v2 = xfmPoint(space,vertex(index+2,j));
-      const Vec3fa v3 = xfmPoint(space,vertex(index+3,j));
+      Vec3fa p0,p1,p2,p3; gather(p0,p1,p2,p3,curve(i),j);
+      const Vec3fa v0 = xfmPoint(space,p0);
+      const Vec3fa v1 = xfmPoint(space,p1);
+      const Vec3fa v2 = xfmPoint(space,p2);
+      const Vec3fa v3 = xfmPoint(space,p3);
       const BBox3fa b = merge(BBox3fa(v0),BBox3fa(v1),BBox3fa(v2),BBox3fa(v3));
-      return enlarge(b,Vec3fa(max(r0,r1,r2,r3)));
+      return enlarge(b,Vec3fa(max(p0.w,p1.w,p2.w,p3.w)));
     }
 
 #if defined(__MIC__)
@@ -172,6 +174,7 @@ namespace embree
     
   public:
     int tessellationRate;                           //!< tessellation rate for bezier curve
+    RTCCurveBasis basis;                            //!< basis of the control points
     BufferT<int> curves;                            //!< array of curve indices
     array_t<BufferT<Vec3fa>,2> vertices;            //!< vertex array
     array_t<std::unique_ptr<Buffer>,2> userbuffers; //!< user buffers
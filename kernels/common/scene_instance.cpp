@@ -43,7 +43,7 @@ namespace embree
   }
 
   Instance::Instance (Scene* parent, Accel* object, size_t numTimeSteps) 
-    : AccelSet(parent,1,numTimeSteps), object(object)
+    : AccelSet(parent,1,numTimeSteps), object(object), native(false), lazy(false), lazyBounds(empty)
   {
     local2world[0] = local2world[1] = one;
     world2local[0] = world2local[1] = one;
@@ -39,10 +39,14 @@ namespace embree
     virtual void setTransform(const AffineSpace3fa& local2world, size_t timeStep);
     virtual void setMask (unsigned mask);
     virtual void build(size_t threadIndex, size_t threadCount) {}
+    virtual Scene* getInstancedScene() const { return (Scene*) object; }
     
   public:
     AffineSpace3fa local2world[2]; //!< transforms from local space to world space
     AffineSpace3fa world2local[2]; //!< transforms from world space to local space
     Accel* object;                 //!< pointer to instanced acceleration structure
+    bool native;                   //!< true if the instance is traversed natively by the instancing BVH of the parent scene
+    bool lazy;                     //!< true if the instanced scene gets build by the first ray reaching the instance
+    BBox3fa lazyBounds;            //!< user specified object space bounds of the instanced scene of lazy instances
   };
 }
@@ -183,7 +183,60 @@ namespace embree
       const vfloatx p1 = vfloatx::loadu(valid,(float*)&src[(segment+1)*stride+ofs]);
       if (P      ) vfloatx::storeu(valid,P+i,(1.0f-u)*p0 + u*p1);
       if (dPdu   ) vfloatx::storeu(valid,dPdu+i,p1-p0);
-      if (ddPdudu) vfloatx::storeu(valid,dPdu+i,vfloatx(zero));
+      if (ddPdudu) vfloatx::storeu(valid,ddPdudu+i,vfloatx(zero));
+    }
+  }
+
+  void LineSegments::interpolateN(const void* valid_i, const unsigned* primIDs, const float* u, const float* v, size_t numUVs, 
+                                  RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats)
+  {
+    /* test if interpolation is enabled */
+#if defined(DEBUG)
+    if ((parent->aflags & RTC_INTERPOLATE) == 0) 
+      throw_RTCError(RTC_INVALID_OPERATION,"rtcInterpolate can only get called when RTC_INTERPOLATE is enabled for the scene");
+#endif
+
+    /* calculate base pointer and stride */
+    assert((buffer >= RTC_VERTEX_BUFFER0 && buffer <= RTC_VERTEX_BUFFER1) ||
+           (buffer >= RTC_USER_VERTEX_BUFFER0 && buffer <= RTC_USER_VERTEX_BUFFER1));
+    const char* src = nullptr; 
+    size_t stride = 0;
+    if (buffer >= RTC_USER_VERTEX_BUFFER0) {
+      src    = userbuffers[buffer&0xFFFF]->getPtr();
+      stride = userbuffers[buffer&0xFFFF]->getStride();
+    } else {
+      src    = vertices[buffer&0xFFFF].getPtr();
+      stride = vertices[buffer&0xFFFF].getStride();
+    }
+    const int* valid = (const int*) valid_i;
+
+    for (size_t i=0; i<numUVs; i+=VSIZEX)
+    {
+      /* gather the vertices of a block of hits, lanes of invalid hits load the first vertex of the buffer */
+      vboolx valid1 = false;
+      vfloatx uu = zero, vv = zero;
+      const char* p0[VSIZEX], *p1[VSIZEX];
+      for (size_t k=0; k<VSIZEX; k++)
+      {
+        p0[k] = src; p1[k] = src;
+        if (i+k >= numUVs || (valid && !valid[i+k])) continue;
+        const size_t segment = segments[primIDs[i+k]];
+        p0[k] = src+(segment+0)*stride; p1[k] = src+(segment+1)*stride;
+        uu[k] = u[i+k]; vv[k] = v[i+k];
+        set(valid1,k);
+      }
+      if (none(valid1)) continue;
+
+      /* interpolate each component for all hits of the block in parallel */
+      for (size_t j=0; j<numFloats; j++)
+      {
+        const size_t ofs = j*sizeof(float);
+        const vfloatx v0 = gatherVertexFloat<VSIZEX>(p0,ofs);
+        const vfloatx v1 = gatherVertexFloat<VSIZEX>(p1,ofs);
+        if (P      ) vfloatx::storeu(valid1,P+j*numUVs+i,(1.0f-uu)*v0 + uu*v1);
+        if (dPdu   ) vfloatx::storeu(valid1,dPdu+j*numUVs+i,v1-v0);
+        if (ddPdudu) vfloatx::storeu(valid1,ddPdudu+j*numUVs+i,vfloatx(zero));
+      }
     }
   }
 
@@ -60,18 +60,18 @@ namespace embree
     if (((size_t(ptr) + offset) & 0x3) || (stride & 0x3)) 
       throw_RTCError(RTC_INVALID_OPERATION,"data must be 4 bytes aligned");
 
+    if (type >= RTC_VERTEX_BUFFER0 && type < RTC_VERTEX_BUFFER0+RTC_MAX_TIME_STEPS) 
+    {
+      const size_t t = type - RTC_VERTEX_BUFFER0;
+      vertices[t].set(ptr,offset,stride); 
+      vertices[t].checkPadding16();
+      return;
+    }
+
     switch (type) {
     case RTC_INDEX_BUFFER  : 
       quads.set(ptr,offset,stride); 
       break;
-    case RTC_VERTEX_BUFFER0: 
-      vertices[0].set(ptr,offset,stride); 
-      vertices[0].checkPadding16();
-      break;
-    case RTC_VERTEX_BUFFER1: 
-      vertices[1].set(ptr,offset,stride); 
-      vertices[1].checkPadding16();
-      break;
     case RTC_USER_VERTEX_BUFFER0: 
       if (userbuffers[0] == nullptr) userbuffers[0].reset(new Buffer(parent->device,numVertices(),stride)); 
       userbuffers[0]->set(ptr,offset,stride);  
@@ -93,10 +93,11 @@ namespace embree
     if (parent->isStatic() && parent->isBuild())
       throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
 
+    if (type >= RTC_VERTEX_BUFFER0 && type < RTC_VERTEX_BUFFER0+RTC_MAX_TIME_STEPS)
+      return vertices[type - RTC_VERTEX_BUFFER0].map(parent->numMappedBuffers);
+
     switch (type) {
     case RTC_INDEX_BUFFER  : return quads.map(parent->numMappedBuffers);
-    case RTC_VERTEX_BUFFER0: return vertices[0].map(parent->numMappedBuffers);
-    case RTC_VERTEX_BUFFER1: return vertices[1].map(parent->numMappedBuffers);
     default                : throw_RTCError(RTC_INVALID_ARGUMENT,"unknown buffer type"); return nullptr;
     }
   }
@@ -106,10 +107,13 @@ namespace embree
     if (parent->isStatic() && parent->isBuild())
       throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
 
+    if (type >= RTC_VERTEX_BUFFER0 && type < RTC_VERTEX_BUFFER0+RTC_MAX_TIME_STEPS) {
+      vertices[type - RTC_VERTEX_BUFFER0].unmap(parent->numMappedBuffers);
+      return;
+    }
+
     switch (type) {
-    case RTC_INDEX_BUFFER  : quads  .unmap(parent->numMappedBuffers); break;
-    case RTC_VERTEX_BUFFER0: vertices[0].unmap(parent->numMappedBuffers); break;
-    case RTC_VERTEX_BUFFER1: vertices[1].unmap(parent->numMappedBuffers); break;
+    case RTC_INDEX_BUFFER  : quads.unmap(parent->numMappedBuffers); break;
     default                : throw_RTCError(RTC_INVALID_ARGUMENT,"unknown buffer type"); break;
     }
   }
@@ -119,14 +123,15 @@ namespace embree
     const bool freeQuads = !parent->needQuadIndices;
     const bool freeVertices  = !parent->needQuadVertices;
     if (freeQuads) quads.free(); 
-    if (freeVertices ) vertices[0].free();
-    if (freeVertices ) vertices[1].free();
+    if (freeVertices ) 
+      for (size_t i=0; i<numTimeSteps; i++) vertices[i].free();
   }
 
   bool QuadMesh::verify () 
   {
     /*! verify consistent size of vertex arrays */
-    if (numTimeSteps == 2 && vertices[0].size() != vertices[1].size())
+    for (size_t i=1; i<numTimeSteps; i++)
+      if (vertices[0].size() != vertices[i].size())
         return false;
 
     /*! verify proper quad indices */
@@ -158,7 +163,7 @@ namespace embree
 #endif
 
     /* calculate base pointer and stride */
-    assert((buffer >= RTC_VERTEX_BUFFER0 && buffer <= RTC_VERTEX_BUFFER1) ||
+    assert((buffer >= RTC_VERTEX_BUFFER0 && buffer < RTC_VERTEX_BUFFER0+RTC_MAX_TIME_STEPS) ||
            (buffer >= RTC_USER_VERTEX_BUFFER0 && buffer <= RTC_USER_VERTEX_BUFFER1));
     const char* src = nullptr; 
     size_t stride = 0;
@@ -201,6 +206,77 @@ namespace embree
     }
   }
 
+  void QuadMesh::interpolateN(const void* valid_i, const unsigned* primIDs, const float* u, const float* v, size_t numUVs, 
+                              RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats)
+  {
+    /* test if interpolation is enabled */
+#if defined(DEBUG)
+    if ((parent->aflags & RTC_INTERPOLATE) == 0) 
+      throw_RTCError(RTC_INVALID_OPERATION,"rtcInterpolate can only get called when RTC_INTERPOLATE is enabled for the scene");
+#endif
+
+    /* calculate base pointer and stride */
+    assert((buffer >= RTC_VERTEX_BUFFER0 && buffer < RTC_VERTEX_BUFFER0+RTC_MAX_TIME_STEPS) ||
+           (buffer >= RTC_USER_VERTEX_BUFFER0 && buffer <= RTC_USER_VERTEX_BUFFER1));
+    const char* src = nullptr; 
+    size_t stride = 0;
+    if (buffer >= RTC_USER_VERTEX_BUFFER0) {
+      src    = userbuffers[buffer&0xFFFF]->getPtr();
+      stride = userbuffers[buffer&0xFFFF]->getStride();
+    } else {
+      src    = vertices[buffer&0xFFFF].getPtr();
+      stride = vertices[buffer&0xFFFF].getStride();
+    }
+    const int* valid = (const int*) valid_i;
+
+    for (size_t i=0; i<numUVs; i+=VSIZEX)
+    {
+      /* gather the vertices of a block of hits, lanes of invalid hits load the first vertex of the buffer */
+      vboolx valid1 = false;
+      vfloatx uu = zero, vv = zero;
+      const char* p0[VSIZEX], *p1[VSIZEX], *p2[VSIZEX], *p3[VSIZEX];
+      for (size_t k=0; k<VSIZEX; k++)
+      {
+        p0[k] = src; p1[k] = src; p2[k] = src; p3[k] = src;
+        if (i+k >= numUVs || (valid && !valid[i+k])) continue;
+        const Quad& quad = this->quad(primIDs[i+k]);
+        p0[k] = src+quad.v[0]*stride; p1[k] = src+quad.v[1]*stride; p2[k] = src+quad.v[2]*stride; p3[k] = src+quad.v[3]*stride;
+        uu[k] = u[i+k]; vv[k] = v[i+k];
+        set(valid1,k);
+      }
+      if (none(valid1)) continue;
+
+      /* interpolate each component for all hits of the block in parallel */
+      for (size_t j=0; j<numFloats; j++)
+      {
+        const size_t ofs = j*sizeof(float);
+        const vfloatx v0 = gatherVertexFloat<VSIZEX>(p0,ofs);
+        const vfloatx v1 = gatherVertexFloat<VSIZEX>(p1,ofs);
+        const vfloatx v2 = gatherVertexFloat<VSIZEX>(p2,ofs);
+        const vfloatx v3 = gatherVertexFloat<VSIZEX>(p3,ofs);
+        const vboolx left = uu+vv <= 1.0f;
+        const vfloatx Q0 = select(left,v0,v2);
+        const vfloatx Q1 = select(left,v1,v3);
+        const vfloatx Q2 = select(left,v3,v1);
+        const vfloatx U  = select(left,uu,vfloatx(1.0f)-uu);
+        const vfloatx V  = select(left,vv,vfloatx(1.0f)-vv);
+        const vfloatx W  = 1.0f-U-V;
+        if (P) {
+          vfloatx::storeu(valid1,P+j*numUVs+i,W*Q0 + U*Q1 + V*Q2);
+        }
+        if (dPdu) { 
+          assert(dPdu); vfloatx::storeu(valid1,dPdu+j*numUVs+i,select(left,Q1-Q0,Q0-Q1));
+          assert(dPdv); vfloatx::storeu(valid1,dPdv+j*numUVs+i,select(left,Q2-Q0,Q0-Q2));
+        }
+        if (ddPdudu) { 
+          assert(ddPdudu); vfloatx::storeu(valid1,ddPdudu+j*numUVs+i,vfloatx(zero));
+          assert(ddPdvdv); vfloatx::storeu(valid1,ddPdvdv+j*numUVs+i,vfloatx(zero));
+          assert(ddPdudv); vfloatx::storeu(valid1,ddPdudv+j*numUVs+i,vfloatx(zero));
+        }
+      }
+    }
+  }
+
   void QuadMesh::write(std::ofstream& file)
   {
     int type = QUAD_MESH;
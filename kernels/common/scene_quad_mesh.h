@@ -57,7 +57,8 @@ namespace embree
     void immutable ();
     bool verify ();
     void interpolate(unsigned primID, float u, float v, RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats);
-    // FIXME: implement interpolateN
+    void interpolateN(const void* valid_i, const unsigned* primIDs, const float* u, const float* v, size_t numUVs, 
+                      RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats);
 
   public:
 
@@ -86,6 +87,16 @@ namespace embree
       return vertices[j].getPtr(i);
     }
 
+    /*! returns i'th vertex at time k/n, linearly interpolated between the enclosing timesteps */
+    __forceinline const Vec3fa vertexAtTime(size_t i, size_t k, size_t n) const 
+    {
+      const size_t j = (k*(numTimeSteps-1))/n;
+      const size_t r = (k*(numTimeSteps-1))%n;
+      if (r == 0) return vertex(i,j);
+      const float f = float(r)/float(n);
+      return (1.0f-f)*vertex(i,j) + f*vertex(i,j+1);
+    }
+
     /*! calculates the bounds of the i'th quad */
     __forceinline BBox3fa bounds(size_t i) const 
     {
@@ -97,6 +108,37 @@ namespace embree
       return BBox3fa(min(v0,v1,v2,v3),max(v0,v1,v2,v3));
     }
 
+    /*! calculates the bounds of the i'th quad at time k/n */
+    __forceinline BBox3fa bounds(size_t i, size_t k, size_t n) const 
+    {
+      const Quad& q = quad(i);
+      const Vec3fa v0 = vertexAtTime(q.v[0],k,n);
+      const Vec3fa v1 = vertexAtTime(q.v[1],k,n);
+      const Vec3fa v2 = vertexAtTime(q.v[2],k,n);
+      const Vec3fa v3 = vertexAtTime(q.v[3],k,n);
+      return BBox3fa(min(v0,v1,v2,v3),max(v0,v1,v2,v3));
+    }
+
+    /*! calculates linear bounds of the i'th quad for the time range
+     *  [k/n,(k+1)/n], the bounds also enclose the quad at all timesteps
+     *  of the mesh that fall inside that time range */
+    __forceinline std::pair<BBox3fa,BBox3fa> linearBounds(size_t i, size_t k, size_t n) const 
+    {
+      BBox3fa b0 = bounds(i,k+0,n);
+      BBox3fa b1 = bounds(i,k+1,n);
+      const size_t m = numTimeSteps-1;
+      for (size_t j=(k*m)/n+1; j*n < (k+1)*m; j++) 
+      {
+        const float f = float(j*n-k*m)/float(m);
+        const BBox3fa bj = bounds(i,j,m);
+        const Vec3fa dlower = min(bj.lower-((1.0f-f)*b0.lower+f*b1.lower),Vec3fa(zero));
+        const Vec3fa dupper = max(bj.upper-((1.0f-f)*b0.upper+f*b1.upper),Vec3fa(zero));
+        b0.lower += dlower; b1.lower += dlower;
+        b0.upper += dupper; b1.upper += dupper;
+      }
+      return std::make_pair(b0,b1);
+    }
+
     /*! check if the i'th primitive is valid */
     __forceinline bool valid(size_t i, BBox3fa* bbox = nullptr) const 
     {
@@ -125,7 +167,7 @@ namespace embree
     
   public:
     BufferT<Quad> quads;                            //!< array of quads
-    array_t<BufferT<Vec3fa>,2> vertices;            //!< vertex array
+    array_t<BufferT<Vec3fa>,RTC_MAX_TIME_STEPS> vertices; //!< vertex array for each timestep
     array_t<std::unique_ptr<Buffer>,2> userbuffers; //!< user buffers
   };
 }
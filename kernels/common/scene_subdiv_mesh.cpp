@@ -15,18 +15,21 @@
 // ======================================================================== //
 
 #include "scene_subdiv_mesh.h"
+#include "scene_subdiv_topology.h"
 #include "scene.h"
 #include "subdiv/patch_eval.h"
 #include "subdiv/patch_eval_simd.h"
+#include "../../include/embree2/rtcore_ray.h"
 
 #include "../algorithms/sort.h"
 #include "../algorithms/prefix.h"
 #include "../algorithms/parallel_for.h"
+#include "../algorithms/parallel_reduce.h"
 
 namespace embree
 {
   SubdivMesh::SubdivMesh (Scene* parent, RTCGeometryFlags flags, size_t numFaces, size_t numEdges, size_t numVertices, 
-			  size_t numEdgeCreases, size_t numVertexCreases, size_t numHoles, size_t numTimeSteps)
+			  size_t numEdgeCreases, size_t numVertexCreases, size_t numHoles, size_t numTimeSteps, SubdivTopology* topology)
     : Geometry(parent,SUBDIV_MESH,numFaces,numTimeSteps,flags), 
       numFaces(numFaces), 
       numEdges(numEdges), 
@@ -34,27 +37,62 @@ namespace embree
       faceStartEdge(parent->device),
       halfEdges(parent->device),
       invalidFace(parent->device),
+      halfEdgeData(nullptr),
+      faceStartEdgeData(nullptr),
       numVertices(numVertices),
       boundary(RTC_BOUNDARY_EDGE_ONLY),
       displFunc(nullptr), 
       displBounds(empty),
+      displFuncN(nullptr),
+      displFlags(RTC_DISPLACEMENT_DEFAULT),
       levelUpdate(false),
-      tessellationRate(2.0f)
+      tessellationRate(2.0f),
+      tessellationCameraOrg(zero),
+      tessellationCameraScale(0.0f),
+      topology(topology),
+      contentHash(0)
   {
     for (size_t i=0; i<numTimeSteps; i++)
       vertices[i].init(parent->device,numVertices,sizeof(Vec3fa));
 
+    /* a mesh with shared topology only stores vertices and levels */
+    if (topology) {
+      topology->refInc();
+      boundary = topology->boundary;
+      numEdges = 0;
+    }
     vertexIndices.init(parent->device,numEdges,sizeof(unsigned int));
-    faceVertices.init(parent->device,numFaces,sizeof(unsigned int));
+    faceVertices.init(parent->device,topology ? 0 : numFaces,sizeof(unsigned int));
     holes.init(parent->device,numHoles,sizeof(int));
     edge_creases.init(parent->device,numEdgeCreases,2*sizeof(unsigned int));
     edge_crease_weights.init(parent->device,numEdgeCreases,sizeof(float));
     vertex_creases.init(parent->device,numVertexCreases,sizeof(unsigned int));
     vertex_crease_weights.init(parent->device,numVertexCreases,sizeof(float));
-    levels.init(parent->device,numEdges,sizeof(float));
+    levels.init(parent->device,this->numEdges,sizeof(float));
     enabling();
   }
 
+  SubdivMesh::~SubdivMesh()
+  {
+    uniformHalfEdges.reset();
+    if (topology) topology->refDec();
+  }
+
+  /*! checks if a buffer belongs to the topology of the mesh */
+  static __forceinline bool isTopologyBuffer(RTCBufferType type)
+  {
+    switch (type) {
+    case RTC_INDEX_BUFFER               : 
+    case RTC_FACE_BUFFER                : 
+    case RTC_HOLE_BUFFER                : 
+    case RTC_EDGE_CREASE_INDEX_BUFFER   : 
+    case RTC_EDGE_CREASE_WEIGHT_BUFFER  : 
+    case RTC_VERTEX_CREASE_INDEX_BUFFER : 
+    case RTC_VERTEX_CREASE_WEIGHT_BUFFER: return true;
+    default                             : return false;
+    }
+  }
+
   void SubdivMesh::enabling() 
   { 
     atomic_add(&parent->numSubdivEnableDisableEvents,1);
@@ -83,6 +121,9 @@ namespace embree
     if (parent->isStatic() && parent->isBuild()) 
       throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
 
+    if (topology)
+      throw_RTCError(RTC_INVALID_OPERATION,"the boundary mode is part of the shared topology");
+
     if (boundary == mode) return;
     boundary = mode;
     updateBuffer(RTC_VERTEX_CREASE_WEIGHT_BUFFER);    
@@ -97,6 +138,9 @@ namespace embree
     if (((size_t(ptr) + offset) & 0x3) || (stride & 0x3)) 
       throw_RTCError(RTC_INVALID_OPERATION,"data must be 4 bytes aligned");
 
+    if (topology && isTopologyBuffer(type))
+      throw_RTCError(RTC_INVALID_OPERATION,"buffers of a shared topology cannot get modified");
+
     /* verify that all vertex accesses are 16 bytes aligned */
 #if defined(__MIC__) && 0
     if (type == RTC_VERTEX_BUFFER0 || type == RTC_VERTEX_BUFFER1) {
@@ -149,6 +193,9 @@ namespace embree
     if (parent->isStatic() && parent->isBuild())
       throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
 
+    if (topology && isTopologyBuffer(type))
+      throw_RTCError(RTC_INVALID_OPERATION,"buffers of a shared topology cannot get modified");
+
     switch (type) {
     case RTC_INDEX_BUFFER                : return vertexIndices.map(parent->numMappedBuffers);
     case RTC_FACE_BUFFER                 : return faceVertices.map(parent->numMappedBuffers);
@@ -201,6 +248,9 @@ namespace embree
 
   void SubdivMesh::updateBuffer (RTCBufferType type)
   {
+    if (topology && isTopologyBuffer(type))
+      throw_RTCError(RTC_INVALID_OPERATION,"buffers of a shared topology cannot get modified");
+
     if (type != RTC_LEVEL_BUFFER)
       atomic_add(&parent->commitCounterSubdiv,1);
 
@@ -226,8 +276,25 @@ namespace embree
       throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
 
     this->displFunc   = func;
+    this->displFuncN  = nullptr;
     if (bounds) this->displBounds = *(BBox3fa*)bounds; 
     else        this->displBounds = empty;
+    this->contentHash = 0;
+  }
+
+  void SubdivMesh::setDisplacementFunctionN (RTCDisplacementFuncN func, RTCDisplacementFlags flags) 
+  {
+    if (parent->isStatic() && parent->isBuild())
+      throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
+
+    if (flags & ~RTC_DISPLACEMENT_DERIVATIVES)
+      throw_RTCError(RTC_INVALID_ARGUMENT,"invalid displacement flags");
+
+    this->displFunc   = nullptr;
+    this->displFuncN  = func;
+    this->displFlags  = flags;
+    this->displBounds = empty;
+    this->contentHash = 0;
   }
 
   void SubdivMesh::setTessellationRate(float N)
@@ -239,6 +306,37 @@ namespace embree
     levels.setModified(true);
   }
 
+  void SubdivMesh::setTessellationCamera(const RTCCamera* camera, float pixelsPerEdge)
+  {
+    if (parent->isStatic() && parent->isBuild()) 
+      throw_RTCError(RTC_INVALID_OPERATION,"static geometries cannot get modified");
+
+    /* disable camera driven edge levels */
+    if (camera == nullptr) {
+      tessellationCameraScale = 0.0f;
+      levels.setModified(true);
+      return;
+    }
+
+    if (!(pixelsPerEdge > 0.0f))
+      throw_RTCError(RTC_INVALID_ARGUMENT,"pixels per edge has to be positive");
+
+    /* an edge of length L at distance D covers about L/D*planeDist/pixelSize pixels */
+    const Vec3fa vx(camera->vx[0],camera->vx[1],camera->vx[2]);
+    const Vec3fa vy(camera->vy[0],camera->vy[1],camera->vy[2]);
+    const Vec3fa vz(camera->vz[0],camera->vz[1],camera->vz[2]);
+    const Vec3fa Nc = cross(vx,vy);
+    const float pixelArea = length(Nc);
+    const float planeDist = abs(dot(vz,Nc))/pixelArea;
+    const float scale = planeDist/(sqrt(pixelArea)*pixelsPerEdge);
+    if (!(pixelArea > 0.0f) || !(scale > 0.0f) || !isvalid(scale))
+      throw_RTCError(RTC_INVALID_ARGUMENT,"invalid camera");
+
+    tessellationCameraOrg = Vec3fa(camera->org[0],camera->org[1],camera->org[2]);
+    tessellationCameraScale = scale;
+    levels.setModified(true);
+  }
+
   void SubdivMesh::immutable () 
   {
     const bool freeIndices = !parent->needSubdivIndices;
@@ -263,6 +361,16 @@ namespace embree
 
   void SubdivMesh::calculateHalfEdges()
   {
+    calculateHalfEdges(numFaces,numHalfEdges,faceVertices,vertexIndices,faceStartEdge,holeSet,vertexCreaseMap,edgeCreaseMap,boundary,
+                       levels,tessellationRate,&vertices[0],halfEdges.data(),invalidFace,halfEdges0,halfEdges1);
+  }
+
+  void SubdivMesh::calculateHalfEdges(size_t numFaces, size_t numHalfEdges, const BufferT<int>& faceVertices, const BufferT<unsigned>& vertexIndices, 
+                                      const mvector<uint32_t>& faceStartEdge, const pset<uint32_t>& holeSet, 
+                                      const pmap<uint32_t,float>& vertexCreaseMap, const pmap<uint64_t,float>& edgeCreaseMap, RTCBoundaryMode boundary,
+                                      const BufferT<float>& levels, float tessellationRate, const BufferT<Vec3fa>* vertices,
+                                      HalfEdge* halfEdges, mvector<char>& invalidFace, std::vector<KeyHalfEdge>& halfEdges0, std::vector<KeyHalfEdge>& halfEdges1)
+  {
 #if defined(__MIC__)
     size_t blockSize = 1;
 #else
@@ -271,8 +379,8 @@ namespace embree
 
     /* allocate temporary array */
     invalidFace.resize(numFaces);
-    halfEdges0.resize(numEdges);
-    halfEdges1.resize(numEdges);
+    halfEdges0.resize(numHalfEdges);
+    halfEdges1.resize(numHalfEdges);
 
     /* create all half edges */
     parallel_for( size_t(0), numFaces, blockSize, [&](const range<size_t>& r) 
@@ -310,7 +418,7 @@ namespace embree
 	  edge->opposite_half_edge_ofs = 0;
 	  edge->edge_crease_weight     = edgeCreaseMap.lookup(key,0.0f);
 	  edge->vertex_crease_weight   = vertexCreaseMap.lookup(startVertex,0.0f);
-	  edge->edge_level             = getEdgeLevel(e+de);
+	  edge->edge_level             = getEdgeLevel(levels,tessellationRate,e+de);
           edge->patch_type             = HalfEdge::COMPLEX_PATCH; // type gets updated below
           edge->vertex_type            = HalfEdge::REGULAR_VERTEX;
 
@@ -384,7 +492,7 @@ namespace embree
       {
         HalfEdge* edge = &halfEdges[faceStartEdge[f]];
         HalfEdge::PatchType patch_type = edge->patchType();
-        invalidFace[f] = !edge->valid(vertices[0]) || holeSet.lookup(f);
+        invalidFace[f] = (vertices && !edge->valid(*vertices)) || holeSet.lookup(f);
           
         for (size_t i=0; i<faceVertices[f]; i++) 
         {
@@ -414,7 +522,7 @@ namespace embree
     {
       for (size_t i=r.begin(); i!=r.end(); i++)
       {
-	HalfEdge& edge = halfEdges[i];
+	HalfEdge& edge = halfEdgeData[i];
 	const unsigned int startVertex = edge.vtx_index;
  
 	if (updateLevels)
@@ -440,50 +548,197 @@ namespace embree
     });
   }
 
+  void SubdivMesh::calculateCameraLevels()
+  {
+    const Vec3fa& org = tessellationCameraOrg;
+    const float scale = tessellationCameraScale;
+
+    /* the level only depends on the length and midpoint of an edge, thus both half edges of an edge get the same level */
+    parallel_for( size_t(0), numHalfEdges, size_t(4096), [&](const range<size_t>& r) 
+    {
+      for (size_t i=r.begin(); i<r.end(); i+=VSIZEX)
+      {
+        const size_t n = min(size_t(VSIZEX),r.end()-i);
+        vfloatx x0 = zero, y0 = zero, z0 = zero;
+        vfloatx x1 = zero, y1 = zero, z1 = zero;
+        for (size_t k=0; k<n; k++) 
+        {
+          const HalfEdge& edge = halfEdgeData[i+k];
+          const Vec3fa v0 = vertices[0][edge.vtx_index];
+          const Vec3fa v1 = vertices[0][edge.next()->vtx_index];
+          x0[k] = v0.x; y0[k] = v0.y; z0[k] = v0.z;
+          x1[k] = v1.x; y1[k] = v1.y; z1[k] = v1.z;
+        }
+
+        const vfloatx dx = x1-x0, dy = y1-y0, dz = z1-z0;
+        const vfloatx cx = 0.5f*(x0+x1)-vfloatx(org.x);
+        const vfloatx cy = 0.5f*(y0+y1)-vfloatx(org.y);
+        const vfloatx cz = 0.5f*(z0+z1)-vfloatx(org.z);
+        const vfloatx len  = sqrt(dx*dx + dy*dy + dz*dz);
+        const vfloatx dist = max(sqrt(cx*cx + cy*cy + cz*cz),vfloatx(1E-20f));
+        const vfloatx level = clamp(len/dist*vfloatx(scale),vfloatx(1.0f),vfloatx(4096.0f));
+
+        for (size_t k=0; k<n; k++)
+          halfEdgeData[i+k].edge_level = level[k];
+      }
+    });
+  }
+
+  uint64_t SubdivMesh::hashBuffer(const Buffer& buffer, const size_t elementBytes, const uint64_t seed)
+  {
+    if (!buffer) return seed;
+
+    /* hash blocks in parallel and sum up the block hashes, the result is thus independent of the scheduling */
+    const size_t N = buffer.size();
+    const size_t blockSize = 4096;
+    const uint64_t sum = parallel_reduce(size_t(0),(N+blockSize-1)/blockSize,uint64_t(0),[&](const range<size_t>& r) -> uint64_t
+    {
+      uint64_t s = 0;
+      for (size_t b=r.begin(); b<r.end(); b++) 
+      {
+        uint64_t h = PersistentTessellationCache::hash(&b,sizeof(b),seed);
+        for (size_t i=b*blockSize; i<min(N,(b+1)*blockSize); i++)
+          h = PersistentTessellationCache::hash(buffer.getPtr(i),elementBytes,h);
+        s += h;
+      }
+      return s;
+    }, std::plus<uint64_t>());
+    return PersistentTessellationCache::hash(&N,sizeof(N),sum);
+  }
+
+  void SubdivMesh::updateContentHash()
+  {
+    /* the displacement function cannot get hashed, thus only its presence is part of the hash */
+    const unsigned info[3] = { id, (unsigned) boundary, displFunc != nullptr || displFuncN != nullptr };
+    uint64_t h = PersistentTessellationCache::hash(info,sizeof(info),0);
+    if (topology) h = PersistentTessellationCache::hash(&topology->contentHash,sizeof(topology->contentHash),h);
+    h = hashBuffer(faceVertices,sizeof(int),h);
+    h = hashBuffer(vertexIndices,sizeof(unsigned),h);
+    h = hashBuffer(vertices[0],3*sizeof(float),h);
+    h = hashBuffer(edge_creases,sizeof(Edge),h);
+    h = hashBuffer(edge_crease_weights,sizeof(float),h);
+    h = hashBuffer(vertex_creases,sizeof(unsigned),h);
+    h = hashBuffer(vertex_crease_weights,sizeof(float),h);
+    h = hashBuffer(holes,sizeof(unsigned),h);
+    contentHash = h ? h : 1;
+  }
+
+  void SubdivMesh::setTopologyHalfEdges()
+  {
+    /* meshes with the same uniform edge level share their half edges */
+    if (!levels && tessellationCameraScale == 0.0f) 
+    {
+      uniformHalfEdges = topology->getUniformHalfEdges(getEdgeLevel(0));
+      halfEdgeData = uniformHalfEdges->data();
+      halfEdges.clear();
+      return;
+    }
+
+    /* otherwise the mesh keeps a copy of the half edges to store its edge levels */
+    uniformHalfEdges.reset();
+    halfEdges.resize(numHalfEdges);
+    halfEdgeData = halfEdges.data();
+    parallel_for( size_t(0), numHalfEdges, size_t(4096), [&](const range<size_t>& r) 
+    {
+      for (size_t i=r.begin(); i<r.end(); i++) {
+        halfEdges[i] = topology->halfEdges[i];
+        halfEdges[i].edge_level = getEdgeLevel(i);
+      }
+    });
+  }
+
+  void SubdivMesh::calculateInvalidFaces()
+  {
+    invalidFace.resize(numFaces);
+    parallel_for( size_t(0), numFaces, size_t(4096), [&](const range<size_t>& r) 
+    {
+      for (size_t f=r.begin(); f<r.end(); f++) 
+        invalidFace[f] = topology->holeFace[f] || !getHalfEdge(f)->valid(vertices[0]);
+    });
+  }
+
   void SubdivMesh::initializeHalfEdgeStructures ()
   {
     double t0 = getSeconds();
 
-    /* allocate half edge array */
-    halfEdges.resize(numEdges);
+    /* the half edges of a shared topology are already calculated, only the edge levels and invalid faces depend on the mesh */
+    if (topology)
+    {
+      const bool recalculate = halfEdgeData == nullptr;
+      const bool update = levels.isModified();
+      const bool cameraLevels = tessellationCameraScale > 0.0f && (recalculate || update || vertices[0].isModified());
+      numHalfEdges = topology->numHalfEdges;
+      faceStartEdgeData = topology->faceStartEdge.data();
+      levelUpdate = !recalculate && !topology->hasCreases() && update;
+      if (recalculate || update) setTopologyHalfEdges();
+      if (cameraLevels) calculateCameraLevels();
+      if (recalculate || vertices[0].isModified()) calculateInvalidFaces();
+      if (PersistentTessellationCache::persistentTessellationCache.enabled() && (contentHash == 0 || vertices[0].isModified()))
+        updateContentHash();
+    }
+    else
+    {
+      /* allocate half edge array */
+      halfEdges.resize(numEdges);
+      halfEdgeData = halfEdges.data();
     
-    /* calculate start edge of each face */
-    faceStartEdge.resize(numFaces);
-    if (faceVertices.isModified()) 
-      numHalfEdges = parallel_prefix_sum(faceVertices,faceStartEdge,numFaces,std::plus<int>());
-
-    /* create set with all holes */
-    if (holes.isModified())
-      holeSet.init(holes);
-
-    /* create set with all vertex creases */
-    if (vertex_creases.isModified() || vertex_crease_weights.isModified())
-      vertexCreaseMap.init(vertex_creases,vertex_crease_weights);
+      /* calculate start edge of each face */
+      faceStartEdge.resize(numFaces);
+      faceStartEdgeData = faceStartEdge.data();
+      if (faceVertices.isModified()) 
+        numHalfEdges = parallel_prefix_sum(faceVertices,faceStartEdge,numFaces,std::plus<int>());
+
+      /* create set with all holes */
+      if (holes.isModified())
+        holeSet.init(holes);
+
+      /* create set with all vertex creases */
+      if (vertex_creases.isModified() || vertex_crease_weights.isModified())
+        vertexCreaseMap.init(vertex_creases,vertex_crease_weights);
     
-    /* create map with all edge creases */
-    if (edge_creases.isModified() || edge_crease_weights.isModified())
-      edgeCreaseMap.init(edge_creases,edge_crease_weights);
-
-    /* check if we have to recalculate the half edges */
-    bool recalculate = false;
-    recalculate |= vertexIndices.isModified(); 
-    recalculate |= faceVertices.isModified();
-    recalculate |= holes.isModified();
-
-    /* check if we can simply update the half edges */
-    bool update = false;
-    update |= edge_creases.isModified();
-    update |= edge_crease_weights.isModified();
-    update |= vertex_creases.isModified();
-    update |= vertex_crease_weights.isModified(); 
-    update |= levels.isModified();
+      /* create map with all edge creases */
+      if (edge_creases.isModified() || edge_crease_weights.isModified())
+        edgeCreaseMap.init(edge_creases,edge_crease_weights);
+
+      /* check if we have to recalculate the half edges */
+      bool recalculate = false;
+      recalculate |= vertexIndices.isModified(); 
+      recalculate |= faceVertices.isModified();
+      recalculate |= holes.isModified();
+
+      /* check if we can simply update the half edges */
+      bool update = false;
+      update |= edge_creases.isModified();
+      update |= edge_crease_weights.isModified();
+      update |= vertex_creases.isModified();
+      update |= vertex_crease_weights.isModified(); 
+      update |= levels.isModified();
+
+      /* camera driven edge levels have to follow the vertices */
+      const bool cameraLevels = tessellationCameraScale > 0.0f && (recalculate || levels.isModified() || vertices[0].isModified());
     
-    /* check whether we can simply update the bvh in cached mode */
-    levelUpdate = !recalculate && edge_creases.size() == 0 && vertex_creases.size() == 0 && levels.isModified();
+      /* check whether we can simply update the bvh in cached mode */
+      levelUpdate = !recalculate && edge_creases.size() == 0 && vertex_creases.size() == 0 && levels.isModified();
+
+      /* now either recalculate or update the half edges */
+      if (recalculate) calculateHalfEdges();
+      else if (update) updateHalfEdges();
+      if (cameraLevels) calculateCameraLevels();
+
+      /* cleanup some state for static scenes */
+      if (parent->isStatic()) 
+      {
+        holeSet.cleanup();
+        halfEdges0.clear();
+        halfEdges1.clear();
+        vertexCreaseMap.clear();
+        edgeCreaseMap.clear();
+      }
 
-    /* now either recalculate or update the half edges */
-    if (recalculate) calculateHalfEdges();
-    else if (update) updateHalfEdges();
+      /* identify the mesh content for the persistent tessellation cache */
+      if (PersistentTessellationCache::persistentTessellationCache.enabled() && (contentHash == 0 || recalculate || update || vertices[0].isModified()))
+        updateContentHash();
+    }
 
     /* create interpolation cache mapping for interpolatable meshes */
     if (parent->isInterpolatable()) 
@@ -503,16 +758,6 @@ namespace embree
       }
     }
 
-    /* cleanup some state for static scenes */
-    if (parent->isStatic()) 
-    {
-      holeSet.cleanup();
-      halfEdges0.clear();
-      halfEdges1.clear();
-      vertexCreaseMap.clear();
-      edgeCreaseMap.clear();
-    }
-
     /* clear modified state of all buffers */
     vertexIndices.setModified(false); 
     faceVertices.setModified(false);
@@ -534,9 +779,9 @@ namespace embree
       size_t numIrregularQuadFaces = 0;
       size_t numComplexFaces = 0;
 
-      for (size_t e=0, f=0; f<numFaces; e+=faceVertices[f++]) 
+      for (size_t f=0; f<numFaces; f++) 
       {
-        switch (halfEdges[e].patch_type) {
+        switch (getHalfEdge(f)->patch_type) {
         case HalfEdge::REGULAR_QUAD_PATCH  : numRegularQuadFaces++;   break;
         case HalfEdge::IRREGULAR_QUAD_PATCH: numIrregularQuadFaces++; break;
         case HalfEdge::COMPLEX_PATCH       : numComplexFaces++;   break;
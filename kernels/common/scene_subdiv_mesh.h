@@ -27,6 +27,8 @@
 
 namespace embree
 {
+  class SubdivTopology;
+
   class SubdivMesh : public Geometry
   {
     ALIGNED_CLASS;
@@ -78,7 +80,10 @@ namespace embree
 
     /*! subdiv mesh construction */
     SubdivMesh(Scene* parent, RTCGeometryFlags flags, size_t numFaces, size_t numEdges, size_t numVertices, 
-               size_t numCreases, size_t numCorners, size_t numHoles, size_t numTimeSteps);
+               size_t numCreases, size_t numCorners, size_t numHoles, size_t numTimeSteps, SubdivTopology* topology = nullptr);
+
+    /*! subdiv mesh destruction */
+    ~SubdivMesh();
 
   public:
     void enabling();
@@ -91,9 +96,11 @@ namespace embree
     void update ();
     void updateBuffer (RTCBufferType type);
     void setTessellationRate(float N);
+    void setTessellationCamera(const RTCCamera* camera, float pixelsPerEdge);
     void immutable ();
     bool verify ();
     void setDisplacementFunction (RTCDisplacementFunc func, RTCBounds* bounds);
+    void setDisplacementFunctionN (RTCDisplacementFuncN func, RTCDisplacementFlags flags);
     void interpolate(unsigned primID, float u, float v, RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats);
     void interpolateN(const void* valid_i, const unsigned* primIDs, const float* u, const float* v, size_t numUVs, 
                       RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats);
@@ -107,7 +114,7 @@ namespace embree
 
     /*! calculates the bounds of the i'th subdivision patch */
     __forceinline BBox3fa bounds(size_t i) const {
-      return halfEdges[faceStartEdge[i]].bounds(vertices[0]);
+      return getHalfEdge(i)->bounds(vertices[0]);
     }
 
     /*! check if the i'th primitive is valid */
@@ -122,20 +129,42 @@ namespace embree
 
     /*! initializes the half edge data structure */
     void initializeHalfEdgeStructures ();
+
+    /*! creates the half edges of a topology, the edge levels are
+     *  initialized from the level buffer or tessellation rate, and
+     *  hole faces and faces with invalid vertices (if a vertex buffer
+     *  is passed) get marked as invalid */
+    static void calculateHalfEdges(size_t numFaces, size_t numHalfEdges, const BufferT<int>& faceVertices, const BufferT<unsigned>& vertexIndices, 
+                                   const mvector<uint32_t>& faceStartEdge, const pset<uint32_t>& holeSet, 
+                                   const pmap<uint32_t,float>& vertexCreaseMap, const pmap<uint64_t,float>& edgeCreaseMap, RTCBoundaryMode boundary,
+                                   const BufferT<float>& levels, float tessellationRate, const BufferT<Vec3fa>* vertices,
+                                   HalfEdge* halfEdges, mvector<char>& invalidFace, std::vector<KeyHalfEdge>& halfEdges0, std::vector<KeyHalfEdge>& halfEdges1);
  
   private:
 
     /*! recalculates the half edges */
     void calculateHalfEdges();
 
+    /*! selects the half edges of the shared topology to use and initializes their edge levels */
+    void setTopologyHalfEdges();
+
+    /*! marks faces of the shared topology as invalid */
+    void calculateInvalidFaces();
+
     /*! updates half edges when recalculation is not necessary */
     void updateHalfEdges();
 
+    /*! calculates the edge levels of all half edges from the tessellation camera */
+    void calculateCameraLevels();
+
+    /*! recalculates the content hash */
+    void updateContentHash();
+
   public:
 
     /*! returns the start half edge for some face */
     __forceinline const HalfEdge* getHalfEdge ( const size_t f ) const { 
-      return &halfEdges[faceStartEdge[f]]; 
+      return &halfEdgeData[faceStartEdgeData[f]]; 
     }    
 
     /*! returns the vertex buffer for some time step */
@@ -147,15 +176,21 @@ namespace embree
     __forceinline bool checkLevelUpdate() const { return levelUpdate; }
 
     /* returns tessellation level of edge */
-    __forceinline float getEdgeLevel(const size_t i) const
+    static __forceinline float getEdgeLevel(const BufferT<float>& levels, const float tessellationRate, const size_t i)
     {
       if (levels) return clamp(levels[i],1.0f,4096.0f); // FIXME: do we want to limit edge level?
       else return clamp(tessellationRate,1.0f,4096.0f); // FIXME: do we want to limit edge level?
     }
 
+    __forceinline float getEdgeLevel(const size_t i) const {
+      return getEdgeLevel(levels,tessellationRate,i);
+    }
+
   public:
     RTCDisplacementFunc displFunc;    //!< displacement function
     BBox3fa             displBounds;  //!< bounds for maximal displacement 
+    RTCDisplacementFuncN displFuncN;  //!< SIMD displacement function
+    RTCDisplacementFlags displFlags;  //!< flags of the SIMD displacement function
 
   private:
     size_t numFaces;           //!< number of faces
@@ -194,9 +229,16 @@ namespace embree
     BufferT<float> levels;
     float tessellationRate;  // constant rate that is used when levels is not set
 
+    /*! camera used to calculate the edge levels, the scale is zero when no camera is set */
+    Vec3fa tessellationCameraOrg;
+    float tessellationCameraScale;
+
     /*! buffer that marks specific faces as holes */
     BufferT<unsigned> holes;
 
+    /*! shared topology the half edges are taken from, or NULL if the mesh has its own topology */
+    SubdivTopology* topology;
+
     /*! all data in this section is generated by initializeHalfEdgeStructures function */
   private:
 
@@ -215,6 +257,13 @@ namespace embree
     /*! fast lookup table to detect invalid faces */
     mvector<char> invalidFace;
 
+    /*! half edges and face start edges in use, either owned by this mesh or by the shared topology */
+    HalfEdge* halfEdgeData;
+    const uint32_t* faceStartEdgeData;
+
+    /*! half edges shared with all meshes of the topology that use the same uniform edge level */
+    std::shared_ptr<mvector<HalfEdge>> uniformHalfEdges;
+
     /*! flag whether only the edge levels have changed and the mesh has no creases,
      *  allows for simple bvh update instead of full rebuild in cached mode */
     bool levelUpdate;
@@ -235,6 +284,12 @@ namespace embree
     std::vector<SharedLazyTessellationCache::CacheEntry> vertex_buffer_tags[2];
     std::vector<SharedLazyTessellationCache::CacheEntry> user_buffer_tags[2];
     std::vector<Patch3fa::Ref> patch_eval_trees;
+
+    /*! hash over all buffers that define the surface, identifies the mesh in the persistent tessellation cache */
+    uint64_t contentHash;
+
+    /*! hashes the first elementBytes of each element of some buffer */
+    static uint64_t hashBuffer(const Buffer& buffer, const size_t elementBytes, const uint64_t seed);
       
     /*! the following data is only required during construction of the
      *  half edge structure and can be cleared for static scenes */
@@ -256,7 +311,7 @@ namespace embree
   public:
     //using SubdivMesh::SubdivMesh; // inherit all constructors // FIXME: compiler bug under VS2013
     SubdivMeshAVX (Scene* parent, RTCGeometryFlags flags, size_t numFaces, size_t numEdges, size_t numVertices, 
-                  size_t numCreases, size_t numCorners, size_t numHoles, size_t numTimeSteps);
+                  size_t numCreases, size_t numCorners, size_t numHoles, size_t numTimeSteps, SubdivTopology* topology = nullptr);
 
     void interpolate(unsigned primID, float u, float v, RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats);
     void interpolateN(const void* valid_i, const unsigned* primIDs, const float* u, const float* v, size_t numUVs, 
@@ -22,8 +22,8 @@
 namespace embree
 {
   SubdivMeshAVX::SubdivMeshAVX(Scene* parent, RTCGeometryFlags flags, size_t numFaces, size_t numEdges, size_t numVertices, 
-                               size_t numCreases, size_t numCorners, size_t numHoles, size_t numTimeSteps)
-                               : SubdivMesh(parent,flags,numFaces,numEdges,numVertices,numCreases,numCorners,numHoles,numTimeSteps) {}
+                               size_t numCreases, size_t numCorners, size_t numHoles, size_t numTimeSteps, SubdivTopology* topology)
+                               : SubdivMesh(parent,flags,numFaces,numEdges,numVertices,numCreases,numCorners,numHoles,numTimeSteps,topology) {}
     
   void SubdivMeshAVX::interpolate(unsigned primID, float u, float v, RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats) 
   {
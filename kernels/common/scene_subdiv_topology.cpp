@@ -0,0 +1,175 @@
+// ======================================================================== //
+// Copyright 2009-2015 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#include "scene_subdiv_topology.h"
+#include "device.h"
+#include "subdiv/tessellation_cache.h"
+
+#include "../algorithms/prefix.h"
+#include "../algorithms/parallel_for.h"
+
+namespace embree
+{
+  SubdivTopology::SubdivTopology (Device* device, size_t numFaces, size_t numEdges, size_t numVertices,
+                                  size_t numEdgeCreases, size_t numVertexCreases, size_t numHoles)
+    : device(device),
+      numFaces(numFaces),
+      numEdges(numEdges),
+      numVertices(numVertices),
+      numEdgeCreases(numEdgeCreases),
+      numVertexCreases(numVertexCreases),
+      numHalfEdges(0),
+      boundary(RTC_BOUNDARY_EDGE_ONLY),
+      committed(false),
+      faceStartEdge(device),
+      halfEdges(device),
+      holeFace(device),
+      contentHash(0)
+  {
+    vertexIndices.init(device,numEdges,sizeof(unsigned int));
+    faceVertices.init(device,numFaces,sizeof(unsigned int));
+    holes.init(device,numHoles,sizeof(int));
+    edge_creases.init(device,numEdgeCreases,2*sizeof(unsigned int));
+    edge_crease_weights.init(device,numEdgeCreases,sizeof(float));
+    vertex_creases.init(device,numVertexCreases,sizeof(unsigned int));
+    vertex_crease_weights.init(device,numVertexCreases,sizeof(float));
+  }
+
+  void SubdivTopology::setBuffer(RTCBufferType type, void* ptr, size_t offset, size_t stride)
+  {
+    if (committed)
+      throw_RTCError(RTC_INVALID_OPERATION,"committed topologies cannot get modified");
+
+    /* verify that all accesses are 4 bytes aligned */
+    if (((size_t(ptr) + offset) & 0x3) || (stride & 0x3))
+      throw_RTCError(RTC_INVALID_OPERATION,"data must be 4 bytes aligned");
+
+    switch (type) {
+    case RTC_INDEX_BUFFER               : vertexIndices.set(ptr,offset,stride); break;
+    case RTC_FACE_BUFFER                : faceVertices.set(ptr,offset,stride); break;
+    case RTC_HOLE_BUFFER                : holes.set(ptr,offset,stride); break;
+    case RTC_EDGE_CREASE_INDEX_BUFFER   : edge_creases.set(ptr,offset,stride); break;
+    case RTC_EDGE_CREASE_WEIGHT_BUFFER  : edge_crease_weights.set(ptr,offset,stride); break;
+    case RTC_VERTEX_CREASE_INDEX_BUFFER : vertex_creases.set(ptr,offset,stride); break;
+    case RTC_VERTEX_CREASE_WEIGHT_BUFFER: vertex_crease_weights.set(ptr,offset,stride); break;
+    default:
+      throw_RTCError(RTC_INVALID_ARGUMENT,"unknown buffer type");
+    }
+  }
+
+  void SubdivTopology::setBoundaryMode (RTCBoundaryMode mode)
+  {
+    if (committed)
+      throw_RTCError(RTC_INVALID_OPERATION,"committed topologies cannot get modified");
+
+    boundary = mode;
+  }
+
+  bool SubdivTopology::verify ()
+  {
+    /*! all buffers have to get specified */
+    if (!faceVertices || !vertexIndices) return false;
+    if (holes.size() && !holes) return false;
+    if (edge_creases.size() && (!edge_creases || !edge_crease_weights)) return false;
+    if (vertex_creases.size() && (!vertex_creases || !vertex_crease_weights)) return false;
+
+    /*! verify vertex indices */
+    size_t ofs = 0;
+    for (size_t i=0; i<numFaces; i++)
+    {
+      const int valence = faceVertices[i];
+      if (valence < 0 || ofs+valence > numEdges)
+        return false;
+
+      for (size_t j=ofs; j<ofs+valence; j++) {
+        if (vertexIndices[j] >= numVertices)
+          return false;
+      }
+      ofs += valence;
+    }
+    return true;
+  }
+
+  void SubdivTopology::commit ()
+  {
+    if (committed)
+      throw_RTCError(RTC_INVALID_OPERATION,"topology got already committed");
+
+    if (!verify())
+      throw_RTCError(RTC_INVALID_ARGUMENT,"invalid topology");
+
+    /* calculate start edge of each face */
+    faceStartEdge.resize(numFaces);
+    numHalfEdges = parallel_prefix_sum(faceVertices,faceStartEdge,numFaces,std::plus<int>());
+
+    /* the sets and maps are only required during construction */
+    pset<uint32_t> holeSet(holes);
+    pmap<uint32_t,float> vertexCreaseMap; vertexCreaseMap.init(vertex_creases,vertex_crease_weights);
+    pmap<uint64_t,float> edgeCreaseMap; edgeCreaseMap.init(edge_creases,edge_crease_weights);
+    std::vector<SubdivMesh::KeyHalfEdge> halfEdges0, halfEdges1;
+
+    /* calculate half edges with unit edge levels, the meshes set their own levels */
+    BufferT<float> noLevels;
+    halfEdges.resize(numEdges);
+    SubdivMesh::calculateHalfEdges(numFaces,numHalfEdges,faceVertices,vertexIndices,faceStartEdge,holeSet,vertexCreaseMap,edgeCreaseMap,boundary,
+                                   noLevels,1.0f,nullptr,halfEdges.data(),holeFace,halfEdges0,halfEdges1);
+
+    /* identify the topology in the persistent tessellation cache */
+    if (PersistentTessellationCache::persistentTessellationCache.enabled())
+    {
+      uint64_t h = PersistentTessellationCache::hash(&boundary,sizeof(boundary),0);
+      h = SubdivMesh::hashBuffer(faceVertices,sizeof(int),h);
+      h = SubdivMesh::hashBuffer(vertexIndices,sizeof(unsigned),h);
+      h = SubdivMesh::hashBuffer(edge_creases,sizeof(SubdivMesh::Edge),h);
+      h = SubdivMesh::hashBuffer(edge_crease_weights,sizeof(float),h);
+      h = SubdivMesh::hashBuffer(vertex_creases,sizeof(unsigned),h);
+      h = SubdivMesh::hashBuffer(vertex_crease_weights,sizeof(float),h);
+      h = SubdivMesh::hashBuffer(holes,sizeof(unsigned),h);
+      contentHash = h ? h : 1;
+    }
+    committed = true;
+  }
+
+  std::shared_ptr<mvector<HalfEdge>> SubdivTopology::getUniformHalfEdges(float level)
+  {
+    Lock<MutexSys> lock(mutex);
+
+    /* reuse the half edges of some other mesh with the same level, and drop entries no mesh uses anymore */
+    std::shared_ptr<mvector<HalfEdge>> edges;
+    for (size_t i=0; i<uniformHalfEdges.size(); )
+    {
+      std::shared_ptr<mvector<HalfEdge>> e = uniformHalfEdges[i].second.lock();
+      if (e == nullptr) {
+        uniformHalfEdges[i] = uniformHalfEdges.back();
+        uniformHalfEdges.pop_back();
+        continue;
+      }
+      if (uniformHalfEdges[i].first == level) edges = e;
+      i++;
+    }
+    if (edges) return edges;
+
+    /* otherwise copy the half edges and set the new level */
+    edges = std::make_shared<mvector<HalfEdge>>(device);
+    edges->resize(numHalfEdges);
+    for (size_t i=0; i<numHalfEdges; i++) {
+      (*edges)[i] = halfEdges[i];
+      (*edges)[i].edge_level = level;
+    }
+    uniformHalfEdges.push_back(std::make_pair(level,std::weak_ptr<mvector<HalfEdge>>(edges)));
+    return edges;
+  }
+}
@@ -0,0 +1,101 @@
+// ======================================================================== //
+// Copyright 2009-2015 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "scene_subdiv_mesh.h"
+
+namespace embree
+{
+  class Device;
+
+  /*! Topology of a subdivision mesh that can get referenced by many
+   *  subdivision meshes. The half edge structure including creases,
+   *  holes, and patch types gets calculated once at commit, the
+   *  meshes only provide vertices and edge levels. */
+  class SubdivTopology : public RefCount
+  {
+    ALIGNED_CLASS;
+  public:
+
+    /*! topology construction */
+    SubdivTopology (Device* device, size_t numFaces, size_t numEdges, size_t numVertices,
+                    size_t numEdgeCreases, size_t numVertexCreases, size_t numHoles);
+
+  public:
+    void setBuffer(RTCBufferType type, void* ptr, size_t offset, size_t stride);
+    void setBoundaryMode (RTCBoundaryMode mode);
+    void commit ();
+
+    /*! checks if the topology got committed */
+    __forceinline bool isCommitted() const {
+      return committed;
+    }
+
+    /*! checks if some creases are specified */
+    __forceinline bool hasCreases() const {
+      return numEdgeCreases || numVertexCreases;
+    }
+
+    /*! returns half edges with the specified uniform edge level, these are shared by all meshes that use the same level */
+    std::shared_ptr<mvector<HalfEdge>> getUniformHalfEdges(float level);
+
+  private:
+
+    /*! verifies the vertex indices */
+    bool verify ();
+
+  public:
+    Device* device;            //!< device the topology belongs to
+    size_t numFaces;           //!< number of faces
+    size_t numEdges;           //!< number of edges
+    size_t numVertices;        //!< number of vertices
+    size_t numEdgeCreases;     //!< number of edge creases
+    size_t numVertexCreases;   //!< number of vertex creases
+    size_t numHalfEdges;       //!< number of half edges used by faces
+    RTCBoundaryMode boundary;  //!< boundary interpolation mode
+    bool committed;            //!< set after the half edges got calculated
+
+    /*! all buffers in this section are provided by the application and only accessed during commit */
+  private:
+    BufferT<int> faceVertices;
+    BufferT<unsigned> vertexIndices;
+    BufferT<SubdivMesh::Edge> edge_creases;
+    BufferT<float> edge_crease_weights;
+    BufferT<unsigned> vertex_creases;
+    BufferT<float> vertex_crease_weights;
+    BufferT<unsigned> holes;
+
+    /*! all data in this section is generated by the commit */
+  public:
+
+    /*! fast lookup table to find the first half edge for some face */
+    mvector<uint32_t> faceStartEdge;
+
+    /*! half edge structure with unit edge levels */
+    mvector<HalfEdge> halfEdges;
+
+    /*! marks all hole faces */
+    mvector<char> holeFace;
+
+    /*! hash over all buffers of the topology, part of the content hash of the meshes */
+    uint64_t contentHash;
+
+  private:
+    MutexSys mutex;
+    std::vector<std::pair<float,std::weak_ptr<mvector<HalfEdge>>>> uniformHalfEdges;
+  };
+};
@@ -16,12 +16,15 @@
 
 #include "scene_triangle_mesh.h"
 #include "scene.h"
+#include "../algorithms/parallel_for.h"
 
 namespace embree
 {
 
   TriangleMesh::TriangleMesh (Scene* parent, RTCGeometryFlags flags, size_t numTriangles, size_t numVertices, size_t numTimeSteps)
-    : Geometry(parent,TRIANGLE_MESH,numTriangles,numTimeSteps,flags)
+    : Geometry(parent,TRIANGLE_MESH,numTriangles,numTimeSteps,flags), opacityLevel(-1),
+      compressedTriangles0(parent->device), compressedTriangles1(parent->device), compressed(&compressedTriangles0), encoded(&compressedTriangles0),
+      modifiedRangesOnly(false), vertexTriangleOffsets(parent->device), vertexTriangles(parent->device)
   {
     triangles.init(parent->device,numTriangles,sizeof(Triangle));
     for (size_t i=0; i<numTimeSteps; i++) {
@@ -51,6 +54,114 @@ namespace embree
     Geometry::update();
   }
 
+  void TriangleMesh::update () 
+  {
+    Geometry::update();
+    modifiedRangesOnly = false;
+    vertexTriangles.clear();
+  }
+
+  void TriangleMesh::updateBufferRange (RTCBufferType type, size_t offset, size_t num) 
+  {
+    if (type >= RTC_VERTEX_BUFFER0 && type < RTC_VERTEX_BUFFER0+numTimeSteps) 
+    {
+      if (offset+num > numVertices()) 
+        throw_RTCError(RTC_INVALID_ARGUMENT,"vertex range out of bounds");
+      Geometry::update();
+      modifiedVertexRanges.push_back(std::make_pair(offset,offset+num));
+    }
+    else if (type == RTC_INDEX_BUFFER) 
+    {
+      if (offset+num > size()) 
+        throw_RTCError(RTC_INVALID_ARGUMENT,"triangle range out of bounds");
+      Geometry::update();
+      modifiedTriangleRanges.push_back(std::make_pair(offset,offset+num));
+      vertexTriangles.clear();
+    }
+    else 
+      updateBuffer(type);
+  }
+
+  bool TriangleMesh::getModifiedPrimitives (std::vector<unsigned>& primIDs)
+  {
+    if (!modifiedRangesOnly) 
+      return false;
+
+    for (size_t i=0; i<modifiedTriangleRanges.size(); i++) 
+      for (size_t j=modifiedTriangleRanges[i].first; j<modifiedTriangleRanges[i].second; j++)
+        primIDs.push_back(unsigned(j));
+
+    if (modifiedVertexRanges.size() == 0) 
+      return true;
+
+    /* count triangles per vertex and store triangle IDs sorted by vertex */
+    if (vertexTriangles.size() == 0) 
+    {
+      vertexTriangleOffsets.resize(numVertices()+1);
+      for (size_t v=0; v<=numVertices(); v++) vertexTriangleOffsets[v] = 0;
+      for (size_t i=0; i<size(); i++)
+        for (size_t k=0; k<3; k++) 
+          vertexTriangleOffsets[triangle(i).v[k]+1]++;
+      for (size_t v=0; v<numVertices(); v++) 
+        vertexTriangleOffsets[v+1] += vertexTriangleOffsets[v];
+
+      vertexTriangles.resize(3*size());
+      for (size_t i=0; i<size(); i++)
+        for (size_t k=0; k<3; k++) 
+          vertexTriangles[vertexTriangleOffsets[triangle(i).v[k]]++] = unsigned(i);
+      for (size_t v=numVertices(); v>0; v--) 
+        vertexTriangleOffsets[v] = vertexTriangleOffsets[v-1];
+      vertexTriangleOffsets[0] = 0;
+    }
+
+    for (size_t i=0; i<modifiedVertexRanges.size(); i++) 
+      for (size_t v=modifiedVertexRanges[i].first; v<modifiedVertexRanges[i].second; v++)
+        for (size_t j=vertexTriangleOffsets[v]; j<vertexTriangleOffsets[v+1]; j++)
+          primIDs.push_back(vertexTriangles[j]);
+
+    return true;
+  }
+
+  void TriangleMesh::clearModified () 
+  {
+    Geometry::clearModified();
+    modifiedVertexRanges.clear();
+    modifiedTriangleRanges.clear();
+    modifiedRangesOnly = true;
+  }
+
+  void TriangleMesh::setOpacityMicroMapLevel (unsigned level) 
+  {
+    if (parent->isStatic() && parent->isBuild())
+      throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
+
+    if (level > 6)
+      throw_RTCError(RTC_INVALID_OPERATION,"opacity micro map level has to be in the range [0,6]");
+
+    /* the filter enabled intersectors have to get used for packets once a micro map is attached */
+    if (opacityLevel < 0 && isEnabled()) {
+      atomic_add(&parent->numIntersectionFilters4,1);
+      atomic_add(&parent->numIntersectionFilters8,1);
+      atomic_add(&parent->numIntersectionFilters16,1);
+    }
+
+    /* 2 bits per micro triangle, padded to 4 bytes per triangle */
+    opacityLevel = level;
+    opacityStates.free();
+    opacityStates.init(parent->device,triangles.size(),max(size_t(4),(size_t(1) << (2*level))/4));
+    Geometry::update();
+  }
+
+  void TriangleMesh::updateIntersectionFilters(bool enable)
+  {
+    Geometry::updateIntersectionFilters(enable);
+    if (opacityLevel < 0) return;
+    const int delta = enable ? 1 : -1;
+    atomic_add(&parent->numIntersectionFilters4,delta);
+    atomic_add(&parent->numIntersectionFilters8,delta);
+    atomic_add(&parent->numIntersectionFilters16,delta);
+  }
+
   void TriangleMesh::setBuffer(RTCBufferType type, void* ptr, size_t offset, size_t stride) 
   { 
     if (parent->isStatic() && parent->isBuild()) 
@@ -60,18 +171,18 @@ namespace embree
     if (((size_t(ptr) + offset) & 0x3) || (stride & 0x3)) 
       throw_RTCError(RTC_INVALID_OPERATION,"data must be 4 bytes aligned");
 
+    if (type >= RTC_VERTEX_BUFFER0 && type < RTC_VERTEX_BUFFER0+RTC_MAX_TIME_STEPS) 
+    {
+      const size_t t = type - RTC_VERTEX_BUFFER0;
+      vertices[t].set(ptr,offset,stride); 
+      vertices[t].checkPadding16();
+      return;
+    }
+
     switch (type) {
     case RTC_INDEX_BUFFER  : 
       triangles.set(ptr,offset,stride); 
       break;
-    case RTC_VERTEX_BUFFER0: 
-      vertices[0].set(ptr,offset,stride); 
-      vertices[0].checkPadding16();
-      break;
-    case RTC_VERTEX_BUFFER1: 
-      vertices[1].set(ptr,offset,stride); 
-      vertices[1].checkPadding16();
-      break;
     case RTC_USER_VERTEX_BUFFER0: 
       if (userbuffers[0] == nullptr) userbuffers[0].reset(new Buffer(parent->device,numVertices(),stride)); 
       userbuffers[0]->set(ptr,offset,stride);  
@@ -82,6 +193,9 @@ namespace embree
       userbuffers[1]->set(ptr,offset,stride);  
       userbuffers[1]->checkPadding16();
       break;
+    case RTC_OPACITY_BUFFER: 
+      opacityStates.set(ptr,offset,stride); 
+      break;
 
     default: 
       throw_RTCError(RTC_INVALID_ARGUMENT,"unknown buffer type");
@@ -93,10 +207,12 @@ namespace embree
     if (parent->isStatic() && parent->isBuild())
       throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
 
+    if (type >= RTC_VERTEX_BUFFER0 && type < RTC_VERTEX_BUFFER0+RTC_MAX_TIME_STEPS)
+      return vertices[type - RTC_VERTEX_BUFFER0].map(parent->numMappedBuffers);
+
     switch (type) {
     case RTC_INDEX_BUFFER  : return triangles.map(parent->numMappedBuffers);
-    case RTC_VERTEX_BUFFER0: return vertices[0].map(parent->numMappedBuffers);
-    case RTC_VERTEX_BUFFER1: return vertices[1].map(parent->numMappedBuffers);
+    case RTC_OPACITY_BUFFER: return opacityStates.map(parent->numMappedBuffers);
     default                : throw_RTCError(RTC_INVALID_ARGUMENT,"unknown buffer type"); return nullptr;
     }
   }
@@ -106,10 +222,14 @@ namespace embree
     if (parent->isStatic() && parent->isBuild())
       throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
 
+    if (type >= RTC_VERTEX_BUFFER0 && type < RTC_VERTEX_BUFFER0+RTC_MAX_TIME_STEPS) {
+      vertices[type - RTC_VERTEX_BUFFER0].unmap(parent->numMappedBuffers);
+      return;
+    }
+
     switch (type) {
-    case RTC_INDEX_BUFFER  : triangles  .unmap(parent->numMappedBuffers); break;
-    case RTC_VERTEX_BUFFER0: vertices[0].unmap(parent->numMappedBuffers); break;
-    case RTC_VERTEX_BUFFER1: vertices[1].unmap(parent->numMappedBuffers); break;
+    case RTC_INDEX_BUFFER  : triangles.unmap(parent->numMappedBuffers); break;
+    case RTC_OPACITY_BUFFER: opacityStates.unmap(parent->numMappedBuffers); break;
     default                : throw_RTCError(RTC_INVALID_ARGUMENT,"unknown buffer type"); break;
     }
   }
@@ -119,14 +239,77 @@ namespace embree
     const bool freeTriangles = !parent->needTriangleIndices;
     const bool freeVertices  = !parent->needTriangleVertices;
     if (freeTriangles) triangles.free(); 
-    if (freeVertices ) vertices[0].free();
-    if (freeVertices ) vertices[1].free();
+    if (freeVertices ) 
+      for (size_t i=0; i<numTimeSteps; i++) vertices[i].free();
+  }
+
+  void TriangleMesh::compressTriangles()
+  {
+    const size_t numTriangles = size();
+    const size_t numClusters = (numTriangles+COMPRESSED_CLUSTER_SIZE-1)/COMPRESSED_CLUSTER_SIZE;
+
+    /* never overwrite the published representation, an unpublished one is not traversed and can get reused */
+    if (encoded == compressed) encoded = encoded == &compressedTriangles0 ? &compressedTriangles1 : &compressedTriangles0;
+    mvector<CompressedCluster>& compressedClusters = encoded->clusters;
+    mvector<unsigned char>& compressedIndices = encoded->indices;
+    compressedClusters.resize(numClusters);
+
+    /* select the smallest local index size each cluster can be encoded with */
+    parallel_for(size_t(0), numClusters, size_t(1024), [&](const range<size_t>& r) 
+    {
+      for (size_t c=r.begin(); c<r.end(); c++)
+      {
+        uint32_t lower = -1, upper = 0;
+        for (size_t i=c*COMPRESSED_CLUSTER_SIZE; i<min(numTriangles,(c+1)*COMPRESSED_CLUSTER_SIZE); i++) 
+        {
+          const Triangle& tri = triangle(i);
+          for (size_t k=0; k<3; k++) {
+            if (tri.v[k] < lower) lower = tri.v[k];
+            if (tri.v[k] > upper) upper = tri.v[k];
+          }
+        }
+        const uint32_t extent = upper-lower;
+        compressedClusters[c].base = lower;
+        compressedClusters[c].bytes = extent < 0x100 ? 1 : extent < 0x10000 ? 2 : 4;
+      }
+    });
+
+    /* clusters with wider indices are aligned to their index size */
+    size_t offset = 0;
+    for (size_t c=0; c<numClusters; c++) {
+      const size_t bytes = compressedClusters[c].bytes;
+      offset = (offset+bytes-1)&(-bytes);
+      compressedClusters[c].offset = offset;
+      offset += 3*COMPRESSED_CLUSTER_SIZE*bytes;
+    }
+    compressedIndices.resize(offset);
+
+    parallel_for(size_t(0), numClusters, size_t(1024), [&](const range<size_t>& r) 
+    {
+      for (size_t c=r.begin(); c<r.end(); c++)
+      {
+        const CompressedCluster& cluster = compressedClusters[c];
+        unsigned char* local = compressedIndices.data() + cluster.offset;
+        for (size_t i=c*COMPRESSED_CLUSTER_SIZE, j=0; i<min(numTriangles,(c+1)*COMPRESSED_CLUSTER_SIZE); i++)
+        {
+          const Triangle& tri = triangle(i);
+          for (size_t k=0; k<3; k++, j++) 
+          {
+            const uint32_t v = tri.v[k]-cluster.base;
+            if      (cluster.bytes == 1) local[j] = v;
+            else if (cluster.bytes == 2) ((uint16_t*)local)[j] = v;
+            else                         ((uint32_t*)local)[j] = v;
+          }
+        }
+      }
+    });
   }
 
   bool TriangleMesh::verify () 
   {
     /*! verify consistent size of vertex arrays */
-    if (numTimeSteps == 2 && vertices[0].size() != vertices[1].size())
+    for (size_t i=1; i<numTimeSteps; i++)
+      if (vertices[0].size() != vertices[i].size())
         return false;
 
     /*! verify proper triangle indices */
@@ -157,7 +340,7 @@ namespace embree
 #endif
 
     /* calculate base pointer and stride */
-    assert((buffer >= RTC_VERTEX_BUFFER0 && buffer <= RTC_VERTEX_BUFFER1) ||
+    assert((buffer >= RTC_VERTEX_BUFFER0 && buffer < RTC_VERTEX_BUFFER0+RTC_MAX_TIME_STEPS) ||
            (buffer >= RTC_USER_VERTEX_BUFFER0 && buffer <= RTC_USER_VERTEX_BUFFER1));
     const char* src = nullptr; 
     size_t stride = 0;
@@ -194,6 +377,69 @@ namespace embree
     }
   }
 
+  void TriangleMesh::interpolateN(const void* valid_i, const unsigned* primIDs, const float* u, const float* v, size_t numUVs, 
+                                  RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats)
+  {
+    /* test if interpolation is enabled */
+#if defined(DEBUG)
+    if ((parent->aflags & RTC_INTERPOLATE) == 0) 
+      throw_RTCError(RTC_INVALID_OPERATION,"rtcInterpolate can only get called when RTC_INTERPOLATE is enabled for the scene");
+#endif
+
+    /* calculate base pointer and stride */
+    assert((buffer >= RTC_VERTEX_BUFFER0 && buffer < RTC_VERTEX_BUFFER0+RTC_MAX_TIME_STEPS) ||
+           (buffer >= RTC_USER_VERTEX_BUFFER0 && buffer <= RTC_USER_VERTEX_BUFFER1));
+    const char* src = nullptr; 
+    size_t stride = 0;
+    if (buffer >= RTC_USER_VERTEX_BUFFER0) {
+      src    = userbuffers[buffer&0xFFFF]->getPtr();
+      stride = userbuffers[buffer&0xFFFF]->getStride();
+    } else {
+      src    = vertices[buffer&0xFFFF].getPtr();
+      stride = vertices[buffer&0xFFFF].getStride();
+    }
+    const int* valid = (const int*) valid_i;
+
+    for (size_t i=0; i<numUVs; i+=VSIZEX)
+    {
+      /* gather the vertices of a block of hits, lanes of invalid hits load the first vertex of the buffer */
+      vboolx valid1 = false;
+      vfloatx uu = zero, vv = zero;
+      const char* p0[VSIZEX], *p1[VSIZEX], *p2[VSIZEX];
+      for (size_t k=0; k<VSIZEX; k++)
+      {
+        p0[k] = src; p1[k] = src; p2[k] = src;
+        if (i+k >= numUVs || (valid && !valid[i+k])) continue;
+        const Triangle& tri = triangle(primIDs[i+k]);
+        p0[k] = src+tri.v[0]*stride; p1[k] = src+tri.v[1]*stride; p2[k] = src+tri.v[2]*stride;
+        uu[k] = u[i+k]; vv[k] = v[i+k];
+        set(valid1,k);
+      }
+      if (none(valid1)) continue;
+
+      /* interpolate each component for all hits of the block in parallel */
+      for (size_t j=0; j<numFloats; j++)
+      {
+        const size_t ofs = j*sizeof(float);
+        const vfloatx v0 = gatherVertexFloat<VSIZEX>(p0,ofs);
+        const vfloatx v1 = gatherVertexFloat<VSIZEX>(p1,ofs);
+        const vfloatx v2 = gatherVertexFloat<VSIZEX>(p2,ofs);
+        if (P) {
+          vfloatx::storeu(valid1,P+j*numUVs+i,(1.0f-uu-vv)*v0 + uu*v1 + vv*v2);
+        }
+        if (dPdu) {
+          assert(dPdu); vfloatx::storeu(valid1,dPdu+j*numUVs+i,v1-v0);
+          assert(dPdv); vfloatx::storeu(valid1,dPdv+j*numUVs+i,v2-v0);
+        }
+        if (ddPdudu) {
+          assert(ddPdudu); vfloatx::storeu(valid1,ddPdudu+j*numUVs+i,vfloatx(zero));
+          assert(ddPdvdv); vfloatx::storeu(valid1,ddPdvdv+j*numUVs+i,vfloatx(zero));
+          assert(ddPdudv); vfloatx::storeu(valid1,ddPdudv+j*numUVs+i,vfloatx(zero));
+        }
+      }
+    }
+  }
+
   void TriangleMesh::write(std::ofstream& file)
   {
     int type = TRIANGLE_MESH;
@@ -103,7 +103,30 @@ namespace embree
       return -1;
     }
 
-    
+    /*! cluster of consecutive triangles of the compressed index
+     *  representation, the vertex indices of the cluster are stored
+     *  relative to the smallest index of the cluster using 1, 2, or 4
+     *  bytes per index */
+    struct CompressedCluster
+    {
+      uint32_t base;   //!< smallest vertex index of the cluster
+      uint32_t bytes;  //!< bytes per local vertex index
+      size_t offset;   //!< offset of the local vertex indices in the encoded index stream
+    };
+
+    /*! number of triangles per compressed cluster */
+    static const size_t COMPRESSED_CLUSTER_SIZE = 64;
+
+    /*! compressed index representation of all triangles of the mesh */
+    struct CompressedTriangles
+    {
+      CompressedTriangles (MemoryMonitorInterface* device)
+        : clusters(device), indices(device) {}
+
+      mvector<CompressedCluster> clusters;  //!< clusters of the compressed index representation
+      mvector<unsigned char> indices;       //!< local vertex indices of all clusters
+    };
+
   public:
 
     /*! triangle mesh construction */
@@ -117,13 +140,20 @@ namespace embree
     void enabling();
     void disabling();
     void setMask (unsigned mask);
+    void update ();
+    void updateBufferRange (RTCBufferType type, size_t offset, size_t num);
+    bool getModifiedPrimitives (std::vector<unsigned>& primIDs);
+    void clearModified ();
+    void setOpacityMicroMapLevel (unsigned level);
+    void updateIntersectionFilters(bool enable);
     void setBuffer(RTCBufferType type, void* ptr, size_t offset, size_t stride);
     void* map(RTCBufferType type);
     void unmap(RTCBufferType type);
     void immutable ();
     bool verify ();
     void interpolate(unsigned primID, float u, float v, RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats);
-    // FIXME: implement interpolateN
+    void interpolateN(const void* valid_i, const unsigned* primIDs, const float* u, const float* v, size_t numUVs, 
+                      RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats);
 
   public:
 
@@ -142,6 +172,40 @@ namespace embree
       return triangles[i];
     }
 
+    /*! losslessly encodes the index buffer into clusters with local
+     *  vertex indices, the encoding is used for traversal once it got
+     *  published */
+    void compressTriangles();
+
+    /*! makes traversal decode from the most recently encoded representation */
+    __forceinline void publishCompressedTriangles() {
+      __memory_barrier();
+      compressed = encoded;
+    }
+
+    /*! returns true if the most recently encoded representation is up to date */
+    __forceinline bool hasCompressedTriangles() const {
+      return encoded->clusters.size() == (size()+COMPRESSED_CLUSTER_SIZE-1)/COMPRESSED_CLUSTER_SIZE;
+    }
+
+    /*! decodes the vertex indices of the i'th triangle from the published compressed index representation */
+    __forceinline void compressedTriangle(size_t i, uint32_t& v0, uint32_t& v1, uint32_t& v2) const
+    {
+      const CompressedTriangles* c = compressed;
+      const CompressedCluster& cluster = c->clusters[i/COMPRESSED_CLUSTER_SIZE];
+      const size_t j = 3*(i%COMPRESSED_CLUSTER_SIZE);
+      const unsigned char* local = c->indices.data() + cluster.offset;
+      if (likely(cluster.bytes == 1)) {
+        v0 = cluster.base + local[j+0]; v1 = cluster.base + local[j+1]; v2 = cluster.base + local[j+2];
+      } else if (cluster.bytes == 2) {
+        const uint16_t* local16 = (const uint16_t*) local;
+        v0 = cluster.base + local16[j+0]; v1 = cluster.base + local16[j+1]; v2 = cluster.base + local16[j+2];
+      } else {
+        const uint32_t* local32 = (const uint32_t*) local;
+        v0 = cluster.base + local32[j+0]; v1 = cluster.base + local32[j+1]; v2 = cluster.base + local32[j+2];
+      }
+    }
+
     /*! returns i'th vertex of j'th timestep */
     __forceinline const Vec3fa vertex(size_t i, size_t j = 0) const {
       return vertices[j][i];
@@ -152,6 +216,16 @@ namespace embree
       return vertices[j].getPtr(i);
     }
 
+    /*! returns i'th vertex at time k/n, linearly interpolated between the enclosing timesteps */
+    __forceinline const Vec3fa vertexAtTime(size_t i, size_t k, size_t n) const 
+    {
+      const size_t j = (k*(numTimeSteps-1))/n;
+      const size_t r = (k*(numTimeSteps-1))%n;
+      if (r == 0) return vertex(i,j);
+      const float f = float(r)/float(n);
+      return (1.0f-f)*vertex(i,j) + f*vertex(i,j+1);
+    }
+
 #if defined(__MIC__)    
     /*! returns the stride in bytes of the triangle buffer */
     __forceinline size_t getTriangleBufferStride() const {
@@ -174,6 +248,61 @@ namespace embree
       return BBox3fa(min(v0,v1,v2),max(v0,v1,v2));
     }
 
+    /*! calculates the bounds of the i'th triangle at time k/n */
+    __forceinline BBox3fa bounds(size_t i, size_t k, size_t n) const
+    {
+      const Triangle& tri = triangle(i);
+      const Vec3fa v0 = vertexAtTime(tri.v[0],k,n);
+      const Vec3fa v1 = vertexAtTime(tri.v[1],k,n);
+      const Vec3fa v2 = vertexAtTime(tri.v[2],k,n);
+      return BBox3fa(min(v0,v1,v2),max(v0,v1,v2));
+    }
+
+    /*! calculates linear bounds of the i'th triangle for the time range
+     *  [k/n,(k+1)/n], the bounds also enclose the triangle at all timesteps
+     *  of the mesh that fall inside that time range */
+    __forceinline std::pair<BBox3fa,BBox3fa> linearBounds(size_t i, size_t k, size_t n) const 
+    {
+      BBox3fa b0 = bounds(i,k+0,n);
+      BBox3fa b1 = bounds(i,k+1,n);
+      const size_t m = numTimeSteps-1;
+      for (size_t j=(k*m)/n+1; j*n < (k+1)*m; j++) 
+      {
+        const float f = float(j*n-k*m)/float(m);
+        const BBox3fa bj = bounds(i,j,m);
+        const Vec3fa dlower = min(bj.lower-((1.0f-f)*b0.lower+f*b1.lower),Vec3fa(zero));
+        const Vec3fa dupper = max(bj.upper-((1.0f-f)*b0.upper+f*b1.upper),Vec3fa(zero));
+        b0.lower += dlower; b1.lower += dlower;
+        b0.upper += dupper; b1.upper += dupper;
+      }
+      return std::make_pair(b0,b1);
+    }
+
+    /*! checks if the motion of the mesh inside each of n time segments is linear, this is the case if its number of time segments divides n */
+    __forceinline bool isLinearInTimeSegments(size_t n) const {
+      return (n % (numTimeSteps-1)) == 0;
+    }
+
+    /*! returns true if an opacity micro map is attached to the mesh */
+    __forceinline bool hasOpacityMicroMap() const {
+      return opacityStates;
+    }
+
+    /*! returns the opacity state of the micro triangle of the i'th
+     *  triangle that contains the barycentric coordinates (u,v), micro
+     *  triangles are enumerated row by row along v */
+    __forceinline int opacity(size_t i, float u, float v) const
+    {
+      const int N = 1 << opacityLevel;
+      const float fu = u*float(N), fv = v*float(N);
+      const int y = min(max(int(fv),0),N-1);
+      const int x = min(max(int(fu),0),N-1-y);
+      const int upper = (fu-float(x))+(fv-float(y)) > 1.0f && x+y < N-1;
+      const size_t k = y*(2*N-y) + 2*x + upper;
+      const unsigned char* states = (const unsigned char*) opacityStates.getPtr(i);
+      return (states[k>>2] >> (2*(k&3))) & 3;
+    }
+
     /*! check if the i'th primitive is valid */
     __forceinline bool valid(size_t i, BBox3fa* bbox = nullptr) const 
     {
@@ -256,8 +385,25 @@ namespace embree
     
   public:
     BufferT<Triangle> triangles;                    //!< array of triangles
-    array_t<BufferT<Vec3fa>,2> vertices;            //!< vertex array
+    array_t<BufferT<Vec3fa>,RTC_MAX_TIME_STEPS> vertices; //!< vertex array for each timestep
     array_t<std::unique_ptr<Buffer>,2> userbuffers; //!< user buffers
+    Buffer opacityStates;                           //!< 2 bit opacity state per micro triangle
+    int opacityLevel;                               //!< subdivision level of opacity micro map, -1 if not set
+
+    /*! the build encodes into the representation traversal does not
+     *  decode from, as an asynchronous commit keeps tracing the
+     *  previous acceleration structures during the build */
+    CompressedTriangles compressedTriangles0;       //!< first buffer of the compressed index representation
+    CompressedTriangles compressedTriangles1;       //!< second buffer of the compressed index representation
+    CompressedTriangles* volatile compressed;       //!< representation traversal decodes from
+    CompressedTriangles* encoded;                   //!< representation most recently encoded
+
+  private:
+    std::vector<std::pair<size_t,size_t>> modifiedVertexRanges;   //!< vertex ranges modified since last commit
+    std::vector<std::pair<size_t,size_t>> modifiedTriangleRanges; //!< triangle ranges modified since last commit
+    bool modifiedRangesOnly;                        //!< true if only the modified ranges changed since last commit
+    mvector<unsigned> vertexTriangleOffsets;        //!< offset of the triangles of each vertex in vertexTriangles
+    mvector<unsigned> vertexTriangles;              //!< triangles referencing each vertex, empty if not yet computed
 
   };
 }
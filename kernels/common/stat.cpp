@@ -126,4 +126,38 @@ namespace embree
     }
     cout << std::endl;
   }
+
+  __thread ThreadStat::Counters* ThreadStat::counters = nullptr;
+  AtomicCounter ThreadStat::numEnabled(0);
+  AtomicMutex ThreadStat::mutex;
+  ThreadStat::Counters* ThreadStat::list = nullptr;
+
+  void ThreadStat::enable(bool on) 
+  {
+    if (on) numEnabled++;
+    else    numEnabled--;
+  }
+
+  ThreadStat::Counters* ThreadStat::create()
+  {
+    Counters* c = new (alignedMalloc(sizeof(Counters),64)) Counters;
+    Lock<AtomicMutex> lock(mutex);
+    c->next = list; list = c;
+    return c;
+  }
+
+  void ThreadStat::gather(Counters& result)
+  {
+    result.clear();
+    Lock<AtomicMutex> lock(mutex);
+    for (Counters* c=list; c; c=c->next) 
+      result += *c;
+  }
+
+  void ThreadStat::clear()
+  {
+    Lock<AtomicMutex> lock(mutex);
+    for (Counters* c=list; c; c=c->next) 
+      c->clear();
+  }
 }
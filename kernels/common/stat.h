@@ -30,6 +30,10 @@
 #  define STAT3(s,x,y,z)
 #endif
 
+/* Makro to gather runtime statistics, only active when enabled through the API */
+#define RSTAT(x) \
+  if (unlikely(ThreadStat::enabled())) { ThreadStat::Counters& c = ThreadStat::get(); x; }
+
 namespace embree
 {
   /*! Gathers ray tracing statistics. We count 1) how often a code
@@ -97,4 +101,91 @@ namespace embree
   private:
     static Stat instance;
   };
+
+  /*! Runtime statistics that can get enabled per device without
+   *  recompiling with RTCORE_STAT_COUNTERS. Each thread increments its
+   *  own counters, thus counting is not synchronized and the gathered
+   *  values are only exact when no rays are traced concurrently. */
+  class ThreadStat
+  {
+  public:
+
+    struct __aligned(64) Counters
+    {
+      Counters () : next(nullptr) {
+        clear();
+      }
+
+      void clear() {
+        nodes = leaves = prims = leafHits = filterCalls = tessCacheHits = tessCacheMisses = 0;
+      }
+
+      __forceinline Counters& operator +=( const Counters& other ) 
+      {
+        nodes += other.nodes; leaves += other.leaves; prims += other.prims; leafHits += other.leafHits;
+        filterCalls += other.filterCalls; tessCacheHits += other.tessCacheHits; tessCacheMisses += other.tessCacheMisses;
+        return *this;
+      }
+
+    public:
+      size_t nodes;            //!< number of traversed inner nodes
+      size_t leaves;           //!< number of traversed leaves
+      size_t prims;            //!< number of intersected primitive blocks
+      size_t leafHits;         //!< number of leaves that produced a hit
+      size_t filterCalls;      //!< number of invoked filter functions
+      size_t tessCacheHits;    //!< number of tessellation cache hits
+      size_t tessCacheMisses;  //!< number of tessellation cache misses
+      Counters* next;          //!< next counters in list of all threads
+    };
+
+    /*! Gathers traversal statistics of one ray traversal in registers
+     *  and adds them to the thread's counters when done. */
+    struct Local
+    {
+      __forceinline Local () 
+        : nodes(0), leaves(0), prims(0), leafHits(0) {}
+
+      __forceinline ~Local () 
+      {
+        if (likely(!enabled())) return;
+        Counters& c = get();
+        c.nodes += nodes; c.leaves += leaves; c.prims += prims; c.leafHits += leafHits;
+      }
+
+    public:
+      size_t nodes, leaves, prims, leafHits;
+    };
+
+  public:
+
+    /*! returns true if any device has statistics enabled */
+    static __forceinline bool enabled() {
+      return numEnabled != 0;
+    }
+
+    /*! enables or disables statistics for one user */
+    static void enable(bool on);
+
+    /*! returns counters of current thread */
+    static __forceinline Counters& get() 
+    {
+      if (unlikely(counters == nullptr)) counters = create();
+      return *counters;
+    }
+
+    /*! sums up counters of all threads */
+    static void gather(Counters& result);
+
+    /*! clears counters of all threads */
+    static void clear();
+
+  private:
+    static Counters* create();
+
+  private:
+    static __thread Counters* counters;
+    static AtomicCounter numEnabled;
+    static AtomicMutex mutex;
+    static Counters* list;
+  };
 }
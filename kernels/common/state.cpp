@@ -87,8 +87,11 @@ namespace embree
     object_accel_mb_max_leaf_size = 1;
 
     memory_preallocation_factor     = 1.0f; 
+    memory_budget = 0;
 
     tessellation_cache_size = 128*1024*1024;
+    tessellation_cache_file = "";
+    tessellation_cache_file_size = 1024*1024*1024;
 
     /* large default cache size only for old mode single device mode */
 #if defined(__X86_64__)
@@ -100,6 +103,8 @@ namespace embree
     subdiv_accel = "default";
 
     float_exceptions = false;
+    statistics = false;
+    numa_replication = 0;
     scene_flags = -1;
     verbose = 0;
     benchmark = 0;
@@ -240,6 +245,11 @@ namespace embree
       else if (tok == Token::Id("float_exceptions") && cin->trySymbol("=")) 
         float_exceptions = cin->get().Int();
 
+      else if (tok == Token::Id("statistics") && cin->trySymbol("=")) 
+        statistics = cin->get().Int();
+      else if (tok == Token::Id("numa_replication") && cin->trySymbol("=")) 
+        numa_replication = cin->get().Int();
+
       else if ((tok == Token::Id("tri_accel") || tok == Token::Id("accel")) && cin->trySymbol("="))
         tri_accel = cin->get().Identifier();
       else if ((tok == Token::Id("tri_builder") || tok == Token::Id("builder")) && cin->trySymbol("="))
@@ -331,6 +341,9 @@ namespace embree
       }
       else if (tok == Token::Id("memory_preallocation_factor") && cin->trySymbol("=")) 
         memory_preallocation_factor = cin->get().Float();
+
+      else if (tok == Token::Id("memory_budget") && cin->trySymbol("="))
+        memory_budget = cin->get().Float() * 1024 * 1024;
       
       else if (tok == Token::Id("regression") && cin->trySymbol("=")) 
         regression_testing = cin->get().Int();
@@ -338,6 +351,12 @@ namespace embree
       else if (tok == Token::Id("tessellation_cache_size") && cin->trySymbol("="))
         tessellation_cache_size = cin->get().Float() * 1024 * 1024;
 
+      else if (tok == Token::Id("tessellation_cache_file") && cin->trySymbol("="))
+        tessellation_cache_file = cin->get().String();
+
+      else if (tok == Token::Id("tessellation_cache_file_size") && cin->trySymbol("="))
+        tessellation_cache_file_size = cin->get().Float() * 1024 * 1024;
+
       cin->trySymbol(","); // optional , separator
     }
   }
@@ -351,6 +370,9 @@ namespace embree
     std::cout << "general:" << std::endl;
     std::cout << "  build threads = " << numThreads << std::endl;
     std::cout << "  verbosity     = " << verbose << std::endl;
+    std::cout << "  statistics    = " << statistics << std::endl;
+    std::cout << "  numa replicas = " << numa_replication << " (" << getNumberOfNumaNodes() << " nodes)" << std::endl;
+    std::cout << "  memory budget = " << memory_budget << std::endl;
     
     std::cout << "triangles:" << std::endl;
     std::cout << "  accel         = " << tri_accel << std::endl;
@@ -100,11 +100,16 @@ namespace embree
 
   public:
     float       memory_preallocation_factor; 
+    size_t      memory_budget;             //!< maximal number of bytes the device may allocate, 0 for unlimited
     size_t      tessellation_cache_size;   //!< size of the shared tessellation cache 
+    std::string tessellation_cache_file;   //!< file backing the persistent tessellation cache, disabled when empty
+    size_t      tessellation_cache_file_size; //!< size of the persistent tessellation cache file
     std::string subdiv_accel;              //!< acceleration structure to use for subdivision surfaces
 
   public:
     bool float_exceptions;                 //!< enable floating point exceptions
+    bool statistics;                       //!< enables runtime traversal statistics
+    size_t numa_replication;               //!< replicates static scenes into the memory of each NUMA node, values larger than 1 force at least that many replicas
     int scene_flags;                       //!< scene flags to use
     size_t verbose;                        //!< verbosity of output
     size_t benchmark;                      //!< true
@@ -120,6 +120,39 @@ namespace embree
     }
   };
 
+  /*! converts the control points of a uniform cubic B-spline segment into bezier control points */
+  template<typename Vertex>
+    __forceinline void convertBSplineToBezier(Vertex& v0, Vertex& v1, Vertex& v2, Vertex& v3)
+  {
+    const Vertex b0 = (1.0f/6.0f)*v0 + (2.0f/3.0f)*v1 + (1.0f/6.0f)*v2;
+    const Vertex b1 = (2.0f/3.0f)*v1 + (1.0f/3.0f)*v2;
+    const Vertex b2 = (1.0f/3.0f)*v1 + (2.0f/3.0f)*v2;
+    const Vertex b3 = (1.0f/6.0f)*v1 + (2.0f/3.0f)*v2 + (1.0f/6.0f)*v3;
+    v0 = b0; v1 = b1; v2 = b2; v3 = b3;
+  }
+
+  /*! converts the control points of a uniform Catmull-Rom segment into bezier control points */
+  template<typename Vertex>
+    __forceinline void convertCatmullRomToBezier(Vertex& v0, Vertex& v1, Vertex& v2, Vertex& v3)
+  {
+    const Vertex b0 = v1;
+    const Vertex b1 = v1 + (1.0f/6.0f)*(v2-v0);
+    const Vertex b2 = v2 - (1.0f/6.0f)*(v3-v1);
+    const Vertex b3 = v2;
+    v0 = b0; v1 = b1; v2 = b2; v3 = b3;
+  }
+
+  /*! converts control points specified in some curve basis into bezier control points */
+  template<typename Vertex>
+    __forceinline void convertToBezier(const RTCCurveBasis basis, Vertex& v0, Vertex& v1, Vertex& v2, Vertex& v3)
+  {
+    switch (basis) {
+    case RTC_BASIS_BEZIER     : break;
+    case RTC_BASIS_BSPLINE    : convertBSplineToBezier(v0,v1,v2,v3); break;
+    case RTC_BASIS_CATMULL_ROM: convertCatmullRomToBezier(v0,v1,v2,v3); break;
+    }
+  }
+
   struct BezierCoefficients
   {
     enum { N = 16 };
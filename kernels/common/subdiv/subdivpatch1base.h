@@ -94,6 +94,21 @@ namespace embree
       return (SharedLazyTessellationCache::CacheEntry&) root_ref;
     }
 
+    /*! returns the key of the grid of this patch in the persistent tessellation cache */
+    __forceinline PersistentTessellationCache::Key persistentKey(const SubdivMesh* const mesh) const
+    {
+      PersistentTessellationCache::Key key;
+      key.mesh = mesh->contentHash;
+      key.prim = prim;
+      key.subPatch = type == EVAL_PATCH ? (unsigned) subPatch() : 0;
+      for (size_t i=0; i<4; i++) {
+        key.level[i] = level[i];
+        key.u[i] = u[i];
+        key.v[i] = v[i];
+      }
+      return key;
+    }
+
   public:    
     SharedLazyTessellationCache::Tag root_ref;
     RWMutex mtx;
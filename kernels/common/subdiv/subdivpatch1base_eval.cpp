@@ -15,6 +15,7 @@
 // ======================================================================== //
 
 #include "subdivpatch1base.h"
+#include "feature_adaptive_eval_simd.h"
 
 namespace embree
 {
@@ -68,6 +69,107 @@ namespace embree
       return Vec3<simdf>( zero );
     }
 
+    /* pads a grid to full SIMD blocks by repeating its last point */
+    static __forceinline void padGrid(float* const grid, const size_t N, const size_t grid_size_simd_blocks)
+    {
+      const float last = grid[N-1];
+      for (size_t i=N; i<grid_size_simd_blocks*VSIZEX; i++)
+        grid[i] = last;
+    }
+
+    /* bounds of the padded grid points */
+    static BBox3fa gridBounds(const float* const grid_x, const float* const grid_y, const float* const grid_z, const size_t grid_size_simd_blocks)
+    {
+      vfloatx bounds_min_x = pos_inf;
+      vfloatx bounds_min_y = pos_inf;
+      vfloatx bounds_min_z = pos_inf;
+      vfloatx bounds_max_x = neg_inf;
+      vfloatx bounds_max_y = neg_inf;
+      vfloatx bounds_max_z = neg_inf;
+      for (size_t i = 0; i<grid_size_simd_blocks; i++)
+      {
+        vfloatx x = vfloatx::loadu(&grid_x[i * VSIZEX]);
+        vfloatx y = vfloatx::loadu(&grid_y[i * VSIZEX]);
+        vfloatx z = vfloatx::loadu(&grid_z[i * VSIZEX]);
+
+        bounds_min_x = min(bounds_min_x,x);
+        bounds_min_y = min(bounds_min_y,y);
+        bounds_min_z = min(bounds_min_z,z);
+
+        bounds_max_x = max(bounds_max_x,x);
+        bounds_max_y = max(bounds_max_y,y);
+        bounds_max_z = max(bounds_max_z,z);
+      }
+
+      BBox3fa b;
+      b.lower.x = reduce_min(bounds_min_x);
+      b.lower.y = reduce_min(bounds_min_y);
+      b.lower.z = reduce_min(bounds_min_z);
+      b.upper.x = reduce_max(bounds_max_x);
+      b.upper.y = reduce_max(bounds_max_y);
+      b.upper.z = reduce_max(bounds_max_z);
+      b.lower.a = 0.0f;
+      b.upper.a = 0.0f;
+      return b;
+    }
+
+    /* calls the SIMD displacement function for a padded grid and returns the bounds it reported, if any */
+    static BBox3fa displaceGridN(const SubdivPatch1Base& patch, const SubdivMesh* const geom, const size_t N, const size_t grid_size_simd_blocks,
+                                 float* const grid_x, float* const grid_y, float* const grid_z,
+                                 const float* const grid_u, const float* const grid_v,
+                                 const float* const grid_Ng_x, const float* const grid_Ng_y, const float* const grid_Ng_z)
+    {
+      /* the partial derivatives are evaluated at patch coordinates, such that they match rtcInterpolate */
+      const size_t M = grid_size_simd_blocks*VSIZEX;
+      const bool derivs = geom->displFlags & RTC_DISPLACEMENT_DERIVATIVES;
+      dynamic_large_stack_array(float,grid_dPdu,derivs ? 3*M : 0,64*64*sizeof(float));
+      dynamic_large_stack_array(float,grid_dPdv,derivs ? 3*M : 0,64*64*sizeof(float));
+      if (derivs)
+      {
+        const HalfEdge* const edge = geom->getHalfEdge(patch.prim);
+        const char* const vertices = geom->getVertexBuffer().getPtr();
+        const size_t stride = geom->getVertexBuffer().getStride();
+        for (size_t i=0; i<grid_size_simd_blocks; i++) 
+        {
+          const vfloatx u = vfloatx::load(&grid_u[i*VSIZEX]);
+          const vfloatx v = vfloatx::load(&grid_v[i*VSIZEX]);
+          FeatureAdaptiveEvalSimd<vboolx,vintx,vfloatx,Vec3fa,Vec3fa_t>(edge,vertices,stride,vboolx(true),u,v,
+                                                                       nullptr,&grid_dPdu[i*VSIZEX],&grid_dPdv[i*VSIZEX],nullptr,nullptr,nullptr,M,3);
+        }
+      }
+
+      RTCDisplacementArguments args;
+      args.ptr = geom->userPtr;
+      args.geomID = patch.geom;
+      args.primID = patch.prim;
+      args.N = N;
+      args.simdWidth = VSIZEX;
+      args.u  = grid_u;    args.v  = grid_v;
+      args.nx = grid_Ng_x; args.ny = grid_Ng_y; args.nz = grid_Ng_z;
+      args.dPdu_x = derivs ? &grid_dPdu[0*M] : nullptr;
+      args.dPdu_y = derivs ? &grid_dPdu[1*M] : nullptr;
+      args.dPdu_z = derivs ? &grid_dPdu[2*M] : nullptr;
+      args.dPdv_x = derivs ? &grid_dPdv[0*M] : nullptr;
+      args.dPdv_y = derivs ? &grid_dPdv[1*M] : nullptr;
+      args.dPdv_z = derivs ? &grid_dPdv[2*M] : nullptr;
+      args.px = grid_x; args.py = grid_y; args.pz = grid_z;
+      for (size_t i=0; i<3; i++) {
+        args.lower[i] = float(pos_inf);
+        args.upper[i] = float(neg_inf);
+      }
+      geom->displFuncN(&args);
+
+      /* the function is free to skip the padding */
+      padGrid(grid_x,N,grid_size_simd_blocks);
+      padGrid(grid_y,N,grid_size_simd_blocks);
+      padGrid(grid_z,N,grid_size_simd_blocks);
+
+      BBox3fa b(Vec3fa(args.lower[0],args.lower[1],args.lower[2]),Vec3fa(args.upper[0],args.upper[1],args.upper[2]));
+      b.lower.a = 0.0f;
+      b.upper.a = 0.0f;
+      return b;
+    }
+
     /* eval grid over patch and stich edges when required */      
     void evalGrid(const SubdivPatch1Base& patch,
                   const size_t x0, const size_t x1,
@@ -87,7 +189,7 @@ namespace embree
 
       if (unlikely(patch.type == SubdivPatch1Base::EVAL_PATCH))
       {
-        const bool displ = geom->displFunc;
+        const bool displ = geom->displFunc || geom->displFuncN;
         const size_t N = displ ? M : 0;
         dynamic_large_stack_array(float,grid_Ng_x,N,64*64*sizeof(float));
         dynamic_large_stack_array(float,grid_Ng_y,N,64*64*sizeof(float));
@@ -134,18 +236,19 @@ namespace embree
           geom->displFunc(geom->userPtr,patch.geom,patch.prim,grid_u,grid_v,grid_Ng_x,grid_Ng_y,grid_Ng_z,grid_x,grid_y,grid_z,dwidth*dheight);
 
         /* set last elements in u,v array to 1.0f */
-        const float last_u = grid_u[dwidth*dheight-1];
-        const float last_v = grid_v[dwidth*dheight-1];
-        const float last_x = grid_x[dwidth*dheight-1];
-        const float last_y = grid_y[dwidth*dheight-1];
-        const float last_z = grid_z[dwidth*dheight-1];
-        for (size_t i=dwidth*dheight;i<grid_size_simd_blocks*VSIZEX;i++)
+        padGrid(grid_u,dwidth*dheight,grid_size_simd_blocks);
+        padGrid(grid_v,dwidth*dheight,grid_size_simd_blocks);
+        padGrid(grid_x,dwidth*dheight,grid_size_simd_blocks);
+        padGrid(grid_y,dwidth*dheight,grid_size_simd_blocks);
+        padGrid(grid_z,dwidth*dheight,grid_size_simd_blocks);
+
+        /* call SIMD displacement shader with padded grid */
+        if (geom->displFuncN) 
         {
-          grid_u[i] = last_u;
-          grid_v[i] = last_v;
-          grid_x[i] = last_x;
-          grid_y[i] = last_y;
-          grid_z[i] = last_z;
+          padGrid(grid_Ng_x,dwidth*dheight,grid_size_simd_blocks);
+          padGrid(grid_Ng_y,dwidth*dheight,grid_size_simd_blocks);
+          padGrid(grid_Ng_z,dwidth*dheight,grid_size_simd_blocks);
+          displaceGridN(patch,geom,dwidth*dheight,grid_size_simd_blocks,grid_x,grid_y,grid_z,grid_u,grid_v,grid_Ng_x,grid_Ng_y,grid_Ng_z);
         }
       }
       else
@@ -165,6 +268,12 @@ namespace embree
         if (unlikely(patch.needsStitching()))
           stitchUVGrid(patch.level,swidth,sheight,x0,y0,dwidth,dheight,grid_u,grid_v);
       
+        /* the SIMD displacement function gets called once for the entire grid */
+        const bool displN = geom->displFuncN != nullptr;
+        dynamic_large_stack_array(float,grid_Ng_x,displN ? M : 0,64*64*sizeof(float));
+        dynamic_large_stack_array(float,grid_Ng_y,displN ? M : 0,64*64*sizeof(float));
+        dynamic_large_stack_array(float,grid_Ng_z,displN ? M : 0,64*64*sizeof(float));
+      
         /* iterates over all grid points */
         for (size_t i=0; i<grid_size_simd_blocks; i++)
         {
@@ -181,10 +290,20 @@ namespace embree
                             &vtx.x[0],&vtx.y[0],&vtx.z[0],VSIZEX);
           
           }
+          else if (unlikely(displN))
+          {
+            const Vec3<vfloatx> normal = normalize_safe(patchNormal(patch, u, v));
+            vfloatx::store(&grid_Ng_x[i*VSIZEX],normal.x);
+            vfloatx::store(&grid_Ng_y[i*VSIZEX],normal.y);
+            vfloatx::store(&grid_Ng_z[i*VSIZEX],normal.z);
+          }
           vfloatx::store(&grid_x[i*VSIZEX],vtx.x);
           vfloatx::store(&grid_y[i*VSIZEX],vtx.y);
           vfloatx::store(&grid_z[i*VSIZEX],vtx.z);
         }
+
+        if (unlikely(displN))
+          displaceGridN(patch,geom,dwidth*dheight,grid_size_simd_blocks,grid_x,grid_y,grid_z,grid_u,grid_v,grid_Ng_x,grid_Ng_y,grid_Ng_z);
       }
     }
 
@@ -206,7 +325,7 @@ namespace embree
 
       if (unlikely(patch.type == SubdivPatch1Base::EVAL_PATCH))
       {
-        const bool displ = geom->displFunc;
+        const bool displ = geom->displFunc || geom->displFuncN;
         dynamic_large_stack_array(float,grid_x,M,64*64*sizeof(float));
         dynamic_large_stack_array(float,grid_y,M,64*64*sizeof(float));
         dynamic_large_stack_array(float,grid_z,M,64*64*sizeof(float));
@@ -235,54 +354,43 @@ namespace embree
             dwidth,dheight);
         }
 
+        /* convert sub-patch UVs to patch UVs*/
+        if (displ)
+        {
+          const Vec2f uv0 = patch.getUV(0);
+          const Vec2f uv1 = patch.getUV(1);
+          const Vec2f uv2 = patch.getUV(2);
+          const Vec2f uv3 = patch.getUV(3);
+          for (size_t i=0; i<grid_size_simd_blocks; i++)
+          {
+            const vfloatx u = vfloatx::load(&grid_u[i*VSIZEX]);
+            const vfloatx v = vfloatx::load(&grid_v[i*VSIZEX]);
+            vfloatx::store(&grid_u[i*VSIZEX],lerp2(uv0.x,uv1.x,uv3.x,uv2.x,u,v));
+            vfloatx::store(&grid_v[i*VSIZEX],lerp2(uv0.y,uv1.y,uv3.y,uv2.y,u,v));
+          }
+        }
+
         /* call displacement shader */
         if (geom->displFunc) 
           geom->displFunc(geom->userPtr,patch.geom,patch.prim,grid_u,grid_v,grid_Ng_x,grid_Ng_y,grid_Ng_z,grid_x,grid_y,grid_z,dwidth*dheight);
 
         /* set last elements in u,v array to 1.0f */
-        const float last_u = grid_u[dwidth*dheight-1];
-        const float last_v = grid_v[dwidth*dheight-1];
-        const float last_x = grid_x[dwidth*dheight-1];
-        const float last_y = grid_y[dwidth*dheight-1];
-        const float last_z = grid_z[dwidth*dheight-1];
-        for (size_t i=dwidth*dheight;i<grid_size_simd_blocks*VSIZEX;i++)
-        {
-          grid_u[i] = last_u;
-          grid_v[i] = last_v;
-          grid_x[i] = last_x;
-          grid_y[i] = last_y;
-          grid_z[i] = last_z;
-        }
+        padGrid(grid_u,dwidth*dheight,grid_size_simd_blocks);
+        padGrid(grid_v,dwidth*dheight,grid_size_simd_blocks);
+        padGrid(grid_x,dwidth*dheight,grid_size_simd_blocks);
+        padGrid(grid_y,dwidth*dheight,grid_size_simd_blocks);
+        padGrid(grid_z,dwidth*dheight,grid_size_simd_blocks);
 
-        vfloatx bounds_min_x = pos_inf;
-        vfloatx bounds_min_y = pos_inf;
-        vfloatx bounds_min_z = pos_inf;
-        vfloatx bounds_max_x = neg_inf;
-        vfloatx bounds_max_y = neg_inf;
-        vfloatx bounds_max_z = neg_inf;
-        for (size_t i = 0; i<grid_size_simd_blocks; i++)
+        /* call SIMD displacement shader with padded grid, bounds reported by the shader are used directly */
+        if (geom->displFuncN) 
         {
-          vfloatx x = vfloatx::loadu(&grid_x[i * VSIZEX]);
-          vfloatx y = vfloatx::loadu(&grid_y[i * VSIZEX]);
-          vfloatx z = vfloatx::loadu(&grid_z[i * VSIZEX]);
-
-	  bounds_min_x = min(bounds_min_x,x);
-	  bounds_min_y = min(bounds_min_y,y);
-	  bounds_min_z = min(bounds_min_z,z);
-
-	  bounds_max_x = max(bounds_max_x,x);
-	  bounds_max_y = max(bounds_max_y,y);
-	  bounds_max_z = max(bounds_max_z,z);
+          padGrid(grid_Ng_x,dwidth*dheight,grid_size_simd_blocks);
+          padGrid(grid_Ng_y,dwidth*dheight,grid_size_simd_blocks);
+          padGrid(grid_Ng_z,dwidth*dheight,grid_size_simd_blocks);
+          b = displaceGridN(patch,geom,dwidth*dheight,grid_size_simd_blocks,grid_x,grid_y,grid_z,grid_u,grid_v,grid_Ng_x,grid_Ng_y,grid_Ng_z);
         }
-
-        b.lower.x = reduce_min(bounds_min_x);
-        b.lower.y = reduce_min(bounds_min_y);
-        b.lower.z = reduce_min(bounds_min_z);
-        b.upper.x = reduce_max(bounds_max_x);
-        b.upper.y = reduce_max(bounds_max_y);
-        b.upper.z = reduce_max(bounds_max_z);
-        b.lower.a = 0.0f;
-        b.upper.a = 0.0f;
+        if (b.empty()) 
+          b = gridBounds(grid_x,grid_y,grid_z,grid_size_simd_blocks);
       }
       else
       {
@@ -290,17 +398,23 @@ namespace embree
         gridUVTessellator(patch.level,swidth,sheight,x0,y0,dwidth,dheight,grid_u,grid_v);
       
         /* set last elements in u,v array to last valid point */
-        const float last_u = grid_u[dwidth*dheight-1];
-        const float last_v = grid_v[dwidth*dheight-1];
-        for (size_t i=dwidth*dheight;i<grid_size_simd_blocks*VSIZEX;i++) {
-          grid_u[i] = last_u;
-          grid_v[i] = last_v;
-        }
+        padGrid(grid_u,dwidth*dheight,grid_size_simd_blocks);
+        padGrid(grid_v,dwidth*dheight,grid_size_simd_blocks);
 
         /* stitch edges if necessary */
         if (unlikely(patch.needsStitching()))
           stitchUVGrid(patch.level,swidth,sheight,x0,y0,dwidth,dheight,grid_u,grid_v);
       
+        /* the SIMD displacement function needs the entire grid */
+        const bool displN = geom->displFuncN != nullptr;
+        const size_t N = displN ? M : 0;
+        dynamic_large_stack_array(float,grid_x,N,64*64*sizeof(float));
+        dynamic_large_stack_array(float,grid_y,N,64*64*sizeof(float));
+        dynamic_large_stack_array(float,grid_z,N,64*64*sizeof(float));
+        dynamic_large_stack_array(float,grid_Ng_x,N,64*64*sizeof(float));
+        dynamic_large_stack_array(float,grid_Ng_y,N,64*64*sizeof(float));
+        dynamic_large_stack_array(float,grid_Ng_z,N,64*64*sizeof(float));
+
         /* iterates over all grid points */
         Vec3<vfloatx> bounds_min;
         bounds_min[0] = pos_inf;
@@ -327,6 +441,17 @@ namespace embree
                             &vtx.x[0],&vtx.y[0],&vtx.z[0],VSIZEX);
           
           }
+          else if (unlikely(displN))
+          {
+            const Vec3<vfloatx> normal = normalize_safe(patchNormal(patch,u,v));
+            vfloatx::store(&grid_Ng_x[i*VSIZEX],normal.x);
+            vfloatx::store(&grid_Ng_y[i*VSIZEX],normal.y);
+            vfloatx::store(&grid_Ng_z[i*VSIZEX],normal.z);
+            vfloatx::store(&grid_x[i*VSIZEX],vtx.x);
+            vfloatx::store(&grid_y[i*VSIZEX],vtx.y);
+            vfloatx::store(&grid_z[i*VSIZEX],vtx.z);
+            continue;
+          }
           bounds_min[0] = min(bounds_min[0],vtx.x);
           bounds_max[0] = max(bounds_max[0],vtx.x);
           bounds_min[1] = min(bounds_min[1],vtx.y);
@@ -335,14 +460,22 @@ namespace embree
           bounds_max[2] = max(bounds_max[2],vtx.z);      
         }
 
-        b.lower.x = reduce_min(bounds_min[0]);
-        b.lower.y = reduce_min(bounds_min[1]);
-        b.lower.z = reduce_min(bounds_min[2]);
-        b.upper.x = reduce_max(bounds_max[0]);
-        b.upper.y = reduce_max(bounds_max[1]);
-        b.upper.z = reduce_max(bounds_max[2]);
-        b.lower.a = 0.0f;
-        b.upper.a = 0.0f;
+        if (unlikely(displN)) 
+        {
+          b = displaceGridN(patch,geom,dwidth*dheight,grid_size_simd_blocks,grid_x,grid_y,grid_z,grid_u,grid_v,grid_Ng_x,grid_Ng_y,grid_Ng_z);
+          if (b.empty()) b = gridBounds(grid_x,grid_y,grid_z,grid_size_simd_blocks);
+        }
+        else
+        {
+          b.lower.x = reduce_min(bounds_min[0]);
+          b.lower.y = reduce_min(bounds_min[1]);
+          b.lower.z = reduce_min(bounds_min[2]);
+          b.upper.x = reduce_max(bounds_max[0]);
+          b.upper.y = reduce_max(bounds_max[1]);
+          b.upper.z = reduce_max(bounds_max[2]);
+          b.lower.a = 0.0f;
+          b.upper.a = 0.0f;
+        }
       }
 
       assert( std::isfinite(b.lower.x) );
@@ -37,6 +37,16 @@ namespace embree
     //SharedLazyTessellationCache::sharedLazyTessellationCache.addCurrentIndex(SharedLazyTessellationCache::NUM_CACHE_SEGMENTS);
     SharedLazyTessellationCache::sharedLazyTessellationCache.reset();
   }
+
+  void openPersistentTessellationCache(const std::string& filename, size_t size)
+  {
+    PersistentTessellationCache::persistentTessellationCache.open(filename,size);
+  }
+
+  void closePersistentTessellationCache()
+  {
+    PersistentTessellationCache::persistentTessellationCache.close();
+  }
   
   SharedLazyTessellationCache::SharedLazyTessellationCache()
   {
@@ -232,6 +242,55 @@ namespace embree
   ////////////////////////////////////////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+  PersistentTessellationCache PersistentTessellationCache::persistentTessellationCache;
+
+  PersistentTessellationCache::PersistentTessellationCache ()
+    : header(nullptr), slots(nullptr) {}
+
+  PersistentTessellationCache::~PersistentTessellationCache () {
+    close();
+  }
+
+  void PersistentTessellationCache::open(const std::string& filename, size_t size)
+  {
+    close();
+
+    /* one hash table slot per 2kB of grid data, this roughly matches a 10x10 grid */
+    size = max(size,size_t(1024*1024));
+    size_t numSlots = 1;
+    while (numSlots < size/2048) numSlots *= 2;
+    const size_t dataBegin = sizeof(Header) + numSlots*sizeof(Slot);
+
+    Header* h = (Header*) os_map_file(filename.c_str(),size);
+    if (h == nullptr)
+      throw_RTCError(RTC_INVALID_ARGUMENT,"cannot map tessellation cache file " + filename);
+
+    /* reinitialize the file if it was created with a different layout */
+    if (h->magic != MAGIC || h->version != VERSION || h->size != size || h->numSlots != numSlots)
+    {
+      memset(h,0,dataBegin);
+      h->version    = VERSION;
+      h->size       = size;
+      h->numSlots   = numSlots;
+      h->numEntries = 0;
+      h->dataBegin  = dataBegin;
+      h->dataEnd    = dataBegin;
+      __memory_barrier();
+      h->magic      = MAGIC;
+    }
+
+    slots  = (Slot*) (h+1);
+    header = h;
+  }
+
+  void PersistentTessellationCache::close()
+  {
+    if (header == nullptr) return;
+    os_unmap_file(header,header->size);
+    header = nullptr;
+    slots  = nullptr;
+  }
+
   AtomicCounter SharedTessellationCacheStats::cache_accesses           = 0;
   AtomicCounter SharedTessellationCacheStats::cache_hits               = 0;
   AtomicCounter SharedTessellationCacheStats::cache_misses             = 0;
@@ -62,6 +62,8 @@ namespace embree
 
   void resizeTessellationCache(size_t new_size);
   void resetTessellationCache();
+  void openPersistentTessellationCache(const std::string& filename, size_t size);
+  void closePersistentTessellationCache();
 
 
 #if defined(__MIC__)
@@ -239,10 +241,12 @@ namespace embree
        if (likely( sharedLazyTessellationCache.validCacheIndex(subdiv_patch_cache_index,globalTime) ))
        {
          CACHE_STATS(SharedTessellationCacheStats::cache_hits++);
+         RSTAT(c.tessCacheHits++);
          return (void*) subdiv_patch_root;
        }
      }
      CACHE_STATS(SharedTessellationCacheStats::cache_misses++);
+     RSTAT(c.tessCacheMisses++);
      return nullptr;
    }
 
@@ -290,10 +294,12 @@ namespace embree
        if (likely( sharedLazyTessellationCache.validCacheIndex(subdiv_patch_cache_index,globalTime) ))
        {
          CACHE_STATS(SharedTessellationCacheStats::cache_hits++);
+         RSTAT(c.tessCacheHits++);
          return subdiv_patch_root;
        }
      }
      CACHE_STATS(SharedTessellationCacheStats::cache_misses++);
+     RSTAT(c.tessCacheMisses++);
      return -1;
    }
 
@@ -410,6 +416,136 @@ namespace embree
     
  };
 
+ /*! Optional second tier of the tessellation cache. Grids are spilled
+  *  into a memory mapped file keyed by patch and tessellation rate and
+  *  copied back into the shared cache on a miss, thus flushed grids and
+  *  grids of a previous process rendering the same scene get restored
+  *  without evaluating the patch again. */
+ class PersistentTessellationCache
+ {
+ public:
+
+   static const uint64_t MAGIC   = 0x454843414353534cULL;
+   static const uint64_t VERSION = 1;
+
+   /*! identifies a tessellated patch */
+   struct Key
+   {
+     __forceinline bool operator== (const Key& other) const {
+       return memcmp(this,&other,sizeof(Key)) == 0;
+     }
+
+     __forceinline uint64_t hash() const {
+       return PersistentTessellationCache::hash(this,sizeof(Key),0);
+     }
+
+     uint64_t mesh;             //!< hash over the buffers of the subdivision mesh
+     unsigned prim;             //!< primitive ID of the face the patch belongs to
+     unsigned subPatch;         //!< sub patch of non-quad faces
+     float level[4];            //!< tessellation levels of the patch edges
+     unsigned short u[4];       //!< 16bit discretized u,v coordinates of the patch corners
+     unsigned short v[4];
+   };
+
+ private:
+
+   struct Header
+   {
+     uint64_t magic;
+     uint64_t version;
+     uint64_t size;             //!< size of the file in bytes
+     uint64_t numSlots;         //!< number of hash table slots, power of two
+     uint64_t numEntries;       //!< number of used hash table slots
+     uint64_t dataBegin;        //!< offset of the first grid
+     uint64_t dataEnd;          //!< offset behind the last grid
+     uint64_t align0;
+   };
+
+   struct Slot
+   {
+     Key key;
+     uint64_t offset;           //!< offset of the grid in the file
+     unsigned bytes;            //!< size of the grid in bytes
+     volatile unsigned valid;   //!< set after all other members got written
+   };
+
+ public:
+
+   PersistentTessellationCache ();
+   ~PersistentTessellationCache ();
+
+   /*! maps the cache file, reuses its content if it got created with same size */
+   void open(const std::string& filename, size_t size);
+
+   /*! unmaps the cache file */
+   void close();
+
+   __forceinline bool enabled() const { return header != nullptr; }
+
+   /*! FNV-1a hash over some bytes */
+   static __forceinline uint64_t hash(const void* ptr, const size_t bytes, uint64_t h)
+   {
+     h ^= 0xcbf29ce484222325ULL;
+     for (size_t i=0; i<bytes; i++) {
+       h ^= ((const unsigned char*)ptr)[i];
+       h *= 0x100000001b3ULL;
+     }
+     return h;
+   }
+
+   /*! returns the grid stored for some key or nullptr, can be called concurrently with store */
+   const void* lookup(const Key& key, size_t& bytes) const
+   {
+     if (header == nullptr) return nullptr;
+     const size_t mask = header->numSlots-1;
+     for (size_t i=key.hash() & mask;; i=(i+1) & mask)
+     {
+       const Slot& slot = slots[i];
+       if (!slot.valid) return nullptr;
+       if (slot.key == key) {
+         bytes = slot.bytes;
+         return (char*)header + slot.offset;
+       }
+     }
+   }
+
+   /*! stores a grid of some size, the writer copies the grid to the provided location */
+   template<typename Writer>
+     bool store(const Key& key, const size_t bytes, const Writer& write)
+   {
+     if (header == nullptr) return false;
+     Lock<AtomicMutex> lock(mutex);
+
+     /* keep the hash table at most 3/4 full, such that lookups always terminate */
+     if (4*(header->numEntries+1) > 3*header->numSlots) return false;
+     const size_t offset = header->dataEnd;
+     if (offset+bytes > header->size) return false;
+
+     const size_t mask = header->numSlots-1;
+     size_t i = key.hash() & mask;
+     for (; slots[i].valid; i=(i+1) & mask)
+       if (slots[i].key == key) return true;
+
+     write((char*)header + offset);
+     slots[i].key = key;
+     slots[i].offset = offset;
+     slots[i].bytes = (unsigned) bytes;
+     __memory_barrier();
+     slots[i].valid = 1;
+
+     header->dataEnd = offset + ((bytes+63) & ~size_t(63));
+     header->numEntries++;
+     return true;
+   }
+
+   static PersistentTessellationCache persistentTessellationCache;
+
+ private:
+   Header* header;
+   Slot* slots;
+   AtomicMutex mutex;
+ };
+
   // =========================================================================================================
   // =========================================================================================================
   // =========================================================================================================
@@ -27,21 +27,21 @@ namespace embree
       class MortonBuildRecord 
     {
     public:
-      unsigned int begin;
-      unsigned int end;
+      size_t begin;
+      size_t end;
       unsigned int depth;
       NodeRef* parent;
 
       __forceinline MortonBuildRecord() {}
 
-      __forceinline MortonBuildRecord(const unsigned begin, const unsigned end, NodeRef* parent, unsigned depth)
+      __forceinline MortonBuildRecord(const size_t begin, const size_t end, NodeRef* parent, unsigned depth)
         : begin(begin), end(end), parent(parent), depth(depth) {}
 
-      __forceinline unsigned int size() const {
+      __forceinline size_t size() const {
         return end - begin;
       }
       
-      __forceinline void init(const unsigned int _begin, const unsigned int _end)			 
+      __forceinline void init(const size_t _begin, const size_t _end)			 
       {
         begin = _begin;
         end = _end;
@@ -50,14 +50,27 @@ namespace embree
       }
     };
     
+    struct MortonCodeGenerator;
+    struct MortonCodeGenerator64;
+
     struct __aligned(8) MortonID32Bit
     {
+    public:
+      typedef unsigned int Code;
+      typedef MortonCodeGenerator Generator;
+      static const unsigned int BITS = 32;
+
     public:
       unsigned int code;
       unsigned int index;
       
     public:   
       __forceinline operator unsigned() const { return code; }
+
+      /*! returns number of leading zero bits of a code */
+      static __forceinline unsigned int lzcnt(const Code code) {
+        return embree::lzcnt((int)code);
+      }
       
       __forceinline unsigned int get(const unsigned int shift, const unsigned and_mask) const {
         return (code >> shift) & and_mask;
@@ -70,25 +83,80 @@ namespace embree
         return o;
       }
     };
+
+    /*! Morton code with 21 bits per dimension and 64 bit primitive
+     *  index, used for very large meshes where 10 bits per dimension
+     *  produce too many identical codes. */
+    struct __aligned(16) MortonID64Bit
+    {
+    public:
+      typedef uint64_t Code;
+      typedef MortonCodeGenerator64 Generator;
+      static const unsigned int BITS = 64;
+
+    public:
+      uint64_t code;
+      uint64_t index;
+      
+    public:   
+      __forceinline operator uint64_t() const { return code; }
+
+      /*! returns number of leading zero bits of a code */
+      static __forceinline unsigned int lzcnt(const Code code) 
+      {
+        const unsigned int hi = (unsigned int)(code >> 32);
+        if (hi) return embree::lzcnt((int)hi);
+        return 32 + embree::lzcnt((int)code);
+      }
+      
+      __forceinline bool operator<(const MortonID64Bit &m) const { return code < m.code; } 
+      
+      __forceinline friend std::ostream &operator<<(std::ostream &o, const MortonID64Bit& mc) {
+        o << "index " << mc.index << " code = " << mc.code;
+        return o;
+      }
+    };
+
+    /*! maps centroids to the lattice of the morton code */
+    template<size_t LATTICE_BITS_PER_DIM>
+    struct MortonCodeMappingT
+    {
+      static const size_t LATTICE_SIZE_PER_DIM = size_t(1) << LATTICE_BITS_PER_DIM;
+
+      vfloat4 base;
+      vfloat4 scale;
+      
+      __forceinline MortonCodeMappingT(const BBox3fa& bounds)
+      {
+        base  = (vfloat4)bounds.lower;
+        const vfloat4 diag  = (vfloat4)bounds.upper - (vfloat4)bounds.lower;
+        scale = select(diag > vfloat4(1E-19f), rcp(diag) * vfloat4(LATTICE_SIZE_PER_DIM * 0.99f),vfloat4(0.0f));
+      }
+
+      __forceinline vint4 bin(const BBox3fa& b) const
+      {
+        const vfloat4 lower = (vfloat4)b.lower;
+        const vfloat4 upper = (vfloat4)b.upper;
+        const vfloat4 centroid = lower+upper;
+        return vint4((centroid-base)*scale);
+      }
+    };
     
     struct MortonCodeGenerator
     {
       static const size_t LATTICE_BITS_PER_DIM = 10;
-      static const size_t LATTICE_SIZE_PER_DIM = size_t(1) << LATTICE_BITS_PER_DIM;
+      typedef MortonCodeMappingT<LATTICE_BITS_PER_DIM> MortonCodeMapping;
       
-      struct MortonCodeMapping
+      /*! calculates morton code of a single primitive */
+      static __forceinline unsigned int encode(const MortonCodeMapping& mapping, const BBox3fa& b)
       {
-        vfloat4 base;
-        vfloat4 scale;
-        
-        __forceinline MortonCodeMapping(const BBox3fa& bounds)
-        {
-          base  = (vfloat4)bounds.lower;
-          const vfloat4 diag  = (vfloat4)bounds.upper - (vfloat4)bounds.lower;
-          scale = select(diag > vfloat4(1E-19f), rcp(diag) * vfloat4(LATTICE_SIZE_PER_DIM * 0.99f),vfloat4(0.0f));
-        }
-      };
-      
+        const vint4 binID = mapping.bin(b);
+        const unsigned int bx = extract<0>(binID);
+        const unsigned int by = extract<1>(binID);
+        const unsigned int bz = extract<2>(binID);
+        return bitInterleave(bx,by,bz);
+      }
+
       __forceinline MortonCodeGenerator(const BBox3fa& bounds, MortonID32Bit* dest)
         : mapping(bounds), dest(dest), currentID(0), slots(0), ax(0), ay(0), az(0), ai(0) {}
       
@@ -109,10 +177,7 @@ namespace embree
       
       __forceinline void operator() (const BBox3fa& b, const size_t index)
       {
-        const vfloat4 lower = (vfloat4)b.lower;
-        const vfloat4 upper = (vfloat4)b.upper;
-        const vfloat4 centroid = lower+upper;
-        const vint4 binID = vint4((centroid-mapping.base)*mapping.scale);
+        const vint4 binID = mapping.bin(b);
         
         ax[slots] = extract<0>(binID);
         ay[slots] = extract<1>(binID);
@@ -139,6 +204,36 @@ namespace embree
       size_t slots;
       vint4 ax, ay, az, ai;
     };
+
+    struct MortonCodeGenerator64
+    {
+      static const size_t LATTICE_BITS_PER_DIM = 21;
+      typedef MortonCodeMappingT<LATTICE_BITS_PER_DIM> MortonCodeMapping;
+
+      /*! calculates morton code of a single primitive */
+      static __forceinline uint64_t encode(const MortonCodeMapping& mapping, const BBox3fa& b)
+      {
+        const vint4 binID = mapping.bin(b);
+        const uint64_t bx = (unsigned int) extract<0>(binID);
+        const uint64_t by = (unsigned int) extract<1>(binID);
+        const uint64_t bz = (unsigned int) extract<2>(binID);
+        return bitInterleave64(bx,by,bz);
+      }
+
+      __forceinline MortonCodeGenerator64(const MortonCodeMapping& mapping, MortonID64Bit* dest)
+        : mapping(mapping), dest(dest) {}
+
+      __forceinline void operator() (const BBox3fa& b, const size_t index)
+      {
+        dest->code = encode(mapping,b);
+        dest->index = index;
+        dest++;
+      }
+
+    public:
+      const MortonCodeMapping mapping;
+      MortonID64Bit* dest;
+    };
     
     template<
       typename NodeRef, 
@@ -149,11 +244,15 @@ namespace embree
       typename SetNodeBoundsFunc, 
       typename CreateLeafFunc, 
       typename CalculateBounds, 
-      typename ProgressMonitor>
+      typename ProgressMonitor,
+      typename MortonID>
 
       class GeneralBVHBuilderMorton
     {
       ALIGNED_CLASS;
+
+      typedef typename MortonID::Code Code;
+      typedef typename MortonID::Generator MortonCodeGenerator;
       
     protected:
       static const size_t MAX_BRANCHING_FACTOR = 16;         //!< maximal supported BVH branching factor
@@ -185,7 +284,7 @@ namespace embree
       
       void splitFallback(MortonBuildRecord<NodeRef>& current, MortonBuildRecord<NodeRef>& leftChild, MortonBuildRecord<NodeRef>& rightChild) const
       {
-        const unsigned int center = (current.begin + current.end)/2;
+        const size_t center = (current.begin + current.end)/2;
         leftChild.init(current.begin,center);
         rightChild.init(center,current.end);
       }
@@ -212,7 +311,7 @@ namespace embree
           
           /* find best child with largest bounding box area */
           int bestChild = -1;
-          int bestSize = 0;
+          size_t bestSize = 0;
           for (size_t i=0; i<numChildren; i++)
           {
             /* ignore leaves as they cannot get split */
@@ -259,19 +358,9 @@ namespace embree
         for (size_t i=current.begin; i<current.end; i++)
           centBounds.extend(center2(calculateBounds(morton[i])));
         
-        MortonCodeGenerator::MortonCodeMapping mapping(centBounds);
+        typename MortonCodeGenerator::MortonCodeMapping mapping(centBounds);
         for (size_t i=current.begin; i<current.end; i++)
-        {
-          const BBox3fa b = calculateBounds(morton[i]);
-          const vfloat4 lower = (vfloat4)b.lower;
-          const vfloat4 upper = (vfloat4)b.upper;
-          const vfloat4 centroid = lower+upper;
-          const vint4 binID = vint4((centroid-mapping.base)*mapping.scale);
-          const unsigned int bx = extract<0>(binID);
-          const unsigned int by = extract<1>(binID);
-          const unsigned int bz = extract<2>(binID);
-          morton[i].code = bitInterleave(bx,by,bz);
-        }
+          morton[i].code = MortonCodeGenerator::encode(mapping,calculateBounds(morton[i]));
         std::sort(morton+current.begin,morton+current.end); // FIXME: use radix sort
       }
       
@@ -279,20 +368,20 @@ namespace embree
                                MortonBuildRecord<NodeRef>& left,
                                MortonBuildRecord<NodeRef>& right) const
       {
-        const unsigned int code_start = morton[current.begin].code;
-        const unsigned int code_end   = morton[current.end-1].code;
-        unsigned int bitpos = lzcnt(code_start^code_end);
+        const Code code_start = morton[current.begin].code;
+        const Code code_end   = morton[current.end-1].code;
+        unsigned int bitpos = MortonID::lzcnt(code_start^code_end);
         
         /* if all items mapped to same morton code, then create new morton codes for the items */
-        if (unlikely(bitpos == 32)) // FIXME: maybe go here earlier to build better tree
+        if (unlikely(bitpos == MortonID::BITS)) // FIXME: maybe go here earlier to build better tree
         {
           recreateMortonCodes(current);
-          const unsigned int code_start = morton[current.begin].code;
-          const unsigned int code_end   = morton[current.end-1].code;
-          bitpos = lzcnt(code_start^code_end);
+          const Code code_start = morton[current.begin].code;
+          const Code code_end   = morton[current.end-1].code;
+          bitpos = MortonID::lzcnt(code_start^code_end);
           
           /* if the morton code is still the same, goto fall back split */
-          if (unlikely(bitpos == 32)) 
+          if (unlikely(bitpos == MortonID::BITS)) 
           {
             size_t center = (current.begin + current.end)/2; 
             left.init(current.begin,center);
@@ -302,21 +391,21 @@ namespace embree
         }
         
         /* split the items at the topmost different morton code bit */
-        const unsigned int bitpos_diff = 31-bitpos;
-        const unsigned int bitmask = 1 << bitpos_diff;
+        const unsigned int bitpos_diff = MortonID::BITS-1-bitpos;
+        const Code bitmask = Code(1) << bitpos_diff;
         
         /* find location where bit differs using binary search */
         size_t begin = current.begin;
         size_t end   = current.end;
         while (begin + 1 != end) {
           const size_t mid = (begin+end)/2;
-          const unsigned bit = morton[mid].code & bitmask;
+          const Code bit = morton[mid].code & bitmask;
           if (bit == 0) begin = mid; else end = mid;
         }
         size_t center = end;
 #if defined(DEBUG)      
-        for (unsigned int i=begin;  i<center; i++) assert((morton[i].code & bitmask) == 0);
-        for (unsigned int i=center; i<end;    i++) assert((morton[i].code & bitmask) == bitmask);
+        for (size_t i=begin;  i<center; i++) assert((morton[i].code & bitmask) == 0);
+        for (size_t i=center; i<end;    i++) assert((morton[i].code & bitmask) == bitmask);
 #endif
         
         left.init(current.begin,center);
@@ -347,7 +436,7 @@ namespace embree
           
           /* find best child with largest bounding box area */
           int bestChild = -1;
-          unsigned bestItems = 0;
+          size_t bestItems = 0;
           for (unsigned int i=0; i<numChildren; i++)
           {
             /* ignore leaves as they cannot get split */
@@ -408,11 +497,11 @@ namespace embree
       }
       
       /* build function */
-      std::pair<NodeRef,BBox3fa> build(MortonID32Bit* src, MortonID32Bit* tmp, size_t numPrimitives) 
+      std::pair<NodeRef,BBox3fa> build(MortonID* src, MortonID* tmp, size_t numPrimitives) 
       {
-        /* using 4 phases radix sort */
+        /* using 4 (or 8 for 64 bit codes) phases radix sort */
         morton = src;
-        radix_sort_u32(src,tmp,numPrimitives);
+        radix_sort<MortonID,Code>(src,tmp,numPrimitives);
 
         /* build BVH */
         NodeRef root;
@@ -424,7 +513,7 @@ namespace embree
       }
       
     public:
-      MortonID32Bit* morton;
+      MortonID* morton;
       const size_t branchingFactor;
       const size_t maxDepth;
       const size_t minLeafSize;
@@ -449,7 +538,8 @@ namespace embree
       typename SetBoundsFunc, 
       typename CreateLeafFunc, 
       typename CalculateBoundsFunc, 
-      typename ProgressMonitor>
+      typename ProgressMonitor,
+      typename MortonID>
 
       std::pair<NodeRef,BBox3fa> bvh_builder_morton_internal(CreateAllocFunc createAllocator, 
                                                              const ReductionTy& identity, 
@@ -458,8 +548,8 @@ namespace embree
                                                              CreateLeafFunc createLeaf, 
                                                              CalculateBoundsFunc calculateBounds,
                                                              ProgressMonitor progressMonitor,
-                                                             MortonID32Bit* src, 
-                                                             MortonID32Bit* tmp, 
+                                                             MortonID* src, 
+                                                             MortonID* tmp, 
                                                              size_t numPrimitives,
                                                              const size_t branchingFactor, 
                                                              const size_t maxDepth, 
@@ -475,7 +565,8 @@ namespace embree
         SetBoundsFunc,
         CreateLeafFunc,
         CalculateBoundsFunc,
-        ProgressMonitor> Builder;
+        ProgressMonitor,
+        MortonID> Builder;
 
       Builder builder(identity,
                       createAllocator,
@@ -500,7 +591,8 @@ namespace embree
       typename SetBoundsFunc, 
       typename CreateLeafFunc, 
       typename CalculateBoundsFunc,
-      typename ProgressMonitor>
+      typename ProgressMonitor,
+      typename MortonID>
 
       std::pair<NodeRef,BBox3fa> bvh_builder_morton(CreateAllocFunc createAllocator, 
                                                     const ReductionTy& identity, 
@@ -509,8 +601,8 @@ namespace embree
                                                     CreateLeafFunc createLeaf, 
                                                     CalculateBoundsFunc calculateBounds,
                                                     ProgressMonitor progressMonitor,
-                                                    MortonID32Bit* src, 
-                                                    MortonID32Bit* temp, 
+                                                    MortonID* src, 
+                                                    MortonID* temp, 
                                                     size_t numPrimitives,
                                                     const size_t branchingFactor, 
                                                     const size_t maxDepth, 
@@ -529,7 +621,8 @@ namespace embree
       }, [] (const BBox3fa& a, const BBox3fa& b) { return merge(a,b); });
       
       /* compute morton codes */
-      MortonCodeGenerator::MortonCodeMapping mapping(centBounds);
+      typedef typename MortonID::Generator MortonCodeGenerator;
+      typename MortonCodeGenerator::MortonCodeMapping mapping(centBounds);
       parallel_for ( size_t(0), numPrimitives, [&](const range<size_t>& r) 
       {
         //MortonCodeGenerator generator(mapping,&temp[r.begin()]);
@@ -156,20 +156,18 @@ namespace embree
           if (ofs < 0 || ofs+3 >= mesh->numVertices())
             continue;
 
-	  Vec3fa p0 = mesh->vertex(ofs+0,0);
-	  Vec3fa p1 = mesh->vertex(ofs+1,0);
-	  Vec3fa p2 = mesh->vertex(ofs+2,0);
-	  Vec3fa p3 = mesh->vertex(ofs+3,0);
-	  if (timeSteps == 2) {
-	    p0 = 0.5f*(p0+mesh->vertex(ofs+0,1));
-	    p1 = 0.5f*(p1+mesh->vertex(ofs+1,1));
-	    p2 = 0.5f*(p2+mesh->vertex(ofs+2,1));
-	    p3 = 0.5f*(p3+mesh->vertex(ofs+3,1));
-	  }
+          Vec3fa p0,p1,p2,p3; mesh->gather(p0,p1,p2,p3,ofs,0);
+          if (timeSteps == 2) {
+            Vec3fa q0,q1,q2,q3; mesh->gather(q0,q1,q2,q3,ofs,1);
+            p0 = 0.5f*(p0+q0);
+            p1 = 0.5f*(p1+q1);
+            p2 = 0.5f*(p2+q2);
+            p3 = 0.5f*(p3+q3);
+          }
           if (!isvalid((vfloat4)p0) || !isvalid((vfloat4)p1) || !isvalid((vfloat4)p2) || !isvalid((vfloat4)p3))
               continue;
 
-	  const BezierPrim bezier(p0,p1,p2,p3,mesh->tessellationRate,mesh->id,j);
+          const BezierPrim bezier(p0,p1,p2,p3,mesh->tessellationRate,mesh->id,j);
           const BBox3fa bounds = bezier.bounds();
           pinfo.add(bounds);
           prims[k++] = bezier;
@@ -191,15 +189,13 @@ namespace embree
             if (ofs < 0 || ofs+3 >= mesh->numVertices())
               continue;
 
-            Vec3fa p0 = mesh->vertex(ofs+0,0);
-            Vec3fa p1 = mesh->vertex(ofs+1,0);
-            Vec3fa p2 = mesh->vertex(ofs+2,0);
-            Vec3fa p3 = mesh->vertex(ofs+3,0);
+            Vec3fa p0,p1,p2,p3; mesh->gather(p0,p1,p2,p3,ofs,0);
             if (timeSteps == 2) {
-              p0 = 0.5f*(p0+mesh->vertex(ofs+0,1));
-              p1 = 0.5f*(p1+mesh->vertex(ofs+1,1));
-              p2 = 0.5f*(p2+mesh->vertex(ofs+2,1));
-              p3 = 0.5f*(p3+mesh->vertex(ofs+3,1));
+              Vec3fa q0,q1,q2,q3; mesh->gather(q0,q1,q2,q3,ofs,1);
+              p0 = 0.5f*(p0+q0);
+              p1 = 0.5f*(p1+q1);
+              p2 = 0.5f*(p2+q2);
+              p3 = 0.5f*(p3+q3);
             }
             if (!isvalid((vfloat4)p0) || !isvalid((vfloat4)p1) || !isvalid((vfloat4)p2) || !isvalid((vfloat4)p3))
               continue;
@@ -16,6 +16,7 @@
 
 #include "bvh.h"
 #include "bvh_statistics.h"
+#include <sstream>
 
 namespace embree
 {
@@ -23,7 +24,7 @@ namespace embree
   BVHN<N>::BVHN (const PrimitiveType& primTy, Scene* scene)
     : AccelData((N==4) ? AccelData::TY_BVH4 : (N==8) ? AccelData::TY_BVH8 : AccelData::TY_UNKNOWN),
       primTy(primTy), device(scene->device), scene(scene),
-      root(emptyNode), alloc(scene->device), numPrimitives(0), numVertices(0), data_mem(nullptr), size_data_mem(0) {}
+      root(emptyNode), numTimeSegments(1), alloc(scene->device), numPrimitives(0), numVertices(0), data_mem(nullptr), size_data_mem(0) {}
 
   template<int N>
   BVHN<N>::~BVHN ()
@@ -49,10 +50,22 @@ namespace embree
   void BVHN<N>::set (NodeRef root, const BBox3fa& bounds, size_t numPrimitives)
   {
     this->root = root;
+    this->numTimeSegments = 1;
+    this->roots.clear();
     this->bounds = bounds;
     this->numPrimitives = numPrimitives;
   }
 
+  template<int N>
+  void BVHN<N>::set (const std::vector<NodeRef>& roots, const BBox3fa& bounds, size_t numPrimitives)
+  {
+    assert(roots.size() >= 1);
+    set(roots[0],bounds,numPrimitives);
+    if (roots.size() == 1) return;
+    this->numTimeSegments = roots.size();
+    this->roots = roots;
+  }
+
   template<int N>
   void BVHN<N>::printStatistics()
   {
@@ -173,6 +186,177 @@ namespace embree
     }
   }
 
+  template<int N>
+  bool BVHN<N>::storable(NodeRef node) const
+  {
+    if (node == emptyNode || node.isLeaf())
+      return true;
+
+    if (!node.isNode() && !node.isNodeMB() && !node.isUnalignedNode() && !node.isUnalignedNodeMB() && !node.isQuantizedNode())
+      return false;
+
+    const BaseNode* n = (const BaseNode*)(size_t(node) & ~(size_t)align_mask);
+    for (size_t i=0; i<N; i++)
+      if (!storable(n->child(i))) return false;
+    return true;
+  }
+
+  template<int N>
+  typename BVHN<N>::NodeRef BVHN<N>::saveRecursion(NodeRef node, std::vector<char>& data, std::vector<size_t>& relocs)
+  {
+    if (node == emptyNode)
+      return node;
+
+    /* determine size of node or leaf */
+    size_t bytes = 0;
+    if (node.isLeaf()) {
+      size_t num; node.leaf(num);
+      bytes = num*primTy.bytes;
+    }
+    else if (node.isNode())            bytes = sizeof(Node);
+    else if (node.isNodeMB())          bytes = sizeof(NodeMB);
+    else if (node.isUnalignedNode())   bytes = sizeof(UnalignedNode);
+    else if (node.isUnalignedNodeMB()) bytes = sizeof(UnalignedNodeMB);
+    else if (node.isQuantizedNode())   bytes = sizeof(QuantizedNode);
+    else throw_RTCError(RTC_INVALID_OPERATION,"BVH contains nodes that cannot get stored");
+
+    /* copy node or leaf to output buffer, all blocks are aligned to 64 bytes */
+    const char* ptr = (const char*)(size_t(node) & ~(size_t)align_mask);
+    const size_t ofs = (data.size()+63) & ~size_t(63);
+    data.resize(ofs+bytes);
+    memcpy(&data[ofs],ptr,bytes);
+
+    /* recurse into children and replace child pointers by offsets */
+    if (!node.isLeaf())
+    {
+      const BaseNode* src = (const BaseNode*) ptr;
+      for (size_t i=0; i<N; i++)
+      {
+        const NodeRef child = saveRecursion(src->child(i),data,relocs);
+        ((BaseNode*)&data[ofs])->child(i) = child;
+        if (child != emptyNode) relocs.push_back(ofs+i*sizeof(NodeRef));
+      }
+    }
+    return NodeRef(ofs | (size_t(node) & (size_t)align_mask));
+  }
+
+  template<int N>
+  void BVHN<N>::save(std::ostream& file)
+  {
+    if (root != emptyNode && !primTy.relocatable)
+      throw_RTCError(RTC_INVALID_OPERATION,"BVH over "+primTy.name+" primitives cannot get stored");
+
+    std::vector<char> data;
+    std::vector<size_t> relocs;
+    std::vector<NodeRef> ofsRoots;
+    if (numTimeSegments == 1) ofsRoots.push_back(saveRecursion(root,data,relocs));
+    else for (size_t i=0; i<numTimeSegments; i++) ofsRoots.push_back(saveRecursion(roots[i],data,relocs));
+
+    int n = N;
+    file.write((char*)&n,sizeof(n));
+    size_t nameLength = primTy.name.size();
+    file.write((char*)&nameLength,sizeof(nameLength));
+    file.write(primTy.name.c_str(),nameLength);
+    file.write((char*)&bounds,sizeof(bounds));
+    file.write((char*)&numPrimitives,sizeof(numPrimitives));
+    file.write((char*)&numVertices,sizeof(numVertices));
+    size_t numRoots = ofsRoots.size();
+    file.write((char*)&numRoots,sizeof(numRoots));
+    file.write((char*)ofsRoots.data(),numRoots*sizeof(NodeRef));
+    size_t numRelocs = relocs.size();
+    file.write((char*)&numRelocs,sizeof(numRelocs));
+    if (numRelocs) file.write((char*)relocs.data(),numRelocs*sizeof(size_t));
+    size_t numBytes = data.size();
+    file.write((char*)&numBytes,sizeof(numBytes));
+    if (numBytes) file.write(data.data(),numBytes);
+  }
+
+  template<int N>
+  void BVHN<N>::load(std::istream& file)
+  {
+    int n = 0;
+    file.read((char*)&n,sizeof(n));
+    size_t nameLength = 0;
+    file.read((char*)&nameLength,sizeof(nameLength));
+    if (!file.good() || n != N || nameLength != primTy.name.size())
+      throw_RTCError(RTC_INVALID_OPERATION,"stored BVH does not match scene configuration");
+    std::string name(nameLength,' ');
+    file.read(&name[0],nameLength);
+    if (name != primTy.name)
+      throw_RTCError(RTC_INVALID_OPERATION,"stored BVH does not match scene configuration");
+
+    BBox3fa storedBounds;
+    size_t storedPrimitives = 0, storedVertices = 0, numRoots = 0, numRelocs = 0, numBytes = 0;
+    file.read((char*)&storedBounds,sizeof(storedBounds));
+    file.read((char*)&storedPrimitives,sizeof(storedPrimitives));
+    file.read((char*)&storedVertices,sizeof(storedVertices));
+    file.read((char*)&numRoots,sizeof(numRoots));
+    if (!file.good() || numRoots == 0 || numRoots >= RTC_MAX_TIME_STEPS)
+      throw_RTCError(RTC_INVALID_OPERATION,"error reading stored BVH");
+    std::vector<NodeRef> ofsRoots(numRoots);
+    file.read((char*)ofsRoots.data(),numRoots*sizeof(NodeRef));
+    file.read((char*)&numRelocs,sizeof(numRelocs));
+    std::vector<size_t> relocs(numRelocs);
+    if (numRelocs) file.read((char*)relocs.data(),numRelocs*sizeof(size_t));
+    file.read((char*)&numBytes,sizeof(numBytes));
+    if (!file.good())
+      throw_RTCError(RTC_INVALID_OPERATION,"error reading stored BVH");
+
+    alloc.clear();
+    if (numBytes == 0) {
+      set(emptyNode,empty,0);
+      return;
+    }
+
+    /* read all nodes and leaves with a single read into one block */
+    char* base = (char*) alloc.mallocBlock(numBytes);
+    file.read(base,numBytes);
+    if (!file.good()) {
+      alloc.clear();
+      throw_RTCError(RTC_INVALID_OPERATION,"error reading stored BVH");
+    }
+
+    /* relocate all child references */
+    for (size_t i=0; i<numRelocs; i++) 
+    {
+      if (relocs[i]+sizeof(NodeRef) > numBytes) {
+        alloc.clear();
+        throw_RTCError(RTC_INVALID_OPERATION,"stored BVH is corrupted");
+      }
+      NodeRef& ref = *(NodeRef*)&base[relocs[i]];
+      ref = NodeRef(size_t(base) + size_t(ref));
+    }
+    for (size_t i=0; i<numRoots; i++) 
+      if (ofsRoots[i] != emptyNode) ofsRoots[i] = NodeRef(size_t(base) + size_t(ofsRoots[i]));
+    set(ofsRoots,storedBounds,storedPrimitives);
+    numVertices = storedVertices;
+  }
+
+  template<int N>
+  AccelData* BVHN<N>::replicate(size_t numaNode)
+  {
+    if (root == emptyNode || !primTy.relocatable)
+      return nullptr;
+
+    /* BVHs containing e.g. transformation nodes cannot get stored and thus not get replicated */
+    if (numTimeSegments == 1) { if (!storable(root)) return nullptr; }
+    else for (size_t i=0; i<numTimeSegments; i++) if (!storable(roots[i])) return nullptr;
+
+    /* the stored representation is relocatable, thus copy by storing and loading into a block of the requested node */
+    std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+    save(stream);
+    BVHN* bvh = new BVHN(primTy,scene);
+    bvh->alloc.setNumaNode(numaNode);
+    try {
+      bvh->load(stream);
+    }
+    catch (...) {
+      delete bvh;
+      throw;
+    }
+    return bvh;
+  }
+
 #if defined(__AVX__)
   template class BVHN<8>;
 #else
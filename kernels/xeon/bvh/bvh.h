@@ -34,6 +34,7 @@ namespace embree
     BVH_FLAG_UNALIGNED_NODE = 0x00100,
     BVH_FLAG_UNALIGNED_NODE_MB = 0x01000,
     BVH_FLAG_TRANSFORM_NODE = 0x10000,
+    BVH_FLAG_QUANTIZED_NODE = 0x100000,
 
     /* short versions */
     BVH_AN1 = BVH_FLAG_ALIGNED_NODE,
@@ -45,6 +46,7 @@ namespace embree
     BVH_AN2_UN2 = BVH_FLAG_ALIGNED_NODE_MB | BVH_FLAG_UNALIGNED_NODE_MB,
     BVH_TN_AN1 = BVH_FLAG_TRANSFORM_NODE | BVH_FLAG_ALIGNED_NODE,
     BVH_TN_AN1_AN2 = BVH_FLAG_TRANSFORM_NODE | BVH_FLAG_ALIGNED_NODE | BVH_FLAG_ALIGNED_NODE_MB,
+    BVH_QN1 = BVH_FLAG_QUANTIZED_NODE,
   };
 
   /*! Multi BVH with N children. Each node stores the bounding box of
@@ -62,6 +64,7 @@ namespace embree
     struct UnalignedNode;
     struct UnalignedNodeMB;
     struct TransformNode;
+    struct QuantizedNode;
 
     /*! Number of bytes the nodes and primitives are minimally aligned to.*/
     static const size_t byteAlignment = 16;
@@ -80,6 +83,7 @@ namespace embree
     static const size_t tyUnalignedNode = 2;
     static const size_t tyUnalignedNodeMB = 3;
     static const size_t tyTransformNode = 4;
+    static const size_t tyQuantizedNode = 5;
     static const size_t tyLeaf = 8;
 
     /*! Empty node */
@@ -158,6 +162,12 @@ namespace embree
 
       /*! Prefetches the node this reference points to */
       __forceinline void prefetch(int types=0) const {
+        if (types == BVH_FLAG_QUANTIZED_NODE) {
+          prefetchL1(((char*)ptr)+0*64);
+          prefetchL1(((char*)ptr)+1*64);
+          if (N >= 8) prefetchL1(((char*)ptr)+2*64);
+          return;
+        }
 #if defined(__AVX512F__)
         prefetchL1(((char*)ptr)+0*64);
         prefetchL2(((char*)ptr)+1*64);
@@ -272,6 +282,9 @@ namespace embree
       __forceinline int isTransformNode() const { return (ptr & (size_t)align_mask) == tyTransformNode; }
       __forceinline int isTransformNode(int types) const { return (types == BVH_FLAG_TRANSFORM_NODE) || ((types & BVH_FLAG_TRANSFORM_NODE) && isTransformNode()); }
 
+      /*! checks if this is a node with quantized bounding boxes */
+      __forceinline int isQuantizedNode() const { return (ptr & (size_t)align_mask) == tyQuantizedNode; }
+
       /*! returns base node pointer */
       __forceinline BaseNode* baseNode(int types)
       {
@@ -314,6 +327,10 @@ namespace embree
       __forceinline       TransformNode* transformNode()       { assert(isTransformNode()); return (      TransformNode*)(ptr & ~(size_t)align_mask); }
       __forceinline const TransformNode* transformNode() const { assert(isTransformNode()); return (const TransformNode*)(ptr & ~(size_t)align_mask); }
 
+      /*! returns quantized node pointer */
+      __forceinline       QuantizedNode* quantizedNode()       { assert(isQuantizedNode()); return (      QuantizedNode*)(ptr & ~(size_t)align_mask); }
+      __forceinline const QuantizedNode* quantizedNode() const { assert(isQuantizedNode()); return (const QuantizedNode*)(ptr & ~(size_t)align_mask); }
+
       /*! returns leaf pointer */
       __forceinline char* leaf(size_t& num) const {
         assert(isLeaf());
@@ -700,8 +717,8 @@ namespace embree
     {
       __forceinline TransformNode () {}
 
-      __forceinline TransformNode(const AffineSpace3fa& local2world, const BBox3fa& localBounds, NodeRef child, unsigned mask, unsigned int instID, unsigned int xfmID, unsigned int type)
-        : identity(local2world == AffineSpace3fa(one)), local2world(local2world), world2local(rcp(local2world)), localBounds(localBounds), child(child), mask(mask), instID(instID), xfmID(xfmID), type(type) {}
+      __forceinline TransformNode(const AffineSpace3fa& local2world, const BBox3fa& localBounds, NodeRef child, unsigned mask, unsigned int instID, unsigned int xfmID, unsigned int type, Scene* scene = nullptr)
+        : identity(local2world == AffineSpace3fa(one)), local2world(local2world), world2local(rcp(local2world)), localBounds(localBounds), child(child), mask(mask), instID(instID), xfmID(xfmID), type(type), scene(scene) {}
 
       NodeRef child;
       unsigned mask;
@@ -712,6 +729,88 @@ namespace embree
       unsigned int instID;
       unsigned int xfmID;
       unsigned int type;
+      Scene* scene;               //!< instanced scene, or nullptr for instanced geometries of the current scene
+    };
+
+    /*! Node with bounds quantized to 8 bits relative to the bounds of the node */
+    struct QuantizedNode : public BaseNode
+    {
+      using BaseNode::children;
+
+      /*! Clears the node. */
+      __forceinline void clear()
+      {
+        start = scale = Vec3f(zero);
+        for (size_t i=0; i<N; i++) {
+          lower_x[i] = lower_y[i] = lower_z[i] = 255; // inverted bounds are never hit
+          upper_x[i] = upper_y[i] = upper_z[i] = 0;
+        }
+        BaseNode::clear();
+      }
+
+      /*! Sets the quantization grid to cover the specified bounds. */
+      __forceinline void setQuantizationBounds(const BBox3fa& bounds)
+      {
+        /* grid cells have to stay larger than the float precision at the bounds, 
+         * otherwise decompressed lower and upper bounds become identical */
+        const Vec3fa extent = max(max(bounds.size(),Vec3fa(1E-19f)),4.0f*float(ulp)*max(abs(bounds.lower),abs(bounds.upper)));
+        start = Vec3f(bounds.lower.x,bounds.lower.y,bounds.lower.z);
+        scale = Vec3f(extent.x/255.0f,extent.y/255.0f,extent.z/255.0f);
+      }
+
+      /*! conservatively quantizes lower and upper bound of one dimension */
+      static __forceinline void quantize(float lower, float upper, float start, float scale, unsigned char& qlower, unsigned char& qupper)
+      {
+        int l = (int) floorf((lower-start)/scale);
+        int u = (int) ceilf ((upper-start)/scale);
+        l = clamp(l,0,255); while (l > 0   && start+float(l)*scale > lower) l--;
+        u = clamp(u,0,255); while (u < 255 && start+float(u)*scale < upper) u++;
+        qlower = (unsigned char) l;
+        qupper = (unsigned char) u;
+      }
+
+      /*! Sets bounding box of child, has to be inside the quantization bounds. */
+      __forceinline void set(size_t i, const BBox3fa& bounds)
+      {
+        assert(i < N);
+        quantize(bounds.lower.x,bounds.upper.x,start.x,scale.x,lower_x[i],upper_x[i]);
+        quantize(bounds.lower.y,bounds.upper.y,start.y,scale.y,lower_y[i],upper_y[i]);
+        quantize(bounds.lower.z,bounds.upper.z,start.z,scale.z,lower_z[i],upper_z[i]);
+      }
+
+      /*! Sets ID of child. */
+      __forceinline void set(size_t i, const NodeRef& childID) {
+        assert(i < N);
+        children[i] = childID;
+      }
+
+      /*! Returns decompressed bounds of specified child. */
+      __forceinline BBox3fa bounds(size_t i) const
+      {
+        assert(i < N);
+        const Vec3fa lower(start.x+float(lower_x[i])*scale.x,start.y+float(lower_y[i])*scale.y,start.z+float(lower_z[i])*scale.z);
+        const Vec3fa upper(start.x+float(upper_x[i])*scale.x,start.y+float(upper_y[i])*scale.y,start.z+float(upper_z[i])*scale.z);
+        return BBox3fa(lower,upper);
+      }
+
+      /*! Returns extent of bounds of specified child. */
+      __forceinline Vec3fa extend(size_t i) const {
+        return bounds(i).size();
+      }
+
+      /*! Returns reference to specified child */
+      __forceinline       NodeRef& child(size_t i)       { assert(i<N); return children[i]; }
+      __forceinline const NodeRef& child(size_t i) const { assert(i<N); return children[i]; }
+
+    public:
+      Vec3f start;                  //!< lower corner of the quantization grid
+      Vec3f scale;                  //!< size of one grid cell in each dimension
+      unsigned char lower_x[N];     //!< X dimension of quantized lower bounds of all N children.
+      unsigned char upper_x[N];     //!< X dimension of quantized upper bounds of all N children.
+      unsigned char lower_y[N];     //!< Y dimension of quantized lower bounds of all N children.
+      unsigned char upper_y[N];     //!< Y dimension of quantized upper bounds of all N children.
+      unsigned char lower_z[N];     //!< Z dimension of quantized lower bounds of all N children.
+      unsigned char upper_z[N];     //!< Z dimension of quantized upper bounds of all N children.
     };
 
     /*! swap the children of two nodes */
@@ -781,6 +880,24 @@ namespace embree
     /*! sets BVH members after build */
     void set (NodeRef root, const BBox3fa& bounds, size_t numPrimitives);
 
+    /*! sets BVH members after a multi-segment motion blur build, one root per time segment */
+    void set (const std::vector<NodeRef>& roots, const BBox3fa& bounds, size_t numPrimitives);
+
+    /*! returns the root node of the time segment that contains the specified time */
+    __forceinline NodeRef getRoot(const float time) const 
+    {
+      if (likely(numTimeSegments == 1)) return root;
+      float ftime; return roots[getTimeSegment(time,float(numTimeSegments),ftime)];
+    }
+
+    /*! returns the specified time relative to the time segment that contains it, node bounds are stored per time segment */
+    template<typename T>
+    __forceinline T getLocalTime(const T& time) const 
+    {
+      if (likely(numTimeSegments == 1)) return time;
+      T ftime; getTimeSegment(time,T(float(numTimeSegments)),ftime); return ftime;
+    }
+
     /*! prints statistics about the BVH */
     void printStatistics();
 
@@ -812,6 +929,19 @@ namespace embree
       alloc.cleanup();
     }
 
+    /*! stores the BVH into a relocatable binary stream */
+    void save(std::ostream& file);
+
+    /*! loads a BVH previously stored with save */
+    void load(std::istream& file);
+
+    /*! creates a copy of the BVH in memory of the specified NUMA node, returns nullptr if the BVH cannot get stored */
+    AccelData* replicate(size_t numaNode);
+
+  private:
+    bool storable(NodeRef node) const;
+    NodeRef saveRecursion(NodeRef node, std::vector<char>& data, std::vector<size_t>& relocs);
+
   public:
 
     /*! Encodes a node */
@@ -841,6 +971,12 @@ namespace embree
       return NodeRef((size_t) node | tyTransformNode);
     }
 
+    /*! Encodes a quantized node */
+    static __forceinline NodeRef encodeNode(QuantizedNode* node) {
+      assert(!((size_t)node & align_mask));
+      return NodeRef((size_t) node | tyQuantizedNode);
+    }
+
     /*! Encodes a leaf */
     static __forceinline NodeRef encodeLeaf(void* tri, size_t num) {
       assert(!((size_t)tri & align_mask));
@@ -861,6 +997,8 @@ namespace embree
     /*! bvh data */
   public:
     NodeRef root;                      //!< Root node
+    size_t numTimeSegments;            //!< number of motion blur time segments the BVH is build for
+    std::vector<NodeRef> roots;        //!< root node of each time segment for multi-segment motion blur
     FastAllocator alloc;               //!< allocator used to allocate nodes
     Device* device;                    //!< device pointer
     Scene* scene;                      //!< scene pointer
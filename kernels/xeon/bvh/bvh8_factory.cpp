@@ -21,6 +21,7 @@
 
 #include "../geometry/bezier1v.h"
 #include "../geometry/bezier1i.h"
+#include "../geometry/bezierv.h"
 #include "../geometry/linei.h"
 #include "../geometry/triangle.h"
 #include "../geometry/trianglev_mb.h"
@@ -35,11 +36,13 @@ namespace embree
   DECLARE_SYMBOL2(Accel::Intersector1,BVH8Line4iIntersector1);
   DECLARE_SYMBOL2(Accel::Intersector1,BVH8Line4iMBIntersector1);
   DECLARE_SYMBOL2(Accel::Intersector1,BVH8Bezier1vIntersector1_OBB);
+  DECLARE_SYMBOL2(Accel::Intersector1,BVH8Bezier8vIntersector1_OBB);
   DECLARE_SYMBOL2(Accel::Intersector1,BVH8Bezier1iIntersector1_OBB);
   DECLARE_SYMBOL2(Accel::Intersector1,BVH8Bezier1iMBIntersector1_OBB);
   DECLARE_SYMBOL2(Accel::Intersector1,BVH8Triangle4Intersector1Moeller);
   DECLARE_SYMBOL2(Accel::Intersector1,BVH8Triangle8Intersector1Moeller);
   DECLARE_SYMBOL2(Accel::Intersector1,BVH8Triangle4vMBIntersector1Moeller);
+  DECLARE_SYMBOL2(Accel::Intersector1,BVH8QuantizedTriangle4Intersector1Moeller);
   DECLARE_SYMBOL2(Accel::Intersector1,BVH8GridAOSIntersector1);
   DECLARE_SYMBOL2(Accel::Intersector1,BVH8Quad4vIntersector1Moeller);
   DECLARE_SYMBOL2(Accel::Intersector1,BVH8Quad4iIntersector1Pluecker);
@@ -48,6 +51,7 @@ namespace embree
   DECLARE_SYMBOL2(Accel::Intersector4,BVH8Line4iIntersector4);
   DECLARE_SYMBOL2(Accel::Intersector4,BVH8Line4iMBIntersector4);
   DECLARE_SYMBOL2(Accel::Intersector4,BVH8Bezier1vIntersector4Single_OBB);
+  DECLARE_SYMBOL2(Accel::Intersector4,BVH8Bezier8vIntersector4Single_OBB);
   DECLARE_SYMBOL2(Accel::Intersector4,BVH8Bezier1iIntersector4Single_OBB);
   DECLARE_SYMBOL2(Accel::Intersector4,BVH8Bezier1iMBIntersector4Single_OBB);
   DECLARE_SYMBOL2(Accel::Intersector4,BVH8Triangle4Intersector4HybridMoeller);
@@ -55,6 +59,7 @@ namespace embree
   DECLARE_SYMBOL2(Accel::Intersector4,BVH8Triangle8Intersector4HybridMoeller);
   DECLARE_SYMBOL2(Accel::Intersector4,BVH8Triangle8Intersector4HybridMoellerNoFilter);
   DECLARE_SYMBOL2(Accel::Intersector4,BVH8Triangle4vMBIntersector4HybridMoeller);
+  DECLARE_SYMBOL2(Accel::Intersector4,BVH8QuantizedTriangle4Intersector4Moeller);
   DECLARE_SYMBOL2(Accel::Intersector4,BVH8GridAOSIntersector4);
   DECLARE_SYMBOL2(Accel::Intersector4,BVH8Quad4vIntersector4HybridMoeller);
   DECLARE_SYMBOL2(Accel::Intersector4,BVH8Quad4vIntersector4HybridMoellerNoFilter);
@@ -65,6 +70,7 @@ namespace embree
   DECLARE_SYMBOL2(Accel::Intersector8,BVH8Line4iIntersector8);
   DECLARE_SYMBOL2(Accel::Intersector8,BVH8Line4iMBIntersector8);
   DECLARE_SYMBOL2(Accel::Intersector8,BVH8Bezier1vIntersector8Single_OBB);
+  DECLARE_SYMBOL2(Accel::Intersector8,BVH8Bezier8vIntersector8Single_OBB);
   DECLARE_SYMBOL2(Accel::Intersector8,BVH8Bezier1iIntersector8Single_OBB);
   DECLARE_SYMBOL2(Accel::Intersector8,BVH8Bezier1iMBIntersector8Single_OBB);
   DECLARE_SYMBOL2(Accel::Intersector8,BVH8Triangle4Intersector8HybridMoeller);
@@ -72,6 +78,7 @@ namespace embree
   DECLARE_SYMBOL2(Accel::Intersector8,BVH8Triangle8Intersector8HybridMoeller);
   DECLARE_SYMBOL2(Accel::Intersector8,BVH8Triangle8Intersector8HybridMoellerNoFilter);
   DECLARE_SYMBOL2(Accel::Intersector8,BVH8Triangle4vMBIntersector8HybridMoeller);
+  DECLARE_SYMBOL2(Accel::Intersector8,BVH8QuantizedTriangle4Intersector8Moeller);
   DECLARE_SYMBOL2(Accel::Intersector8,BVH8GridAOSIntersector8);
   DECLARE_SYMBOL2(Accel::Intersector8,BVH8Quad4vIntersector8HybridMoeller);
   DECLARE_SYMBOL2(Accel::Intersector8,BVH8Quad4vIntersector8HybridMoellerNoFilter);
@@ -82,6 +89,7 @@ namespace embree
   DECLARE_SYMBOL2(Accel::Intersector16,BVH8Line4iIntersector16);
   DECLARE_SYMBOL2(Accel::Intersector16,BVH8Line4iMBIntersector16);
   DECLARE_SYMBOL2(Accel::Intersector16,BVH8Bezier1vIntersector16Single_OBB);
+  DECLARE_SYMBOL2(Accel::Intersector16,BVH8Bezier8vIntersector16Single_OBB);
   DECLARE_SYMBOL2(Accel::Intersector16,BVH8Bezier1iIntersector16Single_OBB);
   DECLARE_SYMBOL2(Accel::Intersector16,BVH8Bezier1iMBIntersector16Single_OBB);
   DECLARE_SYMBOL2(Accel::Intersector16,BVH8Triangle4Intersector16HybridMoeller);
@@ -91,6 +99,7 @@ namespace embree
   DECLARE_SYMBOL2(Accel::Intersector16,BVH8Triangle8Intersector16HybridMoeller);
   DECLARE_SYMBOL2(Accel::Intersector16,BVH8Triangle8Intersector16HybridMoellerNoFilter);
   DECLARE_SYMBOL2(Accel::Intersector16,BVH8Triangle4vMBIntersector16HybridMoeller);
+  DECLARE_SYMBOL2(Accel::Intersector16,BVH8QuantizedTriangle4Intersector16Moeller);
   DECLARE_SYMBOL2(Accel::Intersector16,BVH8GridAOSIntersector16);
   DECLARE_SYMBOL2(Accel::Intersector16,BVH8Quad4vIntersector16HybridMoeller);
   DECLARE_SYMBOL2(Accel::Intersector16,BVH8Quad4vIntersector16HybridMoellerNoFilter);
@@ -104,6 +113,7 @@ namespace embree
   DECLARE_SYMBOL2(Accel::IntersectorN, BVH8Quad4vStreamIntersectorNoFilter);
 
   DECLARE_BUILDER2(void,Scene,size_t,BVH8Bezier1vBuilder_OBB_New);
+  DECLARE_BUILDER2(void,Scene,size_t,BVH8Bezier8vBuilder_OBB_New);
   DECLARE_BUILDER2(void,Scene,size_t,BVH8Bezier1iBuilder_OBB_New);
   DECLARE_BUILDER2(void,Scene,size_t,BVH8Bezier1iMBBuilder_OBB_New);
 
@@ -127,6 +137,7 @@ namespace embree
   {
     /* select builders */
     SELECT_SYMBOL_INIT_AVX(features,BVH8Bezier1vBuilder_OBB_New);
+    SELECT_SYMBOL_INIT_AVX(features,BVH8Bezier8vBuilder_OBB_New);
     SELECT_SYMBOL_INIT_AVX(features,BVH8Bezier1iBuilder_OBB_New);
     SELECT_SYMBOL_INIT_AVX(features,BVH8Bezier1iMBBuilder_OBB_New);
 
@@ -149,11 +160,13 @@ namespace embree
     SELECT_SYMBOL_INIT_AVX_AVX2_AVX512KNL(features,BVH8Line4iIntersector1);
     SELECT_SYMBOL_INIT_AVX_AVX2_AVX512KNL(features,BVH8Line4iMBIntersector1);
     SELECT_SYMBOL_INIT_AVX_AVX2_AVX512KNL(features,BVH8Bezier1vIntersector1_OBB);
+    SELECT_SYMBOL_INIT_AVX_AVX2_AVX512KNL(features,BVH8Bezier8vIntersector1_OBB);
     SELECT_SYMBOL_INIT_AVX_AVX2_AVX512KNL(features,BVH8Bezier1iIntersector1_OBB);
     SELECT_SYMBOL_INIT_AVX_AVX2_AVX512KNL(features,BVH8Bezier1iMBIntersector1_OBB);
     SELECT_SYMBOL_INIT_AVX_AVX2_AVX512KNL(features,BVH8Triangle4Intersector1Moeller);
     SELECT_SYMBOL_INIT_AVX_AVX2_AVX512KNL(features,BVH8Triangle8Intersector1Moeller);
     SELECT_SYMBOL_INIT_AVX_AVX2_AVX512KNL(features,BVH8Triangle4vMBIntersector1Moeller);
+    SELECT_SYMBOL_INIT_AVX_AVX2_AVX512KNL(features,BVH8QuantizedTriangle4Intersector1Moeller);
     SELECT_SYMBOL_INIT_AVX_AVX2_AVX512KNL(features,BVH8Quad4vIntersector1Moeller);
     SELECT_SYMBOL_INIT_AVX_AVX2_AVX512KNL(features,BVH8Quad4iIntersector1Pluecker);
     SELECT_SYMBOL_INIT_AVX_AVX2_AVX512KNL(features,BVH8Quad4iMBIntersector1Pluecker);
@@ -165,6 +178,7 @@ namespace embree
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Line4iIntersector4);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Line4iMBIntersector4);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Bezier1vIntersector4Single_OBB);
+    SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Bezier8vIntersector4Single_OBB);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Bezier1iIntersector4Single_OBB);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Bezier1iMBIntersector4Single_OBB);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Triangle4Intersector4HybridMoeller);
@@ -172,6 +186,7 @@ namespace embree
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Triangle8Intersector4HybridMoeller);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Triangle8Intersector4HybridMoellerNoFilter);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Triangle4vMBIntersector4HybridMoeller);
+    SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8QuantizedTriangle4Intersector4Moeller);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8GridAOSIntersector4);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Quad4vIntersector4HybridMoeller);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Quad4vIntersector4HybridMoellerNoFilter);
@@ -183,6 +198,7 @@ namespace embree
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Line4iIntersector8);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Line4iMBIntersector8);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Bezier1vIntersector8Single_OBB);
+    SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Bezier8vIntersector8Single_OBB);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Bezier1iIntersector8Single_OBB);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Bezier1iMBIntersector8Single_OBB);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Triangle4Intersector8HybridMoeller);
@@ -190,6 +206,7 @@ namespace embree
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Triangle8Intersector8HybridMoeller);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Triangle8Intersector8HybridMoellerNoFilter);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Triangle4vMBIntersector8HybridMoeller);
+    SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8QuantizedTriangle4Intersector8Moeller);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8GridAOSIntersector8);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Quad4vIntersector8HybridMoeller);
     SELECT_SYMBOL_INIT_AVX_AVX2(features,BVH8Quad4vIntersector8HybridMoellerNoFilter);
@@ -201,11 +218,13 @@ namespace embree
     SELECT_SYMBOL_INIT_AVX512KNL(features,BVH8Line4iIntersector16);
     SELECT_SYMBOL_INIT_AVX512KNL(features,BVH8Line4iMBIntersector16);
     SELECT_SYMBOL_INIT_AVX512KNL(features,BVH8Bezier1vIntersector16Single_OBB);
+    SELECT_SYMBOL_INIT_AVX512KNL(features,BVH8Bezier8vIntersector16Single_OBB);
     SELECT_SYMBOL_INIT_AVX512KNL(features,BVH8Bezier1iIntersector16Single_OBB);
     SELECT_SYMBOL_INIT_AVX512KNL(features,BVH8Bezier1iMBIntersector16Single_OBB);
     SELECT_SYMBOL_INIT_AVX512KNL(features,BVH8Triangle4Intersector16HybridMoeller);
     SELECT_SYMBOL_INIT_AVX512KNL(features,BVH8Triangle4Intersector16HybridMoellerNoFilter);
     SELECT_SYMBOL_INIT_AVX512KNL(features,BVH8Triangle4vMBIntersector16HybridMoeller);
+    SELECT_SYMBOL_INIT_AVX512KNL(features,BVH8QuantizedTriangle4Intersector16Moeller);
     SELECT_SYMBOL_INIT_AVX512KNL(features,BVH8GridAOSIntersector16);
     SELECT_SYMBOL_INIT_AVX512KNL(features,BVH8Quad4vIntersector16HybridMoeller);
     SELECT_SYMBOL_INIT_AVX512KNL(features,BVH8Quad4vIntersector16HybridMoellerNoFilter);
@@ -232,6 +251,17 @@ namespace embree
     return intersectors;
   }
 
+  Accel::Intersectors BVH8Factory::BVH8Bezier8vIntersectors_OBB(BVH8* bvh)
+  {
+    Accel::Intersectors intersectors;
+    intersectors.ptr = bvh;
+    intersectors.intersector1  = BVH8Bezier8vIntersector1_OBB;
+    intersectors.intersector4  = BVH8Bezier8vIntersector4Single_OBB;
+    intersectors.intersector8  = BVH8Bezier8vIntersector8Single_OBB;
+    intersectors.intersector16 = BVH8Bezier8vIntersector16Single_OBB;
+    return intersectors;
+  }
+
   Accel::Intersectors BVH8Factory::BVH8Bezier1iIntersectors_OBB(BVH8* bvh)
   {
     Accel::Intersectors intersectors;
@@ -317,6 +347,17 @@ namespace embree
     return intersectors;
   }
 
+  Accel::Intersectors BVH8Factory::BVH8QuantizedTriangle4Intersectors(BVH8* bvh)
+  {
+    Accel::Intersectors intersectors;
+    intersectors.ptr = bvh;
+    intersectors.intersector1  = BVH8QuantizedTriangle4Intersector1Moeller;
+    intersectors.intersector4  = BVH8QuantizedTriangle4Intersector4Moeller;
+    intersectors.intersector8  = BVH8QuantizedTriangle4Intersector8Moeller;
+    intersectors.intersector16 = BVH8QuantizedTriangle4Intersector16Moeller;
+    return intersectors;
+  }
+
   Accel::Intersectors BVH8Factory::BVH8Quad4vIntersectors(BVH8* bvh)
   {
     Accel::Intersectors intersectors;
@@ -366,6 +407,14 @@ namespace embree
     return new AccelInstance(accel,builder,intersectors);
   }
 
+  Accel* BVH8Factory::BVH8OBBBezier8v(Scene* scene, bool highQuality)
+  {
+    BVH8* accel = new BVH8(Bezier8v::type,scene);
+    Accel::Intersectors intersectors = BVH8Bezier8vIntersectors_OBB(accel);
+    Builder* builder = BVH8Bezier8vBuilder_OBB_New(accel,scene,0);
+    return new AccelInstance(accel,builder,intersectors);
+  }
+
   Accel* BVH8Factory::BVH8OBBBezier1i(Scene* scene, bool highQuality)
   {
     BVH8* accel = new BVH8(Bezier1i::type,scene);
@@ -437,6 +486,14 @@ namespace embree
     return new AccelInstance(accel,builder,intersectors);
   }
 
+  Accel* BVH8Factory::BVH8Triangle4Compressed(Scene* scene)
+  {
+    BVH8* accel = new BVH8(Triangle4::type,scene);
+    Accel::Intersectors intersectors= BVH8QuantizedTriangle4Intersectors(accel);
+    Builder* builder = BVH8Triangle4SceneBuilderSAH(accel,scene,MODE_QUANTIZED);
+    return new AccelInstance(accel,builder,intersectors);
+  }
+
   Accel* BVH8Factory::BVH8Triangle8(Scene* scene)
   {
     BVH8* accel = new BVH8(Triangle8::type,scene);
@@ -462,6 +519,9 @@ namespace embree
     else if (scene->device->tri_builder_mb == "sah"         )  builder = BVH8Triangle4vMBSceneBuilderSAH(accel,scene,0);
     else throw_RTCError(RTC_INVALID_ARGUMENT,"unknown builder "+scene->device->tri_builder_mb+" for BVH8<Triangle4vMB>");
 
+    /* the vertices of meshes with non uniform motion get gathered at ray time */
+    scene->needTriangleIndices = true;
+    scene->needTriangleVertices = true;
     return new AccelInstance(accel,builder,intersectors);
   }
 
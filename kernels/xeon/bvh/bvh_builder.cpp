@@ -82,6 +82,57 @@ namespace embree
       bvh->layoutLargeNodes(pinfo.size()*0.005f);
     }
 
+    template<int N>
+      struct CreateQuantizedNode
+    {
+      typedef BVHN<N> BVH;
+      typedef typename BVH::QuantizedNode QuantizedNode;
+
+      __forceinline CreateQuantizedNode (BVH* bvh) : bvh(bvh) {}
+      
+      __forceinline QuantizedNode* operator() (const isa::BVHBuilderBinnedSAH::BuildRecord& current, BVHBuilderBinnedSAH::BuildRecord* children, const size_t num, FastAllocator::ThreadLocal2* alloc)
+      {
+        /* child bounds are quantized relative to the merged bounds of all children */
+        BBox3fa bounds = empty;
+        for (size_t i=0; i<num; i++)
+          bounds.extend(children[i].bounds());
+
+        QuantizedNode* node = (QuantizedNode*) alloc->alloc0.malloc(sizeof(QuantizedNode), BVH::byteAlignment); node->clear();
+        node->setQuantizationBounds(bounds);
+        for (size_t i=0; i<num; i++) {
+          node->set(i,children[i].bounds());
+          children[i].parent = (size_t*)&node->child(i);
+        }
+        *current.parent = bvh->encodeNode(node);
+        return node;
+      }
+
+      BVH* bvh;
+    };
+
+    template<int N>
+    void BVHNBuilderQuantized<N>::BVHNBuilderV::build(BVH* bvh, BuildProgressMonitor& progress_in, PrimRef* prims, const PrimInfo& pinfo, const size_t blockSize, const size_t minLeafSize, const size_t maxLeafSize, const float travCost, const float intCost)
+    {
+      auto progressFunc = [&] (size_t dn) { 
+        progress_in(dn); 
+      };
+            
+      auto createLeafFunc = [&] (const BVHBuilderBinnedSAH::BuildRecord& current, Allocator* alloc) -> size_t {
+        return createLeaf(current,alloc);
+      };
+
+      auto updateNode = [] (typename BVH::QuantizedNode* node, const size_t* counts, const size_t num) -> size_t {
+        return 0;
+      };
+      
+      NodeRef root;
+      BVHBuilderBinnedSAH::build_reduce<NodeRef>
+        (root,typename BVH::CreateAlloc(bvh),size_t(0),CreateQuantizedNode<N>(bvh),updateNode,createLeafFunc,progressFunc,
+         prims,pinfo,N,BVH::maxBuildDepthLeaf,blockSize,minLeafSize,maxLeafSize,travCost,intCost);
+
+      bvh->set(root,pinfo.geomBounds,pinfo.size());
+    }
+
     template<int N>
       struct CreateNodeMB
     {
@@ -191,11 +242,13 @@ namespace embree
     }
 
     template struct BVHNBuilder<4>;
+    template struct BVHNBuilderQuantized<4>;
     template struct BVHNBuilderMblur<4>;    
     template struct BVHNBuilderSpatial<4>;
 
 #if defined(__AVX__)
     template struct BVHNBuilder<8>;
+    template struct BVHNBuilderQuantized<8>;
     template struct BVHNBuilderMblur<8>;
     template struct BVHNBuilderSpatial<8>;
 #endif
@@ -55,6 +55,40 @@ namespace embree
       }
     };
 
+    template<int N>
+      struct BVHNBuilderQuantized
+    {
+      typedef BVHN<N> BVH;
+      typedef typename BVH::NodeRef NodeRef;
+      typedef FastAllocator::ThreadLocal2 Allocator;
+      
+      struct BVHNBuilderV {
+        void build(BVH* bvh, BuildProgressMonitor& progress, PrimRef* prims, const PrimInfo& pinfo, 
+                   const size_t blockSize, const size_t minLeafSize, const size_t maxLeafSize, const float travCost, const float intCost);
+        virtual size_t createLeaf (const BVHBuilderBinnedSAH::BuildRecord& current, Allocator* alloc) = 0;
+      };
+
+      template<typename CreateLeafFunc>
+      struct BVHNBuilderT : public BVHNBuilderV
+      {
+        BVHNBuilderT (CreateLeafFunc createLeafFunc)
+          : createLeafFunc(createLeafFunc) {}
+
+        size_t createLeaf (const BVHBuilderBinnedSAH::BuildRecord& current, Allocator* alloc) {
+          return createLeafFunc(current,alloc);
+        }
+
+      private:
+        CreateLeafFunc createLeafFunc;
+      };
+
+      template<typename CreateLeafFunc>
+      static void build(BVH* bvh, CreateLeafFunc createLeaf, BuildProgressMonitor& progress, PrimRef* prims, const PrimInfo& pinfo, 
+                        const size_t blockSize, const size_t minLeafSize, const size_t maxLeafSize, const float travCost, const float intCost) {
+        BVHNBuilderT<CreateLeafFunc>(createLeaf).build(bvh,progress,prims,pinfo,blockSize,minLeafSize,maxLeafSize,travCost,intCost);
+      }
+    };
+
     template<int N>
       struct BVHNBuilderMblur
     {
@@ -64,7 +98,7 @@ namespace embree
       typedef FastAllocator::ThreadLocal2 Allocator;
       
       struct BVHNBuilderV {
-        void build(BVH* bvh, BuildProgressMonitor& progress, PrimRef* prims, const PrimInfo& pinfo, 
+        void build(BVH* bvh, BuildProgressMonitor& progress, PrimRef* prims, const PrimInfo& pinfo,
                    const size_t blockSize, const size_t minLeafSize, const size_t maxLeafSize, const float travCost, const float intCost);
         virtual std::pair<BBox3fa,BBox3fa> createLeaf (const BVHBuilderBinnedSAH::BuildRecord& current, Allocator* alloc) = 0;
       };
@@ -16,6 +16,7 @@
 
 #include "bvh_builder_instancing.h"
 #include "bvh_statistics.h"
+#include "../../common/accelinstance.h"
 #include "../builders/bvh_builder_sah.h"
 #include "../geometry/triangle.h"
 #include "../geometry/trianglev_mb.h"
@@ -82,6 +83,33 @@ namespace embree
       return box;
     }
 
+    template<int N>
+    bool BVHNBuilderInstancing<N>::createNativeRef(Instance* instance, BuildRef& ref_o)
+    {
+      /* an instanced scene consists of its triangle BVH and its own instancing BVH */
+      Scene* object = instance->getInstancedScene();
+      BVH* tris  = (BVH*) ((AccelInstance*)object->nativeTriangleAccel)->getAccel();
+      BVH* insts = (BVH*) ((AccelInstance*)object->nativeInstanceAccel)->getAccel();
+      const bool hasTris  = tris ->root != BVH::emptyNode;
+      const bool hasInsts = insts->root != BVH::emptyNode;
+      if (!hasTris && !hasInsts) return false;
+
+      NodeRef root; BBox3fa bounds;
+      if (hasTris && hasInsts) 
+      {
+        Node* node = (Node*) bvh->alloc.threadLocal2()->alloc0.malloc(sizeof(Node)); node->clear();
+        node->set(0,tris ->bounds); node->child(0) = tris ->root;
+        node->set(1,insts->bounds); node->child(1) = insts->root;
+        root = bvh->encodeNode(node);
+        bounds = merge(tris->bounds,insts->bounds);
+      }
+      else if (hasTris) { root = tris ->root; bounds = tris ->bounds; }
+      else              { root = insts->root; bounds = insts->bounds; }
+
+      ref_o = BuildRef(instance->local2world[0],bounds,root,instance->mask,instance->id,hash(instance->local2world[0]),0,object);
+      return true;
+    }
+
     template<int N>
     void BVHNBuilderInstancing<N>::build(size_t threadIndex, size_t threadCount)
     {
@@ -104,6 +132,7 @@ namespace embree
       //numPrimitives += scene->getNumPrimitives<TriangleMesh,1>();
       numPrimitives += scene->instanced1.numTriangles;
       numPrimitives += scene->instanced2.numTriangles;
+      numPrimitives += scene->nativeInstances.size();
       if (numPrimitives == 0) {
         prims.resize(0);
         bvh->set(BVH::emptyNode,empty,0);
@@ -170,7 +199,7 @@ namespace embree
             if (geom == nullptr) continue;
             Builder* builder = builders[objectID]; 
             if (builder == nullptr) continue;
-            if (geom->isModified() && geom->isInstanced()) 
+            if ((geom->isModified() || objects[objectID]->root == BVH::emptyNode) && geom->isInstanced()) 
               builder->build(0,0);
           }
         });
@@ -191,6 +220,13 @@ namespace embree
             refs[nextRef++] = BVHNBuilderInstancing::BuildRef(instance->local2world,object->bounds,object->root,instance->mask,objectID,hash(instance->local2world),s);
           }
         });
+
+      /* creates all natively traversed scene instances */
+      for (size_t i=0; i<scene->nativeInstances.size(); i++) {
+        BuildRef ref;
+        if (createNativeRef(scene->nativeInstances[i],ref))
+          refs[nextRef++] = ref;
+      }
       refs.resize(nextRef);
 
 #if 0
@@ -241,7 +277,9 @@ namespace embree
         BuildRef* ref = (BuildRef*) prims[0].ID();
         //const BBox3fa bounds = xfmBounds(ref->local2world,ref->localBounds);
         const BBox3fa bounds = xfmDeepBounds<N>(ref->local2world,ref->localBounds,ref->node,2);
-        bvh->set(ref->node,bounds,numPrimitives);
+        TransformNode* node = (TransformNode*) bvh->alloc.threadLocal2()->alloc0.malloc(sizeof(TransformNode));
+        new (node) TransformNode(ref->local2world,ref->localBounds,ref->node,ref->mask,ref->instID,ref->xfmID,ref->type,ref->scene);
+        bvh->set(BVH::encodeNode(node),bounds,numPrimitives);
       }
 
       /* otherwise build toplevel hierarchy */
@@ -266,7 +304,7 @@ namespace embree
             assert(current.prims.size() == 1);
             BuildRef* ref = (BuildRef*) prims[current.prims.begin()].ID();
             TransformNode* node = (TransformNode*) alloc->alloc0.malloc(sizeof(TransformNode));
-            new (node) TransformNode(ref->local2world,ref->localBounds,ref->node,ref->mask,ref->instID,ref->xfmID,ref->type); // FIXME: rcp should be precalculated somewhere
+            new (node) TransformNode(ref->local2world,ref->localBounds,ref->node,ref->mask,ref->instID,ref->xfmID,ref->type,ref->scene); // FIXME: rcp should be precalculated somewhere
             *current.parent = BVH::encodeNode(node);
             //*current.parent = ref->node;
             ((NodeRef*)current.parent)->setBarrier();
@@ -275,6 +313,7 @@ namespace embree
            [&] (size_t dn) { bvh->scene->progressMonitor(0); },
            prims.data(),pinfo,N,BVH::maxBuildDepthLeaf,4,1,1,1.0f,1.0f);
         
+        bvh->clearBarrier(root);
         bvh->set(root,pinfo.geomBounds,numPrimitives);
         numCollapsedTransformNodes = refs.size();
         //bvh->root = collapse(bvh->root);
@@ -18,6 +18,7 @@
 
 #include "bvh.h"
 #include "../../common/scene_triangle_mesh.h"
+#include "../../common/scene_instance.h"
 
 namespace embree
 {
@@ -41,8 +42,8 @@ namespace embree
       public:
         __forceinline BuildRef () {}
 
-        __forceinline BuildRef (const AffineSpace3fa& local2world, const BBox3fa& localBounds_in, NodeRef node, unsigned mask, int instID, int xfmID, int type, int depth = 0)
-          : local2world(local2world), localBounds(localBounds_in), node(node), mask(mask), instID(instID), xfmID(xfmID), type(type), depth(depth)
+        __forceinline BuildRef (const AffineSpace3fa& local2world, const BBox3fa& localBounds_in, NodeRef node, unsigned mask, int instID, int xfmID, int type, Scene* scene = nullptr, int depth = 0)
+          : local2world(local2world), localBounds(localBounds_in), node(node), mask(mask), instID(instID), xfmID(xfmID), type(type), scene(scene), depth(depth)
         {
           if (node.isNode()) {
           //if (node.isNode() || node.isNodeMB()) {
@@ -73,6 +74,7 @@ namespace embree
         int instID;
         int xfmID;
         int type;
+        Scene* scene;
         int depth;
       };
       
@@ -82,6 +84,9 @@ namespace embree
       /*! Destructor */
       ~BVHNBuilderInstancing ();
       
+      /*! creates the reference to a natively traversed scene instance */
+      bool createNativeRef(Instance* instance, BuildRef& ref_o);
+
       /*! builder entry point */
       void build(size_t threadIndex, size_t threadCount);
       void deleteGeometry(size_t geomID);
@@ -95,16 +95,16 @@ namespace embree
       }
     };
 
-    template<int N, typename Primitive>
+    template<int N, typename Primitive, typename MortonID>
     struct CreateMortonLeaf;
 
-    template<int N>
-    struct CreateMortonLeaf<N,Triangle4>
+    template<int N, typename MortonID>
+    struct CreateMortonLeaf<N,Triangle4,MortonID>
     {
       typedef BVHN<N> BVH;
       typedef typename BVH::NodeRef NodeRef;
 
-      __forceinline CreateMortonLeaf (TriangleMesh* mesh, MortonID32Bit* morton)
+      __forceinline CreateMortonLeaf (TriangleMesh* mesh, MortonID* morton)
         : mesh(mesh), morton(morton) {}
 
       __noinline void operator() (MortonBuildRecord<NodeRef>& current, FastAllocator::ThreadLocal2* alloc, BBox3fa& box_o)
@@ -150,18 +150,18 @@ namespace embree
     
     private:
       TriangleMesh* mesh;
-      MortonID32Bit* morton;
+      MortonID* morton;
     };
     
 #if defined(__AVX__)
     
-    template<int N>
-    struct CreateMortonLeaf<N,Triangle8>
+    template<int N, typename MortonID>
+    struct CreateMortonLeaf<N,Triangle8,MortonID>
     {
       typedef BVHN<N> BVH;
       typedef typename BVH::NodeRef NodeRef;
 
-      __forceinline CreateMortonLeaf (TriangleMesh* mesh, MortonID32Bit* morton)
+      __forceinline CreateMortonLeaf (TriangleMesh* mesh, MortonID* morton)
         : mesh(mesh), morton(morton) {}
       
       __noinline void operator() (MortonBuildRecord<NodeRef>& current, FastAllocator::ThreadLocal2* alloc, BBox3fa& box_o)
@@ -207,17 +207,17 @@ namespace embree
 
     private:
       TriangleMesh* mesh;
-      MortonID32Bit* morton;
+      MortonID* morton;
     };
 #endif
     
-    template<int N>
-    struct CreateMortonLeaf<N,Triangle4v>
+    template<int N, typename MortonID>
+    struct CreateMortonLeaf<N,Triangle4v,MortonID>
     {
       typedef BVHN<N> BVH;
       typedef typename BVH::NodeRef NodeRef;
 
-      __forceinline CreateMortonLeaf (TriangleMesh* mesh, MortonID32Bit* morton)
+      __forceinline CreateMortonLeaf (TriangleMesh* mesh, MortonID* morton)
         : mesh(mesh), morton(morton) {}
       
       __noinline void operator() (MortonBuildRecord<NodeRef>& current, FastAllocator::ThreadLocal2* alloc, BBox3fa& box_o)
@@ -262,16 +262,16 @@ namespace embree
       }
     private:
       TriangleMesh* mesh;
-      MortonID32Bit* morton;
+      MortonID* morton;
     };
 
-    template<int N>
-    struct CreateMortonLeaf<N,Triangle4i>
+    template<int N, typename MortonID>
+    struct CreateMortonLeaf<N,Triangle4i,MortonID>
     {
       typedef BVHN<N> BVH;
       typedef typename BVH::NodeRef NodeRef;
 
-      __forceinline CreateMortonLeaf (TriangleMesh* mesh, MortonID32Bit* morton)
+      __forceinline CreateMortonLeaf (TriangleMesh* mesh, MortonID* morton)
         : mesh(mesh), morton(morton) {}
       
       __noinline void operator() (MortonBuildRecord<NodeRef>& current, FastAllocator::ThreadLocal2* alloc, BBox3fa& box_o)
@@ -327,7 +327,7 @@ namespace embree
       }
     private:
       TriangleMesh* mesh;
-      MortonID32Bit* morton;
+      MortonID* morton;
     };
     
     template<typename Mesh>
@@ -336,7 +336,8 @@ namespace embree
       __forceinline CalculateMeshBounds (Mesh* mesh)
         : mesh(mesh) {}
       
-      __forceinline const BBox3fa operator() (const MortonID32Bit& morton) {
+      template<typename MortonID>
+      __forceinline const BBox3fa operator() (const MortonID& morton) {
         return mesh->bounds(morton.index);
       }
       
@@ -344,12 +345,13 @@ namespace embree
       Mesh* mesh;
     };        
     
-    template<int N, typename Mesh, typename Primitive>
+    template<int N, typename Mesh, typename Primitive, typename MortonID>
     class BVHNMeshBuilderMorton : public Builder
     {
       typedef BVHN<N> BVH;
       typedef typename BVH::Node Node;
       typedef typename BVH::NodeRef NodeRef;
+      typedef typename MortonID::Generator MortonCodeGenerator;
 
     public:
       
@@ -383,7 +385,7 @@ namespace embree
         /* preallocate arrays */
         morton.resize(numPrimitives);
         size_t bytesAllocated = numPrimitives*sizeof(Node)/(4*N) + size_t(1.2f*Primitive::blocks(numPrimitives)*sizeof(Primitive));
-        size_t bytesMortonCodes = numPrimitives*sizeof(MortonID32Bit);
+        size_t bytesMortonCodes = numPrimitives*sizeof(MortonID);
         bytesAllocated = max(bytesAllocated,bytesMortonCodes); // the first allocation block is reused to sort the morton codes
         bvh->alloc.init(bytesAllocated,2*bytesAllocated);
 
@@ -398,8 +400,8 @@ namespace embree
             }, [] (const BBox3fa& a, const BBox3fa& b) { return merge(a,b); });
 
         /* compute morton codes */
-        MortonID32Bit* dest = (MortonID32Bit*) bvh->alloc.specialAlloc(bytesMortonCodes);
-        MortonCodeGenerator::MortonCodeMapping mapping(centBounds);
+        MortonID* dest = (MortonID*) bvh->alloc.specialAlloc(bytesMortonCodes);
+        typename MortonCodeGenerator::MortonCodeMapping mapping(centBounds);
         size_t numPrimitivesGen = parallel_prefix_sum( pstate, size_t(0), numPrimitives, size_t(BLOCK_SIZE), size_t(0), [&](const range<size_t>& r, const size_t base) -> size_t {
             size_t num = 0;
             MortonCodeGenerator generator(mapping,&morton.data()[r.begin()]);
@@ -433,7 +435,7 @@ namespace embree
         /* create BVH */
         AllocBVHNNode<N> allocNode;
         SetBVHNBounds<N> setBounds(bvh);
-        CreateMortonLeaf<N,Primitive> createLeaf(mesh,morton.data());
+        CreateMortonLeaf<N,Primitive,MortonID> createLeaf(mesh,morton.data());
         CalculateMeshBounds<Mesh> calculateBounds(mesh);
         auto node_bounds = bvh_builder_morton_internal<NodeRef>(
           typename BVH::CreateAlloc(bvh), BBox3fa(empty),
@@ -470,15 +472,22 @@ namespace embree
       const size_t minLeafSize;
       const size_t maxLeafSize;
       size_t numPrimitives;
-      mvector<MortonID32Bit> morton;
+      mvector<MortonID> morton;
     };
     
-    Builder* BVH4Triangle4MeshBuilderMortonGeneral  (void* bvh, TriangleMesh* mesh, size_t mode) { return new class BVHNMeshBuilderMorton<4,TriangleMesh,Triangle4> ((BVH4*)bvh,mesh,4,4*BVH4::maxLeafBlocks); }
+    template<typename Primitive>
+    __forceinline Builder* BVH4MeshBuilderMorton (void* bvh, TriangleMesh* mesh, const size_t blockSize, const size_t mode) 
+    {
+      if (mode & MODE_MORTON64) return new class BVHNMeshBuilderMorton<4,TriangleMesh,Primitive,MortonID64Bit>((BVH4*)bvh,mesh,blockSize,blockSize*BVH4::maxLeafBlocks);
+      else                      return new class BVHNMeshBuilderMorton<4,TriangleMesh,Primitive,MortonID32Bit>((BVH4*)bvh,mesh,blockSize,blockSize*BVH4::maxLeafBlocks);
+    }
+
+    Builder* BVH4Triangle4MeshBuilderMortonGeneral  (void* bvh, TriangleMesh* mesh, size_t mode) { return BVH4MeshBuilderMorton<Triangle4> (bvh,mesh,4,mode); }
 #if defined(__AVX__)
-    Builder* BVH4Triangle8MeshBuilderMortonGeneral  (void* bvh, TriangleMesh* mesh, size_t mode) { return new class BVHNMeshBuilderMorton<4,TriangleMesh,Triangle8> ((BVH4*)bvh,mesh,8,8*BVH4::maxLeafBlocks); }
+    Builder* BVH4Triangle8MeshBuilderMortonGeneral  (void* bvh, TriangleMesh* mesh, size_t mode) { return BVH4MeshBuilderMorton<Triangle8> (bvh,mesh,8,mode); }
 #endif
-    Builder* BVH4Triangle4vMeshBuilderMortonGeneral (void* bvh, TriangleMesh* mesh, size_t mode) { return new class BVHNMeshBuilderMorton<4,TriangleMesh,Triangle4v>((BVH4*)bvh,mesh,4,4*BVH4::maxLeafBlocks); }
-    Builder* BVH4Triangle4iMeshBuilderMortonGeneral (void* bvh, TriangleMesh* mesh, size_t mode) { return new class BVHNMeshBuilderMorton<4,TriangleMesh,Triangle4i>((BVH4*)bvh,mesh,4,4*BVH4::maxLeafBlocks); }
+    Builder* BVH4Triangle4vMeshBuilderMortonGeneral (void* bvh, TriangleMesh* mesh, size_t mode) { return BVH4MeshBuilderMorton<Triangle4v>(bvh,mesh,4,mode); }
+    Builder* BVH4Triangle4iMeshBuilderMortonGeneral (void* bvh, TriangleMesh* mesh, size_t mode) { return BVH4MeshBuilderMorton<Triangle4i>(bvh,mesh,4,mode); }
   }
 }
 
@@ -26,6 +26,7 @@
 #include "../geometry/triangle.h"
 #include "../geometry/trianglev.h"
 #include "../geometry/trianglei.h"
+#include "../geometry/trianglec.h"
 #include "../geometry/trianglev_mb.h"
 #include "../geometry/quadv.h"
 #include "../geometry/quadi.h"
@@ -86,14 +87,15 @@ namespace embree
       const size_t minLeafSize;
       const size_t maxLeafSize;
       const float presplitFactor;
+      const bool quantized;
 
       BVHNBuilderSAH (BVH* bvh, Scene* scene, const size_t sahBlockSize, const float intCost, const size_t minLeafSize, const size_t maxLeafSize, const size_t mode)
         : bvh(bvh), scene(scene), mesh(nullptr), prims(scene->device), sahBlockSize(sahBlockSize), intCost(intCost), minLeafSize(minLeafSize), maxLeafSize(min(maxLeafSize,Primitive::max_size()*BVH::maxLeafBlocks)),
-          presplitFactor((mode & MODE_HIGH_QUALITY) ? 1.5f : 1.0f) {}
+          presplitFactor((mode & MODE_HIGH_QUALITY) ? 1.5f : 1.0f), quantized(mode & MODE_QUANTIZED) {}
 
       BVHNBuilderSAH (BVH* bvh, Mesh* mesh, const size_t sahBlockSize, const float intCost, const size_t minLeafSize, const size_t maxLeafSize, const size_t mode)
         : bvh(bvh), scene(nullptr), mesh(mesh), prims(bvh->device), sahBlockSize(sahBlockSize), intCost(intCost), minLeafSize(minLeafSize), maxLeafSize(min(maxLeafSize,Primitive::max_size()*BVH::maxLeafBlocks)),
-          presplitFactor((mode & MODE_HIGH_QUALITY) ? 1.5f : 1.0f) {}
+          presplitFactor((mode & MODE_HIGH_QUALITY) ? 1.5f : 1.0f), quantized(mode & MODE_QUANTIZED) {}
 
       // FIXME: shrink bvh->alloc in destructor here and in other builders too
 
@@ -126,7 +128,10 @@ namespace embree
         
         /* call BVH builder */
         bvh->alloc.init_estimate(pinfo.size()*sizeof(PrimRef));
-        BVHNBuilder<N>::build(bvh,CreateLeaf<N,Primitive>(bvh,prims.data()),bvh->scene->progressInterface,prims.data(),pinfo,sahBlockSize,minLeafSize,maxLeafSize,travCost,intCost);
+        if (quantized)
+          BVHNBuilderQuantized<N>::build(bvh,CreateLeaf<N,Primitive>(bvh,prims.data()),bvh->scene->progressInterface,prims.data(),pinfo,sahBlockSize,minLeafSize,maxLeafSize,travCost,intCost);
+        else
+          BVHNBuilder<N>::build(bvh,CreateLeaf<N,Primitive>(bvh,prims.data()),bvh->scene->progressInterface,prims.data(),pinfo,sahBlockSize,minLeafSize,maxLeafSize,travCost,intCost);
 
 #if PROFILE
           }); 
@@ -154,6 +159,7 @@ namespace embree
     Builder* BVH4Triangle4SceneBuilderSAH  (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<4,TriangleMesh,Triangle4>((BVH4*)bvh,scene,4,1.0f,4,inf,mode); }
     Builder* BVH4Triangle4vSceneBuilderSAH (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<4,TriangleMesh,Triangle4v>((BVH4*)bvh,scene,4,1.0f,4,inf,mode); }
     Builder* BVH4Triangle4iSceneBuilderSAH (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<4,TriangleMesh,Triangle4i>((BVH4*)bvh,scene,4,1.0f,4,inf,mode); }
+    Builder* BVH4Triangle4cSceneBuilderSAH (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<4,TriangleMesh,Triangle4c>((BVH4*)bvh,scene,4,1.0f,4,inf,mode); }
     Builder* BVH4VirtualSceneBuilderSAH    (void* bvh, Scene* scene, size_t mode) {
       int minLeafSize = scene->device->object_accel_min_leaf_size;
       int maxLeafSize = scene->device->object_accel_max_leaf_size;
@@ -334,7 +340,8 @@ namespace embree
     struct CreateLeafMB
     {
       typedef BVHN<N> BVH;
-      __forceinline CreateLeafMB (BVH* bvh, PrimRef* prims) : bvh(bvh), prims(prims) {}
+      __forceinline CreateLeafMB (BVH* bvh, PrimRef* prims, size_t itime = 0, size_t numTimeSegments = 1) 
+        : bvh(bvh), prims(prims), itime(itime), numTimeSegments(numTimeSegments) {}
       
       __forceinline std::pair<BBox3fa,BBox3fa> operator() (const BVHBuilderBinnedSAH::BuildRecord& current, Allocator* alloc)
       {
@@ -345,7 +352,7 @@ namespace embree
 	BBox3fa bounds0 = empty;
 	BBox3fa bounds1 = empty;
         for (size_t i=0; i<items; i++) {
-          auto bounds = accel[i].fill_mblur(prims,start,current.prims.end(),bvh->scene,false);
+          auto bounds = accel[i].fill_mblur(prims,start,current.prims.end(),bvh->scene,false,itime,numTimeSegments);
 	  bounds0.extend(bounds.first);
 	  bounds1.extend(bounds.second);
         }
@@ -355,8 +362,18 @@ namespace embree
 
       BVH* bvh;
       PrimRef* prims;
+      size_t itime;
+      size_t numTimeSegments;
     };
 
+    /*! linear bounds of a primitive inside time segment k of n, only triangle and quad meshes support more than one time segment */
+    template<typename Mesh>
+      __forceinline std::pair<BBox3fa,BBox3fa> linearBounds(const Mesh* mesh, size_t i, size_t k, size_t n) {
+      assert(false); return std::make_pair(BBox3fa(empty),BBox3fa(empty));
+    }
+    __forceinline std::pair<BBox3fa,BBox3fa> linearBounds(const TriangleMesh* mesh, size_t i, size_t k, size_t n) { return mesh->linearBounds(i,k,n); }
+    __forceinline std::pair<BBox3fa,BBox3fa> linearBounds(const QuadMesh*     mesh, size_t i, size_t k, size_t n) { return mesh->linearBounds(i,k,n); }
+
     template<int N, typename Mesh, typename Primitive>
     struct BVHNBuilderMblurSAH : public Builder
     {
@@ -398,8 +415,41 @@ namespace embree
         
         /* call BVH builder */
         bvh->alloc.init_estimate(pinfo.size()*sizeof(PrimRef));
-        BVHNBuilderMblur<N>::build(bvh,CreateLeafMB<N,Primitive>(bvh,prims.data()),bvh->scene->progressInterface,prims.data(),pinfo,
-                                  sahBlockSize,minLeafSize,maxLeafSize,travCost,intCost);
+        const size_t numTimeSegments = mesh ? mesh->numTimeSteps-1 : Scene::Iterator<Mesh,2>(scene).maxTimeSegments();
+        if (numTimeSegments <= 1) 
+        {
+          BVHNBuilderMblur<N>::build(bvh,CreateLeafMB<N,Primitive>(bvh,prims.data()),bvh->scene->progressInterface,prims.data(),pinfo,
+                                     sahBlockSize,minLeafSize,maxLeafSize,travCost,intCost);
+        }
+
+        /* build one BVH per time segment */
+        else
+        {
+          std::vector<typename BVH::NodeRef> roots(numTimeSegments);
+          BBox3fa geomBounds = empty;
+          for (size_t itime=0; itime<numTimeSegments; itime++)
+          {
+            const PrimInfo pinfoSegment = parallel_reduce(size_t(pinfo.begin), size_t(pinfo.end), size_t(1024), PrimInfo(empty), [&] (const range<size_t>& r) -> PrimInfo {
+                PrimInfo pinfo(empty);
+                for (size_t i=r.begin(); i<r.end(); i++) 
+                {
+                  const unsigned geomID = prims[i].geomID(), primID = prims[i].primID();
+                  const Mesh* m = (const Mesh*) bvh->scene->get(geomID);
+                  const std::pair<BBox3fa,BBox3fa> lbounds = linearBounds(m,primID,itime,numTimeSegments);
+                  const BBox3fa bounds = merge(lbounds.first,lbounds.second);
+                  pinfo.add(bounds,bounds.center2());
+                  prims[i] = PrimRef(bounds,geomID,primID);
+                }
+                return pinfo;
+              }, [] (const PrimInfo& a, const PrimInfo& b) { return PrimInfo::merge(a,b); });
+
+            BVHNBuilderMblur<N>::build(bvh,CreateLeafMB<N,Primitive>(bvh,prims.data(),itime,numTimeSegments),bvh->scene->progressInterface,prims.data(),pinfoSegment,
+                                       sahBlockSize,minLeafSize,maxLeafSize,travCost,intCost);
+            roots[itime] = bvh->root;
+            geomBounds.extend(pinfoSegment.geomBounds);
+          }
+          bvh->set(roots,geomBounds,pinfo.size());
+        }
         
 	/* clear temporary data for static geometry */
 	bool staticGeom = mesh ? mesh->isStatic() : scene->isStatic();
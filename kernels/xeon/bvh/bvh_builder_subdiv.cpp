@@ -216,6 +216,7 @@ namespace embree
 
         /* only enable fast mode of no subdiv mesh got enabled or disabled since last run */
         fastUpdateMode &= numSubdivEnableDisableEvents == scene->numSubdivEnableDisableEvents;
+        fastUpdateMode &= bvh->root != BVH::emptyNode;
         numSubdivEnableDisableEvents = scene->numSubdivEnableDisableEvents;
 
         /* skip build for empty scene */
@@ -303,7 +304,8 @@ namespace embree
                 //if (grid_changed) atomic_add(&numChanged,1); else atomic_add(&numUnchanged,1);
                 if (grid_changed) {
                   patch.resetRootRef();
-                  bound = evalGridBounds(patch,0,patch.grid_u_res-1,0,patch.grid_v_res-1,patch.grid_u_res,patch.grid_v_res,mesh);
+                  if (!GridSOA::cachedBounds(patch,mesh,bound))
+                    bound = evalGridBounds(patch,0,patch.grid_u_res-1,0,patch.grid_v_res-1,patch.grid_u_res,patch.grid_v_res,mesh);
                 }
                 else {
                   bound = bounds[patchIndex];
@@ -311,7 +313,8 @@ namespace embree
               }
               else {
                 new (&patch) SubdivPatch1Cached(mesh->id,f,subPatch,mesh,uv,edge_level,subdiv,VSIZEX);
-                bound = evalGridBounds(patch,0,patch.grid_u_res-1,0,patch.grid_v_res-1,patch.grid_u_res,patch.grid_v_res,mesh);
+                if (!GridSOA::cachedBounds(patch,mesh,bound))
+                  bound = evalGridBounds(patch,0,patch.grid_u_res-1,0,patch.grid_v_res-1,patch.grid_u_res,patch.grid_v_res,mesh);
                 //patch.root_ref.data = (int64_t) GridSOA::create(&patch,scene,[&](size_t bytes) { return (*bvh->alloc.threadLocal())(bytes); });
               }
               bounds[patchIndex] = bound;
@@ -22,6 +22,7 @@
 
 #define PROFILE 0
 #define MAX_OPEN_SIZE 10000
+#define MAX_REFIT_SAH_INCREASE 1.5f
 
 namespace embree
 {
@@ -29,7 +30,8 @@ namespace embree
   {
     template<int N, typename Mesh>
     BVHNBuilderTwoLevel<N,Mesh>::BVHNBuilderTwoLevel (BVH* bvh, Scene* scene, const createMeshAccelTy createMeshAccel)
-      : bvh(bvh), objects(bvh->objects), scene(scene), createMeshAccel(createMeshAccel), refs(scene->device), prims(scene->device) {}
+      : bvh(bvh), objects(bvh->objects), scene(scene), createMeshAccel(createMeshAccel), refs(scene->device), prims(scene->device), 
+        numTopObjects(0), topRoot(BVH::emptyNode), topCost(0.0f), topSAH(0.0f) {}
     
     template<int N, typename Mesh>
     BVHNBuilderTwoLevel<N,Mesh>::~BVHNBuilderTwoLevel ()
@@ -52,14 +54,13 @@ namespace embree
           });
       }
 
-      /* reset memory allocator */
-      bvh->alloc.reset();
-      
       /* skip build for empty scene */
       const size_t numPrimitives = scene->getNumPrimitives<Mesh,1>();
       if (numPrimitives == 0) {
+        bvh->alloc.reset();
         prims.resize(0);
         bvh->set(BVH::emptyNode,empty,0);
+        topRoot = BVH::emptyNode;
         return;
       }
 
@@ -109,26 +110,36 @@ namespace embree
           BVH*     object  = objects [objectID]; assert(object);
           Builder* builder = builders[objectID]; assert(builder);
           
-          /* build object if it got modified */
+          /* build object if it got modified or was never build */
 #if !PROFILE 
-          if (mesh->isModified()) 
+          if (mesh->isModified() || object->root == BVH::emptyNode) 
 #endif
             builder->build(0,0);
           
           /* create build primitive */
           if (!object->bounds.empty())
-            refs[nextRef++] = BVHNBuilderTwoLevel::BuildRef(object->bounds,object->root);
+            refs[nextRef++] = BVHNBuilderTwoLevel::BuildRef(object->bounds,object->root,unsigned(objectID));
         }
       });
+      refs.resize(nextRef);
+
+      /* only update toplevel hierarchy if few objects changed */
+      if (refit(numPrimitives)) {
+        bvh->postBuild(t0);
+        return;
+      }
+
+      /* reset memory allocator */
+      bvh->alloc.reset();
+      topRoot = BVH::emptyNode;
       
       /* fast path for single geometry scenes */
-      if (nextRef == 1) { 
+      if (refs.size() == 1) { 
         bvh->set(refs[0].node,refs[0].bounds(),numPrimitives);
         return;
       }
 
       /* open all large nodes */
-      refs.resize(nextRef);
       open_sequential(numPrimitives); 
       
       /* fast path for small geometries */
@@ -144,7 +155,7 @@ namespace embree
         PrimInfo pinfo(empty);
         for (size_t i=r.begin(); i<r.end(); i++) {
           pinfo.add(refs[i].bounds());
-          prims[i] = PrimRef(refs[i].bounds(),(size_t)refs[i].node);
+          prims[i] = PrimRef(refs[i].bounds(),i);
         }
         return pinfo;
       }, [] (const PrimInfo& a, const PrimInfo& b) { return PrimInfo::merge(a,b); });
@@ -157,6 +168,10 @@ namespace embree
       else
       {
         NodeRef root;
+        std::vector<size_t*> leafRefs(refs.size());
+        topNodes.resize(refs.size());
+        nextTopNode = 0;
+
         BVHBuilderBinnedSAH::build<NodeRef>
           (root,
            [&] { return bvh->alloc.threadLocal2(); },
@@ -168,18 +183,22 @@ namespace embree
                children[i].parent = (size_t*)&node->child(i);
              }
              *current.parent = bvh->encodeNode(node);
+             topNodes[nextTopNode++] = TopNode(node,current.parent);
              return 0;
            },
            [&] (const BVHBuilderBinnedSAH::BuildRecord& current, FastAllocator::ThreadLocal2* alloc) -> int
            {
              assert(current.prims.size() == 1);
-             *current.parent = (NodeRef) prims[current.prims.begin()].ID();
+             const size_t refID = prims[current.prims.begin()].ID();
+             *current.parent = refs[refID].node;
+             leafRefs[refID] = current.parent;
              return 1;
            },
            [&] (size_t dn) { bvh->scene->progressMonitor(0); },
            prims.data(),pinfo,N,BVH::maxBuildDepthLeaf,N,1,1,1.0f,1.0f);
         
         bvh->set(root,pinfo.geomBounds,numPrimitives);
+        setupRefit(root,pinfo.geomBounds,leafRefs);
       }
 
 #if PROFILE
@@ -190,9 +209,108 @@ namespace embree
       bvh->postBuild(t0);
     }
 
+    template<int N, typename Mesh>
+    void BVHNBuilderTwoLevel<N,Mesh>::setupRefit(NodeRef root, const BBox3fa& bounds, const std::vector<size_t*>& leafRefs)
+    {
+      /* sort nodes by address to find the node a child slot belongs to */
+      topNodes.resize(nextTopNode);
+      std::sort(topNodes.begin(),topNodes.end(),[] (const TopNode& a, const TopNode& b) { return a.node < b.node; });
+
+      /* link nodes to their parents */
+      topCost = halfArea(bounds);
+      for (size_t i=0; i<topNodes.size(); i++) 
+      {
+        TopNode& n = topNodes[i];
+        if (!locate(n.ref,n.parent,n.slot)) n.parent = -1;
+        for (size_t c=0; c<N; c++)
+          if (n.node->child(c) != BVH::emptyNode) topCost += halfArea(n.node->bounds(c));
+      }
+      topSAH = topCost/halfArea(bounds);
+
+      /* find location of each object in the hierarchy */
+      topLeaves.clear();
+      topLeaves.resize(objects.size());
+      numTopObjects = 0;
+      for (size_t i=0; i<refs.size(); i++)
+      {
+        TopLeaf& leaf = topLeaves[refs[i].geomID()];
+        if (leaf.numRefs++ == 0) numTopObjects++;
+        int node = -1; unsigned slot = 0;
+        if (!locate(leafRefs[i],node,slot)) return;
+        leaf.node = node; leaf.slot = slot;
+      }
+      topRoot = root;
+    }
+
+    template<int N, typename Mesh>
+    bool BVHNBuilderTwoLevel<N,Mesh>::locate(const size_t* ref, int& node, unsigned& slot) const
+    {
+      auto i = std::upper_bound(topNodes.begin(),topNodes.end(),(const char*)ref,[] (const char* ptr, const TopNode& n) { return ptr < (const char*)n.node; });
+      if (i == topNodes.begin()) return false;
+      --i;
+      const NodeRef* children = &i->node->child(0);
+      if ((const NodeRef*)ref >= children+N) return false;
+      node = int(i-topNodes.begin());
+      slot = unsigned((const NodeRef*)ref-children);
+      return true;
+    }
+
+    template<int N, typename Mesh>
+    bool BVHNBuilderTwoLevel<N,Mesh>::refit(size_t numPrimitives)
+    {
+      /* toplevel hierarchy has to be unchanged since last full build */
+      if (topRoot == BVH::emptyNode || bvh->root != topRoot)
+        return false;
+
+      /* the same objects have to be present and changed objects must not be opened */
+      if (refs.size() != numTopObjects)
+        return false;
+      
+      for (size_t i=0; i<refs.size(); i++) 
+      {
+        const unsigned geomID = refs[i].geomID();
+        if (geomID >= topLeaves.size() || topLeaves[geomID].numRefs == 0) return false;
+        if (scene->get(geomID)->isModified() && topLeaves[geomID].numRefs != 1) return false;
+      }
+
+      /* update leaves of changed objects and propagate bounds towards the root */
+      for (size_t i=0; i<refs.size(); i++)
+      {
+        const unsigned geomID = refs[i].geomID();
+        if (!scene->get(geomID)->isModified()) continue;
+        
+        int node = topLeaves[geomID].node;
+        unsigned slot = topLeaves[geomID].slot;
+        BBox3fa bounds = refs[i].bounds();
+        topNodes[node].node->child(slot) = refs[i].node;
+
+        while (true)
+        {
+          Node* n = topNodes[node].node;
+          const BBox3fa oldBounds = n->bounds(slot);
+          if (oldBounds == bounds) break;
+          topCost += halfArea(bounds)-halfArea(oldBounds);
+          n->set(slot,bounds);
+          bounds = n->bounds();
+          slot = topNodes[node].slot;
+          node = topNodes[node].parent;
+          if (node < 0) break;
+        }
+      }
+
+      /* request full rebuild if quality of hierarchy degraded too much */
+      const BBox3fa bounds = topRoot.node()->bounds();
+      topCost += halfArea(bounds)-halfArea(bvh->bounds);
+      bvh->set(topRoot,bounds,numPrimitives);
+      if (topCost > MAX_REFIT_SAH_INCREASE*topSAH*halfArea(bounds)) 
+        return false;
+      return true;
+    }
+
     template<int N, typename Mesh>
     void BVHNBuilderTwoLevel<N,Mesh>::deleteGeometry(size_t geomID)
     {
+      topRoot = BVH::emptyNode;
       if (geomID >= objects.size()) return;
       delete builders[geomID]; builders[geomID] = nullptr;
       delete objects [geomID]; objects [geomID] = nullptr;
@@ -208,6 +326,7 @@ namespace embree
 	if (builders[i]) builders[i]->clear();
 
       refs.clear();
+      topRoot = BVH::emptyNode;
     }
 
     template<int N, typename Mesh>
@@ -224,13 +343,14 @@ namespace embree
       {
         std::pop_heap (refs.begin(),refs.end()); 
         NodeRef ref = refs.back().node;
+        const unsigned geomID = refs.back().geomID();
         if (ref.isLeaf()) break;
         refs.pop_back();    
         
         Node* node = ref.node();
         for (size_t i=0; i<N; i++) {
           if (node->child(i) == BVH::emptyNode) continue;
-          refs.push_back(BuildRef(node->bounds(i),node->child(i)));
+          refs.push_back(BuildRef(node->bounds(i),node->child(i),geomID));
           std::push_heap (refs.begin(),refs.end()); 
         }
       }
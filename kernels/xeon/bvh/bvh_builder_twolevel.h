@@ -40,19 +40,24 @@ namespace embree
       public:
         __forceinline BuildRef () {}
 
-        __forceinline BuildRef (const BBox3fa& bounds, NodeRef node)
+        __forceinline BuildRef (const BBox3fa& bounds, NodeRef node, unsigned geomID)
           : lower(bounds.lower), upper(bounds.upper), node(node)
         {
           if (node.isLeaf())
             lower.w = 0.0f;
           else
             lower.w = area(this->bounds());
+          upper.u = geomID;
         }
 
         __forceinline BBox3fa bounds () const {
           return BBox3fa(lower,upper);
         }
 
+        __forceinline unsigned geomID () const {
+          return upper.u;
+        }
+
         friend bool operator< (const BuildRef& a, const BuildRef& b) {
           return a.lower.w < b.lower.w;
         }
@@ -75,6 +80,44 @@ namespace embree
       void clear();
 
       void open_sequential(size_t numPrimitives);
+
+    private:
+
+      /*! node of the toplevel hierarchy, linked to its parent for refitting */
+      struct TopNode
+      {
+        __forceinline TopNode () {}
+
+        __forceinline TopNode (Node* node, size_t* ref)
+          : node(node), ref(ref), parent(-1), slot(0) {}
+
+      public:
+        Node* node;          //!< toplevel node
+        size_t* ref;         //!< child slot of parent node that references this node
+        int parent;          //!< index of parent node, -1 for the root
+        unsigned slot;       //!< child slot of this node in parent node
+      };
+
+      /*! location of an object in the toplevel hierarchy */
+      struct TopLeaf
+      {
+        __forceinline TopLeaf () 
+          : numRefs(0), node(0), slot(0) {}
+
+      public:
+        unsigned numRefs;    //!< number of toplevel leaves the object got opened into
+        unsigned node;       //!< toplevel node referencing the object (valid if numRefs == 1)
+        unsigned slot;       //!< child slot inside that node
+      };
+
+      /*! links the toplevel hierarchy of the last full build for later refits */
+      void setupRefit(NodeRef root, const BBox3fa& bounds, const std::vector<size_t*>& leafRefs);
+
+      /*! refits the toplevel hierarchy to the changed objects, returns false if a full rebuild is required */
+      bool refit(size_t numPrimitives);
+
+      /*! returns location of a child slot inside the toplevel hierarchy */
+      bool locate(const size_t* ref, int& node, unsigned& slot) const;
       
     public:
       BVH* bvh;
@@ -88,6 +131,15 @@ namespace embree
       mvector<BuildRef> refs;
       mvector<PrimRef> prims;
       AlignedAtomicCounter32 nextRef;
+
+    private:
+      std::vector<TopNode> topNodes;   //!< nodes of toplevel hierarchy sorted by address
+      std::vector<TopLeaf> topLeaves;  //!< location of each object in the toplevel hierarchy
+      AlignedAtomicCounter32 nextTopNode;
+      size_t numTopObjects;            //!< number of objects referenced by toplevel hierarchy
+      NodeRef topRoot;                 //!< root of toplevel hierarchy, empty if it cannot get refitted
+      float topCost;                   //!< sum of surface areas of all toplevel nodes and leaves
+      float topSAH;                    //!< SAH cost of toplevel hierarchy after the last full build
     };
   }
 }
@@ -25,10 +25,12 @@
 #include "../geometry/intersector_iterators.h"
 #include "../geometry/bezier1v_intersector.h"
 #include "../geometry/bezier1i_intersector.h"
+#include "../geometry/bezierv_intersector.h"
 #include "../geometry/linei_intersector.h"
 #include "../geometry/triangle_intersector_moeller.h"
 #include "../geometry/triangle_intersector_pluecker.h"
 #include "../geometry/triangle4i_intersector_pluecker.h"
+#include "../geometry/triangle4c_intersector_pluecker.h"
 #include "../geometry/subdivpatch1cached_intersector1.h"
 #include "../geometry/grid_aos_intersector1.h"
 #include "../geometry/object_intersector1.h"
@@ -54,7 +56,7 @@ namespace embree
       StackItemT<NodeRef> stack[stackSize];           //!< stack of nodes 
       StackItemT<NodeRef>* stackPtr = stack+1;        //!< current stack pointer
       StackItemT<NodeRef>* stackEnd = stack+stackSize;
-      stack[0].ptr  = bvh->root;
+      stack[0].ptr  = (types & BVH_MB) ? bvh->getRoot(ray.time) : bvh->root;
       stack[0].dist = neg_inf;
 
       /* filter out invalid rays */
@@ -70,12 +72,15 @@ namespace embree
       /*! load the ray into SIMD registers */
       size_t leafType = 0;
       const unsigned int* geomID_to_instID = nullptr;
+      Scene* scene = bvh->scene;
       TravRay<N,Nx> vray(ray.org,ray.dir);
       vfloat<Nx> ray_near = max(ray.tnear,0.0f);
       vfloat<Nx> ray_far  = max(ray.tfar ,0.0f);
+      const float ray_time = (types & BVH_MB) ? bvh->getLocalTime(ray.time) : ray.time;
 
       /*! initialize the node traverser */
       BVHNNodeTraverser1<N,Nx,types> nodeTraverser(vray);
+      ThreadStat::Local stats;
 
       /* pop loop */
       while (true) pop:
@@ -98,9 +103,10 @@ namespace embree
           /*! stop if we found a leaf node */
           if (unlikely(cur.isLeaf())) break;
           STAT3(normal.trav_nodes,1,1,1);
+          stats.nodes++;
 
           /* intersect node */
-          bool nodeIntersected = BVHNNodeIntersector1<N,Nx,types,robust>::intersect(cur,vray,ray_near,ray_far,ray.time,tNear,mask);
+          bool nodeIntersected = BVHNNodeIntersector1<N,Nx,types,robust>::intersect(cur,vray,ray_near,ray_far,ray_time,tNear,mask);
           if (unlikely(!nodeIntersected)) break;
 
           /*! if no child is hit, pop next node */
@@ -112,15 +118,18 @@ namespace embree
         }
 
         /* ray transformation support */
-        if (unlikely(nodeTraverser.traverseTransform(cur,ray,vray,leafType,geomID_to_instID,stackPtr,stackEnd)))
+        if (unlikely(nodeTraverser.traverseTransform(cur,ray,vray,leafType,geomID_to_instID,scene,stackPtr,stackEnd)))
           goto pop;
         
         /*! this is a leaf node */
         assert(cur != BVH::emptyNode);
         STAT3(normal.trav_leaves,1,1,1);
         size_t num; Primitive* prim = (Primitive*) cur.leaf(num);
+        stats.leaves++; stats.prims += num;
         size_t lazy_node = 0;
-        PrimitiveIntersector1::intersect(pre,ray,leafType,prim,num,bvh->scene,geomID_to_instID,lazy_node);
+        const float tfar = ray.tfar;
+        PrimitiveIntersector1::intersect(pre,ray,leafType,prim,num,scene,geomID_to_instID,lazy_node);
+        stats.leafHits += ray.tfar < tfar;
         ray_far = ray.tfar;
 
         /*! push lazy node onto stack */
@@ -152,7 +161,7 @@ namespace embree
       NodeRef stack[stackSize];  //!< stack of nodes that still need to get traversed
       NodeRef* stackPtr = stack+1;        //!< current stack pointer
       NodeRef* stackEnd = stack+stackSize;
-      stack[0] = bvh->root;
+      stack[0] = (types & BVH_MB) ? bvh->getRoot(ray.time) : bvh->root;
       
       /* filter out invalid rays */
 #if defined(RTCORE_IGNORE_INVALID_RAYS)
@@ -167,12 +176,15 @@ namespace embree
       /*! load the ray into SIMD registers */
       size_t leafType = 0;
       const unsigned int* geomID_to_instID = nullptr;
+      Scene* scene = bvh->scene;
       TravRay<N,Nx> vray(ray.org,ray.dir);
       vfloat<Nx> ray_near = max(ray.tnear,0.0f);
       vfloat<Nx> ray_far  = max(ray.tfar ,0.0f);
+      const float ray_time = (types & BVH_MB) ? bvh->getLocalTime(ray.time) : ray.time;
 
       /*! initialize the node traverser */
       BVHNNodeTraverser1<N,Nx,types> nodeTraverser(vray);
+      ThreadStat::Local stats;
 
       /* pop loop */
       while (true) pop:
@@ -191,9 +203,10 @@ namespace embree
           /*! stop if we found a leaf node */
           if (unlikely(cur.isLeaf())) break;
           STAT3(shadow.trav_nodes,1,1,1);
+          stats.nodes++;
 
           /* intersect node */
-          bool nodeIntersected = BVHNNodeIntersector1<N,Nx,types,robust>::intersect(cur,vray,ray_near,ray_far,ray.time,tNear,mask);
+          bool nodeIntersected = BVHNNodeIntersector1<N,Nx,types,robust>::intersect(cur,vray,ray_near,ray_far,ray_time,tNear,mask);
           if (unlikely(!nodeIntersected)) break;
 
           /*! if no child is hit, pop next node */
@@ -205,15 +218,18 @@ namespace embree
         }
         
         /* ray transformation support */
-        if (unlikely(nodeTraverser.traverseTransform(cur,ray,vray,leafType,geomID_to_instID,stackPtr,stackEnd)))
+        if (unlikely(nodeTraverser.traverseTransform(cur,ray,vray,leafType,geomID_to_instID,scene,stackPtr,stackEnd)))
           goto pop;
 
         /*! this is a leaf node */
         assert(cur != BVH::emptyNode);
         STAT3(shadow.trav_leaves,1,1,1);
         size_t num; Primitive* prim = (Primitive*) cur.leaf(num);
+        stats.leaves++; stats.prims += num;
         size_t lazy_node = 0;
-        if (PrimitiveIntersector1::occluded(pre,ray,leafType,prim,num,bvh->scene,geomID_to_instID,lazy_node)) {
+        if (PrimitiveIntersector1::occluded(pre,ray,leafType,prim,num,scene,geomID_to_instID,lazy_node)) {
+          stats.leafHits++;
+          nodeTraverser.restoreRay(ray);
           ray.geomID = 0;
           break;
         }
@@ -227,6 +243,32 @@ namespace embree
       AVX_ZERO_UPPER();
     }
 
+#if defined(RTCORE_RAY_PACKETS)
+
+    template<int N, int K, int types, bool robust, typename PrimitiveIntersector1>
+    void BVHNIntersectorKTransform<N,K,types,robust,PrimitiveIntersector1>::intersect(vint<K>* __restrict__ valid_i, BVH* __restrict__ bvh, RayK<K>& __restrict__ ray)
+    {
+      Ray rays[K]; ray.get(rays);
+      for (size_t bits = movemask(*valid_i == -1); bits!=0; ) {
+        const size_t i = __bscf(bits);
+        BVHNIntersector1<N,types,robust,PrimitiveIntersector1>::intersect(bvh,rays[i]);
+      }
+      ray.set(rays);
+    }
+
+    template<int N, int K, int types, bool robust, typename PrimitiveIntersector1>
+    void BVHNIntersectorKTransform<N,K,types,robust,PrimitiveIntersector1>::occluded(vint<K>* __restrict__ valid_i, BVH* __restrict__ bvh, RayK<K>& __restrict__ ray)
+    {
+      Ray rays[K]; ray.get(rays);
+      for (size_t bits = movemask(*valid_i == -1); bits!=0; ) {
+        const size_t i = __bscf(bits);
+        BVHNIntersector1<N,types,robust,PrimitiveIntersector1>::occluded(bvh,rays[i]);
+        if (rays[i].geomID == 0) ray.geomID[i] = 0;
+      }
+    }
+
+#endif
+
     ////////////////////////////////////////////////////////////////////////////////
     /// BVH4Intersector1 Definitions
     ////////////////////////////////////////////////////////////////////////////////
@@ -239,12 +281,22 @@ namespace embree
     DEFINE_INTERSECTOR1(BVH4Bezier1vIntersector1_OBB,BVHNIntersector1<4 COMMA BVH_AN1_UN1 COMMA false COMMA ArrayIntersector1<Bezier1vIntersector1> >);
     DEFINE_INTERSECTOR1(BVH4Bezier1iIntersector1_OBB,BVHNIntersector1<4 COMMA BVH_AN1_UN1 COMMA false COMMA ArrayIntersector1<Bezier1iIntersector1> >);
     DEFINE_INTERSECTOR1(BVH4Bezier1iMBIntersector1_OBB,BVHNIntersector1<4 COMMA BVH_AN2_UN2 COMMA false COMMA ArrayIntersector1<Bezier1iIntersector1MB> >);
+    DEFINE_INTERSECTOR1(BVH4Bezier4vIntersector1_OBB,BVHNIntersector1<4 COMMA BVH_AN1_UN1 COMMA false COMMA ArrayIntersector1<BezierMvIntersector1<4> > >);
   
 #if 1
     typedef Select2Intersector1<
       TriangleMIntersector1MoellerTrumbore<4 COMMA 4 COMMA true>,
       TriangleMvMBIntersector1MoellerTrumbore<4 COMMA 4 COMMA true> > Intersector1_Triangle4Moeller_Triangle4vMBMoeller;
     DEFINE_INTERSECTOR1(BVH4XfmTriangle4Intersector1Moeller,BVHNIntersector1<4 COMMA BVH_TN_AN1_AN2 COMMA false COMMA Intersector1_Triangle4Moeller_Triangle4vMBMoeller>);
+#if defined(RTCORE_RAY_PACKETS)
+    DEFINE_INTERSECTOR4(BVH4XfmTriangle4Intersector4Moeller,BVHNIntersectorKTransform<4 COMMA 4 COMMA BVH_TN_AN1_AN2 COMMA false COMMA Intersector1_Triangle4Moeller_Triangle4vMBMoeller>);
+#if defined(__AVX__)
+    DEFINE_INTERSECTOR8(BVH4XfmTriangle4Intersector8Moeller,BVHNIntersectorKTransform<4 COMMA 8 COMMA BVH_TN_AN1_AN2 COMMA false COMMA Intersector1_Triangle4Moeller_Triangle4vMBMoeller>);
+#endif
+#if defined(__AVX512F__)
+    DEFINE_INTERSECTOR16(BVH4XfmTriangle4Intersector16Moeller,BVHNIntersectorKTransform<4 COMMA 16 COMMA BVH_TN_AN1_AN2 COMMA false COMMA Intersector1_Triangle4Moeller_Triangle4vMBMoeller>);
+#endif
+#endif
 #else
     DEFINE_INTERSECTOR1(BVH4XfmTriangle4Intersector1Moeller,BVHNIntersector1<4 COMMA BVH_TN_AN1 COMMA false COMMA ArrayIntersector1<TriangleMIntersector1MoellerTrumbore<4 COMMA 4 COMMA true> > >);
 #endif
@@ -255,6 +307,7 @@ namespace embree
 #endif
     DEFINE_INTERSECTOR1(BVH4Triangle4vIntersector1Pluecker,BVHNIntersector1<4 COMMA BVH_AN1 COMMA true COMMA ArrayIntersector1<TriangleMvIntersector1Pluecker<4 COMMA 4 COMMA true> > >);
     DEFINE_INTERSECTOR1(BVH4Triangle4iIntersector1Pluecker,BVHNIntersector1<4 COMMA BVH_AN1 COMMA true COMMA ArrayIntersector1<Triangle4iIntersector1Pluecker<4 COMMA 4 COMMA true> > >);
+    DEFINE_INTERSECTOR1(BVH4Triangle4cIntersector1Pluecker,BVHNIntersector1<4 COMMA BVH_AN1 COMMA true COMMA ArrayIntersector1<Triangle4cIntersector1Pluecker<4 COMMA 4 COMMA true> > >);
     DEFINE_INTERSECTOR1(BVH4Triangle4vMBIntersector1Moeller,BVHNIntersector1<4 COMMA BVH_AN2 COMMA false COMMA ArrayIntersector1<TriangleMvMBIntersector1MoellerTrumbore<4 COMMA 4 COMMA true> > >);
 
     DEFINE_INTERSECTOR1(BVH4Subdivpatch1CachedIntersector1,BVHNIntersector1<4 COMMA BVH_AN1 COMMA true COMMA SubdivPatch1CachedIntersector1>);
@@ -278,15 +331,18 @@ namespace embree
     DEFINE_INTERSECTOR1(BVH8Triangle8Intersector1Moeller,BVHNIntersector1<8 COMMA BVH_AN1 COMMA false COMMA ArrayIntersector1<TriangleMIntersector1MoellerTrumbore<8 COMMA 16 COMMA true> > >);
     DEFINE_INTERSECTOR1(BVH8Triangle4vMBIntersector1Moeller,BVHNIntersector1<8 COMMA BVH_AN2 COMMA false COMMA ArrayIntersector1<TriangleMvMBIntersector1MoellerTrumbore<4 COMMA 16 COMMA true> > >);
     DEFINE_INTERSECTOR1(BVH8Quad4vIntersector1Moeller,BVHNIntersector1<8 COMMA BVH_AN1 COMMA false COMMA ArrayIntersector1<QuadMvIntersector1MoellerTrumbore<4 COMMA true> > >);
+    DEFINE_INTERSECTOR1(BVH8QuantizedTriangle4Intersector1Moeller,BVHNIntersector1<8 COMMA BVH_QN1 COMMA false COMMA ArrayIntersector1<TriangleMIntersector1MoellerTrumbore<4 COMMA 16 COMMA true> > >);
 #else
     DEFINE_INTERSECTOR1(BVH8Triangle4Intersector1Moeller,BVHNIntersector1<8 COMMA BVH_AN1 COMMA false COMMA ArrayIntersector1<TriangleMIntersector1MoellerTrumbore<4 COMMA 4 COMMA true> > >);
     DEFINE_INTERSECTOR1(BVH8Triangle8Intersector1Moeller,BVHNIntersector1<8 COMMA BVH_AN1 COMMA false COMMA ArrayIntersector1<TriangleMIntersector1MoellerTrumbore<8 COMMA 8 COMMA true> > >);
     DEFINE_INTERSECTOR1(BVH8Triangle4vMBIntersector1Moeller,BVHNIntersector1<8 COMMA BVH_AN2 COMMA false COMMA ArrayIntersector1<TriangleMvMBIntersector1MoellerTrumbore<4 COMMA 4 COMMA true> > >);
     DEFINE_INTERSECTOR1(BVH8Quad4vIntersector1Moeller,BVHNIntersector1<8 COMMA BVH_AN1 COMMA false COMMA ArrayIntersector1<QuadMvIntersector1MoellerTrumbore<4 COMMA true> > >);
+    DEFINE_INTERSECTOR1(BVH8QuantizedTriangle4Intersector1Moeller,BVHNIntersector1<8 COMMA BVH_QN1 COMMA false COMMA ArrayIntersector1<TriangleMIntersector1MoellerTrumbore<4 COMMA 4 COMMA true> > >);
 #endif
     DEFINE_INTERSECTOR1(BVH8Bezier1vIntersector1_OBB,BVHNIntersector1<8 COMMA BVH_AN1_UN1 COMMA false COMMA ArrayIntersector1<Bezier1vIntersector1> >);
     DEFINE_INTERSECTOR1(BVH8Bezier1iIntersector1_OBB,BVHNIntersector1<8 COMMA BVH_AN1_UN1 COMMA false COMMA ArrayIntersector1<Bezier1iIntersector1> >);
     DEFINE_INTERSECTOR1(BVH8Bezier1iMBIntersector1_OBB,BVHNIntersector1<8 COMMA BVH_AN2_UN2 COMMA false COMMA ArrayIntersector1<Bezier1iIntersector1MB> >);
+    DEFINE_INTERSECTOR1(BVH8Bezier8vIntersector1_OBB,BVHNIntersector1<8 COMMA BVH_AN1_UN1 COMMA false COMMA ArrayIntersector1<BezierMvIntersector1<8> > >);
     DEFINE_INTERSECTOR1(BVH8Line4iIntersector1,BVHNIntersector1<8 COMMA BVH_AN1 COMMA false COMMA ArrayIntersector1<LineMiIntersector1<4 COMMA 4 COMMA true> > >);
     DEFINE_INTERSECTOR1(BVH8Line4iMBIntersector1,BVHNIntersector1<8 COMMA BVH_AN2 COMMA false COMMA ArrayIntersector1<LineMiMBIntersector1<4 COMMA 4 COMMA true> > >);
     DEFINE_INTERSECTOR1(BVH8Quad4iIntersector1Pluecker,BVHNIntersector1<8 COMMA BVH_AN1 COMMA false COMMA ArrayIntersector1<QuadMiIntersector1Pluecker<4 COMMA true> > >);
@@ -35,7 +35,8 @@ namespace embree
       typedef typename BVH::Node Node;
       typedef typename BVH::TransformNode TransformNode;
 
-      static const size_t stackSize = 
+      static const size_t stackSize = (types & BVH_FLAG_TRANSFORM_NODE) ?
+        (1+RTC_MAX_INSTANCE_DEPTH)*(1+(N-1)*BVH::maxDepth+1) : // every instance level plus its pop marker
         1+(N-1)*BVH::maxDepth+   // standard depth
         1+(N-1)*BVH::maxDepth;   // transform feature
 
@@ -46,5 +47,18 @@ namespace embree
       static void intersect(const BVH* This, Ray& ray);
       static void occluded (const BVH* This, Ray& ray);
     };
+
+    /*! BVH ray packet intersector for BVHs with transform nodes. Traces
+     *  each active ray of the packet with the single ray intersector,
+     *  which walks nested instances natively. */
+    template<int N, int K, int types, bool robust, typename PrimitiveIntersector1>
+      class BVHNIntersectorKTransform
+    {
+      typedef BVHN<N> BVH;
+
+    public:
+      static void intersect(vint<K>* valid, BVH* bvh, RayK<K>& ray);
+      static void occluded (vint<K>* valid, BVH* bvh, RayK<K>& ray);
+    };
   }
 }
@@ -28,6 +28,7 @@
 #include "../geometry/triangle_intersector_moeller.h"
 #include "../geometry/triangle_intersector_pluecker.h"
 #include "../geometry/triangle4i_intersector_pluecker.h"
+#include "../geometry/triangle4c_intersector_pluecker.h"
 #include "../geometry/quadv_intersector_moeller.h"
 #include "../geometry/quadi_intersector_moeller.h"
 #include "../geometry/quadi_intersector_pluecker.h"
@@ -56,6 +57,28 @@ namespace embree
       assert(all(valid0,ray.valid()));
       assert(all(valid0,ray.tnear >= 0.0f));
       assert(!(types & BVH_MB) || all(valid0,ray.time >= 0.0f & ray.time <= 1.0f));
+
+      /* motion blur BVHs with multiple time segments are traversed once per time segment present in the packet */
+      NodeRef root = bvh->root;
+      vfloat<K> ray_time = ray.time; //!< time relative to the time segment of the root
+      if ((types & BVH_MB) && unlikely(bvh->numTimeSegments > 1))
+      {
+        if (unlikely(none(valid0))) return;
+        vfloat<K> ftime;
+        const vint<K> itime = getTimeSegment(ray.time,vfloat<K>(float(bvh->numTimeSegments)),ftime);
+        const int itime0 = itime[__bsf(movemask(valid0))];
+        const vbool<K> valid_first = valid0 & (itime == vint<K>(itime0));
+        const vbool<K> valid_other = valid0 & !valid_first;
+        if (unlikely(any(valid_other))) {
+          vint<K> valid_first_i = select(valid_first,vint<K>(-1),vint<K>(0));
+          vint<K> valid_other_i = select(valid_other,vint<K>(-1),vint<K>(0));
+          intersect(&valid_first_i,bvh,ray);
+          intersect(&valid_other_i,bvh,ray);
+          return;
+        }
+        root = bvh->roots[itime0];
+        ray_time = ftime;
+      }
       
       /* load ray */
       Vec3vfK ray_org = ray.org;
@@ -78,12 +101,14 @@ namespace embree
         nearXYZ.z = select(rdir.z >= 0.0f,vint<K>(4*(int)sizeof(vfloat<N>)),vint<K>(5*(int)sizeof(vfloat<N>)));
       }
 
+      ThreadStat::Local stats;
+
       /* allocate stack and push root node */
       vfloat<K> stack_near[stackSizeChunk];
       NodeRef stack_node[stackSizeChunk];
       stack_node[0] = BVH::invalidNode;
       stack_near[0] = inf;
-      stack_node[1] = bvh->root;
+      stack_node[1] = root;
       stack_near[1] = ray_tnear; 
       NodeRef* stackEnd = stack_node+stackSizeChunk;
       NodeRef* __restrict__ sptr_node = stack_node + 2;
@@ -131,6 +156,7 @@ namespace embree
           /* process nodes */
           const vbool<K> valid_node = ray_tfar > curDist;
           STAT3(normal.trav_nodes,1,popcnt(valid_node),K);
+          stats.nodes += popcnt(valid_node);
           const NodeRef nodeRef = cur;
           const BaseNode* __restrict__ const node = nodeRef.baseNode(types);
 
@@ -144,7 +170,7 @@ namespace embree
             if (unlikely(child == BVH::emptyNode)) break;
             vfloat<K> lnearP;
             vbool<K> lhit;
-            BVHNNodeIntersectorK<N,K,types,robust>::intersect(nodeRef,i,org,rdir,org_rdir,ray_tnear,ray_tfar,ray.time,lnearP,lhit);
+            BVHNNodeIntersectorK<N,K,types,robust>::intersect(nodeRef,i,org,rdir,org_rdir,ray_tnear,ray_tfar,ray_time,lnearP,lhit);
 
             /* if we hit the child we choose to continue with that child if it
                is closer than the current next child, or we push it onto the stack */
@@ -200,9 +226,12 @@ namespace embree
         const vbool<K> valid_leaf = ray_tfar > curDist;
         STAT3(normal.trav_leaves,1,popcnt(valid_leaf),K);
         size_t items; const Primitive* prim = (Primitive*) cur.leaf(items);
+        const size_t numLeafRays = popcnt(valid_leaf);
+        stats.leaves += numLeafRays; stats.prims += numLeafRays*items;
 
         size_t lazy_node = 0;
         PrimitiveIntersectorK::intersect(valid_leaf,pre,ray,prim,items,bvh->scene,lazy_node);
+        stats.leafHits += popcnt(valid_leaf & (ray.tfar < ray_tfar));
         ray_tfar = select(valid_leaf,ray.tfar,ray_tfar);
 
         if (unlikely(lazy_node)) {
@@ -234,6 +263,28 @@ namespace embree
       assert(all(valid,ray.tnear >= 0.0f));
       assert(!(types & BVH_MB) || all(valid,ray.time >= 0.0f & ray.time <= 1.0f));
 
+      /* motion blur BVHs with multiple time segments are traversed once per time segment present in the packet */
+      NodeRef root = bvh->root;
+      vfloat<K> ray_time = ray.time; //!< time relative to the time segment of the root
+      if ((types & BVH_MB) && unlikely(bvh->numTimeSegments > 1))
+      {
+        if (unlikely(none(valid))) return;
+        vfloat<K> ftime;
+        const vint<K> itime = getTimeSegment(ray.time,vfloat<K>(float(bvh->numTimeSegments)),ftime);
+        const int itime0 = itime[__bsf(movemask(valid))];
+        const vbool<K> valid_first = valid & (itime == vint<K>(itime0));
+        const vbool<K> valid_other = valid & !valid_first;
+        if (unlikely(any(valid_other))) {
+          vint<K> valid_first_i = select(valid_first,vint<K>(-1),vint<K>(0));
+          vint<K> valid_other_i = select(valid_other,vint<K>(-1),vint<K>(0));
+          occluded(&valid_first_i,bvh,ray);
+          occluded(&valid_other_i,bvh,ray);
+          return;
+        }
+        root = bvh->roots[itime0];
+        ray_time = ftime;
+      }
+
       /* load ray */
       vbool<K> terminated = !valid;
       Vec3vfK ray_org = ray.org, ray_dir = ray.dir;
@@ -255,12 +306,14 @@ namespace embree
         nearXYZ.z = select(rdir.z >= 0.0f,vint<K>(4*(int)sizeof(vfloat<N>)),vint<K>(5*(int)sizeof(vfloat<N>)));
       }
 
+      ThreadStat::Local stats;
+
       /* allocate stack and push root node */
       vfloat<K> stack_near[stackSizeChunk];
       NodeRef stack_node[stackSizeChunk];
       stack_node[0] = BVH::invalidNode;
       stack_near[0] = inf;
-      stack_node[1] = bvh->root;
+      stack_node[1] = root;
       stack_near[1] = ray_tnear; 
       NodeRef* stackEnd = stack_node+stackSizeChunk;
       NodeRef* __restrict__ sptr_node = stack_node + 2;
@@ -306,6 +359,7 @@ namespace embree
           /* process nodes */
           const vbool<K> valid_node = ray_tfar > curDist;
           STAT3(shadow.trav_nodes,1,popcnt(valid_node),K);
+          stats.nodes += popcnt(valid_node);
           const NodeRef nodeRef = cur;
           const BaseNode* __restrict__ const node = nodeRef.baseNode(types);
 
@@ -319,7 +373,7 @@ namespace embree
             if (unlikely(child == BVH::emptyNode)) break;
             vfloat<K> lnearP;
             vbool<K> lhit;
-            BVHNNodeIntersectorK<N,K,types,robust>::intersect(nodeRef,i,org,rdir,org_rdir,ray_tnear,ray_tfar,ray.time,lnearP,lhit);
+            BVHNNodeIntersectorK<N,K,types,robust>::intersect(nodeRef,i,org,rdir,org_rdir,ray_tnear,ray_tfar,ray_time,lnearP,lhit);
 
             /* if we hit the child we choose to continue with that child if it
                is closer than the current next child, or we push it onto the stack */
@@ -376,9 +430,13 @@ namespace embree
         const vbool<K> valid_leaf = ray_tfar > curDist;
         STAT3(shadow.trav_leaves,1,popcnt(valid_leaf),K);
         size_t items; const Primitive* prim = (Primitive*) cur.leaf(items);
+        const size_t numLeafRays = popcnt(valid_leaf);
+        stats.leaves += numLeafRays; stats.prims += numLeafRays*items;
 
         size_t lazy_node = 0;
-        terminated |= PrimitiveIntersectorK::occluded(!terminated,pre,ray,prim,items,bvh->scene,lazy_node);
+        const vbool<K> hit = PrimitiveIntersectorK::occluded(!terminated,pre,ray,prim,items,bvh->scene,lazy_node);
+        stats.leafHits += popcnt(hit & !terminated);
+        terminated |= hit;
         if (all(terminated)) break;
         ray_tfar = select(terminated,vfloat<K>(neg_inf),ray_tfar);
 
@@ -403,6 +461,7 @@ namespace embree
 #endif
     DEFINE_INTERSECTOR4(BVH4Triangle4vIntersector4HybridPluecker, BVHNIntersectorKHybrid<4 COMMA 4 COMMA BVH_AN1 COMMA true COMMA ArrayIntersectorK_1<4 COMMA TriangleMvIntersectorKPluecker<4 COMMA 4 COMMA 4 COMMA true> > >);
     DEFINE_INTERSECTOR4(BVH4Triangle4iIntersector4HybridPluecker, BVHNIntersectorKHybrid<4 COMMA 4 COMMA BVH_AN1 COMMA true COMMA ArrayIntersectorK_1<4 COMMA Triangle4iIntersectorKPluecker<4 COMMA 4 COMMA 4 COMMA true> > >);
+    DEFINE_INTERSECTOR4(BVH4Triangle4cIntersector4HybridPluecker, BVHNIntersectorKHybrid<4 COMMA 4 COMMA BVH_AN1 COMMA true COMMA ArrayIntersectorK_1<4 COMMA Triangle4cIntersectorKPluecker<4 COMMA 4 COMMA 4 COMMA true> > >);
     DEFINE_INTERSECTOR4(BVH4Triangle4vMBIntersector4HybridMoeller, BVHNIntersectorKHybrid<4 COMMA 4 COMMA BVH_AN2 COMMA false COMMA ArrayIntersectorK_1<4 COMMA TriangleMvMBIntersectorKMoellerTrumbore<4 COMMA 4 COMMA 4 COMMA true> > >);
 
     DEFINE_INTERSECTOR4(BVH4Quad4vIntersector4HybridMoeller        ,BVHNIntersectorKHybrid<4 COMMA 4 COMMA BVH_AN1 COMMA false COMMA ArrayIntersectorK_1<4 COMMA QuadMvIntersectorKMoellerTrumbore<4 COMMA 4 COMMA true > > >);
@@ -428,6 +487,7 @@ namespace embree
     DEFINE_INTERSECTOR8(BVH4Triangle8Intersector8HybridMoellerNoFilter, BVHNIntersectorKHybrid<4 COMMA 8 COMMA BVH_AN1 COMMA false COMMA ArrayIntersectorK_1<8 COMMA TriangleMIntersectorKMoellerTrumbore<8 COMMA 8 COMMA 8 COMMA false> > >);
     DEFINE_INTERSECTOR8(BVH4Triangle4vIntersector8HybridPluecker, BVHNIntersectorKHybrid<4 COMMA 8 COMMA BVH_AN1 COMMA true COMMA ArrayIntersectorK_1<8 COMMA TriangleMvIntersectorKPluecker<4 COMMA 4 COMMA 8 COMMA true> > >);
     DEFINE_INTERSECTOR8(BVH4Triangle4iIntersector8HybridPluecker, BVHNIntersectorKHybrid<4 COMMA 8 COMMA BVH_AN1 COMMA true COMMA ArrayIntersectorK_1<8 COMMA Triangle4iIntersectorKPluecker<4 COMMA 4 COMMA 8 COMMA true> > >);
+    DEFINE_INTERSECTOR8(BVH4Triangle4cIntersector8HybridPluecker, BVHNIntersectorKHybrid<4 COMMA 8 COMMA BVH_AN1 COMMA true COMMA ArrayIntersectorK_1<8 COMMA Triangle4cIntersectorKPluecker<4 COMMA 4 COMMA 8 COMMA true> > >);
     DEFINE_INTERSECTOR8(BVH4Triangle4vMBIntersector8HybridMoeller, BVHNIntersectorKHybrid<4 COMMA 8 COMMA BVH_AN2 COMMA false COMMA ArrayIntersectorK_1<8 COMMA TriangleMvMBIntersectorKMoellerTrumbore<4 COMMA 4 COMMA 8 COMMA true> > >);
 
     DEFINE_INTERSECTOR8(BVH4Quad4vIntersector8HybridMoeller        ,BVHNIntersectorKHybrid<4 COMMA 8 COMMA BVH_AN1 COMMA false COMMA ArrayIntersectorK_1<8 COMMA QuadMvIntersectorKMoellerTrumbore<4 COMMA 8 COMMA true > > >);
@@ -453,6 +513,7 @@ namespace embree
     DEFINE_INTERSECTOR16(BVH4Triangle8Intersector16HybridMoellerNoFilter, BVHNIntersectorKHybrid<4 COMMA 16 COMMA BVH_AN1 COMMA false COMMA ArrayIntersectorK_1<16 COMMA TriangleMIntersectorKMoellerTrumbore<8 COMMA 8 COMMA 16 COMMA false> > >);
     DEFINE_INTERSECTOR16(BVH4Triangle4vIntersector16HybridPluecker, BVHNIntersectorKHybrid<4 COMMA 16 COMMA BVH_AN1 COMMA true COMMA ArrayIntersectorK_1<16 COMMA TriangleMvIntersectorKPluecker<4 COMMA 16 COMMA 16 COMMA true> > >);
     DEFINE_INTERSECTOR16(BVH4Triangle4iIntersector16HybridPluecker, BVHNIntersectorKHybrid<4 COMMA 16 COMMA BVH_AN1 COMMA true COMMA ArrayIntersectorK_1<16 COMMA Triangle4iIntersectorKPluecker<4 COMMA 16 COMMA 16 COMMA true> > >);
+    DEFINE_INTERSECTOR16(BVH4Triangle4cIntersector16HybridPluecker, BVHNIntersectorKHybrid<4 COMMA 16 COMMA BVH_AN1 COMMA true COMMA ArrayIntersectorK_1<16 COMMA Triangle4cIntersectorKPluecker<4 COMMA 16 COMMA 16 COMMA true> > >);
     DEFINE_INTERSECTOR16(BVH4Triangle4vMBIntersector16HybridMoeller, BVHNIntersectorKHybrid<4 COMMA 16 COMMA BVH_AN2 COMMA false COMMA ArrayIntersectorK_1<16 COMMA TriangleMvMBIntersectorKMoellerTrumbore<4 COMMA 16 COMMA 16 COMMA true> > >);
 
     DEFINE_INTERSECTOR16(BVH4Quad4vIntersector16HybridMoeller        ,BVHNIntersectorKHybrid<4 COMMA 16 COMMA BVH_AN1 COMMA false COMMA ArrayIntersectorK_1<16 COMMA QuadMvIntersectorKMoellerTrumbore<4 COMMA 16 COMMA true > > >);
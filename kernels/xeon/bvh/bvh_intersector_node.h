@@ -433,6 +433,57 @@ namespace embree
       return movemask(vmask);
     }
 
+    /*! loads N quantized bounds and converts them to floats */
+    template<int N>
+      __forceinline vfloat<N> loadQuantized(const unsigned char* ptr);
+
+    template<>
+      __forceinline vfloat4 loadQuantized<4>(const unsigned char* ptr)
+    {
+#if defined(__SSE4_1__)
+      return vfloat4(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(const int*)ptr))));
+#else
+      return vfloat4(float(ptr[0]),float(ptr[1]),float(ptr[2]),float(ptr[3]));
+#endif
+    }
+
+#if defined(__AVX__)
+    template<>
+      __forceinline vfloat8 loadQuantized<8>(const unsigned char* ptr)
+    {
+      const __m128i q = _mm_loadl_epi64((const __m128i*)ptr);
+#if defined(__AVX2__)
+      return vfloat8(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(q)));
+#else
+      const __m128i q0 = _mm_cvtepu8_epi32(q);
+      const __m128i q1 = _mm_cvtepu8_epi32(_mm_srli_si128(q,4));
+      return vfloat8(_mm256_cvtepi32_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(q0),q1,1)));
+#endif
+    }
+#endif
+
+    /*! intersect N quantized boxes with single ray, the bounds are decompressed on the fly */
+    template<int N>
+      __forceinline size_t intersectNode(const typename BVHN<N>::QuantizedNode* node, const TravRay<N,N>& ray, const vfloat<N>& tnear, const vfloat<N>& tfar, vfloat<N>& dist)
+    {
+      /* the near/far offsets of the ray address floats, the quantized bounds use one byte per child */
+      const unsigned char* ptr = node->lower_x;
+      const vfloat<N> scale_x = node->scale.x*ray.rdir.x, ofs_x = (node->start.x-ray.org.x)*ray.rdir.x;
+      const vfloat<N> scale_y = node->scale.y*ray.rdir.y, ofs_y = (node->start.y-ray.org.y)*ray.rdir.y;
+      const vfloat<N> scale_z = node->scale.z*ray.rdir.z, ofs_z = (node->start.z-ray.org.z)*ray.rdir.z;
+      const vfloat<N> tNearX = madd(loadQuantized<N>(ptr+ray.nearX/sizeof(float)),scale_x,ofs_x);
+      const vfloat<N> tNearY = madd(loadQuantized<N>(ptr+ray.nearY/sizeof(float)),scale_y,ofs_y);
+      const vfloat<N> tNearZ = madd(loadQuantized<N>(ptr+ray.nearZ/sizeof(float)),scale_z,ofs_z);
+      const vfloat<N> tFarX  = madd(loadQuantized<N>(ptr+ray.farX /sizeof(float)),scale_x,ofs_x);
+      const vfloat<N> tFarY  = madd(loadQuantized<N>(ptr+ray.farY /sizeof(float)),scale_y,ofs_y);
+      const vfloat<N> tFarZ  = madd(loadQuantized<N>(ptr+ray.farZ /sizeof(float)),scale_z,ofs_z);
+      const vfloat<N> tNear  = max(tnear,tNearX,tNearY,tNearZ);
+      const vfloat<N> tFar   = min(tfar ,tFarX ,tFarY ,tFarZ );
+      const vbool<N> vmask = tNear <= tFar;
+      dist = tNear;
+      return movemask(vmask);
+    }
+
     /*! Intersects N nodes with 1 ray */
     template<int N, int Nx, int types, bool robust>
     struct BVHNNodeIntersector1;
@@ -502,6 +553,16 @@ namespace embree
     };
 
 
+    template<int N, int Nx>
+      struct BVHNNodeIntersector1<N,Nx,BVH_QN1,false>
+    {
+      static __forceinline bool intersect(const typename BVHN<N>::NodeRef& node, const TravRay<N,Nx>& ray, const vfloat<N>& tnear, const vfloat<N>& tfar, const float time, vfloat<N>& dist, size_t& mask)
+      {
+        mask = intersectNode<N>(node.quantizedNode(),ray,tnear,tfar,dist);
+        return true;
+      }
+    };
+
     /*! Intersects N nodes with K rays */
     template<int N, int K, int types, bool robust>
     struct BVHNNodeIntersectorK;
@@ -69,6 +69,8 @@ namespace embree
 	/*! load the ray into SIMD registers */
         TravRay<N,Nx> vray(k,ray_org,ray_dir,ray_rdir,nearXYZ);
         vfloat<Nx> ray_near(ray_tnear[k]), ray_far(ray_tfar[k]);
+        const float ray_time = (types & BVH_MB) ? bvh->getLocalTime(ray.time[k]) : ray.time[k];
+        ThreadStat::Local stats;
 	
 	/* pop loop */
 	while (true) pop:
@@ -91,9 +93,10 @@ namespace embree
             /*! stop if we found a leaf node */
             if (unlikely(cur.isLeaf())) break;
             STAT3(normal.trav_nodes,1,1,1);
+            stats.nodes++;
 
             /* intersect node */
-            BVHNNodeIntersector1<N,Nx,types,robust>::intersect(cur,vray,ray_near,ray_far,ray.time[k],tNear,mask);
+            BVHNNodeIntersector1<N,Nx,types,robust>::intersect(cur,vray,ray_near,ray_far,ray_time,tNear,mask);
 
             /*! if no child is hit, pop next node */
             if (unlikely(mask == 0))
@@ -107,9 +110,12 @@ namespace embree
           assert(cur != BVH::emptyNode);
 	  STAT3(normal.trav_leaves, 1, 1, 1);
 	  size_t num; Primitive* prim = (Primitive*)cur.leaf(num);
+          stats.leaves++; stats.prims += num;
 
           size_t lazy_node = 0;
+          const float tfar = ray.tfar[k];
           PrimitiveIntersectorK::intersect(pre, ray, k, prim, num, bvh->scene, lazy_node);
+          stats.leafHits += ray.tfar[k] < tfar;
 	  ray_far = ray.tfar[k];
 
           if (unlikely(lazy_node)) {
@@ -133,6 +139,8 @@ namespace embree
 	/*! load the ray into SIMD registers */
         TravRay<N,Nx> vray(k,ray_org,ray_dir,ray_rdir,nearXYZ);
         const vfloat<Nx> ray_near(ray_tnear[k]), ray_far(ray_tfar[k]);
+        const float ray_time = (types & BVH_MB) ? bvh->getLocalTime(ray.time[k]) : ray.time[k];
+        ThreadStat::Local stats;
 	
 	/* pop loop */
 	while (true) pop:
@@ -151,9 +159,10 @@ namespace embree
             /*! stop if we found a leaf node */
             if (unlikely(cur.isLeaf())) break;
             STAT3(shadow.trav_nodes,1,1,1);
+            stats.nodes++;
 
             /* intersect node */
-            BVHNNodeIntersector1<N,Nx,types,robust>::intersect(cur,vray,ray_near,ray_far,ray.time[k],tNear,mask);
+            BVHNNodeIntersector1<N,Nx,types,robust>::intersect(cur,vray,ray_near,ray_far,ray_time,tNear,mask);
 
             /*! if no child is hit, pop next node */
             if (unlikely(mask == 0))
@@ -167,9 +176,11 @@ namespace embree
           assert(cur != BVH::emptyNode);
 	  STAT3(shadow.trav_leaves,1,1,1);
 	  size_t num; Primitive* prim = (Primitive*) cur.leaf(num);
+          stats.leaves++; stats.prims += num;
 
           size_t lazy_node = 0;
           if (PrimitiveIntersectorK::occluded(pre,ray,k,prim,num,bvh->scene,lazy_node)) {
+            stats.leafHits++;
 	    ray.geomID[k] = 0;
 	    return true;
 	  }
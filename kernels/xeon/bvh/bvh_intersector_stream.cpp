@@ -57,6 +57,7 @@ namespace embree
       __aligned(64) Precalculations pre[MAX_RAYS_PER_OCTANT]; 
       __aligned(64) StackItemMask  stack0[stackSizeSingle];  //!< stack of nodes 
       __aligned(64) StackItemMask  stack1[stackSizeSingle];  //!< stack of nodes 
+      ThreadStat::Local stats;
 
       for (size_t r=0;r<numTotalRays;r+=MAX_RAYS_PER_OCTANT)
       {
@@ -147,6 +148,7 @@ namespace embree
               do
               {            
                 STAT3(normal.trav_nodes,1,1,1);                          
+                stats.nodes++;
                 const size_t i = __bscf(bits);
                 const RayContext &ray = ray_ctx[i];
                 const vfloat<K> tNearFarX = msub(bminmaxX, ray.rdir.x, ray.org_rdir.x);
@@ -192,6 +194,7 @@ namespace embree
             do
             {            
               STAT3(normal.trav_nodes,1,1,1);                          
+              stats.nodes++;
               const size_t i = __bscf(bits);
               const RayContext &ray = cur_ray_ctx[i];
               const vfloat<K> tNearX = msub(bminX, ray.rdir.x, ray.org_rdir.x);
@@ -263,6 +266,7 @@ namespace embree
           assert(cur != BVH::emptyNode);
           STAT3(normal.trav_leaves, 1, 1, 1);
           size_t num; Primitive* prim = (Primitive*)cur.leaf(num);
+          stats.leaves += __popcnt(m_trav_active); stats.prims += __popcnt(m_trav_active)*num;
           
           //STAT3(normal.trav_hit_boxes[__popcnt(m_trav_active)],1,1,1);                          
 
@@ -275,6 +279,7 @@ namespace embree
             m_valid_intersection |= rays[i]->tfar < ray_ctx[i].org_rdir.w ? ((size_t)1 << i) : 0;
             ray_ctx[i].org_rdir.w = rays[i]->tfar;
           } while(unlikely(bits));
+          stats.leafHits += __popcnt(m_valid_intersection);
 
           /*! pop next node */
           STAT3(normal.trav_stack_pop,1,1,1);                          
@@ -298,6 +303,7 @@ namespace embree
       __aligned(64) Precalculations pre[MAX_RAYS_PER_OCTANT]; 
       __aligned(64) StackItemMask  stack0[stackSizeSingle];  //!< stack of nodes 
       __aligned(64) StackItemMask  stack1[stackSizeSingle];  //!< stack of nodes 
+      ThreadStat::Local stats;
 
       for (size_t r=0;r<numTotalRays;r+=MAX_RAYS_PER_OCTANT)
       {
@@ -373,6 +379,7 @@ namespace embree
             do
             {            
               STAT3(shadow.trav_nodes,1,1,1);                          
+              stats.nodes++;
               const size_t i = __bscf(bits);
               assert(i<MAX_RAYS_PER_OCTANT);
               RayContext &ray = ray_ctx[i];
@@ -420,6 +427,7 @@ namespace embree
             do
             {            
               STAT3(shadow.trav_nodes,1,1,1);                          
+              stats.nodes++;
               const size_t i = __bscf(bits);
               const RayContext &ray = cur_ray_ctx[i];
               const vfloat<K> tNearX = msub(bminX, ray.rdir.x, ray.org_rdir.x);
@@ -480,6 +488,7 @@ namespace embree
           assert(cur != BVH::emptyNode);
           STAT3(shadow.trav_leaves, 1, 1, 1);
           size_t num; Primitive* prim = (Primitive*)cur.leaf(num);
+          stats.leaves += __popcnt(m_trav_active); stats.prims += __popcnt(m_trav_active)*num;
 
           size_t lazy_node = 0;
           size_t bits = (m_trav_active<<cur_fiber->getOffset()) & m_active;          
@@ -491,6 +500,7 @@ namespace embree
             {
               m_active &= ~((size_t)1 << i);
               rays[i]->geomID = 0;
+              stats.leafHits++;
             }
           } while(bits);
 
@@ -187,6 +187,37 @@ namespace embree
     
   }
 
+    template<int N>
+    void BVHNRefitter<N>::refit(const std::vector<size_t>& modifiedSubTrees)
+    {
+      if (bvh->numPrimitives <= block_size) {
+        bvh->bounds = recurse_bottom(bvh->root);
+        return;
+      }
+
+      /* the subtree IDs refer to the deterministic order of gather_subtree_refs */
+      gather_subtrees();
+
+      parallel_for(size_t(0), modifiedSubTrees.size(), [&] (const range<size_t>& r) {
+          for (size_t i=r.begin(); i<r.end(); i++) {
+            assert(modifiedSubTrees[i] < numSubTrees);
+            recurse_bottom(subTrees[modifiedSubTrees[i]]);
+          }
+        });
+
+      numSubTrees = 0;        
+      bvh->bounds = refit_toplevel(bvh->root,numSubTrees,0);
+    }
+
+    template<int N>
+    size_t BVHNRefitter<N>::gather_subtrees()
+    {
+      numSubTrees = 0;
+      if (bvh->numPrimitives > block_size)
+        gather_subtree_refs(bvh->root,numSubTrees,0);
+      return numSubTrees;
+    }
+
     template<int N>
     size_t BVHNRefitter<N>::annotate_tree_sizes(NodeRef& ref)
     {
@@ -392,14 +423,61 @@ namespace embree
         builder->clear();
     }
     
+    template<int N, typename Mesh, typename Primitive>
+    void BVHNRefitT<N,Mesh,Primitive>::annotate_subtree(NodeRef ref, unsigned subTree)
+    {
+      if (ref.isNode())
+      {
+        Node* node = ref.node();
+        for (size_t i=0; i<N; i++) {
+          NodeRef child = node->child(i);
+          if (child == BVH::emptyNode) continue;
+          annotate_subtree(child,subTree); 
+        }
+      }
+      else if (ref != BVH::emptyNode)
+      {
+        size_t num; Primitive* prims = (Primitive*) ref.leaf(num);
+        for (size_t i=0; i<num; i++)
+          for (size_t j=0; j<Primitive::max_size() && prims[i].valid(j); j++)
+            primSubTrees[prims[i].primID(j)] = subTree;
+      }
+    }
+    
     template<int N, typename Mesh, typename Primitive>
     void BVHNRefitT<N,Mesh,Primitive>::build(size_t threadIndex, size_t threadCount)
     {
+      std::vector<unsigned> modifiedPrims;
+      std::vector<size_t> modifiedSubTrees;
+
       /* build initial BVH */
+      bool refitAll = true;
       if (builder) {
         builder->build(threadIndex,threadCount);
         delete builder; builder = nullptr;
         refitter = new BVHNRefitter<N>(bvh,*(typename BVHNRefitter<N>::LeafBoundsInterface*)this);
+
+        /* remember the refit subtree of each primitive to later refit only modified subtrees */
+        primSubTrees.resize(mesh->size());
+        std::fill(primSubTrees.begin(),primSubTrees.end(),unsigned(-1));
+        const size_t numSubTrees = refitter->gather_subtrees();
+        parallel_for(size_t(0), numSubTrees, [&] (const range<size_t>& r) {
+            for (size_t i=r.begin(); i<r.end(); i++)
+              annotate_subtree(refitter->subTrees[i],unsigned(i));
+          });
+      }
+
+      /* if only some primitives got modified we only refit the subtrees containing them */
+      else if (mesh->getModifiedPrimitives(modifiedPrims))
+      {
+        std::vector<bool> modified(refitter->gather_subtrees(),false);
+        for (size_t i=0; i<modifiedPrims.size(); i++) {
+          const unsigned subTree = primSubTrees[modifiedPrims[i]];
+          if (subTree == unsigned(-1) || modified[subTree]) continue;
+          modified[subTree] = true;
+          modifiedSubTrees.push_back(subTree);
+        }
+        refitAll = false;
       }
       
       /* refit BVH */
@@ -409,7 +487,8 @@ namespace embree
         t0 = getSeconds();
       }
       
-      refitter->refit();
+      if (refitAll) refitter->refit();
+      else          refitter->refit(modifiedSubTrees);
 
       if (bvh->device->verbosity(2)) 
       {
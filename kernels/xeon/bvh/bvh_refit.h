@@ -44,6 +44,12 @@ namespace embree
       /*! refits the BVH */
       void refit();
 
+      /*! refits only the specified subtrees and the toplevel nodes above all subtrees */
+      void refit(const std::vector<size_t>& modifiedSubTrees);
+
+      /*! extracts the subtrees that get refitted in parallel, returns the number of subtrees */
+      size_t gather_subtrees();
+
     private:
       size_t annotate_tree_sizes(NodeRef& ref);
       void calculate_refit_roots ();
@@ -109,12 +115,17 @@ namespace embree
             bounds.extend(((Primitive*)prim)[i].update(mesh));
         return bounds;
       }
+
+    private:
+      /*! assigns all primitives of the subtree to the specified subtree ID */
+      void annotate_subtree(NodeRef ref, unsigned subTree);
       
     private:
       Mesh* mesh;
       Builder* builder;
       BVHNRefitter<N>* refitter;
       BVH* bvh;
+      std::vector<unsigned> primSubTrees; //!< subtree containing each primitive, -1 for primitives above all subtrees
     };
   }
 }
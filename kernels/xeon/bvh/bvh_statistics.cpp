@@ -30,12 +30,19 @@ namespace embree
     numAlignedNodes = numUnalignedNodes = 0;
     numAlignedNodesMB = numUnalignedNodesMB = 0;
     numTransformNodes = 0;
+    numQuantizedNodes = childrenQuantizedNodes = 0;
     numLeaves = numPrims = numPrimBlocks = depth = 0;
     childrenAlignedNodes = childrenUnalignedNodes = 0;
     childrenAlignedNodesMB = childrenUnalignedNodesMB = 0;
     bvhSAH = 0.0f; leafSAH = 0.0f;
     float A = max(0.0f,halfArea(bvh->bounds));
-    statistics(bvh->root,A,depth);
+    if (bvh->numTimeSegments == 1) 
+      statistics(bvh->root,A,depth);
+    else {
+      for (size_t i=0; i<bvh->numTimeSegments; i++) {
+        size_t d = 0; statistics(bvh->roots[i],A,d); depth = max(depth,d);
+      }
+    }
     bvhSAH /= halfArea(bvh->bounds);
     leafSAH /= halfArea(bvh->bounds);
     assert(depth <= BVH::maxDepth);
@@ -49,10 +56,11 @@ namespace embree
     size_t bytesAlignedNodesMB = numAlignedNodesMB*sizeof(AlignedNodeMB);
     size_t bytesUnalignedNodesMB = numUnalignedNodesMB*sizeof(UnalignedNodeMB);
     size_t bytesTransformNodes = numTransformNodes*sizeof(TransformNode);
+    size_t bytesQuantizedNodes = numQuantizedNodes*sizeof(QuantizedNode);
     size_t bytesPrims  = numPrimBlocks*bvh->primTy.bytes;
     size_t numVertices = bvh->numVertices;
     size_t bytesVertices = numVertices*sizeof(Vec3fa); 
-    return bytesAlignedNodes+bytesUnalignedNodes+bytesAlignedNodesMB+bytesUnalignedNodesMB+bytesTransformNodes+bytesPrims+bytesVertices;
+    return bytesAlignedNodes+bytesUnalignedNodes+bytesAlignedNodesMB+bytesUnalignedNodesMB+bytesTransformNodes+bytesQuantizedNodes+bytesPrims+bytesVertices;
   }
   
   template<int N>
@@ -64,10 +72,11 @@ namespace embree
     size_t bytesAlignedNodesMB = numAlignedNodesMB*sizeof(AlignedNodeMB);
     size_t bytesUnalignedNodesMB = numUnalignedNodesMB*sizeof(UnalignedNodeMB);
     size_t bytesTransformNodes = numTransformNodes*sizeof(TransformNode);
+    size_t bytesQuantizedNodes = numQuantizedNodes*sizeof(QuantizedNode);
     size_t bytesPrims  = numPrimBlocks*bvh->primTy.bytes;
     size_t numVertices = bvh->numVertices;
     size_t bytesVertices = numVertices*sizeof(Vec3fa); 
-    size_t bytesTotal = bytesAlignedNodes+bytesUnalignedNodes+bytesAlignedNodesMB+bytesUnalignedNodesMB+bytesTransformNodes+bytesPrims+bytesVertices;
+    size_t bytesTotal = bytesAlignedNodes+bytesUnalignedNodes+bytesAlignedNodesMB+bytesUnalignedNodesMB+bytesTransformNodes+bytesQuantizedNodes+bytesPrims+bytesVertices;
     //size_t bytesTotalAllocated = bvh->alloc.bytes();
     stream.setf(std::ios::fixed, std::ios::floatfield);
     stream << "  primitives = " << bvh->numPrimitives << ", vertices = " << bvh->numVertices << std::endl;
@@ -106,6 +115,13 @@ namespace embree
 	     << "(" << 100.0*double(bytesUnalignedNodesMB)/double(bytesTotal) << "% of total)"
 	     << std::endl;
     }
+    if (numQuantizedNodes) {
+      stream << "  quantizedNodes = "  << numQuantizedNodes << " "
+             << "(" << 100.0*double(childrenQuantizedNodes)/double(N*numQuantizedNodes) << "% filled) "
+	     << "(" << bytesQuantizedNodes/1E6  << " MB) " 
+	     << "(" << 100.0*double(bytesQuantizedNodes)/double(bytesTotal) << "% of total)"
+	     << std::endl;
+    }
     if (numTransformNodes) {
       stream << "  transformNodes = "  << numTransformNodes << " "
 	     << "(" << bytesTransformNodes/1E6  << " MB) " 
@@ -191,6 +207,22 @@ namespace embree
       }
       depth++;
     }
+    else if (node.isQuantizedNode())
+    {
+      numQuantizedNodes++;
+      QuantizedNode* n = node.quantizedNode();
+      bvhSAH += A*travCostAligned;
+      
+      depth = 0;
+      for (size_t i=0; i<N; i++) {
+        if (n->child(i) == BVH::emptyNode) continue;
+        childrenQuantizedNodes++;
+        const float Ai = max(0.0f,halfArea(n->extend(i)));
+        size_t cdepth; statistics(n->child(i),Ai,cdepth); 
+        depth=max(depth,cdepth);
+      }
+      depth++;
+    }
     else if (node.isTransformNode())
     {
       numTransformNodes++;
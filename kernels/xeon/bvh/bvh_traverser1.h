@@ -484,8 +484,6 @@ namespace embree
     template<int N, int Nx, int types, bool transform>
     class BVHNNodeTraverser1Transform;
 
-#define ENABLE_TRANSFORM_CACHE 0
-
     template<int N, int Nx, int types>
       class BVHNNodeTraverser1Transform<N,Nx,types,true>
     {
@@ -493,14 +491,21 @@ namespace embree
       typedef typename BVH::NodeRef NodeRef;
       typedef typename BVH::TransformNode TransformNode;
 
+      /*! traversal state of the enclosing instance level */
+      struct Level
+      {
+        TravRay<N,Nx> vray;                    //!< ray of the enclosing level
+        size_t leafType;                       //!< leaf type of the enclosing level
+        const unsigned int* geomID_to_instID;  //!< geometry ID to instance ID mapping of the enclosing level
+        Scene* scene;                          //!< scene of the enclosing level
+        bool instancedScene;                   //!< true if the level was entered through a scene instance
+        int geomID;                            //!< geometry ID of the ray when entering the scene instance
+        int instID;                            //!< instance ID of the ray when entering the scene instance
+      };
+
     public:
       __forceinline explicit BVHNNodeTraverser1Transform(const TravRay<N,Nx>& vray)
-#if ENABLE_TRANSFORM_CACHE
-        : cacheSlot(0), cacheTag(-1)
-#endif
-      {
-        new (&tlray) TravRay<N,Nx>(vray);
-      }
+        : depth(0) {}
 
       /* If a transform node is passed, traverses the node and returns true. */
       __forceinline bool traverseTransform(NodeRef& cur,
@@ -508,6 +513,7 @@ namespace embree
                                            TravRay<N,Nx>& vray,
                                            size_t& leafType,
                                            const unsigned int*& geomID_to_instID,
+                                           Scene*& scene,
                                            StackItemT<NodeRef>*& stackPtr,
                                            StackItemT<NodeRef>* stackEnd)
       {
@@ -518,46 +524,29 @@ namespace embree
           const TransformNode* node = cur.transformNode();
 #if defined(RTCORE_RAY_MASK)
           if (unlikely((ray.mask & node->mask) == 0)) return true;
-#endif          
-          leafType = node->type;
-          geomID_to_instID = &node->instID;
-
-#if ENABLE_TRANSFORM_CACHE
-          const vboolx xfm_hit = cacheTag == vintx(node->xfmID);
-          if (likely(any(xfm_hit))) {
-            const int slot = __bsf(movemask(xfm_hit));
-            vray = cacheEntry[slot];
-            ray.org = vray.org_xyz;
-            ray.dir = vray.dir_xyz;
-          } 
-          else 
-#endif
-            //if (likely(!node->identity)) 
-          {
-            const Vec3fa ray_org = xfmPoint (node->world2local,((TravRay<N,Nx>&)tlray).org_xyz);
-            const Vec3fa ray_dir = xfmVector(node->world2local,((TravRay<N,Nx>&)tlray).dir_xyz);  
-            new (&vray) TravRay<N,Nx>(ray_org,ray_dir);
-            ray.org = ray_org;
-            ray.dir = ray_dir;
-#if ENABLE_TRANSFORM_CACHE
-            cacheTag  [cacheSlot&(VSIZEX-1)] = node->xfmID;
-            cacheEntry[cacheSlot&(VSIZEX-1)] = vray;
-            cacheSlot++;
 #endif
+          Level& level = enter(node,ray,vray,leafType,geomID_to_instID,scene);
+
+          /*! hits inside an instanced scene report the innermost instance */
+          if (level.instancedScene) {
+            level.geomID = ray.geomID;
+            level.instID = ray.instID;
+            ray.geomID = -1;
+            ray.instID = node->instID;
           }
           stackPtr->ptr = BVH::popRay; stackPtr->dist = neg_inf; stackPtr++;
           stackPtr->ptr = node->child; stackPtr->dist = neg_inf; stackPtr++;
           return true;
         }
 
-        /*! restore toplevel ray */
+        /*! restore ray of the enclosing level */
         if (cur == BVH::popRay)
         {
-          leafType = 0;
-          geomID_to_instID = nullptr;
-          vray = (TravRay<N,Nx>&) tlray;
-          ray.org = ((TravRay<N,Nx>&)tlray).org_xyz;
-          ray.dir = ((TravRay<N,Nx>&)tlray).dir_xyz;
+          const Level& level = leave(ray,vray,leafType,geomID_to_instID,scene);
+          if (level.instancedScene && ray.geomID == -1) {
+            ray.geomID = level.geomID;
+            ray.instID = level.instID;
+          }
           return true;
         }
 
@@ -570,6 +559,7 @@ namespace embree
                                            TravRay<N,Nx>& vray,
                                            size_t& leafType,
                                            const unsigned int*& geomID_to_instID,
+                                           Scene*& scene,
                                            NodeRef*& stackPtr,
                                            NodeRef* stackEnd)
       {
@@ -581,60 +571,86 @@ namespace embree
 #if defined(RTCORE_RAY_MASK)
           if (unlikely((ray.mask & node->mask) == 0)) return true;
 #endif
-          leafType = node->type;
-          geomID_to_instID = &node->instID;
-
-#if ENABLE_TRANSFORM_CACHE
-          const vboolx xfm_hit = cacheTag == vintx(node->xfmID);
-          if (likely(any(xfm_hit))) {
-            const int slot = __bsf(movemask(xfm_hit));
-            vray = cacheEntry[slot];
-            ray.org = vray.org_xyz;
-            ray.dir = vray.dir_xyz;
-          } 
-          else 
-#endif
-            //if (likely(!node->identity)) 
-          {
-            const Vec3fa ray_org = xfmPoint (node->world2local,((TravRay<N,Nx>&)tlray).org_xyz);
-            const Vec3fa ray_dir = xfmVector(node->world2local,((TravRay<N,Nx>&)tlray).dir_xyz);
-            new (&vray) TravRay<N,Nx>(ray_org,ray_dir);
-            ray.org = ray_org;
-            ray.dir = ray_dir;
-#if ENABLE_TRANSFORM_CACHE
-            cacheTag  [cacheSlot&(VSIZEX-1)] = node->xfmID;
-            cacheEntry[cacheSlot&(VSIZEX-1)] = vray;
-            cacheSlot++;
-#endif
-          }
+          enter(node,ray,vray,leafType,geomID_to_instID,scene);
           *stackPtr = BVH::popRay; stackPtr++;
           *stackPtr = node->child; stackPtr++;
           return true;
         }
 
-        /*! restore toplevel ray */
+        /*! restore ray of the enclosing level */
         if (cur == BVH::popRay)
         {
-          leafType = 0;
-          geomID_to_instID = nullptr;
-          vray = (TravRay<N,Nx>&) tlray;
-          ray.org = ((TravRay<N,Nx>&)tlray).org_xyz;
-          ray.dir = ((TravRay<N,Nx>&)tlray).dir_xyz;
+          leave(ray,vray,leafType,geomID_to_instID,scene);
           return true;
         }
 
         return false;
       }
 
+      /*! restores the toplevel ray when traversal terminates early inside an instance */
+      __forceinline void restoreRay(Ray& ray)
+      {
+        if (depth == 0) return;
+        ray.org = levels[0].vray.org_xyz;
+        ray.dir = levels[0].vray.dir_xyz;
+        depth = 0;
+      }
+
     private:
-      TravRay<N,Nx> tlray;
 
-#if ENABLE_TRANSFORM_CACHE
+      /*! saves the state of the current level and transforms the ray into the instance */
+      __forceinline Level& enter(const TransformNode* node,
+                                 Ray& ray,
+                                 TravRay<N,Nx>& vray,
+                                 size_t& leafType,
+                                 const unsigned int*& geomID_to_instID,
+                                 Scene*& scene)
+      {
+        assert(depth < RTC_MAX_INSTANCE_DEPTH);
+        Level& level = levels[depth++];
+        level.vray = vray;
+        level.leafType = leafType;
+        level.geomID_to_instID = geomID_to_instID;
+        level.scene = scene;
+        level.instancedScene = node->scene != nullptr;
+
+        leafType = node->type;
+        if (level.instancedScene) {
+          geomID_to_instID = nullptr;
+          scene = node->scene;
+        } else {
+          geomID_to_instID = &node->instID;
+        }
+
+        const Vec3fa ray_org = xfmPoint (node->world2local,level.vray.org_xyz);
+        const Vec3fa ray_dir = xfmVector(node->world2local,level.vray.dir_xyz);
+        new (&vray) TravRay<N,Nx>(ray_org,ray_dir);
+        ray.org = ray_org;
+        ray.dir = ray_dir;
+        return level;
+      }
+
+      /*! restores the state of the enclosing level */
+      __forceinline const Level& leave(Ray& ray,
+                                       TravRay<N,Nx>& vray,
+                                       size_t& leafType,
+                                       const unsigned int*& geomID_to_instID,
+                                       Scene*& scene)
+      {
+        assert(depth > 0);
+        const Level& level = levels[--depth];
+        leafType = level.leafType;
+        geomID_to_instID = level.geomID_to_instID;
+        scene = level.scene;
+        vray = level.vray;
+        ray.org = level.vray.org_xyz;
+        ray.dir = level.vray.dir_xyz;
+        return level;
+      }
+
     private:
-      unsigned int cacheSlot;
-      vintx cacheTag;
-      TravRay<N,Nx> cacheEntry[VSIZEX];
-#endif
+      size_t depth;                          //!< current instance nesting depth
+      Level levels[RTC_MAX_INSTANCE_DEPTH];  //!< per-ray instance stack
     };
 
     template<int N, int Nx, int types>
@@ -651,6 +667,7 @@ namespace embree
                                            TravRay<N,Nx>& vray,
                                            size_t& leafType,
                                            const unsigned int*& geomID_to_instID,
+                                           Scene*& scene,
                                            StackItemT<NodeRef>*& stackPtr,
                                            StackItemT<NodeRef>* stackEnd)
       {
@@ -662,11 +679,14 @@ namespace embree
                                            TravRay<N,Nx>& vray,
                                            size_t& leafType,
                                            const unsigned int*& geomID_to_instID,
+                                           Scene*& scene,
                                            NodeRef*& stackPtr,
                                            NodeRef* stackEnd)
       {
         return false;
       }
+
+      __forceinline void restoreRay(Ray& ray) {}
     };
 
     /*! BVH node traversal for single rays. */
@@ -32,10 +32,7 @@ namespace embree
       {
         STAT3(normal.trav_prims,1,1,1);
         const BezierCurves* in = (BezierCurves*) scene->get(prim.geomID());
-        const Vec3fa a0 = in->vertex(prim.vertexID+0,0);
-        const Vec3fa a1 = in->vertex(prim.vertexID+1,0);
-        const Vec3fa a2 = in->vertex(prim.vertexID+2,0);
-        const Vec3fa a3 = in->vertex(prim.vertexID+3,0);
+        Vec3fa a0,a1,a2,a3; in->gather(a0,a1,a2,a3,prim.vertexID,0);
         const int N = in->tessellationRate;
         pre.intersect(ray,a0,a1,a2,a3,N,Intersect1EpilogU<VSIZEX,true>(ray,prim.geomID(),prim.primID(),scene,geomID_to_instID));
       }
@@ -44,10 +41,7 @@ namespace embree
       {
         STAT3(shadow.trav_prims,1,1,1);
         const BezierCurves* in = (BezierCurves*) scene->get(prim.geomID());
-        const Vec3fa a0 = in->vertex(prim.vertexID+0,0);
-        const Vec3fa a1 = in->vertex(prim.vertexID+1,0);
-        const Vec3fa a2 = in->vertex(prim.vertexID+2,0);
-        const Vec3fa a3 = in->vertex(prim.vertexID+3,0);
+        Vec3fa a0,a1,a2,a3; in->gather(a0,a1,a2,a3,prim.vertexID,0);
         const int N = in->tessellationRate;
         return pre.intersect(ray,a0,a1,a2,a3,N,Occluded1EpilogU<VSIZEX,true>(ray,prim.geomID(),prim.primID(),scene,geomID_to_instID));
       }
@@ -63,10 +57,7 @@ namespace embree
       {
         STAT3(normal.trav_prims,1,1,1);
         const BezierCurves* in = (BezierCurves*) scene->get(curve.geomID());
-        const Vec3fa a0 = in->vertex(curve.vertexID+0,0);
-        const Vec3fa a1 = in->vertex(curve.vertexID+1,0);
-        const Vec3fa a2 = in->vertex(curve.vertexID+2,0);
-        const Vec3fa a3 = in->vertex(curve.vertexID+3,0);
+        Vec3fa a0,a1,a2,a3; in->gather(a0,a1,a2,a3,curve.vertexID,0);
         const int N = in->tessellationRate;
         pre.intersect(ray,k,a0,a1,a2,a3,N,Intersect1KEpilogU<VSIZEX,K,true>(ray,k,curve.geomID(),curve.primID(),scene));
       }
@@ -81,10 +72,7 @@ namespace embree
       {
         STAT3(shadow.trav_prims,1,1,1);
         const BezierCurves* in = (BezierCurves*) scene->get(curve.geomID());
-        const Vec3fa a0 = in->vertex(curve.vertexID+0,0);
-        const Vec3fa a1 = in->vertex(curve.vertexID+1,0);
-        const Vec3fa a2 = in->vertex(curve.vertexID+2,0);
-        const Vec3fa a3 = in->vertex(curve.vertexID+3,0);
+        Vec3fa a0,a1,a2,a3; in->gather(a0,a1,a2,a3,curve.vertexID,0);
         const int N = in->tessellationRate;
         return pre.intersect(ray,k,a0,a1,a2,a3,N,Occluded1KEpilogU<VSIZEX,K,true>(ray,k,curve.geomID(),curve.primID(),scene));
       }
@@ -111,14 +99,8 @@ namespace embree
       {
         STAT3(normal.trav_prims,1,1,1);
         const BezierCurves* in = (BezierCurves*) scene->get(prim.geomID());
-        const Vec3fa a0 = in->vertex(prim.vertexID+0,0);
-        const Vec3fa a1 = in->vertex(prim.vertexID+1,0);
-        const Vec3fa a2 = in->vertex(prim.vertexID+2,0);
-        const Vec3fa a3 = in->vertex(prim.vertexID+3,0);
-        const Vec3fa b0 = in->vertex(prim.vertexID+0,1);
-        const Vec3fa b1 = in->vertex(prim.vertexID+1,1);
-        const Vec3fa b2 = in->vertex(prim.vertexID+2,1);
-        const Vec3fa b3 = in->vertex(prim.vertexID+3,1);
+        Vec3fa a0,a1,a2,a3; in->gather(a0,a1,a2,a3,prim.vertexID,0);
+        Vec3fa b0,b1,b2,b3; in->gather(b0,b1,b2,b3,prim.vertexID,1);
         const float t0 = 1.0f-ray.time, t1 = ray.time;
         const Vec3fa p0 = t0*a0 + t1*b0;
         const Vec3fa p1 = t0*a1 + t1*b1;
@@ -132,14 +114,8 @@ namespace embree
       {
         STAT3(shadow.trav_prims,1,1,1);
         const BezierCurves* in = (BezierCurves*) scene->get(prim.geomID());
-        const Vec3fa a0 = in->vertex(prim.vertexID+0,0);
-        const Vec3fa a1 = in->vertex(prim.vertexID+1,0);
-        const Vec3fa a2 = in->vertex(prim.vertexID+2,0);
-        const Vec3fa a3 = in->vertex(prim.vertexID+3,0);
-        const Vec3fa b0 = in->vertex(prim.vertexID+0,1);
-        const Vec3fa b1 = in->vertex(prim.vertexID+1,1);
-        const Vec3fa b2 = in->vertex(prim.vertexID+2,1);
-        const Vec3fa b3 = in->vertex(prim.vertexID+3,1);
+        Vec3fa a0,a1,a2,a3; in->gather(a0,a1,a2,a3,prim.vertexID,0);
+        Vec3fa b0,b1,b2,b3; in->gather(b0,b1,b2,b3,prim.vertexID,1);
         const float t0 = 1.0f-ray.time, t1 = ray.time;
         const Vec3fa p0 = t0*a0 + t1*b0;
         const Vec3fa p1 = t0*a1 + t1*b1;
@@ -160,14 +136,8 @@ namespace embree
       {
         STAT3(normal.trav_prims,1,1,1);
         const BezierCurves* in = (BezierCurves*) scene->get(curve.geomID());
-        const Vec3fa a0 = in->vertex(curve.vertexID+0,0);
-        const Vec3fa a1 = in->vertex(curve.vertexID+1,0);
-        const Vec3fa a2 = in->vertex(curve.vertexID+2,0);
-        const Vec3fa a3 = in->vertex(curve.vertexID+3,0);
-        const Vec3fa b0 = in->vertex(curve.vertexID+0,1);
-        const Vec3fa b1 = in->vertex(curve.vertexID+1,1);
-        const Vec3fa b2 = in->vertex(curve.vertexID+2,1);
-        const Vec3fa b3 = in->vertex(curve.vertexID+3,1);
+        Vec3fa a0,a1,a2,a3; in->gather(a0,a1,a2,a3,curve.vertexID,0);
+        Vec3fa b0,b1,b2,b3; in->gather(b0,b1,b2,b3,curve.vertexID,1);
         const float t0 = 1.0f-ray.time[k], t1 = ray.time[k];
         const Vec3fa p0 = t0*a0 + t1*b0;
         const Vec3fa p1 = t0*a1 + t1*b1;
@@ -181,14 +151,8 @@ namespace embree
       {
         STAT3(shadow.trav_prims,1,1,1);
         const BezierCurves* in = (BezierCurves*) scene->get(curve.geomID());
-        const Vec3fa a0 = in->vertex(curve.vertexID+0,0);
-        const Vec3fa a1 = in->vertex(curve.vertexID+1,0);
-        const Vec3fa a2 = in->vertex(curve.vertexID+2,0);
-        const Vec3fa a3 = in->vertex(curve.vertexID+3,0);
-        const Vec3fa b0 = in->vertex(curve.vertexID+0,1);
-        const Vec3fa b1 = in->vertex(curve.vertexID+1,1);
-        const Vec3fa b2 = in->vertex(curve.vertexID+2,1);
-        const Vec3fa b3 = in->vertex(curve.vertexID+3,1);
+        Vec3fa a0,a1,a2,a3; in->gather(a0,a1,a2,a3,curve.vertexID,0);
+        Vec3fa b0,b1,b2,b3; in->gather(b0,b1,b2,b3,curve.vertexID,1);
         const float t0 = 1.0f-ray.time[k], t1 = ray.time[k];
         const Vec3fa p0 = t0*a0 + t1*b0;
         const Vec3fa p1 = t0*a1 + t1*b1;
@@ -151,10 +151,7 @@ namespace embree
       const size_t primID = prim.primID();
       const BezierCurves* curves = scene->getBezierCurves(geomID);
       const size_t id = curves->curve(primID);
-      const Vec3fa& p0 = curves->vertex(id+0);
-      const Vec3fa& p1 = curves->vertex(id+1);
-      const Vec3fa& p2 = curves->vertex(id+2);
-      const Vec3fa& p3 = curves->vertex(id+3);
+      Vec3fa p0,p1,p2,p3; curves->gather(p0,p1,p2,p3,id);
       new (this) Bezier1v(p0,p1,p2,p3,geomID,primID);
     }
 
@@ -0,0 +1,105 @@
+// ======================================================================== //
+// Copyright 2009-2015 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "primitive.h"
+#include "bezier1v.h"
+
+namespace embree
+{
+  /* Stores the control points of M bezier curves in struct of array layout */
+  template <int M>
+  struct BezierMv
+  {
+    typedef Vec4<vfloat<M>> Vec4vfM;
+
+  public:
+    struct Type : public PrimitiveType
+    {
+      Type();
+      size_t size(const char* This) const;
+    };
+    static Type type;
+
+  public:
+
+    /* Returns maximal number of stored curves */
+    static __forceinline size_t max_size() { return M; }
+
+    /* Returns required number of primitive blocks for N primitives */
+    static __forceinline size_t blocks(size_t N) { return (N+max_size()-1)/max_size(); }
+
+  public:
+
+    /* Default constructor */
+    __forceinline BezierMv() {}
+
+    /* Construction from control points and IDs */
+    __forceinline BezierMv(const Vec4vfM& p0, const Vec4vfM& p1, const Vec4vfM& p2, const Vec4vfM& p3, const vint<M>& geomIDs, const vint<M>& primIDs)
+      : p0(p0), p1(p1), p2(p2), p3(p3), geomIDs(geomIDs), primIDs(primIDs) {}
+
+    /* Returns a mask that tells which curves are valid */
+    __forceinline vbool<M> valid() const { return geomIDs != vint<M>(-1); }
+
+    /* Returns true if the specified curve is valid */
+    __forceinline bool valid(const size_t i) const { assert(i<M); return geomIDs[i] != -1; }
+
+    /* Returns the number of stored curves */
+    __forceinline size_t size() const { return __bsf(~movemask(valid())); }
+
+    /* Returns the geometry IDs */
+    __forceinline vint<M> geomID() const { return geomIDs; }
+    __forceinline int geomID(const size_t i) const { assert(i<M); return geomIDs[i]; }
+
+    /* Returns the primitive IDs */
+    __forceinline vint<M> primID() const { return primIDs; }
+    __forceinline int primID(const size_t i) const { assert(i<M); return primIDs[i]; }
+
+    /* Fill curves from curve list */
+    __forceinline void fill(const BezierPrim* prims, size_t& begin, size_t end, Scene* scene, const bool list)
+    {
+      vint<M> vgeomID = -1, vprimID = -1;
+      Vec4vfM v0 = zero, v1 = zero, v2 = zero, v3 = zero;
+
+      for (size_t i=0; i<M && begin<end; i++, begin++)
+      {
+        const BezierPrim& prim = prims[begin];
+        vgeomID[i] = prim.geomID();
+        vprimID[i] = prim.primID();
+        v0.x[i] = prim.p0.x; v0.y[i] = prim.p0.y; v0.z[i] = prim.p0.z; v0.w[i] = prim.p0.w;
+        v1.x[i] = prim.p1.x; v1.y[i] = prim.p1.y; v1.z[i] = prim.p1.z; v1.w[i] = prim.p1.w;
+        v2.x[i] = prim.p2.x; v2.y[i] = prim.p2.y; v2.z[i] = prim.p2.z; v2.w[i] = prim.p2.w;
+        v3.x[i] = prim.p3.x; v3.y[i] = prim.p3.y; v3.z[i] = prim.p3.z; v3.w[i] = prim.p3.w;
+      }
+      new (this) BezierMv(v0,v1,v2,v3,vgeomID,vprimID);
+    }
+
+  public:
+    Vec4vfM p0;      //!< 1st control point of the curves (x,y,z,r)
+    Vec4vfM p1;      //!< 2nd control point of the curves (x,y,z,r)
+    Vec4vfM p2;      //!< 3rd control point of the curves (x,y,z,r)
+    Vec4vfM p3;      //!< 4th control point of the curves (x,y,z,r)
+    vint<M> geomIDs; //!< geometry IDs
+    vint<M> primIDs; //!< primitive IDs
+  };
+
+  template<int M>
+  typename BezierMv<M>::Type BezierMv<M>::type;
+
+  typedef BezierMv<4> Bezier4v;
+  typedef BezierMv<8> Bezier8v;
+}
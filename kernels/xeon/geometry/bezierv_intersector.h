@@ -0,0 +1,216 @@
+// ======================================================================== //
+// Copyright 2009-2015 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "bezierv.h"
+#include "bezier_intersector.h"
+#include "intersector_epilog.h"
+
+namespace embree
+{
+  namespace isa
+  {
+    template<int M>
+      struct BezierMvHit
+    {
+      typedef Vec3<vfloat<M>> Vec3vfM;
+
+      __forceinline BezierMvHit(const vfloat<M>& U, const vfloat<M>& T, const int i, const vfloat<M>& N, const BezierMv<M>& prim)
+        : U(U), T(T), i(i), N(N), prim(prim) {}
+
+      __forceinline void finalize()
+      {
+        vu = (U+vfloat<M>(float(i)))/N;
+        vv = 0.0f;
+        vt = T;
+
+        /* the geometry normal is the tangent of the curve */
+        const vfloat<M> t0 = 1.0f-vu, t1 = vu;
+        const vfloat<M> B0 = 3.0f*(t0*t0), B1 = 6.0f*(t0*t1), B2 = 3.0f*(t1*t1);
+        const Vec3vfM d01 = Vec3vfM(prim.p1.x-prim.p0.x,prim.p1.y-prim.p0.y,prim.p1.z-prim.p0.z);
+        const Vec3vfM d12 = Vec3vfM(prim.p2.x-prim.p1.x,prim.p2.y-prim.p1.y,prim.p2.z-prim.p1.z);
+        const Vec3vfM d23 = Vec3vfM(prim.p3.x-prim.p2.x,prim.p3.y-prim.p2.y,prim.p3.z-prim.p2.z);
+        vNg = B0*d01 + B1*d12 + B2*d23;
+        const vbool<M> degenerated = (vNg.x == 0.0f) & (vNg.y == 0.0f) & (vNg.z == 0.0f);
+        vNg.x = select(degenerated,vfloat<M>(one),vNg.x);
+        vNg.y = select(degenerated,vfloat<M>(one),vNg.y);
+        vNg.z = select(degenerated,vfloat<M>(one),vNg.z);
+      }
+
+      __forceinline Vec2f uv (const size_t i) const { return Vec2f(vu[i],vv[i]); }
+      __forceinline float t  (const size_t i) const { return vt[i]; }
+      __forceinline Vec3fa Ng(const size_t i) const { return Vec3fa(vNg.x[i],vNg.y[i],vNg.z[i]); }
+
+    public:
+      vfloat<M> U;
+      vfloat<M> T;
+      int i;
+      vfloat<M> N;
+      const BezierMv<M>& prim;
+
+    public:
+      vfloat<M> vu;
+      vfloat<M> vv;
+      vfloat<M> vt;
+      Vec3vfM vNg;
+    };
+
+    /*! Intersects a single ray with M curves. Instead of testing the
+     *  subdivided segments of one curve in parallel, the i'th segment
+     *  of all curves is tested in parallel across the SIMD lanes. */
+    template<int M>
+      struct BezierMvIntersector
+    {
+      typedef Vec4<vfloat<M>> Vec4vfM;
+
+      static __forceinline Vec4vfM toRaySpace(const LinearSpace3fa& space, const Vec3fa& org, const Vec4vfM& p)
+      {
+        const vfloat<M> dx = p.x-vfloat<M>(org.x);
+        const vfloat<M> dy = p.y-vfloat<M>(org.y);
+        const vfloat<M> dz = p.z-vfloat<M>(org.z);
+        return Vec4vfM(dx*space.vx.x + dy*space.vy.x + dz*space.vz.x,
+                       dx*space.vx.y + dy*space.vy.y + dz*space.vz.y,
+                       dx*space.vx.z + dy*space.vy.z + dz*space.vz.z,
+                       p.w);
+      }
+
+      static __forceinline Vec4vfM eval(const Vec4vfM& p0, const Vec4vfM& p1, const Vec4vfM& p2, const Vec4vfM& p3, const vfloat<M>& t)
+      {
+        const vfloat<M> t0 = 1.0f-t, t1 = t;
+        const vfloat<M> B0 = t0*t0*t0;
+        const vfloat<M> B1 = 3.0f*t1*(t0*t0);
+        const vfloat<M> B2 = 3.0f*t0*(t1*t1);
+        const vfloat<M> B3 = t1*t1*t1;
+        return B0*p0 + B1*p1 + B2*p2 + B3*p3;
+      }
+
+      template<typename Epilog>
+      static __forceinline bool intersect(const Vec3fa& ray_org, const LinearSpace3fa& ray_space, const float depth_scale,
+                                          const float ray_tnear, const float& ray_tfar,
+                                          const BezierMv<M>& prim, Scene* scene, const Epilog& epilog)
+      {
+        /* gather tessellation rate of all curves */
+        const vbool<M> valid = prim.valid();
+        vfloat<M> N(one); int maxN = 0;
+        for (size_t m=movemask(valid), i=__bsf(m); m!=0; m=__btc(m,i), i=__bsf(m)) {
+          const int Ni = ((BezierCurves*)scene->get(prim.geomID(i)))->tessellationRate;
+          N[i] = float(Ni); maxN = max(maxN,Ni);
+        }
+
+        /* transform control points into ray space */
+        const Vec4vfM w0 = toRaySpace(ray_space,ray_org,prim.p0);
+        const Vec4vfM w1 = toRaySpace(ray_space,ray_org,prim.p1);
+        const Vec4vfM w2 = toRaySpace(ray_space,ray_org,prim.p2);
+        const Vec4vfM w3 = toRaySpace(ray_space,ray_org,prim.p3);
+
+        /* process the i'th segment of all curves per iteration, the end point of a segment is the start point of the next */
+        bool ishit = false;
+        Vec4vfM p0 = w0;
+        for (int i=0; i<maxN; i++)
+        {
+          vbool<M> valid_i = valid & (vfloat<M>(float(i)) < N);
+          const Vec4vfM p1 = eval(w0,w1,w2,w3,vfloat<M>(float(i+1))/N);
+
+          /* approximative intersection with cone */
+          const Vec4vfM v = p1-p0;
+          const Vec4vfM w = -p0;
+          const vfloat<M> d0 = w.x*v.x + w.y*v.y;
+          const vfloat<M> d1 = v.x*v.x + v.y*v.y;
+          const vfloat<M> u = clamp(d0*rcp(d1),vfloat<M>(zero),vfloat<M>(one));
+          const Vec4vfM p = p0 + u*v;
+          const vfloat<M> t = p.z*depth_scale;
+          const vfloat<M> d2 = p.x*p.x + p.y*p.y;
+          const vfloat<M> r = p.w;
+          const vfloat<M> r2 = r*r;
+          valid_i &= d2 <= r2 & vfloat<M>(ray_tnear) < t & t < vfloat<M>(ray_tfar);
+          p0 = p1;
+
+          /* update hit information */
+          if (unlikely(any(valid_i))) {
+            BezierMvHit<M> hit(u,t,i,N,prim);
+            ishit |= epilog(valid_i,hit);
+          }
+        }
+        return ishit;
+      }
+    };
+
+    /*! Intersector for a single ray with M bezier curves. */
+    template<int M>
+      struct BezierMvIntersector1
+    {
+      typedef BezierMv<M> Primitive;
+      typedef Bezier1Intersector1 Precalculations;
+
+      static __forceinline void intersect(const Precalculations& pre, Ray& ray, const Primitive& prim, Scene* scene, const unsigned* geomID_to_instID)
+      {
+        STAT3(normal.trav_prims,1,1,1);
+        BezierMvIntersector<M>::intersect(ray.org,pre.ray_space,pre.depth_scale,ray.tnear,ray.tfar,prim,scene,
+                                          Intersect1Epilog<M,M,true>(ray,prim.geomIDs,prim.primIDs,scene,geomID_to_instID));
+      }
+
+      static __forceinline bool occluded(const Precalculations& pre, Ray& ray, const Primitive& prim, Scene* scene, const unsigned* geomID_to_instID)
+      {
+        STAT3(shadow.trav_prims,1,1,1);
+        return BezierMvIntersector<M>::intersect(ray.org,pre.ray_space,pre.depth_scale,ray.tnear,ray.tfar,prim,scene,
+                                                 Occluded1Epilog<M,M,true>(ray,prim.geomIDs,prim.primIDs,scene,geomID_to_instID));
+      }
+    };
+
+    /*! Intersector for a single ray from a ray packet with M bezier curves. */
+    template<int M, int K>
+      struct BezierMvIntersectorK
+    {
+      typedef BezierMv<M> Primitive;
+      typedef Bezier1IntersectorK<K> Precalculations;
+
+      static __forceinline void intersect(Precalculations& pre, RayK<K>& ray, const size_t k, const Primitive& prim, Scene* scene)
+      {
+        STAT3(normal.trav_prims,1,1,1);
+        const Vec3fa ray_org(ray.org.x[k],ray.org.y[k],ray.org.z[k]);
+        BezierMvIntersector<M>::intersect(ray_org,pre.ray_space[k],pre.depth_scale[k],ray.tnear[k],ray.tfar[k],prim,scene,
+                                          Intersect1KEpilog<M,M,K,true>(ray,k,prim.geomIDs,prim.primIDs,scene));
+      }
+
+      static __forceinline void intersect(const vbool<K>& valid_i, Precalculations& pre, RayK<K>& ray, const Primitive& prim, Scene* scene)
+      {
+        int mask = movemask(valid_i);
+        while (mask) intersect(pre,ray,__bscf(mask),prim,scene);
+      }
+
+      static __forceinline bool occluded(Precalculations& pre, RayK<K>& ray, const size_t k, const Primitive& prim, Scene* scene)
+      {
+        STAT3(shadow.trav_prims,1,1,1);
+        const Vec3fa ray_org(ray.org.x[k],ray.org.y[k],ray.org.z[k]);
+        return BezierMvIntersector<M>::intersect(ray_org,pre.ray_space[k],pre.depth_scale[k],ray.tnear[k],ray.tfar[k],prim,scene,
+                                                 Occluded1KEpilog<M,M,K,true>(ray,k,prim.geomIDs,prim.primIDs,scene));
+      }
+
+      static __forceinline vbool<K> occluded(const vbool<K>& valid_i, Precalculations& pre, RayK<K>& ray, const Primitive& prim, Scene* scene)
+      {
+        vbool<K> valid_o = false;
+        int mask = movemask(valid_i);
+        while (mask) {
+          size_t k = __bscf(mask);
+          if (occluded(pre,ray,k,prim,scene))
+            set(valid_o, k);
+        }
+        return valid_o;
+      }
+    };
+  }
+}
@@ -52,6 +52,7 @@ namespace embree
       ray.Ng = Ng;
       
       /* invoke filter function */
+      RSTAT(c.filterCalls++);
       AVX_ZERO_UPPER();
       geometry->intersectionFilter1(geometry->userPtr,(RTCRay&)ray);
       
@@ -84,6 +85,7 @@ namespace embree
       ray.Ng = Ng;
       
       /* invoke filter function */
+      RSTAT(c.filterCalls++);
       AVX_ZERO_UPPER();
       geometry->occlusionFilter1(geometry->userPtr,(RTCRay&)ray);
       
@@ -113,6 +115,7 @@ namespace embree
       const vfloat4 ray_Ng_z = ray.Ng.z;     vfloat4::store(valid,&ray.Ng.z,Ng.z);
       
       /* invoke filter function */
+      RSTAT(c.filterCalls++);
       RTCFilterFunc4  filter4 = geometry->intersectionFilter4;
       AVX_ZERO_UPPER();
       if (geometry->ispcIntersectionFilter4) ((ISPCFilterFunc4)filter4)(geometry->userPtr,(RTCRay4&)ray,valid);
@@ -155,6 +158,7 @@ namespace embree
       vfloat4::store(valid,&ray.Ng.z,Ng.z);
       
       /* invoke filter function */
+      RSTAT(c.filterCalls++);
       RTCFilterFunc4 filter4 = geometry->occlusionFilter4;
       AVX_ZERO_UPPER();
       if (geometry->ispcOcclusionFilter4) ((ISPCFilterFunc4)filter4)(geometry->userPtr,(RTCRay4&)ray,valid);
@@ -184,6 +188,7 @@ namespace embree
       const vfloat4 ray_Ng_z = ray.Ng.z;     ray.Ng.z[k] = Ng.z;
       
       /* invoke filter function */
+      RSTAT(c.filterCalls++);
       const vbool4 valid(1 << k);
       RTCFilterFunc4  filter4 = geometry->intersectionFilter4;
       AVX_ZERO_UPPER();
@@ -223,6 +228,7 @@ namespace embree
       ray.Ng.z[k] = Ng.z;
       
       /* invoke filter function */
+      RSTAT(c.filterCalls++);
       const vbool4 valid(1 << k);
       RTCFilterFunc4  filter4 = geometry->occlusionFilter4;
       AVX_ZERO_UPPER();
@@ -255,6 +261,7 @@ namespace embree
       const vfloat8 ray_Ng_z = ray.Ng.z;     vfloat8::store(valid,&ray.Ng.z,Ng.z);
       
       /* invoke filter function */
+      RSTAT(c.filterCalls++);
       RTCFilterFunc8  filter8 = geometry->intersectionFilter8;
       if (geometry->ispcIntersectionFilter8) ((ISPCFilterFunc8)filter8)(geometry->userPtr,(RTCRay8&)ray,valid);
       else { const vbool8 valid_temp = valid; filter8(&valid_temp,geometry->userPtr,(RTCRay8&)ray); }
@@ -296,6 +303,7 @@ namespace embree
       vfloat8::store(valid,&ray.Ng.z,Ng.z);
       
       /* invoke filter function */
+      RSTAT(c.filterCalls++);
       RTCFilterFunc8 filter8 = geometry->occlusionFilter8;
       if (geometry->ispcOcclusionFilter8) ((ISPCFilterFunc8)filter8)(geometry->userPtr,(RTCRay8&)ray,valid);
       else { const vbool8 valid_temp = valid; filter8(&valid_temp,geometry->userPtr,(RTCRay8&)ray); }
@@ -324,6 +332,7 @@ namespace embree
       const vfloat8 ray_Ng_z = ray.Ng.z;     ray.Ng.z[k] = Ng.z;
       
       /* invoke filter function */
+      RSTAT(c.filterCalls++);
       const vbool8 valid(1 << k);
       RTCFilterFunc8  filter8 = geometry->intersectionFilter8;
       if (geometry->ispcIntersectionFilter8) ((ISPCFilterFunc8)filter8)(geometry->userPtr,(RTCRay8&)ray,valid);
@@ -364,6 +373,7 @@ namespace embree
       ray.Ng.z[k] = Ng.z;
       
       /* invoke filter function */
+      RSTAT(c.filterCalls++);
       const vbool8 valid(1 << k);
       RTCFilterFunc8 filter8 = geometry->occlusionFilter8;
       if (geometry->ispcOcclusionFilter8) ((ISPCFilterFunc8)filter8)(geometry->userPtr,(RTCRay8&)ray,valid);
@@ -398,6 +408,7 @@ namespace embree
       const vfloat16 ray_Ng_z = ray.Ng.z;     vfloat16::store(valid,&ray.Ng.z,Ng.z);
       
       /* invoke filter function */
+      RSTAT(c.filterCalls++);
       RTCFilterFunc16  filter16 = geometry->intersectionFilter16;
       if (geometry->ispcIntersectionFilter16) ((ISPCFilterFunc16)filter16)(geometry->userPtr,(RTCRay16&)ray,valid.mask8());
       else { const vint16 mask = valid.mask32(); filter16(&mask,geometry->userPtr,(RTCRay16&)ray); }
@@ -439,6 +450,7 @@ namespace embree
       vfloat16::store(valid,&ray.Ng.z,Ng.z);
       
       /* invoke filter function */
+      RSTAT(c.filterCalls++);
       RTCFilterFunc16 filter16 = geometry->occlusionFilter16;
       if (geometry->ispcOcclusionFilter16) ((ISPCFilterFunc16)filter16)(geometry->userPtr,(RTCRay16&)ray,valid.mask8());
       else { const vint16 mask = valid.mask32(); filter16(&mask,geometry->userPtr,(RTCRay16&)ray); }
@@ -467,6 +479,7 @@ namespace embree
       const vfloat16 ray_Ng_z = ray.Ng.z;     ray.Ng.z[k] = Ng.z;
       
       /* invoke filter function */
+      RSTAT(c.filterCalls++);
       const vbool16 valid(1 << k);
       RTCFilterFunc16  filter16 = geometry->intersectionFilter16;
       if (geometry->ispcIntersectionFilter16) ((ISPCFilterFunc16)filter16)(geometry->userPtr,(RTCRay16&)ray,valid.mask8());
@@ -507,6 +520,7 @@ namespace embree
       ray.Ng.z[k] = Ng.z;
       
       /* invoke filter function */
+      RSTAT(c.filterCalls++);
       const vbool16 valid(1 << k);
       RTCFilterFunc16 filter16 = geometry->occlusionFilter16;
       if (geometry->ispcOcclusionFilter16) ((ISPCFilterFunc16)filter16)(geometry->userPtr,(RTCRay16&)ray,valid.mask8());
@@ -525,5 +539,93 @@ namespace embree
     
 #endif
 
+    /* invokes the packet filter of matching width for a batch of candidate hits */
+    __forceinline void invokeIntersectionFilter(const vbool4& valid, const Geometry* const geometry, Ray4& ray)
+    {
+      RTCFilterFunc4 filter4 = geometry->intersectionFilter4;
+      AVX_ZERO_UPPER();
+      if (geometry->ispcIntersectionFilter4) ((ISPCFilterFunc4)filter4)(geometry->userPtr,(RTCRay4&)ray,valid);
+      else { const vbool4 valid_temp = valid; filter4(&valid_temp,geometry->userPtr,(RTCRay4&)ray); }
+    }
+
+    __forceinline void invokeOcclusionFilter(const vbool4& valid, const Geometry* const geometry, Ray4& ray)
+    {
+      RTCFilterFunc4 filter4 = geometry->occlusionFilter4;
+      AVX_ZERO_UPPER();
+      if (geometry->ispcOcclusionFilter4) ((ISPCFilterFunc4)filter4)(geometry->userPtr,(RTCRay4&)ray,valid);
+      else { const vbool4 valid_temp = valid; filter4(&valid_temp,geometry->userPtr,(RTCRay4&)ray); }
+    }
+
+#if defined(__AVX__)
+    __forceinline void invokeIntersectionFilter(const vbool8& valid, const Geometry* const geometry, Ray8& ray)
+    {
+      RTCFilterFunc8 filter8 = geometry->intersectionFilter8;
+      if (geometry->ispcIntersectionFilter8) ((ISPCFilterFunc8)filter8)(geometry->userPtr,(RTCRay8&)ray,valid);
+      else { const vbool8 valid_temp = valid; filter8(&valid_temp,geometry->userPtr,(RTCRay8&)ray); }
+    }
+
+    __forceinline void invokeOcclusionFilter(const vbool8& valid, const Geometry* const geometry, Ray8& ray)
+    {
+      RTCFilterFunc8 filter8 = geometry->occlusionFilter8;
+      if (geometry->ispcOcclusionFilter8) ((ISPCFilterFunc8)filter8)(geometry->userPtr,(RTCRay8&)ray,valid);
+      else { const vbool8 valid_temp = valid; filter8(&valid_temp,geometry->userPtr,(RTCRay8&)ray); }
+    }
+#endif
+
+#if defined(__AVX512F__)
+    __forceinline void invokeIntersectionFilter(const vbool16& valid, const Geometry* const geometry, Ray16& ray)
+    {
+      RTCFilterFunc16 filter16 = geometry->intersectionFilter16;
+      if (geometry->ispcIntersectionFilter16) ((ISPCFilterFunc16)filter16)(geometry->userPtr,(RTCRay16&)ray,valid.mask8());
+      else { const vint16 mask = valid.mask32(); filter16(&mask,geometry->userPtr,(RTCRay16&)ray); }
+    }
+
+    __forceinline void invokeOcclusionFilter(const vbool16& valid, const Geometry* const geometry, Ray16& ray)
+    {
+      RTCFilterFunc16 filter16 = geometry->occlusionFilter16;
+      if (geometry->ispcOcclusionFilter16) ((ISPCFilterFunc16)filter16)(geometry->userPtr,(RTCRay16&)ray,valid.mask8());
+      else { const vint16 mask = valid.mask32(); filter16(&mask,geometry->userPtr,(RTCRay16&)ray); }
+    }
+#endif
+
+    /* replicates a single ray into a packet that holds one candidate hit per lane */
+    template<int K>
+    __forceinline RayK<K> makeFilterBatch(const Ray& ray, const vfloat<K>& u, const vfloat<K>& v, const vfloat<K>& t, const Vec3<vfloat<K>>& Ng, 
+                                          const int geomID, const vint<K>& primID)
+    {
+      RayK<K> rays(Vec3<vfloat<K>>(ray.org.x,ray.org.y,ray.org.z),Vec3<vfloat<K>>(ray.dir.x,ray.dir.y,ray.dir.z),
+                   vfloat<K>(ray.tnear),t,vfloat<K>(ray.time),vint<K>(ray.mask));
+      rays.u = u; rays.v = v; rays.Ng = Ng;
+      rays.geomID = geomID;
+      rays.primID = primID;
+      rays.instID = ray.instID;
+      return rays;
+    }
+
+    /*! Runs the packet intersection filter once for all valid candidate
+     *  hits of a single ray and returns the hits the filter accepted. The
+     *  ray itself is not modified. */
+    template<int K>
+    __forceinline vbool<K> runIntersectionFilterBatch(const vbool<K>& valid, const Geometry* const geometry, const Ray& ray, 
+                                                      const vfloat<K>& u, const vfloat<K>& v, const vfloat<K>& t, const Vec3<vfloat<K>>& Ng, 
+                                                      const int geomID, const vint<K>& primID)
+    {
+      RayK<K> rays = makeFilterBatch(ray,u,v,t,Ng,geomID,primID);
+      RSTAT(c.filterCalls++);
+      invokeIntersectionFilter(valid,geometry,rays);
+      return valid & (rays.geomID != vint<K>(-1));
+    }
+
+    template<int K>
+    __forceinline vbool<K> runOcclusionFilterBatch(const vbool<K>& valid, const Geometry* const geometry, const Ray& ray, 
+                                                   const vfloat<K>& u, const vfloat<K>& v, const vfloat<K>& t, const Vec3<vfloat<K>>& Ng, 
+                                                   const int geomID, const vint<K>& primID)
+    {
+      RayK<K> rays = makeFilterBatch(ray,u,v,t,Ng,geomID,primID);
+      RSTAT(c.filterCalls++);
+      invokeOcclusionFilter(valid,geometry,rays);
+      return valid & (rays.geomID != vint<K>(-1));
+    }
+
   }
 }
@@ -59,6 +59,36 @@ namespace embree
       root = buildBVH(bvhData(),gridData(),bvhBytes,bounds_o);
     }
 
+    void GridSOA::relocate(const size_t oldBase, const size_t newBase) {
+      relocate(root,oldBase,newBase);
+    }
+
+    void GridSOA::relocate(BVH4::NodeRef& ref, const size_t oldBase, const size_t newBase)
+    {
+      /* leaves store offsets into the grid and stay valid */
+      if (ref.isLeaf()) return;
+
+      const size_t offset = (size_t)ref - oldBase;
+      ref = BVH4::NodeRef(newBase + offset);
+      BVH4::Node* node = (BVH4::Node*) ((char*)this + (offset & ~BVH4::align_mask));
+      for (size_t i=0; i<4; i++)
+        relocate(node->child(i),oldBase,newBase);
+    }
+
+    BBox3fa GridSOA::bounds(const size_t base) const
+    {
+      if (root.isLeaf())
+      {
+        const float* const grid_array = (const float*) &data[bvhBytes];
+        BBox3fa bounds(empty);
+        for (size_t i=0; i<dim_offset; i++)
+          bounds.extend(Vec3fa(grid_array[0*dim_offset+i],grid_array[1*dim_offset+i],grid_array[2*dim_offset+i]));
+        return bounds;
+      }
+      const BVH4::Node* node = (const BVH4::Node*) ((const char*)this + (((size_t)root - base) & ~BVH4::align_mask));
+      return node->bounds();
+    }
+
     size_t GridSOA::getBVHBytes(const GridRange& range, const unsigned int leafBytes)
     {
       if (range.hasLeafSize()) 
@@ -57,6 +57,47 @@ namespace embree
         return create(patch,0,patch->grid_u_res-1,0,patch->grid_v_res-1,scene,alloc,bounds_o);
       }
 
+      /*! Grid creation that restores the grid from the persistent tessellation cache if possible */
+      template<typename Allocator>
+        static GridSOA* createCached(SubdivPatch1Base* const patch, const Scene* scene, const Allocator& alloc) 
+      {
+        PersistentTessellationCache& cache = PersistentTessellationCache::persistentTessellationCache;
+        if (likely(!cache.enabled()))
+          return create(patch,scene,alloc);
+
+        /* copy stored grid and move its node references to the new location */
+        size_t bytes = 0;
+        const PersistentTessellationCache::Key key = patch->persistentKey(scene->getSubdivMesh(patch->geom));
+        if (const GridSOA* stored = (const GridSOA*) cache.lookup(key,bytes)) 
+        {
+          GridSOA* grid = (GridSOA*) alloc(bytes);
+          memcpy(grid,stored,bytes);
+          grid->relocate(0,(size_t)grid);
+          return grid;
+        }
+
+        /* otherwise create grid and spill a copy with node references relative to the grid */
+        GridSOA* grid = create(patch,scene,alloc);
+        cache.store(key,grid->bytes(),[&] (void* ptr) {
+            memcpy(ptr,grid,grid->bytes());
+            ((GridSOA*)ptr)->relocate((size_t)grid,0);
+          });
+        return grid;
+      }
+
+      /*! Looks up the bounds of the grid of a patch in the persistent tessellation cache */
+      static __forceinline bool cachedBounds(const SubdivPatch1Base& patch, const SubdivMesh* const mesh, BBox3fa& bounds_o)
+      {
+        PersistentTessellationCache& cache = PersistentTessellationCache::persistentTessellationCache;
+        if (likely(!cache.enabled())) return false;
+
+        size_t bytes = 0;
+        const GridSOA* stored = (const GridSOA*) cache.lookup(patch.persistentKey(mesh),bytes);
+        if (stored == nullptr) return false;
+        bounds_o = stored->bounds(0);
+        return true;
+      }
+
       static size_t getNumEagerLeaves(size_t width, size_t height) {
         const size_t w = (((width +1)/2)+3)/4;
         const size_t h = (((height+1)/2)+3)/4;
@@ -95,9 +136,21 @@ namespace embree
         return (float*) &data[bvhBytes];
       }
       
+      /*! returns the size of the grid in bytes */
+      __forceinline size_t bytes() const {
+        return offsetof(GridSOA,data)+bvhBytes+4*width*height*sizeof(float)+4;
+      }
+
       /*! returns the size of the BVH over the grid in bytes */
       static size_t getBVHBytes(const GridRange& range, const unsigned int leafBytes);
 
+      /*! Moves all node references from relative to oldBase to relative to newBase. */
+      void relocate(const size_t oldBase, const size_t newBase);
+      void relocate(BVH4::NodeRef& ref, const size_t oldBase, const size_t newBase);
+
+      /*! Returns the bounds of the grid, node references are relative to base. */
+      BBox3fa bounds(const size_t base) const;
+
       /*! Evaluates grid over patch and builds BVH4 tree over the grid. */
       BVH4::NodeRef buildBVH(char* node_array, float* grid_array, const size_t bvhBytes, BBox3fa* bounds_o);
       
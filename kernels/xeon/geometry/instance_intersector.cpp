@@ -15,6 +15,7 @@
 // ======================================================================== //
 
 #include "instance_intersector.h"
+#include "../../common/scene.h"
 
 namespace embree
 {
@@ -42,6 +43,9 @@ namespace embree
     template<int K>
     void FastInstanceIntersectorK<K>::intersect(vint<K>* valid, const Instance* instance, RayK<K>& ray, size_t item)
     {
+      if (unlikely(instance->lazy)) 
+        ((Scene*)instance->object)->lazyBuild();
+
       typedef Vec3<vfloat<K>> Vec3vfK;
       typedef AffineSpaceT<LinearSpace3<Vec3vfK>> AffineSpace3vfK;
       
@@ -72,6 +76,9 @@ namespace embree
     template<int K>
     void FastInstanceIntersectorK<K>::occluded(vint<K>* valid, const Instance* instance, RayK<K>& ray, size_t item)
     {
+      if (unlikely(instance->lazy)) 
+        ((Scene*)instance->object)->lazyBuild();
+
       typedef Vec3<vfloat<K>> Vec3vfK;
       typedef AffineSpaceT<LinearSpace3<Vec3vfK>> AffineSpace3vfK;
 
@@ -15,6 +15,7 @@
 // ======================================================================== //
 
 #include "instance_intersector1.h"
+#include "../../common/scene.h"
 
 namespace embree
 {
@@ -22,7 +23,16 @@ namespace embree
   {
     void InstanceBoundsFunction(void* userPtr, const Instance* instance, size_t item, BBox3fa* bounds_o) 
     {
-      if (instance->numTimeSteps == 1) {
+      /* natively traversed instances are handled by the instancing BVH,
+       * returning invalid bounds excludes them from the user geometry BVH */
+      if (instance->native) {
+        bounds_o[0] = BBox3fa(Vec3fa(neg_inf),Vec3fa(pos_inf));
+      }
+      /* lazy instances are bound by the user specified bounds as the instanced scene is not build yet */
+      else if (instance->lazy) {
+        bounds_o[0] = xfmBounds(instance->local2world[0],instance->lazyBounds);
+      }
+      else if (instance->numTimeSteps == 1) {
         bounds_o[0] = xfmBounds(instance->local2world[0],instance->object->bounds);
       } else {
         bounds_o[0] = xfmBounds(instance->local2world[0],instance->object->bounds);
@@ -34,6 +44,9 @@ namespace embree
 
     void FastInstanceIntersector1::intersect(const Instance* instance, Ray& ray, size_t item)
     {
+      if (unlikely(instance->lazy)) 
+        ((Scene*)instance->object)->lazyBuild();
+
       AffineSpace3fa world2local;
       if (likely(instance->numTimeSteps == 1)) {
         world2local = instance->world2local[0];
@@ -60,6 +73,9 @@ namespace embree
     
     void FastInstanceIntersector1::occluded (const Instance* instance, Ray& ray, size_t item)
     {
+      if (unlikely(instance->lazy)) 
+        ((Scene*)instance->object)->lazyBuild();
+
       AffineSpace3fa world2local;
       if (likely(instance->numTimeSteps == 1)) {
         world2local = instance->world2local[0];
@@ -17,12 +17,38 @@
 #pragma once
 
 #include "../../common/ray.h"
+#include "../../common/scene_triangle_mesh.h"
 #include "filter.h"
 
 namespace embree
 {
   namespace isa
   {
+    /*! returns the opacity micro map state of a hit, hits of geometries without micro map are unknown */
+    __forceinline int opacityState(const Geometry* const geometry, const int primID, const float u, const float v)
+    {
+      if (likely(geometry->type != Geometry::TRIANGLE_MESH)) return RTC_OPACITY_UNKNOWN;
+      const TriangleMesh* mesh = (const TriangleMesh*) geometry;
+      if (likely(!mesh->hasOpacityMicroMap())) return RTC_OPACITY_UNKNOWN;
+      return mesh->opacity(primID,u,v);
+    }
+
+    /*! classifies the hits of K rays with one triangle into transparent and opaque hits */
+    template<int K>
+    __forceinline bool opacityStates(const vbool<K>& valid, const Geometry* const geometry, const int primID, const vfloat<K>& u, const vfloat<K>& v,
+                                     vbool<K>& transparent, vbool<K>& opaque)
+    {
+      if (likely(geometry->type != Geometry::TRIANGLE_MESH)) return false;
+      const TriangleMesh* mesh = (const TriangleMesh*) geometry;
+      if (likely(!mesh->hasOpacityMicroMap())) return false;
+      for (size_t m=movemask(valid), k=__bsf(m); m!=0; m=__btc(m,k), k=__bsf(m)) {
+        const int state = mesh->opacity(primID,u[k],v[k]);
+        if      (state == RTC_OPACITY_TRANSPARENT) set(transparent,k);
+        else if (state == RTC_OPACITY_OPAQUE     ) set(opaque,k);
+      }
+      return true;
+    }
+
     template<int M>
       struct UVIdentity
       {
@@ -59,6 +85,7 @@ namespace embree
 
           /* intersection filter test */
 #if defined(RTCORE_INTERSECTION_FILTER) || defined(RTCORE_RAY_MASK)
+          vbool<Mx> passed = false;
           goto entry;
           while (true) 
           {
@@ -81,6 +108,34 @@ namespace embree
 #if defined(RTCORE_INTERSECTION_FILTER) 
             /* call intersection filter function */
             if (filter) {
+              /* hits already accepted by a batched filter call need no further test */
+              if ((movemask(passed) >> i) & 1) break;
+
+              /* hits on transparent or opaque micro triangles need no filter call */
+              const int state = opacityState(geometry,primIDs[i],hit.vu[i],hit.vv[i]);
+              if (state == RTC_OPACITY_TRANSPARENT) {
+                clear(valid,i);
+                continue;
+              }
+              if (state == RTC_OPACITY_OPAQUE) break;
+
+              if (unlikely(geometry->filterBatching && geometry->hasIntersectionFilter<vfloat<Mx>>())) 
+              {
+                /* filter all valid hits of this geometry with a single packet filter call */
+                vbool<Mx> same = false; vint<Mx> vprimID(-1);
+                for (size_t m=movemask(valid), j=__bsf(m); m!=0; m=__btc(m,j), j=__bsf(m)) {
+                  if (geomIDs[j] != geomID) continue;
+                  const int state_j = opacityState(geometry,primIDs[j],hit.vu[j],hit.vv[j]);
+                  if      (state_j == RTC_OPACITY_TRANSPARENT) clear(valid,j);
+                  else if (state_j == RTC_OPACITY_OPAQUE     ) set(passed,j);
+                  else { set(same,j); vprimID[j] = primIDs[j]; }
+                }
+                const vbool<Mx> accepted = runIntersectionFilterBatch(same,geometry,ray,hit.vu,hit.vv,hit.vt,hit.vNg,instID,vprimID);
+                valid = (valid & !same) | accepted;
+                passed |= accepted;
+                continue;
+              }
+
               if (unlikely(geometry->hasIntersectionFilter1())) {
                 const Vec2f uv = hit.uv(i);
                 if (runIntersectionFilter1(geometry,ray,uv.x,uv.y,hit.t(i),hit.Ng(i),instID,primIDs[i])) return true;
@@ -138,6 +193,7 @@ namespace embree
 
           /* intersection filter test */
 #if defined(RTCORE_INTERSECTION_FILTER) || defined(RTCORE_RAY_MASK)
+          vbool<Mx> passed = false;
           goto entry;
           while (true) 
           {
@@ -160,6 +216,34 @@ namespace embree
 #if defined(RTCORE_INTERSECTION_FILTER) 
             /* call intersection filter function */
             if (filter) {
+              /* hits already accepted by a batched filter call need no further test */
+              if ((movemask(passed) >> i) & 1) break;
+
+              /* hits on transparent or opaque micro triangles need no filter call */
+              const int state = opacityState(geometry,primIDs[i],hit.vu[i],hit.vv[i]);
+              if (state == RTC_OPACITY_TRANSPARENT) {
+                clear(valid,i);
+                continue;
+              }
+              if (state == RTC_OPACITY_OPAQUE) break;
+
+              if (unlikely(geometry->filterBatching && geometry->hasIntersectionFilter<vfloat<Mx>>())) 
+              {
+                /* filter all valid hits of this geometry with a single packet filter call */
+                vbool<Mx> same = false; vint<Mx> vprimID(-1);
+                for (size_t m=movemask(valid), j=__bsf(m); m!=0; m=__btc(m,j), j=__bsf(m)) {
+                  if (geomIDs[j] != geomID) continue;
+                  const int state_j = opacityState(geometry,primIDs[j],hit.vu[j],hit.vv[j]);
+                  if      (state_j == RTC_OPACITY_TRANSPARENT) clear(valid,j);
+                  else if (state_j == RTC_OPACITY_OPAQUE     ) set(passed,j);
+                  else { set(same,j); vprimID[j] = primIDs[j]; }
+                }
+                const vbool<Mx> accepted = runIntersectionFilterBatch(same,geometry,ray,hit.vu,hit.vv,hit.vt,hit.vNg,instID,vprimID);
+                valid = (valid & !same) | accepted;
+                passed |= accepted;
+                continue;
+              }
+
               if (unlikely(geometry->hasIntersectionFilter1())) {
                 const Vec2f uv = hit.uv(i);
                 if (runIntersectionFilter1(geometry,ray,uv.x,uv.y,hit.t(i),hit.Ng(i),instID,primIDs[i])) return true;
@@ -227,6 +311,30 @@ namespace embree
 #if defined(RTCORE_INTERSECTION_FILTER)
             /* if we have no filter then the test passed */
             if (filter) {
+              /* hits on transparent or opaque micro triangles need no filter call */
+              const int state = opacityState(geometry,primIDs[i],hit.vu[i],hit.vv[i]);
+              if (state == RTC_OPACITY_TRANSPARENT) {
+                m=__btc(m,i);
+                continue;
+              }
+              if (state == RTC_OPACITY_OPAQUE) break;
+
+              if (unlikely(geometry->filterBatching && geometry->hasOcclusionFilter<vfloat<Mx>>())) 
+              {
+                /* filter all remaining hits of this geometry with a single packet filter call */
+                vbool<Mx> same = false; vint<Mx> vprimID(-1);
+                for (size_t mj=m, j=__bsf(mj); mj!=0; mj=__btc(mj,j), j=__bsf(mj)) {
+                  if (geomIDs[j] != geomID) continue;
+                  const int state_j = opacityState(geometry,primIDs[j],hit.vu[j],hit.vv[j]);
+                  if (state_j == RTC_OPACITY_OPAQUE) return true;
+                  if (state_j == RTC_OPACITY_TRANSPARENT) m=__btc(m,j);
+                  else { set(same,j); vprimID[j] = primIDs[j]; }
+                }
+                if (any(runOcclusionFilterBatch(same,geometry,ray,hit.vu,hit.vv,hit.vt,hit.vNg,instID,vprimID))) return true;
+                m &= ~(size_t)movemask(same);
+                continue;
+              }
+
               if (unlikely(geometry->hasOcclusionFilter1())) 
               {
                 //const Vec3fa Ngi = Vec3fa(Ng.x[i],Ng.y[i],Ng.z[i]);
@@ -389,8 +497,16 @@ namespace embree
           /* occlusion filter test */
 #if defined(RTCORE_INTERSECTION_FILTER)
           if (filter) {
+            /* hits on transparent or opaque micro triangles need no filter call */
+            vbool<K> transparent = false, opaque = false;
+            if (unlikely(opacityStates(valid,geometry,primID,u,v,transparent,opaque))) {
+              valid &= !transparent;
+              if (unlikely(none(valid))) return valid;
+            }
             if (unlikely(geometry->hasIntersectionFilter<vfloat<K>>())) {
-              return runIntersectionFilter(valid,geometry,ray,u,v,t,Ng,geomID,primID);
+              if (likely(none(opaque))) return runIntersectionFilter(valid,geometry,ray,u,v,t,Ng,geomID,primID);
+              const vbool<K> unknown = valid & !opaque;
+              if (any(unknown)) valid = opaque | runIntersectionFilter(unknown,geometry,ray,u,v,t,Ng,geomID,primID);
             }
           }
 #endif
@@ -443,12 +559,20 @@ namespace embree
           /* intersection filter test */
 #if defined(RTCORE_INTERSECTION_FILTER)
           if (filter) {
-            if (unlikely(geometry->hasOcclusionFilter<vfloat<K>>()))
+            const bool hasOpacity = geometry->type == Geometry::TRIANGLE_MESH && ((TriangleMesh*)geometry)->hasOpacityMicroMap();
+            if (unlikely(hasOpacity || geometry->hasOcclusionFilter<vfloat<K>>()))
             {
               vfloat<K> u, v, t; 
               Vec3<vfloat<K>> Ng;
               std::tie(u,v,t,Ng) = hit();
-              valid = runOcclusionFilter(valid,geometry,ray,u,v,t,Ng,geomID,primID);
+
+              /* hits on transparent or opaque micro triangles need no filter call */
+              vbool<K> transparent = false, opaque = false;
+              if (unlikely(opacityStates(valid,geometry,primID,u,v,transparent,opaque)))
+                valid &= !transparent;
+              const vbool<K> unknown = valid & !opaque;
+              if (geometry->hasOcclusionFilter<vfloat<K>>() && any(unknown))
+                valid = opaque | runOcclusionFilter(unknown,geometry,ray,u,v,t,Ng,geomID,primID);
             }
           }
 #endif
@@ -607,6 +731,14 @@ namespace embree
 #if defined(RTCORE_INTERSECTION_FILTER) 
             /* call intersection filter function */
             if (filter) {
+              /* hits on transparent or opaque micro triangles need no filter call */
+              const int state = opacityState(geometry,primIDs[i],hit.vu[i],hit.vv[i]);
+              if (state == RTC_OPACITY_TRANSPARENT) {
+                clear(valid,i);
+                continue;
+              }
+              if (state == RTC_OPACITY_OPAQUE) break;
+
               if (unlikely(geometry->hasIntersectionFilter<vfloat<K>>())) {
                 assert(i<M);
                 const Vec2f uv = hit.uv(i);
@@ -684,6 +816,14 @@ namespace embree
 #if defined(RTCORE_INTERSECTION_FILTER)
             /* execute occlusion filer */
             if (filter) {
+              /* hits on transparent or opaque micro triangles need no filter call */
+              const int state = opacityState(geometry,primIDs[i],hit.vu[i],hit.vv[i]);
+              if (state == RTC_OPACITY_TRANSPARENT) {
+                m=__btc(m,i);
+                continue;
+              }
+              if (state == RTC_OPACITY_OPAQUE) break;
+
               if (unlikely(geometry->hasOcclusionFilter<vfloat<K>>())) 
               {
                 const Vec2f uv = hit.uv(i);
@@ -160,8 +160,9 @@ namespace embree
     }
 
     /* Fill line segment from line segment list */
-    __forceinline std::pair<BBox3fa,BBox3fa> fill_mblur(const PrimRef* prims, size_t& begin, size_t end, Scene* scene, const bool list)
+    __forceinline std::pair<BBox3fa,BBox3fa> fill_mblur(const PrimRef* prims, size_t& begin, size_t end, Scene* scene, const bool list, size_t itime = 0, size_t numTimeSegments = 1)
     {
+      assert(numTimeSegments == 1); // only two time steps supported
       fill(prims,begin,end,scene,list);
       return bounds(scene);
     }
@@ -51,8 +51,9 @@ namespace embree
     }
 
     /*! fill triangle from triangle list */
-    __forceinline std::pair<BBox3fa,BBox3fa> fill_mblur(const PrimRef* prims, size_t& i, size_t end, Scene* scene, const bool list)
+    __forceinline std::pair<BBox3fa,BBox3fa> fill_mblur(const PrimRef* prims, size_t& i, size_t end, Scene* scene, const bool list, size_t itime = 0, size_t numTimeSegments = 1)
     {
+      assert(numTimeSegments == 1); // only two time steps supported
       const PrimRef& prim = prims[i]; i++;
       const size_t geomID = prim.geomID();
       const size_t primID = prim.primID();
@@ -17,10 +17,12 @@
 #include "primitive.h"
 #include "bezier1v.h"
 #include "bezier1i.h"
+#include "bezierv.h"
 #include "linei.h"
 #include "triangle.h"
 #include "trianglev.h"
 #include "trianglei.h"
+#include "trianglec.h"
 #include "trianglev_mb.h"
 #include "quadv.h"
 #include "quadi.h"
@@ -57,6 +59,34 @@ namespace embree
   Bezier1i::Type Bezier1i::type;
 #endif
 
+  /********************** Bezier4v **************************/
+
+#if !defined(__AVX__)
+  template<>
+  Bezier4v::Type::Type ()
+    : PrimitiveType("bezier4v",sizeof(Bezier4v),4) {}
+
+  template<>
+  size_t Bezier4v::Type::size(const char* This) const {
+    return ((Bezier4v*)This)->size();
+  }
+#endif
+
+  /********************** Bezier8v **************************/
+
+#if defined(__TARGET_AVX__)
+#if !defined(__AVX__)
+  template<>
+  Bezier8v::Type::Type ()
+    : PrimitiveType("bezier8v",2*sizeof(Bezier4v),8) {}
+#else
+  template<>
+  size_t Bezier8v::Type::size(const char* This) const {
+    return ((Bezier8v*)This)->size();
+  }
+#endif
+#endif
+
   /********************** Line4i **************************/
 
 #if !defined(__AVX__)
@@ -101,7 +131,7 @@ namespace embree
 #if !defined(__AVX__)
   template<>
   Triangle4i::Type::Type () 
-    : PrimitiveType("triangle4i",sizeof(Triangle4i),4) {} 
+    : PrimitiveType("triangle4i",sizeof(Triangle4i),4,false) {} 
 
   template<>
   size_t Triangle4i::Type::size(const char* This) const {
@@ -109,6 +139,19 @@ namespace embree
   }
 #endif
 
+  /********************** Triangle4c **************************/
+
+#if !defined(__AVX__)
+  template<>
+  Triangle4c::Type::Type () 
+    : PrimitiveType("triangle4c",sizeof(Triangle4c),4,false) {} 
+
+  template<>
+  size_t Triangle4c::Type::size(const char* This) const {
+    return ((Triangle4c*)This)->size();
+  }
+#endif
+
   /********************** Triangle4vMB **************************/
 
 #if !defined(__AVX__)
@@ -181,7 +224,7 @@ namespace embree
 
 #if !defined(__AVX__)
   SubdivPatch1Cached::Type::Type () 
-    : PrimitiveType("subdivpatch1cached",sizeof(SubdivPatch1Cached),1) {} 
+    : PrimitiveType("subdivpatch1cached",sizeof(SubdivPatch1Cached),1,false) {} 
   
   size_t SubdivPatch1Cached::Type::size(const char* This) const {
     return 1;
@@ -194,7 +237,7 @@ namespace embree
 
 #if !defined(__AVX__)
   SubdivPatch1Eager::Type::Type () 
-    : PrimitiveType("subdivpatch1eager",sizeof(SubdivPatch1Eager),1) {} 
+    : PrimitiveType("subdivpatch1eager",sizeof(SubdivPatch1Eager),1,false) {} 
   
   size_t SubdivPatch1Eager::Type::size(const char* This) const {
     return 1;
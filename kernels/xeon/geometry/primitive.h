@@ -25,8 +25,8 @@ namespace embree
   struct PrimitiveType
   {
     /*! constructs the primitive type */
-    PrimitiveType (const std::string& name, size_t bytes, size_t blockSize) 
-    : name(name), bytes(bytes), blockSize(blockSize) {} 
+    PrimitiveType (const std::string& name, size_t bytes, size_t blockSize, bool relocatable = true) 
+    : name(name), bytes(bytes), blockSize(blockSize), relocatable(relocatable) {} 
 
     /*! Returns the number of stored primitives in a block. */
     virtual size_t size(const char* This) const = 0;
@@ -35,5 +35,6 @@ namespace embree
     std::string name;       //!< name of this primitive type
     size_t bytes;           //!< number of bytes of the triangle data
     size_t blockSize;       //!< block size
+    bool relocatable;       //!< true if primitive data stores no absolute pointers
   };
 }
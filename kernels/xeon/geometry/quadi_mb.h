@@ -86,11 +86,26 @@ namespace embree
      __forceinline Vec3<T> getVertex(const vint<M> &v, const size_t index, const Scene *const scene, const T& time) const
     {
       const QuadMesh* mesh = scene->getQuadMesh(geomID(index));
-      const Vec3fa v0  = *(Vec3fa*)mesh->vertexPtr(v[index],0);
-      const Vec3fa v1  = *(Vec3fa*)mesh->vertexPtr(v[index],1);
-      const Vec3<T> p0(v0.x,v0.y,v0.z);
-      const Vec3<T> p1(v1.x,v1.y,v1.z);
-      return (T(one)-time)*p0 + time*p1;
+      if (likely(mesh->numTimeSteps == 2))
+      {
+        const Vec3fa v0  = *(Vec3fa*)mesh->vertexPtr(v[index],0);
+        const Vec3fa v1  = *(Vec3fa*)mesh->vertexPtr(v[index],1);
+        const Vec3<T> p0(v0.x,v0.y,v0.z);
+        const Vec3<T> p1(v1.x,v1.y,v1.z);
+        return (T(one)-time)*p0 + time*p1;
+      }
+
+      /* gather the vertices of the time segment of each ray */
+      T ftime; const auto itime = getTimeSegment(time,T(float(mesh->numTimeSteps-1)),ftime);
+      Vec3<T> p0, p1;
+      for (size_t k=0; k<T::size; k++)
+      {
+        const Vec3fa v0 = mesh->vertex(v[index],itime[k]+0);
+        const Vec3fa v1 = mesh->vertex(v[index],itime[k]+1);
+        p0.x[k] = v0.x; p0.y[k] = v0.y; p0.z[k] = v0.z;
+        p1.x[k] = v1.x; p1.y[k] = v1.y; p1.z[k] = v1.z;
+      }
+      return (T(one)-ftime)*p0 + ftime*p1;
     }
 
     /* gather the quads */
@@ -99,7 +114,7 @@ namespace embree
                               Vec3<vfloat<M>>& p2, 
                               Vec3<vfloat<M>>& p3,
                               const Scene *const scene,
-                              const size_t j) const;
+                              const vint<M>& itime) const;
 
     __forceinline void gather(Vec3<vfloat<M>>& p0, 
                               Vec3<vfloat<M>>& p1, 
@@ -147,17 +162,21 @@ namespace embree
 
     
     /* Fill quad from quad list */
-    __forceinline std::pair<BBox3fa,BBox3fa> fill_mblur(const PrimRef* prims, size_t& begin, size_t end, Scene* scene, const bool list)
+    __forceinline std::pair<BBox3fa,BBox3fa> fill_mblur(const PrimRef* prims, size_t& begin, size_t end, Scene* scene, const bool list, size_t itime = 0, size_t numTimeSegments = 1)
     {
       vint<M> geomID = -1, primID = -1;
       vint<M> v0 = zero, v1 = zero, v2 = zero, v3 = zero;
       const PrimRef* prim = &prims[begin];
+      BBox3fa bounds0 = empty, bounds1 = empty;
       
       for (size_t i=0; i<M; i++)
       {
 	const QuadMesh* mesh = scene->getQuadMesh(prim->geomID());
 	const QuadMesh::Quad& q = mesh->quad(prim->primID());
 	if (begin<end) {
+          const std::pair<BBox3fa,BBox3fa> b = mesh->linearBounds(prim->primID(),itime,numTimeSegments);
+          bounds0.extend(b.first);
+          bounds1.extend(b.second);
 	  geomID[i] = prim->geomID();
 	  primID[i] = prim->primID();
 	  v0[i] = q.v[0]; 
@@ -178,7 +197,7 @@ namespace embree
       }
       
       new (this) QuadMiMB(v0,v1,v2,v3,geomID,primID); // FIXME: use non temporal store
-      return bounds(scene);
+      return std::make_pair(bounds0,bounds1);
     }
     
     /* Updates the primitive */
@@ -215,38 +234,39 @@ namespace embree
                                            Vec3vf4& p2, 
                                            Vec3vf4& p3,
                                            const Scene *const scene,
-                                           const size_t j) const
+                                           const vint4& itime) const
   {
     const QuadMesh* mesh0 = scene->getQuadMesh(geomIDs[0]);
     const QuadMesh* mesh1 = scene->getQuadMesh(geomIDs[1]);
     const QuadMesh* mesh2 = scene->getQuadMesh(geomIDs[2]);
     const QuadMesh* mesh3 = scene->getQuadMesh(geomIDs[3]);
+    const size_t j0 = itime[0], j1 = itime[1], j2 = itime[2], j3 = itime[3];
 
-    const vfloat4 a0 = vfloat4::loadu(mesh0->vertexPtr(v0[0],j));
-    const vfloat4 a1 = vfloat4::loadu(mesh1->vertexPtr(v0[1],j));
-    const vfloat4 a2 = vfloat4::loadu(mesh2->vertexPtr(v0[2],j));
-    const vfloat4 a3 = vfloat4::loadu(mesh3->vertexPtr(v0[3],j));
+    const vfloat4 a0 = vfloat4::loadu(mesh0->vertexPtr(v0[0],j0));
+    const vfloat4 a1 = vfloat4::loadu(mesh1->vertexPtr(v0[1],j1));
+    const vfloat4 a2 = vfloat4::loadu(mesh2->vertexPtr(v0[2],j2));
+    const vfloat4 a3 = vfloat4::loadu(mesh3->vertexPtr(v0[3],j3));
 
     transpose(a0,a1,a2,a3,p0.x,p0.y,p0.z);
 
-    const vfloat4 b0 = vfloat4::loadu(mesh0->vertexPtr(v1[0],j));
-    const vfloat4 b1 = vfloat4::loadu(mesh1->vertexPtr(v1[1],j));
-    const vfloat4 b2 = vfloat4::loadu(mesh2->vertexPtr(v1[2],j));
-    const vfloat4 b3 = vfloat4::loadu(mesh3->vertexPtr(v1[3],j));
+    const vfloat4 b0 = vfloat4::loadu(mesh0->vertexPtr(v1[0],j0));
+    const vfloat4 b1 = vfloat4::loadu(mesh1->vertexPtr(v1[1],j1));
+    const vfloat4 b2 = vfloat4::loadu(mesh2->vertexPtr(v1[2],j2));
+    const vfloat4 b3 = vfloat4::loadu(mesh3->vertexPtr(v1[3],j3));
 
     transpose(b0,b1,b2,b3,p1.x,p1.y,p1.z);
 
-    const vfloat4 c0 = vfloat4::loadu(mesh0->vertexPtr(v2[0],j));
-    const vfloat4 c1 = vfloat4::loadu(mesh1->vertexPtr(v2[1],j));
-    const vfloat4 c2 = vfloat4::loadu(mesh2->vertexPtr(v2[2],j));
-    const vfloat4 c3 = vfloat4::loadu(mesh3->vertexPtr(v2[3],j));
+    const vfloat4 c0 = vfloat4::loadu(mesh0->vertexPtr(v2[0],j0));
+    const vfloat4 c1 = vfloat4::loadu(mesh1->vertexPtr(v2[1],j1));
+    const vfloat4 c2 = vfloat4::loadu(mesh2->vertexPtr(v2[2],j2));
+    const vfloat4 c3 = vfloat4::loadu(mesh3->vertexPtr(v2[3],j3));
 
     transpose(c0,c1,c2,c3,p2.x,p2.y,p2.z);
 
-    const vfloat4 d0 = vfloat4::loadu(mesh0->vertexPtr(v3[0],j));
-    const vfloat4 d1 = vfloat4::loadu(mesh1->vertexPtr(v3[1],j));
-    const vfloat4 d2 = vfloat4::loadu(mesh2->vertexPtr(v3[2],j));
-    const vfloat4 d3 = vfloat4::loadu(mesh3->vertexPtr(v3[3],j));
+    const vfloat4 d0 = vfloat4::loadu(mesh0->vertexPtr(v3[0],j0));
+    const vfloat4 d1 = vfloat4::loadu(mesh1->vertexPtr(v3[1],j1));
+    const vfloat4 d2 = vfloat4::loadu(mesh2->vertexPtr(v3[2],j2));
+    const vfloat4 d3 = vfloat4::loadu(mesh3->vertexPtr(v3[3],j3));
 
     transpose(d0,d1,d2,d3,p3.x,p3.y,p3.z);
   }
@@ -261,12 +281,17 @@ namespace embree
                                            const Scene *const scene,
                                            const float t) const
   {
-    const vfloat4 t0 = 1.0f - t;
-    const vfloat4 t1 = t;
+    const vfloat4 numTimeSegments(float(scene->getQuadMesh(geomIDs[0])->numTimeSteps-1),
+                                  float(scene->getQuadMesh(geomIDs[1])->numTimeSteps-1),
+                                  float(scene->getQuadMesh(geomIDs[2])->numTimeSteps-1),
+                                  float(scene->getQuadMesh(geomIDs[3])->numTimeSteps-1));
+    vfloat4 ftime; const vint4 itime = getTimeSegment(vfloat4(t),numTimeSegments,ftime);
+    const vfloat4 t0 = 1.0f - ftime;
+    const vfloat4 t1 = ftime;
     Vec3vf4 a0,a1,a2,a3;
-    gather(a0,a1,a2,a3,scene,(size_t)0);
+    gather(a0,a1,a2,a3,scene,itime);
     Vec3vf4 b0,b1,b2,b3;
-    gather(b0,b1,b2,b3,scene,(size_t)1);
+    gather(b0,b1,b2,b3,scene,itime+1);
     p0 = t0 * a0 + t1 * b0;
     p1 = t0 * a1 + t1 * b1;
     p2 = t0 * a2 + t1 * b2;
@@ -38,7 +38,7 @@ namespace embree
         if (pre.grid) SharedLazyTessellationCache::sharedLazyTessellationCache.unlock();
         GridSOA* grid = (GridSOA*) SharedLazyTessellationCache::lookup(prim->entry(),scene->commitCounterSubdiv,[&] () {
             auto alloc = [] (const size_t bytes) { return SharedLazyTessellationCache::sharedLazyTessellationCache.malloc(bytes); };
-            return GridSOA::create(prim,scene,alloc);
+            return GridSOA::createCached(prim,scene,alloc);
           });
         //GridSOA* grid = (GridSOA*) prim->root_ref.data;
         //GridSOA* grid = (GridSOA*) prim;
@@ -80,7 +80,7 @@ namespace embree
         if (pre.grid) SharedLazyTessellationCache::sharedLazyTessellationCache.unlock();
         GridSOA* grid = (GridSOA*) SharedLazyTessellationCache::lookup(prim->entry(),scene->commitCounterSubdiv,[&] () {
             auto alloc = [] (const size_t bytes) { return SharedLazyTessellationCache::sharedLazyTessellationCache.malloc(bytes); };
-            return GridSOA::create(prim,scene,alloc);
+            return GridSOA::createCached(prim,scene,alloc);
           });
         lazy_node = grid->root;
         pre.grid = grid;
@@ -0,0 +1,119 @@
+// ======================================================================== //
+// Copyright 2009-2015 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "primitive.h"
+
+namespace embree
+{
+  /* Stores M triangles of meshes with compressed index representation,
+   * the vertices get decoded from the mesh during intersection */
+  template <int M>
+  struct TriangleMc
+  {
+    /* Virtual interface to query information about the triangle type */
+    struct Type : public PrimitiveType
+    {
+      Type();
+      size_t size(const char* This) const;
+    };
+    static Type type;
+
+  public:
+
+    /* Returns maximal number of stored triangles */
+    static __forceinline size_t max_size() { return M; }
+    
+    /* Returns required number of primitive blocks for N primitives */
+    static __forceinline size_t blocks(size_t N) { return (N+max_size()-1)/max_size(); }
+  
+  public:
+
+    /* Default constructor */
+    __forceinline TriangleMc() {  }
+
+    /* Construction from IDs */
+    __forceinline TriangleMc(const vint<M>& geomIDs, const vint<M>& primIDs)
+      : geomIDs(geomIDs), primIDs(primIDs) {}
+
+    /* Returns a mask that tells which triangles are valid */
+    __forceinline vbool<M> valid() const { return primIDs != vint<M>(-1); }
+    
+    /* Returns if the specified triangle is valid */
+    __forceinline bool valid(const size_t i) const { assert(i<M); return geomIDs[i] != -1; }
+    
+    /* Returns the number of stored triangles */
+    __forceinline size_t size() const { return __bsf(~movemask(valid())); }
+    
+    /* Returns the geometry IDs */
+    __forceinline vint<M> geomID() const { return geomIDs; }
+    __forceinline int geomID(const size_t i) const { assert(i<M); return geomIDs[i]; }
+    
+    /* Returns the primitive IDs */
+    __forceinline vint<M> primID() const { return primIDs; }
+    __forceinline int primID(const size_t i) const { assert(i<M); return primIDs[i]; }
+
+    /* Decodes the vertices of the i'th triangle, invalid triangles decode to a degenerated triangle */
+    __forceinline void vertices(const size_t i, const Scene* scene, const float*& p0, const float*& p1, const float*& p2) const 
+    {
+      const TriangleMesh* mesh = scene->getTriangleMesh(geomIDs[valid(i) ? i : 0]);
+      uint32_t v0, v1, v2; mesh->compressedTriangle(primIDs[valid(i) ? i : 0],v0,v1,v2);
+      p0 = (const float*) mesh->vertexPtr(v0);
+      p1 = valid(i) ? (const float*) mesh->vertexPtr(v1) : p0;
+      p2 = valid(i) ? (const float*) mesh->vertexPtr(v2) : p0;
+    }
+
+    /* Decodes and gathers the triangles */
+    __forceinline void gather(Vec3<vfloat<M>>& p0, Vec3<vfloat<M>>& p1, Vec3<vfloat<M>>& p2, const Scene* scene) const;
+    
+    /* Fill triangle from triangle list */
+    __forceinline void fill(const PrimRef* prims, size_t& begin, size_t end, Scene* scene, const bool list)
+    {
+      vint<M> geomID = -1, primID = -1;
+      for (size_t i=0; i<M && begin<end; i++, begin++) 
+      {
+        const PrimRef& prim = prims[begin];
+        assert(scene->getTriangleMesh(prim.geomID())->hasCompressedTriangles());
+        geomID[i] = prim.geomID();
+        primID[i] = prim.primID();
+      }
+      new (this) TriangleMc(geomID,primID);
+    }
+    
+  public:
+    vint<M> geomIDs;    // geometry ID of mesh
+    vint<M> primIDs;    // primitive ID of primitive inside mesh
+  };
+
+  template<>
+    __forceinline void TriangleMc<4>::gather(Vec3vf4& p0, Vec3vf4& p1, Vec3vf4& p2, const Scene* scene) const
+  {
+    const float *a0, *a1, *a2, *a3, *b0, *b1, *b2, *b3, *c0, *c1, *c2, *c3;
+    vertices(0,scene,a0,b0,c0);
+    vertices(1,scene,a1,b1,c1);
+    vertices(2,scene,a2,b2,c2);
+    vertices(3,scene,a3,b3,c3);
+    transpose(vfloat4::loadu(a0),vfloat4::loadu(a1),vfloat4::loadu(a2),vfloat4::loadu(a3),p0.x,p0.y,p0.z);
+    transpose(vfloat4::loadu(b0),vfloat4::loadu(b1),vfloat4::loadu(b2),vfloat4::loadu(b3),p1.x,p1.y,p1.z);
+    transpose(vfloat4::loadu(c0),vfloat4::loadu(c1),vfloat4::loadu(c2),vfloat4::loadu(c3),p2.x,p2.y,p2.z);
+  }
+
+  template<int M>
+  typename TriangleMc<M>::Type TriangleMc<M>::type;
+
+  typedef TriangleMc<4> Triangle4c;
+}
@@ -52,8 +52,10 @@ namespace embree
     __forceinline TriangleMvMB(const Vec3vfM& a0, const Vec3vfM& a1,
                                const Vec3vfM& b0, const Vec3vfM& b1,
                                const Vec3vfM& c0, const Vec3vfM& c1,
-                               const vint<M>& geomIDs, const vint<M>& primIDs)
-      : v0(a0), v1(b0), v2(c0), dv0(a1-a0), dv1(b1-b0), dv2(c1-c0), geomIDs(geomIDs), primIDs(primIDs) {}
+                               const vint<M>& geomIDs, const vint<M>& primIDs,
+                               const size_t itime = 0, const size_t numTimeSegments = 1)
+      : v0(a0), v1(b0), v2(c0), dv0(a1-a0), dv1(b1-b0), dv2(c1-c0), geomIDs(geomIDs), primIDs(primIDs), 
+      itime(float(itime)), numTimeSegments(float(numTimeSegments)) {}
 
     /* Returns a mask that tells which triangles are valid */
     __forceinline vbool<M> valid() const { return geomIDs != vint<M>(-1); }
@@ -72,6 +74,77 @@ namespace embree
     __forceinline vint<M> primID() const { return primIDs; }
     __forceinline int  primID(const size_t i) const { assert(i<M); return primIDs[i]; }
 
+    /* Returns the specified time relative to the time segment the vertices are stored for */
+    template<typename T>
+    __forceinline T localTime(const T& time) const { return time*T(numTimeSegments)-T(itime); }
+
+    /* Returns true if the vertices have to get gathered from the meshes at ray time */
+    __forceinline bool gatherVertices() const { return numTimeSegments == 0.0f; }
+
+    /* Returns the vertex v of the i'th triangle at the specified time, gathered from the mesh */
+    template<typename T>
+    __forceinline Vec3<T> getVertex(const size_t i, const size_t v, const Scene* scene, const T& time) const
+    {
+      const TriangleMesh* mesh = scene->getTriangleMesh(geomID(i));
+      const unsigned vtx = mesh->triangle(primID(i)).v[v];
+      T ftime; const auto itime = getTimeSegment(time,T(float(mesh->numTimeSteps-1)),ftime);
+      Vec3<T> p0, p1;
+      for (size_t k=0; k<T::size; k++)
+      {
+        const Vec3fa a0 = mesh->vertex(vtx,itime[k]+0);
+        const Vec3fa a1 = mesh->vertex(vtx,itime[k]+1);
+        p0.x[k] = a0.x; p0.y[k] = a0.y; p0.z[k] = a0.z;
+        p1.x[k] = a1.x; p1.y[k] = a1.y; p1.z[k] = a1.z;
+      }
+      return (T(one)-ftime)*p0 + ftime*p1;
+    }
+
+    /* Returns the vertices of all triangles at the time of a single ray */
+    template<int Mx>
+    __forceinline void getVertices(const Scene* scene, const float time, Vec3<vfloat<Mx>>& p0, Vec3<vfloat<Mx>>& p1, Vec3<vfloat<Mx>>& p2) const
+    {
+      if (likely(!gatherVertices()))
+      {
+        const Vec3<vfloat<Mx>> ftime(localTime(time));
+        p0 = madd(ftime,Vec3<vfloat<Mx>>(dv0),Vec3<vfloat<Mx>>(v0));
+        p1 = madd(ftime,Vec3<vfloat<Mx>>(dv1),Vec3<vfloat<Mx>>(v1));
+        p2 = madd(ftime,Vec3<vfloat<Mx>>(dv2),Vec3<vfloat<Mx>>(v2));
+        return;
+      }
+
+      Vec3vfM a = zero, b = zero, c = zero;
+      for (size_t i=0; i<M && valid(i); i++)
+      {
+        const TriangleMesh* mesh = scene->getTriangleMesh(geomID(i));
+        const TriangleMesh::Triangle& tri = mesh->triangle(primID(i));
+        float ftime; const int itime = getTimeSegment(time,float(mesh->numTimeSteps-1),ftime);
+        const Vec3fa ai = (1.0f-ftime)*mesh->vertex(tri.v[0],itime+0) + ftime*mesh->vertex(tri.v[0],itime+1);
+        const Vec3fa bi = (1.0f-ftime)*mesh->vertex(tri.v[1],itime+0) + ftime*mesh->vertex(tri.v[1],itime+1);
+        const Vec3fa ci = (1.0f-ftime)*mesh->vertex(tri.v[2],itime+0) + ftime*mesh->vertex(tri.v[2],itime+1);
+        a.x[i] = ai.x; a.y[i] = ai.y; a.z[i] = ai.z;
+        b.x[i] = bi.x; b.y[i] = bi.y; b.z[i] = bi.z;
+        c.x[i] = ci.x; c.y[i] = ci.y; c.z[i] = ci.z;
+      }
+      p0 = Vec3<vfloat<Mx>>(a); p1 = Vec3<vfloat<Mx>>(b); p2 = Vec3<vfloat<Mx>>(c);
+    }
+
+    /* Returns the vertices of the i'th triangle at the times of K rays */
+    template<int K>
+    __forceinline void getVertices(const size_t i, const Scene* scene, const vfloat<K>& time, Vec3<vfloat<K>>& p0, Vec3<vfloat<K>>& p1, Vec3<vfloat<K>>& p2) const
+    {
+      if (likely(!gatherVertices()))
+      {
+        const Vec3<vfloat<K>> ftime(localTime(time));
+        p0 = madd(ftime,broadcast<vfloat<K>>(dv0,i),broadcast<vfloat<K>>(v0,i));
+        p1 = madd(ftime,broadcast<vfloat<K>>(dv1,i),broadcast<vfloat<K>>(v1,i));
+        p2 = madd(ftime,broadcast<vfloat<K>>(dv2,i),broadcast<vfloat<K>>(v2,i));
+        return;
+      }
+      p0 = getVertex(i,0,scene,time);
+      p1 = getVertex(i,1,scene,time);
+      p2 = getVertex(i,2,scene,time);
+    }
+
     /* Calculate the bounds of the triangles at t0 */
     __forceinline BBox3fa bounds0() const 
     {
@@ -144,8 +217,12 @@ namespace embree
       new (this) TriangleMvMB(va0,va1,vb0,vb1,vc0,vc1,vgeomID,vprimID); // FIXME: store_nt
     }
     
-    /* Fill triangle from triangle list */
-    __forceinline std::pair<BBox3fa,BBox3fa> fill_mblur(const PrimRef* prims, size_t& begin, size_t end, Scene* scene, const bool list)
+    /* Fill triangle from triangle list. The vertices get stored for
+     * time segment itime of numTimeSegments. Meshes with a number of time
+     * segments that does not divide numTimeSegments do not move linearly
+     * inside the time segment, their vertices get gathered from the mesh
+     * at ray time and the returned bounds enclose all their timesteps. */
+    __forceinline std::pair<BBox3fa,BBox3fa> fill_mblur(const PrimRef* prims, size_t& begin, size_t end, Scene* scene, const bool list, size_t itime = 0, size_t numTimeSegments = 1)
     {
       vint<M> vgeomID = -1, vprimID = -1;
       Vec3vfM va0 = zero, vb0 = zero, vc0 = zero;
@@ -153,6 +230,7 @@ namespace embree
 
       BBox3fa bounds0 = empty;
       BBox3fa bounds1 = empty;
+      bool gather = false;
       
       for (size_t i=0; i<M && begin<end; i++, begin++)
       {
@@ -161,12 +239,16 @@ namespace embree
         const size_t primID = prim.primID();
         const TriangleMesh* __restrict__ const mesh = scene->getTriangleMesh(geomID);
         const TriangleMesh::Triangle& tri = mesh->triangle(primID);
-	const Vec3fa& a0 = mesh->vertex(tri.v[0],0); bounds0.extend(a0);
-	const Vec3fa& a1 = mesh->vertex(tri.v[0],1); bounds1.extend(a1);
-        const Vec3fa& b0 = mesh->vertex(tri.v[1],0); bounds0.extend(b0);
-	const Vec3fa& b1 = mesh->vertex(tri.v[1],1); bounds1.extend(b1);
-        const Vec3fa& c0 = mesh->vertex(tri.v[2],0); bounds0.extend(c0);
-	const Vec3fa& c1 = mesh->vertex(tri.v[2],1); bounds1.extend(c1);
+        const std::pair<BBox3fa,BBox3fa> b = mesh->linearBounds(primID,itime,numTimeSegments);
+        bounds0.extend(b.first);
+        bounds1.extend(b.second);
+        gather |= !mesh->isLinearInTimeSegments(numTimeSegments);
+	const Vec3fa a0 = mesh->vertexAtTime(tri.v[0],itime+0,numTimeSegments);
+	const Vec3fa a1 = mesh->vertexAtTime(tri.v[0],itime+1,numTimeSegments);
+        const Vec3fa b0 = mesh->vertexAtTime(tri.v[1],itime+0,numTimeSegments);
+	const Vec3fa b1 = mesh->vertexAtTime(tri.v[1],itime+1,numTimeSegments);
+        const Vec3fa c0 = mesh->vertexAtTime(tri.v[2],itime+0,numTimeSegments);
+	const Vec3fa c1 = mesh->vertexAtTime(tri.v[2],itime+1,numTimeSegments);
         vgeomID [i] = geomID;
         vprimID [i] = primID;
         va0.x[i] = a0.x; va0.y[i] = a0.y; va0.z[i] = a0.z;
@@ -176,7 +258,7 @@ namespace embree
 	vc0.x[i] = c0.x; vc0.y[i] = c0.y; vc0.z[i] = c0.z;
 	vc1.x[i] = c1.x; vc1.y[i] = c1.y; vc1.z[i] = c1.z;
       }
-      new (this) TriangleMvMB(va0,va1,vb0,vb1,vc0,vc1,vgeomID,vprimID);
+      new (this) TriangleMvMB(va0,va1,vb0,vb1,vc0,vc1,vgeomID,vprimID,itime,gather ? 0 : numTimeSegments);
       return std::make_pair(bounds0,bounds1);
     }
    
@@ -189,6 +271,8 @@ namespace embree
     Vec3vfM dv2;     // difference vector between time steps t0 and t1 for third vertex
     vint<M> geomIDs; // geometry ID
     vint<M> primIDs; // primitive ID
+    float itime;           // time segment the vertices are stored for
+    float numTimeSegments; // number of time segments, zero if the vertices have to get gathered from the meshes
   };
 
   template<int M>
@@ -15,6 +15,7 @@
 // ======================================================================== //
 
 #include "instance_intersector1.h"
+#include "../../common/scene.h"
 
 namespace embree
 {
@@ -22,8 +23,9 @@ namespace embree
   {
     void InstanceBoundsFunction(void* userPtr, const Instance* instance, size_t item, BBox3fa* bounds_o)
     {
-      Vec3fa lower = instance->object->bounds.lower;
-      Vec3fa upper = instance->object->bounds.upper;
+      const BBox3fa bounds = instance->lazy ? instance->lazyBounds : instance->object->bounds;
+      Vec3fa lower = bounds.lower;
+      Vec3fa upper = bounds.upper;
       AffineSpace3fa local2world = instance->local2world[0];
       Vec3fa p000 = xfmPoint(local2world,Vec3fa(lower.x,lower.y,lower.z));
       Vec3fa p001 = xfmPoint(local2world,Vec3fa(lower.x,lower.y,upper.z));
@@ -41,6 +43,9 @@ namespace embree
 
     void FastInstanceIntersector1::intersect(const Instance* instance, Ray& ray, size_t item)
     {
+      if (unlikely(instance->lazy)) 
+        ((Scene*)instance->object)->lazyBuild();
+
       const Vec3fa ray_org = ray.org;
       const Vec3fa ray_dir = ray.dir;
       const int ray_geomID = ray.geomID;
@@ -60,6 +65,9 @@ namespace embree
     
     void FastInstanceIntersector1::occluded (const Instance* instance, Ray& ray, size_t item)
     {
+      if (unlikely(instance->lazy)) 
+        ((Scene*)instance->object)->lazyBuild();
+
       const Vec3fa ray_org = ray.org;
       const Vec3fa ray_dir = ray.dir;
       ray.org = xfmPoint (instance->world2local[0],ray_org);
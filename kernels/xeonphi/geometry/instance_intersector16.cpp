@@ -15,6 +15,7 @@
 // ======================================================================== //
 
 #include "instance_intersector16.h"
+#include "../../common/scene.h"
 
 namespace embree
 {
@@ -22,6 +23,9 @@ namespace embree
   {
     void FastInstanceIntersector16::intersect(vint16* valid, const Instance* instance, Ray16& ray, size_t item)
     {
+      if (unlikely(instance->lazy)) 
+        ((Scene*)instance->object)->lazyBuild();
+
       const Vec3vf16 ray_org = ray.org;
       const Vec3vf16 ray_dir = ray.dir;
       const vint16 ray_geomID = ray.geomID;
@@ -41,6 +45,9 @@ namespace embree
     
     void FastInstanceIntersector16::occluded (vint16* valid, const Instance* instance, Ray16& ray, size_t item)
     {
+      if (unlikely(instance->lazy)) 
+        ((Scene*)instance->object)->lazyBuild();
+
       const Vec3vf16 ray_org = ray.org;
       const Vec3vf16 ray_dir = ray.dir;
       const vint16 ray_geomID = ray.geomID;
@@ -1277,7 +1277,7 @@ namespace embree
 
 
 
-  template<bool intersect>
+  template<bool intersect, int rayNFlags = RTC_RAYN_DEFAULT>
   class benchmark_rtcore_intersect_stream_throughput : public Benchmark
   {
   public:
@@ -1285,7 +1285,8 @@ namespace embree
     static RTCScene scene;
 
     benchmark_rtcore_intersect_stream_throughput () 
-      : Benchmark(intersect ? "incoherent_intersect_stream_throughput" : "incoherent_occluded_stream_throughput","MRays/s (all HW threads)") {}
+      : Benchmark(std::string(intersect ? "incoherent_intersect_stream" : "incoherent_occluded_stream") + 
+                  (rayNFlags & RTC_RAYN_REORDER ? "_reorder" : "") + "_throughput","MRays/s (all HW threads)") {}
 
     static double benchmark_rtcore_intersect_stream_throughput_thread(void* arg) 
     {
@@ -1314,9 +1315,9 @@ namespace embree
           setRay(rays[j],Vec3fa(zero),numbers[i+j]);
 
         if (intersect)
-          rtcIntersectN(scene,rays,STREAM_SIZE,sizeof(RTCRay),RTC_RAYN_DEFAULT);
+          rtcIntersectN(scene,rays,STREAM_SIZE,sizeof(RTCRay),rayNFlags);
         else
-          rtcOccludedN(scene,rays,STREAM_SIZE,sizeof(RTCRay),RTC_RAYN_DEFAULT);
+          rtcOccludedN(scene,rays,STREAM_SIZE,sizeof(RTCRay),rayNFlags);
       }        
 
       //if (threadIndex != 0) 
@@ -1365,6 +1366,8 @@ namespace embree
 
   template<> RTCScene benchmark_rtcore_intersect_stream_throughput<true>::scene = nullptr;
   template<> RTCScene benchmark_rtcore_intersect_stream_throughput<false>::scene = nullptr;
+  template<> RTCScene benchmark_rtcore_intersect_stream_throughput<true,RTC_RAYN_REORDER>::scene = nullptr;
+  template<> RTCScene benchmark_rtcore_intersect_stream_throughput<false,RTC_RAYN_REORDER>::scene = nullptr;
 
 
   class benchmark_rtcore_intersect_coherent_stream_throughput : public Benchmark
@@ -1711,6 +1714,8 @@ namespace embree
 
     benchmarks.push_back(new benchmark_rtcore_intersect_stream_throughput<true>());
     benchmarks.push_back(new benchmark_rtcore_intersect_stream_throughput<false>());
+    benchmarks.push_back(new benchmark_rtcore_intersect_stream_throughput<true,RTC_RAYN_REORDER>());
+    benchmarks.push_back(new benchmark_rtcore_intersect_stream_throughput<false,RTC_RAYN_REORDER>());
     benchmarks.push_back(new benchmark_rtcore_intersect_coherent_stream_throughput());
 
     benchmarks.push_back(new benchmark_mutex_sys());
@@ -0,0 +1,627 @@
+// ======================================================================== //
+// Copyright 2009-2015 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#include "../kernels/common/default.h"
+#include "../include/embree2/rtcore.h"
+#include "../include/embree2/rtcore_ray.h"
+#include "../kernels/common/raystream_log.h"
+#include <vector>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <algorithm>
+
+#if defined(RTCORE_RAY_PACKETS)
+#  define HAS_INTERSECT4 1
+#else
+#  define HAS_INTERSECT4 0
+#endif
+
+#if defined(RTCORE_RAY_PACKETS) && (defined(__TARGET_AVX__) || defined(__TARGET_AVX2__))
+#  define HAS_INTERSECT8 1
+#else
+#  define HAS_INTERSECT8 0
+#endif
+
+/* number of logged rays traced between two timer reads */
+#define RAY_BLOCK_SIZE 256
+
+namespace embree
+{
+  /* replays the geometry and rays captured by the RayStreamLogger for
+   * a list of acceleration structures, ray APIs, and thread counts */
+
+  enum Mode { MODE_SINGLE = 0, MODE_PACKET = 1, MODE_STREAM = 2 };
+  static const char* modeNames[] = { "single", "packet", "stream" };
+
+  /* configuration */
+  static RTCAlgorithmFlags aflags = (RTCAlgorithmFlags) (RTC_INTERSECT1 | RTC_INTERSECT4 | RTC_INTERSECT8 | RTC_INTERSECTN);
+  static std::string g_rtcore = "";
+  static std::string g_binaries_path = DEFAULT_PATH_BINARY_FILES;
+  static std::vector<std::string> g_accels;
+  static std::vector<size_t> g_threadCounts;
+  static std::vector<Mode> g_modes;
+  static size_t g_frames = 4;
+  static size_t g_simd_width = 0;
+
+  /* vertex and triangle layout */
+  struct Triangle { int v0, v1, v2; };
+
+  /* packet of logged rays of same type */
+  template<typename RayK, int K>
+  struct ReplayPacket
+  {
+    RayK ray;
+    __aligned(32) int valid[K];
+    unsigned type;
+  };
+
+  typedef ReplayPacket<RTCRay4,4> ReplayPacket4;
+  typedef ReplayPacket<RTCRay8,8> ReplayPacket8;
+
+  /* logged rays in single ray and packet layout, split into blocks of consecutive rays */
+  struct ReplayRays
+  {
+    avector<RTCRay> rays;
+    std::vector<unsigned> types;
+    std::vector<size_t> blocks;  //!< first ray of each block, terminated by the number of rays
+
+    size_t packetWidth;
+    avector<ReplayPacket4> packets4;
+    avector<ReplayPacket8> packets8;
+    std::vector<size_t> packetBlocks; //!< first packet of each block, terminated by the number of packets
+
+    size_t numBlocks() const { return blocks.size()-1; }
+  };
+
+  /* currently executed benchmark */
+  struct ReplayTask
+  {
+    RTCScene scene;
+    Mode mode;
+    const ReplayRays* rays;
+    size_t numThreads;
+    size_t numFrames;
+  };
+
+  static ReplayTask g_task;
+  static AlignedAtomicCounter32 g_counter = 0;
+  static BarrierSys g_barrier;
+  static std::vector<std::vector<double>> g_blockTimes; //!< per thread time per ray of each traced block in ns
+
+  static void parseCommandLine(int argc, char** argv)
+  {
+    for (int i=1; i<argc; i++)
+    {
+      std::string tag = argv[i];
+      if (tag == "") return;
+
+      /* rtcore configuration */
+      else if (tag == "-rtcore" && i+1<argc) {
+        if (g_rtcore != "") g_rtcore += ",";
+        g_rtcore += argv[++i];
+      }
+      else if (tag == "-accel" && i+1<argc) {
+        g_accels.push_back(argv[++i]);
+      }
+      else if (tag == "-threads" && i+1<argc) {
+        g_threadCounts.push_back(atoi(argv[++i]));
+      }
+      else if (tag == "-frames" && i+1<argc) {
+        g_frames = max(1,atoi(argv[++i]));
+      }
+      else if (tag == "-mode" && i+1<argc) {
+        std::string mode = argv[++i];
+        if      (mode == "single") g_modes.push_back(MODE_SINGLE);
+        else if (mode == "packet") g_modes.push_back(MODE_PACKET);
+        else if (mode == "stream") g_modes.push_back(MODE_STREAM);
+        else THROW_RUNTIME_ERROR("unknown mode "+mode);
+      }
+      else if (tag == "-simd_width" && i+1<argc) {
+        g_simd_width = atoi(argv[++i]);
+        if (g_simd_width != 1 && g_simd_width != 4 && g_simd_width != 8 && g_simd_width != 16)
+          THROW_RUNTIME_ERROR("only simd widths of 1,4,8, and 16 are supported");
+      }
+      else if (tag == "-h" || tag == "-help") {
+        std::cout << "Usage: replay [OPTIONS] [PATH_TO_BINARY_FILES] " << std::endl;
+        std::cout << "Options:" << std::endl;
+        std::cout << "-rtcore cfg   : appends cfg to the configuration of all devices" << std::endl;
+        std::cout << "-accel cfg    : benchmarks the device configuration cfg (e.g. tri_accel=bvh8.triangle4), can be specified multiple times" << std::endl;
+        std::cout << "-threads N    : benchmarks with N threads, can be specified multiple times" << std::endl;
+        std::cout << "-frames N     : traces all rays N times per measurement" << std::endl;
+        std::cout << "-mode M       : benchmarks ray API M (single, packet, or stream), can be specified multiple times" << std::endl;
+        std::cout << "-simd_width N : loads ray stream for simd width N (if existing)" << std:: endl;
+        exit(0);
+      }
+
+      /* the path to the binary files */
+      else {
+        g_binaries_path = tag + "/";
+      }
+    }
+  }
+
+  static bool existsFile(const std::string& filename)
+  {
+    std::ifstream file;
+    file.open(filename.c_str(),std::ios::in | std::ios::binary);
+    if (!file) return false;
+    file.close();
+    return true;
+  }
+
+  static char* loadFile(const std::string& filename, size_t& fileSize)
+  {
+    std::ifstream data;
+    data.open(filename.c_str(),std::ios::in | std::ios::binary);
+    if (!data) THROW_RUNTIME_ERROR("could not open file "+filename);
+    data.seekg(0, std::ios::end);
+    fileSize = data.tellg();
+    char* ptr = (char*)os_malloc(fileSize);
+    data.seekg(0, std::ios::beg);
+    data.read(ptr,fileSize);
+    data.close();
+    return ptr;
+  }
+
+  /* creates a scene that shares the buffers of the dumped geometry */
+  static RTCScene createScene(RTCDevice device, char* g, bool& hasHair)
+  {
+    RTCScene scene = rtcDeviceNewScene(device,RTC_SCENE_STATIC,aflags);
+
+    int magick = *(int*)g; g += sizeof(int);
+    if (magick != 0x35238765)
+      THROW_RUNTIME_ERROR("invalid binary file");
+
+    int numGroups = *(int*)g; g += sizeof(int);
+    for (int i=0; i<numGroups; i++)
+    {
+      int type = *(int*)g; g += sizeof(int);
+      if (type == 1 || type == 2)
+      {
+        int numTimeSteps = *(int*)g; g += sizeof(int);
+        int numVertices  = *(int*)g; g += sizeof(int);
+        int numPrims     = *(int*)g; g += sizeof(int);
+
+        unsigned int geometry = type == 1 ?
+          rtcNewTriangleMesh (scene, RTC_GEOMETRY_STATIC, numPrims, numVertices, numTimeSteps) :
+          rtcNewHairGeometry (scene, RTC_GEOMETRY_STATIC, numPrims, numVertices, numTimeSteps);
+        hasHair |= type == 2;
+
+        for (int t=0; t<numTimeSteps; t++) {
+          if (((size_t)g % 16) != 0) g += 16 - ((size_t)g % 16);
+          rtcSetBuffer(scene, geometry, (RTCBufferType)(RTC_VERTEX_BUFFER0+t), g, 0, sizeof(Vec3fa));
+          g += numVertices*sizeof(Vec3fa);
+        }
+
+        const size_t indexSize = type == 1 ? sizeof(Triangle) : sizeof(int);
+        if (((size_t)g % 16) != 0) g += 16 - ((size_t)g % 16);
+        rtcSetBuffer(scene, geometry, RTC_INDEX_BUFFER, g, 0, indexSize);
+        g += numPrims*indexSize;
+      }
+      else if (type != -1)
+        std::cout << "unknown geometry type..ignoring" << std::endl;
+    }
+
+    rtcCommit(scene);
+    return scene;
+  }
+
+  template<typename RayK>
+  static RTCRay extractRay(const RayK& rayK, size_t i)
+  {
+    RTCRay ray;
+    ray.org[0] = rayK.orgx[i]; ray.org[1] = rayK.orgy[i]; ray.org[2] = rayK.orgz[i]; ray.align0 = 0.0f;
+    ray.dir[0] = rayK.dirx[i]; ray.dir[1] = rayK.diry[i]; ray.dir[2] = rayK.dirz[i]; ray.align1 = 0.0f;
+    ray.tnear = rayK.tnear[i];
+    ray.tfar = rayK.tfar[i];
+    ray.time = rayK.time[i];
+    ray.mask = rayK.mask[i];
+    ray.Ng[0] = ray.Ng[1] = ray.Ng[2] = ray.align2 = 0.0f;
+    ray.u = ray.v = 0.0f;
+    ray.geomID = ray.primID = ray.instID = RTC_INVALID_GEOMETRY_ID;
+    return ray;
+  }
+
+  template<typename RayK>
+  static void insertRay(RayK& rayK, size_t i, const RTCRay& ray)
+  {
+    rayK.orgx[i] = ray.org[0]; rayK.orgy[i] = ray.org[1]; rayK.orgz[i] = ray.org[2];
+    rayK.dirx[i] = ray.dir[0]; rayK.diry[i] = ray.dir[1]; rayK.dirz[i] = ray.dir[2];
+    rayK.tnear[i] = ray.tnear;
+    rayK.tfar[i] = ray.tfar;
+    rayK.time[i] = ray.time;
+    rayK.mask[i] = ray.mask;
+    rayK.geomID[i] = rayK.primID[i] = rayK.instID[i] = RTC_INVALID_GEOMETRY_ID;
+  }
+
+  static void appendRay(ReplayRays& rays, const RTCRay& ray, unsigned type)
+  {
+    rays.rays.push_back(ray);
+    rays.types.push_back(type);
+  }
+
+  /* loads the logged rays and converts them into single rays, packets are repacked from consecutive rays of same type */
+  static void loadRays(ReplayRays& rays, const std::string& filename, size_t simd_width, size_t packetWidth)
+  {
+    size_t fileSize = 0;
+    char* data = loadFile(filename,fileSize);
+
+    switch (simd_width)
+    {
+    case 1: {
+      const RayStreamLogger::LogRay1* log = (const RayStreamLogger::LogRay1*) data;
+      for (size_t i=0; i<fileSize/sizeof(RayStreamLogger::LogRay1); i++)
+        appendRay(rays,log[i].ray,log[i].type);
+      break;
+    }
+    case 4: {
+      const RayStreamLogger::LogRay4* log = (const RayStreamLogger::LogRay4*) data;
+      for (size_t i=0; i<fileSize/sizeof(RayStreamLogger::LogRay4); i++)
+        for (size_t k=0; k<4; k++)
+          if (log[i].m_valid & (1<<k)) appendRay(rays,extractRay(log[i].ray4,k),log[i].type);
+      break;
+    }
+    case 8: {
+      const RayStreamLogger::LogRay8* log = (const RayStreamLogger::LogRay8*) data;
+      for (size_t i=0; i<fileSize/sizeof(RayStreamLogger::LogRay8); i++)
+        for (size_t k=0; k<8; k++)
+          if (log[i].m_valid & (1<<k)) appendRay(rays,extractRay(log[i].ray8,k),log[i].type);
+      break;
+    }
+    case 16: {
+      const RayStreamLogger::LogRay16* log = (const RayStreamLogger::LogRay16*) data;
+      for (size_t i=0; i<fileSize/sizeof(RayStreamLogger::LogRay16); i++)
+        for (size_t k=0; k<16; k++)
+          if (log[i].m_valid & (1<<k)) appendRay(rays,extractRay(log[i].ray16,k),log[i].type);
+      break;
+    }
+    default:
+      THROW_RUNTIME_ERROR("unknown SIMD width");
+    }
+    os_free(data,fileSize);
+
+    for (size_t i=0; i<rays.rays.size(); i+=RAY_BLOCK_SIZE)
+      rays.blocks.push_back(i);
+    rays.blocks.push_back(rays.rays.size());
+
+    /* repack each block into packets of consecutive rays of same type */
+    rays.packetWidth = packetWidth;
+    for (size_t b=0; b<rays.numBlocks(); b++)
+    {
+      rays.packetBlocks.push_back(packetWidth == 8 ? rays.packets8.size() : rays.packets4.size());
+      for (size_t i=rays.blocks[b]; i<rays.blocks[b+1]; )
+      {
+        ReplayPacket4 packet4; memset(&packet4,0,sizeof(packet4));
+        ReplayPacket8 packet8; memset(&packet8,0,sizeof(packet8));
+        packet4.type = packet8.type = rays.types[i];
+        for (size_t k=0; k<packetWidth && i<rays.blocks[b+1] && rays.types[i] == packet4.type; k++, i++) {
+          if (packetWidth == 8) { insertRay(packet8.ray,k,rays.rays[i]); packet8.valid[k] = -1; }
+          else                  { insertRay(packet4.ray,k,rays.rays[i]); packet4.valid[k] = -1; }
+        }
+        if (packetWidth == 8) rays.packets8.push_back(packet8);
+        else                  rays.packets4.push_back(packet4);
+      }
+    }
+    rays.packetBlocks.push_back(packetWidth == 8 ? rays.packets8.size() : rays.packets4.size());
+  }
+
+  __forceinline void tracePacket(RTCScene scene, ReplayPacket4& packet)
+  {
+#if HAS_INTERSECT4
+    if (packet.type == RayStreamLogger::RAY_INTERSECT) rtcIntersect4(packet.valid,scene,packet.ray);
+    else                                               rtcOccluded4 (packet.valid,scene,packet.ray);
+#endif
+  }
+
+  __forceinline void tracePacket(RTCScene scene, ReplayPacket8& packet)
+  {
+#if HAS_INTERSECT8
+    if (packet.type == RayStreamLogger::RAY_INTERSECT) rtcIntersect8(packet.valid,scene,packet.ray);
+    else                                               rtcOccluded8 (packet.valid,scene,packet.ray);
+#endif
+  }
+
+  template<typename Packet>
+  static double tracePackets(RTCScene scene, const Packet* packets, size_t begin, size_t end, avector<Packet>& scratch)
+  {
+    scratch.resize(end-begin);
+    std::copy(packets+begin,packets+end,scratch.begin());
+    double t0 = getSeconds();
+    for (size_t i=0; i<scratch.size(); i++)
+      tracePacket(scene,scratch[i]);
+    return getSeconds()-t0;
+  }
+
+  /* traces blocks of rays until all blocks got processed */
+  static void traceBlocks(size_t threadIndex)
+  {
+    const ReplayRays& rays = *g_task.rays;
+    avector<RTCRay> scratch;
+    avector<ReplayPacket4> scratch4;
+    avector<ReplayPacket8> scratch8;
+
+    while (true)
+    {
+      const size_t b = g_counter.add(1);
+      if (b >= rays.numBlocks()) break;
+      const size_t begin = rays.blocks[b], end = rays.blocks[b+1];
+
+      double dt = 0.0;
+      switch (g_task.mode)
+      {
+      case MODE_SINGLE: {
+        scratch.resize(end-begin);
+        std::copy(rays.rays.begin()+begin,rays.rays.begin()+end,scratch.begin());
+        double t0 = getSeconds();
+        for (size_t i=0; i<scratch.size(); i++) {
+          if (rays.types[begin+i] == RayStreamLogger::RAY_INTERSECT) rtcIntersect(g_task.scene,scratch[i]);
+          else                                                        rtcOccluded (g_task.scene,scratch[i]);
+        }
+        dt = getSeconds()-t0;
+        break;
+      }
+      case MODE_PACKET: {
+        if (rays.packetWidth == 8) dt = tracePackets(g_task.scene,rays.packets8.data(),rays.packetBlocks[b],rays.packetBlocks[b+1],scratch8);
+        else                       dt = tracePackets(g_task.scene,rays.packets4.data(),rays.packetBlocks[b],rays.packetBlocks[b+1],scratch4);
+        break;
+      }
+      case MODE_STREAM: {
+        scratch.resize(end-begin);
+        std::copy(rays.rays.begin()+begin,rays.rays.begin()+end,scratch.begin());
+        double t0 = getSeconds();
+        for (size_t i=0; i<scratch.size(); )
+        {
+          /* trace run of consecutive rays of same type as one stream */
+          size_t j = i+1;
+          while (j<scratch.size() && rays.types[begin+j] == rays.types[begin+i]) j++;
+          if (rays.types[begin+i] == RayStreamLogger::RAY_INTERSECT) rtcIntersectN(g_task.scene,&scratch[i],j-i,sizeof(RTCRay));
+          else                                                        rtcOccludedN (g_task.scene,&scratch[i],j-i,sizeof(RTCRay));
+          i = j;
+        }
+        dt = getSeconds()-t0;
+        break;
+      }
+      }
+      g_blockTimes[threadIndex].push_back(1E9*dt/double(end-begin));
+    }
+  }
+
+  static void threadMainLoop(void* ptr)
+  {
+    const size_t threadIndex = (size_t) ptr;
+    for (size_t f=0; f<g_task.numFrames; f++) {
+      g_barrier.wait();
+      traceBlocks(threadIndex);
+      g_barrier.wait();
+    }
+  }
+
+  struct ReplayResult
+  {
+    double mraysPerSec;
+    double p50, p90, p99; //!< percentiles of the time per ray of the traced blocks in ns
+  };
+
+  /* traces all rays the specified number of frames with the specified number of threads */
+  static ReplayResult replay(RTCScene scene, Mode mode, const ReplayRays& rays, size_t numThreads, size_t numFrames)
+  {
+    g_task.scene = scene;
+    g_task.mode = mode;
+    g_task.rays = &rays;
+    g_task.numThreads = numThreads;
+    g_task.numFrames = numFrames;
+    g_blockTimes.clear();
+    g_blockTimes.resize(numThreads);
+    g_barrier.init(numThreads);
+
+    std::vector<thread_t> threads;
+    for (size_t i=1; i<numThreads; i++)
+      threads.push_back(createThread(threadMainLoop,(void*)i,1000000,i));
+
+    double time = 0.0;
+    for (size_t f=0; f<numFrames; f++)
+    {
+      g_counter = 0;
+      double t0 = getSeconds(); // start timer before releasing the threads as they may finish before this thread wakes up
+      g_barrier.wait();
+      traceBlocks(0);
+      g_barrier.wait();
+      time += getSeconds()-t0;
+    }
+
+    for (size_t i=0; i<threads.size(); i++)
+      join(threads[i]);
+
+    std::vector<double> blockTimes;
+    for (size_t i=0; i<numThreads; i++)
+      blockTimes.insert(blockTimes.end(),g_blockTimes[i].begin(),g_blockTimes[i].end());
+    std::sort(blockTimes.begin(),blockTimes.end());
+
+    ReplayResult result;
+    result.mraysPerSec = 1E-6*double(numFrames*rays.rays.size())/time;
+    result.p50 = blockTimes[(blockTimes.size()-1)*50/100];
+    result.p90 = blockTimes[(blockTimes.size()-1)*90/100];
+    result.p99 = blockTimes[(blockTimes.size()-1)*99/100];
+    return result;
+  }
+
+  /* benchmarks one device configuration for all selected modes and thread counts */
+  static void replayConfig(const std::string& cfg, char* geometry, const ReplayRays& rays)
+  {
+    RTCDevice device = rtcNewDevice((g_rtcore == "" ? cfg : g_rtcore+","+cfg).c_str());
+    if (rtcDeviceGetError(device) != RTC_NO_ERROR) {
+      std::cout << std::setw(36) << cfg << "  not supported" << std::endl;
+      rtcDeleteDevice(device);
+      return;
+    }
+
+    bool hasHair = false;
+    RTCScene scene = createScene(device,geometry,hasHair);
+    if (rtcDeviceGetError(device) != RTC_NO_ERROR) {
+      std::cout << std::setw(36) << cfg << "  not supported" << std::endl;
+      rtcDeleteScene(scene);
+      rtcDeleteDevice(device);
+      return;
+    }
+
+    for (size_t m=0; m<g_modes.size(); m++)
+    {
+      /* gather traversal statistics single threaded */
+      rtcDeviceSetParameter1i(device,RTC_STATISTICS,1);
+      rtcDeviceClearStatistics(device);
+      replay(scene,g_modes[m],rays,1,1);
+      RTCStatistics stats;
+      rtcDeviceGetStatistics(device,&stats);
+      rtcDeviceSetParameter1i(device,RTC_STATISTICS,0);
+      const double N = double(rays.rays.size());
+
+      for (size_t t=0; t<g_threadCounts.size(); t++)
+      {
+        ReplayResult result = replay(scene,g_modes[m],rays,g_threadCounts[t],g_frames);
+        std::cout << std::setw(36) << cfg
+                  << std::setw(8)  << modeNames[g_modes[m]]
+                  << std::setw(8)  << g_threadCounts[t]
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(10) << result.mraysPerSec
+                  << std::setw(10) << result.p50
+                  << std::setw(10) << result.p90
+                  << std::setw(10) << result.p99
+                  << std::setw(10) << double(stats.nodes)/N
+                  << std::setw(10) << double(stats.leaves)/N
+                  << std::setw(10) << double(stats.primitives)/N
+                  << std::endl;
+      }
+    }
+
+    rtcDeleteScene(scene);
+    rtcDeleteDevice(device);
+  }
+
+  /* main function in embree namespace */
+  int main(int argc, char** argv)
+  {
+    /* parse command line */
+    parseCommandLine(argc,argv);
+
+    /* by default benchmark the default configuration, all triangle and all hair acceleration structures */
+    if (g_accels.size() == 0)
+    {
+      const char* tri_accels[] = {
+        "bvh4.triangle4", "bvh4.triangle4v", "bvh4.triangle4i", "bvh4.triangle8",
+        "bvh8.triangle4", "bvh8.triangle8", "bvh8.triangle4.compressed"
+      };
+      const char* hair_accels[] = {
+        "bvh4.bezier1v", "bvh4.bezier1i", "bvh4obb.bezier1v", "bvh4obb.bezier1i", "bvh4obb.bezier4v",
+        "bvh8obb.bezier1v", "bvh8obb.bezier1i", "bvh8obb.bezier8v"
+      };
+      g_accels.push_back("tri_accel=default");
+      for (size_t i=0; i<sizeof(tri_accels)/sizeof(tri_accels[0]); i++)
+        g_accels.push_back(std::string("tri_accel=")+tri_accels[i]);
+      for (size_t i=0; i<sizeof(hair_accels)/sizeof(hair_accels[0]); i++)
+        g_accels.push_back(std::string("hair_accel=")+hair_accels[i]);
+    }
+    if (g_threadCounts.size() == 0) {
+      g_threadCounts.push_back(1);
+      if (getNumberOfLogicalThreads() > 1)
+        g_threadCounts.push_back(getNumberOfLogicalThreads());
+    }
+    if (g_modes.size() == 0) {
+      g_modes.push_back(MODE_SINGLE);
+#if HAS_INTERSECT4
+      g_modes.push_back(MODE_PACKET);
+#endif
+      g_modes.push_back(MODE_STREAM);
+    }
+
+    /* load geometry file */
+    size_t geometrySize = 0;
+    char* geometry = loadFile(g_binaries_path + DEFAULT_FILENAME_GEOMETRY,geometrySize);
+
+    /* skip hair acceleration structures for scenes without hair */
+    {
+      RTCDevice device = rtcNewDevice(g_rtcore.c_str());
+      bool hasHair = false;
+      rtcDeleteScene(createScene(device,geometry,hasHair));
+      rtcDeleteDevice(device);
+      if (!hasHair) {
+        std::vector<std::string> accels;
+        for (size_t i=0; i<g_accels.size(); i++)
+          if (g_accels[i].find("hair_accel=") != 0) accels.push_back(g_accels[i]);
+        g_accels = accels;
+      }
+    }
+
+    /* looking for stream files in the following order: ray1.bin, ray4.bin, ray8.bin, ray16.bin */
+    std::string rayStreamFileName;
+    if (g_simd_width == 0) {
+      for (size_t shift=0; shift<=4 && g_simd_width == 0; shift++) {
+        rayStreamFileName = g_binaries_path + "ray" + toString(size_t(1) << shift) + ".bin";
+        if (existsFile(rayStreamFileName)) g_simd_width = size_t(1) << shift;
+      }
+      if (g_simd_width == 0)
+        THROW_RUNTIME_ERROR("no valid ray stream data files found");
+    }
+    rayStreamFileName = g_binaries_path + "ray" + toString(g_simd_width) + ".bin";
+
+    /* replay packets with the native packet size if possible */
+    size_t packetWidth = 4;
+#if HAS_INTERSECT8
+    RTCDevice device = rtcNewDevice(g_rtcore.c_str());
+    if (rtcDeviceGetParameter1i(device,RTC_CONFIG_INTERSECT8)) packetWidth = 8;
+    rtcDeleteDevice(device);
+#endif
+
+    ReplayRays rays;
+    loadRays(rays,rayStreamFileName,g_simd_width,packetWidth);
+    if (rays.rays.size() == 0)
+      THROW_RUNTIME_ERROR("ray stream file "+rayStreamFileName+" contains no rays");
+    std::cout << "replaying " << rays.rays.size() << " rays from " << rayStreamFileName << " using packets of " << packetWidth << " rays" << std::endl;
+
+    std::cout << std::setw(36) << "config"
+              << std::setw(8)  << "api"
+              << std::setw(8)  << "threads"
+              << std::setw(10) << "Mrays/s"
+              << std::setw(10) << "p50 ns"
+              << std::setw(10) << "p90 ns"
+              << std::setw(10) << "p99 ns"
+              << std::setw(10) << "nodes"
+              << std::setw(10) << "leaves"
+              << std::setw(10) << "prims"
+              << std::endl;
+
+    for (size_t i=0; i<g_accels.size(); i++)
+      replayConfig(g_accels[i],geometry,rays);
+
+    os_free(geometry,geometrySize);
+    return 0;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  try {
+    return embree::main(argc, argv);
+  }
+  catch (const std::exception& e) {
+    std::cout << "Error: " << e.what() << std::endl;
+    return 1;
+  }
+  catch (...) {
+    std::cout << "Error: unknown exception caught." << std::endl;
+    return 1;
+  }
+}
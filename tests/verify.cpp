@@ -1313,6 +1313,1009 @@ namespace embree
     return bounds0 == bounds1;
   }
 
+  bool rtcore_save_load_scene()
+  {
+    ClearBuffers clear_before_return;
+    const char* filename = "verify_scene.bvh";
+    RTCSceneRef scene0 = rtcDeviceNewScene(g_device,RTC_SCENE_STATIC,RTC_INTERSECT1);
+    addSphere(scene0,RTC_GEOMETRY_STATIC,zero,1.0f,50);
+    addHair(scene0,RTC_GEOMETRY_STATIC,Vec3fa(0,0,0),0.1f,0.05f,100);
+    rtcCommit (scene0);
+    AssertNoError();
+    rtcSaveScene(scene0,filename);
+    AssertNoError();
+
+    /* loading into scene with different geometry has to fail */
+    RTCSceneRef scene1 = rtcDeviceNewScene(g_device,RTC_SCENE_STATIC,RTC_INTERSECT1);
+    addSphere(scene1,RTC_GEOMETRY_STATIC,zero,1.0f,40);
+    addHair(scene1,RTC_GEOMETRY_STATIC,Vec3fa(0,0,0),0.1f,0.05f,100);
+    rtcLoadScene(scene1,filename);
+    AssertError(RTC_INVALID_OPERATION);
+
+    /* loading into identical scene has to give identical hits */
+    RTCSceneRef scene2 = rtcDeviceNewScene(g_device,RTC_SCENE_STATIC,RTC_INTERSECT1);
+    addSphere(scene2,RTC_GEOMETRY_STATIC,zero,1.0f,50);
+    addHair(scene2,RTC_GEOMETRY_STATIC,Vec3fa(0,0,0),0.1f,0.05f,100);
+    rtcLoadScene(scene2,filename);
+    AssertNoError();
+    remove(filename);
+
+    bool passed = true;
+    for (size_t i=0; i<1000; i++)
+    {
+      const Vec3fa org(2.0f*drand48()-1.0f,2.0f*drand48()-1.0f,2.0f*drand48()-1.0f);
+      const Vec3fa dir(2.0f*drand48()-1.0f,2.0f*drand48()-1.0f,2.0f*drand48()-1.0f);
+      RTCRay ray0 = makeRay(org,dir); rtcIntersect(scene0,ray0);
+      RTCRay ray1 = makeRay(org,dir); rtcIntersect(scene2,ray1);
+      passed &= ray0.geomID == ray1.geomID && ray0.primID == ray1.primID && ray0.tfar == ray1.tfar;
+    }
+    AssertNoError();
+    return passed;
+  }
+
+  bool rtcore_compressed_bvh()
+  {
+    if (!hasISA(AVX)) return true;
+    ClearBuffers clear_before_return;
+    RTCDevice device0 = rtcNewDevice("tri_accel=bvh8.triangle4");
+    RTCDevice device = rtcNewDevice("tri_accel=bvh8.triangle4.compressed");
+    bool passed = true;
+    {
+      /* the compressed BVH has to give identical hits as the uncompressed one */
+      RTCSceneRef scene0 = rtcDeviceNewScene(device0,RTC_SCENE_STATIC,aflags);
+      addSphere(scene0,RTC_GEOMETRY_STATIC,zero,1.0f,50);
+      addSphere(scene0,RTC_GEOMETRY_STATIC,Vec3fa(1.5f,0.0f,0.0f),0.01f,10);
+      rtcCommit (scene0);
+      passed &= rtcDeviceGetError(device0) == RTC_NO_ERROR;
+
+      RTCSceneRef scene1 = rtcDeviceNewScene(device,RTC_SCENE_STATIC,aflags);
+      addSphere(scene1,RTC_GEOMETRY_STATIC,zero,1.0f,50);
+      addSphere(scene1,RTC_GEOMETRY_STATIC,Vec3fa(1.5f,0.0f,0.0f),0.01f,10);
+      rtcCommit (scene1);
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+
+      for (size_t i=0; i<1000; i++)
+      {
+        const Vec3fa org(4.0f*drand48()-2.0f,4.0f*drand48()-2.0f,4.0f*drand48()-2.0f);
+        const Vec3fa dir(2.0f*drand48()-1.0f,2.0f*drand48()-1.0f,2.0f*drand48()-1.0f);
+        RTCRay ray0 = makeRay(org,dir); rtcIntersect(scene0,ray0);
+        RTCRay ray1 = makeRay(org,dir); rtcIntersect(scene1,ray1);
+        passed &= ray0.geomID == ray1.geomID && ray0.primID == ray1.primID && ray0.tfar == ray1.tfar;
+        RTCRay shadow = makeRay(org,dir); rtcOccluded(scene1,shadow);
+        passed &= (shadow.geomID == 0) == (ray0.geomID != RTC_INVALID_GEOMETRY_ID);
+      }
+
+#if HAS_INTERSECT4
+      for (size_t i=0; i<250; i++)
+      {
+        RTCRay ray[4];
+        RTCRay4 ray4; memset(&ray4,0,sizeof(ray4));
+        for (size_t k=0; k<4; k++)
+        {
+          const Vec3fa org(4.0f*drand48()-2.0f,4.0f*drand48()-2.0f,4.0f*drand48()-2.0f);
+          const Vec3fa dir(2.0f*drand48()-1.0f,2.0f*drand48()-1.0f,2.0f*drand48()-1.0f);
+          ray[k] = makeRay(org,dir); setRay(ray4,k,ray[k]);
+          rtcIntersect(scene0,ray[k]);
+        }
+        __aligned(16) int valid4[4] = { -1,-1,-1,-1 };
+        rtcIntersect4(valid4,scene1,ray4);
+        for (size_t k=0; k<4; k++)
+          passed &= ray4.geomID[k] == ray[k].geomID && ray4.primID[k] == ray[k].primID && ray4.tfar[k] == ray[k].tfar;
+      }
+#endif
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+    }
+    rtcDeleteDevice(device);
+    rtcDeleteDevice(device0);
+    return passed;
+  }
+
+  /* adds a height field whose second half of triangles is stored in shuffled order */
+  unsigned addShuffledGrid (const RTCSceneRef& scene, RTCGeometryFlags flags, size_t W, size_t H)
+  {
+    unsigned mesh = rtcNewTriangleMesh (scene, flags, 2*(W-1)*(H-1), W*H);
+    Vertex3fa* vertices = (Vertex3fa*) rtcMapBuffer(scene,mesh,RTC_VERTEX_BUFFER); 
+    for (size_t y=0; y<H; y++) {
+      for (size_t x=0; x<W; x++) {
+        const float fx = 2.0f*float(x)/float(W-1)-1.0f, fy = 2.0f*float(y)/float(H-1)-1.0f;
+        vertices[y*W+x] = Vertex3fa(fx,fy,0.1f*sinf(8.0f*fx)*cosf(8.0f*fy));
+      }
+    }
+    rtcUnmapBuffer(scene,mesh,RTC_VERTEX_BUFFER); 
+
+    std::vector<Triangle> tris;
+    for (size_t y=0; y<H-1; y++) {
+      for (size_t x=0; x<W-1; x++) {
+        const int p00 = int(y*W+x), p01 = p00+1, p10 = p00+int(W), p11 = p10+1;
+        tris.push_back(Triangle(p00,p01,p10));
+        tris.push_back(Triangle(p01,p11,p10));
+      }
+    }
+    for (size_t i=tris.size()/2; i<tris.size(); i++) 
+      std::swap(tris[i],tris[i+size_t(drand48()*(tris.size()-i))%(tris.size()-i)]);
+
+    Triangle* triangles = (Triangle*) rtcMapBuffer(scene,mesh,RTC_INDEX_BUFFER);
+    std::copy(tris.begin(),tris.end(),triangles);
+    rtcUnmapBuffer(scene,mesh,RTC_INDEX_BUFFER);
+    return mesh;
+  }
+
+  bool rtcore_compressed_triangles()
+  {
+    ClearBuffers clear_before_return;
+    RTCDevice device0 = rtcNewDevice("tri_accel=bvh4.triangle4i");
+    RTCDevice device = rtcNewDevice("tri_accel=bvh4.triangle4c");
+    bool passed = true;
+    {
+      /* the grid has more than 64k vertices, thus the clusters need 1, 2, and 4 byte local indices */
+      RTCSceneRef scene0 = rtcDeviceNewScene(device0,RTC_SCENE_DYNAMIC,aflags);
+      RTCSceneRef scene1 = rtcDeviceNewScene(device,RTC_SCENE_DYNAMIC,aflags);
+      addSphere(scene0,RTC_GEOMETRY_STATIC,Vec3fa(0.0f,0.0f,1.0f),0.5f,50);
+      addSphere(scene1,RTC_GEOMETRY_STATIC,Vec3fa(0.0f,0.0f,1.0f),0.5f,50);
+      srand48(17); unsigned grid0 = addShuffledGrid(scene0,RTC_GEOMETRY_DYNAMIC,300,240);
+      srand48(17); unsigned grid1 = addShuffledGrid(scene1,RTC_GEOMETRY_DYNAMIC,300,240);
+
+      for (size_t iter=0; iter<2; iter++)
+      {
+        /* modified index buffers have to get encoded again on commit */
+        if (iter == 1) {
+          Triangle* triangles0 = (Triangle*) rtcMapBuffer(scene0,grid0,RTC_INDEX_BUFFER);
+          Triangle* triangles1 = (Triangle*) rtcMapBuffer(scene1,grid1,RTC_INDEX_BUFFER);
+          for (size_t i=0; i<2*299*239; i+=2) {
+            std::swap(triangles0[i].v0,triangles0[i].v2);
+            std::swap(triangles1[i].v0,triangles1[i].v2);
+          }
+          rtcUnmapBuffer(scene0,grid0,RTC_INDEX_BUFFER);
+          rtcUnmapBuffer(scene1,grid1,RTC_INDEX_BUFFER);
+          rtcUpdateBuffer(scene0,grid0,RTC_INDEX_BUFFER);
+          rtcUpdateBuffer(scene1,grid1,RTC_INDEX_BUFFER);
+        }
+        rtcCommit (scene0);
+        rtcCommit (scene1);
+        passed &= rtcDeviceGetError(device0) == RTC_NO_ERROR;
+        passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+
+        /* decoding the compressed indices has to give identical hits */
+        for (size_t i=0; i<1000; i++)
+        {
+          const Vec3fa org(2.0f*drand48()-1.0f,2.0f*drand48()-1.0f,2.0f);
+          const Vec3fa dir(0.5f*drand48()-0.25f,0.5f*drand48()-0.25f,-1.0f);
+          RTCRay ray0 = makeRay(org,dir); rtcIntersect(scene0,ray0);
+          RTCRay ray1 = makeRay(org,dir); rtcIntersect(scene1,ray1);
+          passed &= ray0.geomID == ray1.geomID && ray0.primID == ray1.primID && ray0.tfar == ray1.tfar;
+          passed &= ray0.geomID == RTC_INVALID_GEOMETRY_ID || (ray0.Ng[0] == ray1.Ng[0] && ray0.Ng[1] == ray1.Ng[1] && ray0.Ng[2] == ray1.Ng[2]);
+          RTCRay shadow = makeRay(org,dir); rtcOccluded(scene1,shadow);
+          passed &= (shadow.geomID == 0) == (ray0.geomID != RTC_INVALID_GEOMETRY_ID);
+        }
+
+#if HAS_INTERSECT4
+        for (size_t i=0; i<250; i++)
+        {
+          RTCRay ray[4];
+          RTCRay4 ray4; memset(&ray4,0,sizeof(ray4));
+          for (size_t k=0; k<4; k++)
+          {
+            const Vec3fa org(2.0f*drand48()-1.0f,2.0f*drand48()-1.0f,2.0f);
+            const Vec3fa dir(0.5f*drand48()-0.25f,0.5f*drand48()-0.25f,-1.0f);
+            ray[k] = makeRay(org,dir); setRay(ray4,k,ray[k]);
+            rtcIntersect(scene0,ray[k]);
+          }
+          __aligned(16) int valid4[4] = { -1,-1,-1,-1 };
+          rtcIntersect4(valid4,scene1,ray4);
+          for (size_t k=0; k<4; k++)
+            passed &= ray4.geomID[k] == ray[k].geomID && ray4.primID[k] == ray[k].primID && ray4.tfar[k] == ray[k].tfar;
+        }
+#endif
+      }
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+    }
+    rtcDeleteDevice(device);
+    rtcDeleteDevice(device0);
+    return passed;
+  }
+
+  bool rtcore_update_buffer_range()
+  {
+    ClearBuffers clear_before_return;
+    const size_t W = 300, H = 240;
+    bool passed = true;
+
+    /* the rebuilt dynamic grid is the reference for the partially refitted deformable grid */
+    RTCSceneRef scene0 = rtcDeviceNewScene(g_device,RTC_SCENE_DYNAMIC,aflags);
+    RTCSceneRef scene1 = rtcDeviceNewScene(g_device,RTC_SCENE_DYNAMIC,aflags);
+    srand48(23); unsigned grid0 = addShuffledGrid(scene0,RTC_GEOMETRY_DYNAMIC,W,H);
+    srand48(23); unsigned grid1 = addShuffledGrid(scene1,RTC_GEOMETRY_DEFORMABLE,W,H);
+    AssertNoError();
+
+    for (size_t iter=0; iter<4; iter++)
+    {
+      /* lift some rows of vertices and only tag these as modified */
+      const size_t rows[4][2] = { { 0, 0 }, { 100, 120 }, { 10, 15 }, { 200, 210 } };
+      Vertex3fa* vertices0 = (Vertex3fa*) rtcMapBuffer(scene0,grid0,RTC_VERTEX_BUFFER);
+      Vertex3fa* vertices1 = (Vertex3fa*) rtcMapBuffer(scene1,grid1,RTC_VERTEX_BUFFER);
+      for (size_t i=rows[iter][0]*W; i<rows[iter][1]*W; i++) {
+        vertices0[i].z += 0.3f;
+        vertices1[i].z += 0.3f;
+      }
+      rtcUnmapBuffer(scene0,grid0,RTC_VERTEX_BUFFER);
+      rtcUnmapBuffer(scene1,grid1,RTC_VERTEX_BUFFER);
+      rtcUpdate(scene0,grid0);
+      if (iter) rtcUpdateBufferRange(scene1,grid1,RTC_VERTEX_BUFFER,rows[iter][0]*W,(rows[iter][1]-rows[iter][0])*W);
+
+      /* the last iteration additionally modifies a range of triangles and lowers a vertex range at the border */
+      if (iter == 3) 
+      {
+        Triangle* triangles0 = (Triangle*) rtcMapBuffer(scene0,grid0,RTC_INDEX_BUFFER);
+        Triangle* triangles1 = (Triangle*) rtcMapBuffer(scene1,grid1,RTC_INDEX_BUFFER);
+        for (size_t i=5000; i<5100; i++) {
+          triangles0[i].v2 = triangles0[i].v1;
+          triangles1[i].v2 = triangles1[i].v1;
+        }
+        rtcUnmapBuffer(scene0,grid0,RTC_INDEX_BUFFER);
+        rtcUnmapBuffer(scene1,grid1,RTC_INDEX_BUFFER);
+        rtcUpdateBufferRange(scene1,grid1,RTC_INDEX_BUFFER,5000,100);
+
+        vertices0 = (Vertex3fa*) rtcMapBuffer(scene0,grid0,RTC_VERTEX_BUFFER);
+        vertices1 = (Vertex3fa*) rtcMapBuffer(scene1,grid1,RTC_VERTEX_BUFFER);
+        for (size_t i=(H-2)*W; i<H*W; i++) {
+          vertices0[i].z -= 0.5f;
+          vertices1[i].z -= 0.5f;
+        }
+        rtcUnmapBuffer(scene0,grid0,RTC_VERTEX_BUFFER);
+        rtcUnmapBuffer(scene1,grid1,RTC_VERTEX_BUFFER);
+        rtcUpdateBufferRange(scene1,grid1,RTC_VERTEX_BUFFER,(H-2)*W,2*W);
+      }
+      rtcCommit (scene0);
+      rtcCommit (scene1);
+      AssertNoError();
+
+      for (size_t i=0; i<2000; i++)
+      {
+        const Vec3fa org(2.0f*drand48()-1.0f,2.0f*drand48()-1.0f,2.0f);
+        const Vec3fa dir(0.2f*drand48()-0.1f,0.2f*drand48()-0.1f,-1.0f);
+        RTCRay ray0 = makeRay(org,dir); rtcIntersect(scene0,ray0);
+        RTCRay ray1 = makeRay(org,dir); rtcIntersect(scene1,ray1);
+        passed &= ray0.geomID == ray1.geomID && ray0.primID == ray1.primID && ray0.tfar == ray1.tfar;
+      }
+    }
+
+    /* ranges exceeding the buffer are invalid */
+    rtcUpdateBufferRange(scene1,grid1,RTC_VERTEX_BUFFER,W*H-10,11);
+    passed &= rtcDeviceGetError(g_device) == RTC_INVALID_ARGUMENT;
+    return passed;
+  }
+
+  atomic_t lazyNumCreated[16];
+
+  void lazyCreateSphere(void* ptr, RTCScene hscene)
+  {
+    atomic_add((atomic_t*)ptr,1);
+    RTCSceneRef scene(hscene);
+    addSphere(scene,RTC_GEOMETRY_STATIC,zero,1.0f,20);
+    scene.scene = nullptr; // the scene is owned by the lazy instance test
+  }
+
+  struct LazyInstanceTask
+  {
+    RTCScene scene0;
+    RTCScene scene1;
+    size_t begin, end;
+    bool passed;
+  };
+
+  /* compares hits of lazy instances against eagerly build instances for spheres [begin,end) */
+  void lazyInstanceTrace(void* ptr)
+  {
+    LazyInstanceTask* task = (LazyInstanceTask*) ptr;
+    for (size_t i=0; i<256; i++)
+    {
+      const size_t j = task->begin + (i*7)%(task->end-task->begin);
+      const Vec3fa org = Vec3fa(4.0f*(j%4),10.0f,4.0f*(j/4)) + Vec3fa(float(i%16)/8.0f-1.0f,0.0f,float(i/16)/8.0f-1.0f);
+      RTCRay ray0 = makeRay(org,Vec3fa(0,-1,0)); rtcIntersect(task->scene0,ray0);
+      RTCRay ray1 = makeRay(org,Vec3fa(0,-1,0)); rtcIntersect(task->scene1,ray1);
+      task->passed &= ray0.geomID == ray1.geomID && ray0.primID == ray1.primID && ray0.instID == ray1.instID;
+      task->passed &= ray0.geomID == RTC_INVALID_GEOMETRY_ID || ray0.tfar == ray1.tfar;
+      RTCRay shadow = makeRay(org,Vec3fa(0,-1,0)); rtcOccluded(task->scene1,shadow);
+      task->passed &= (shadow.geomID == 0) == (ray0.geomID != RTC_INVALID_GEOMETRY_ID);
+    }
+  }
+
+  bool rtcore_lazy_instances()
+  {
+    ClearBuffers clear_before_return;
+    RTCSceneRef sphere = rtcDeviceNewScene(g_device,RTC_SCENE_STATIC,aflags);
+    addSphere(sphere,RTC_GEOMETRY_STATIC,zero,1.0f,20);
+    rtcCommit (sphere);
+
+    /* scene0 eagerly instances a committed sphere, scene1 lazily instances spheres created on first hit */
+    RTCSceneRef scene0 = rtcDeviceNewScene(g_device,RTC_SCENE_STATIC,aflags);
+    RTCSceneRef scene1 = rtcDeviceNewScene(g_device,RTC_SCENE_STATIC,aflags);
+    RTCScene objects[16];
+    const RTCBounds bounds = { -1.0f,-1.0f,-1.0f,0.0f, 1.0f,1.0f,1.0f,0.0f };
+    for (size_t i=0; i<16; i++)
+    {
+      const AffineSpace3fa xfm = AffineSpace3fa::translate(Vec3fa(4.0f*(i%4),0.0f,4.0f*(i/4)));
+      unsigned instID0 = rtcNewInstance(scene0,sphere);
+      rtcSetTransform(scene0,instID0,RTC_MATRIX_COLUMN_MAJOR_ALIGNED16,(float*)&xfm);
+      objects[i] = rtcDeviceNewScene(g_device,RTC_SCENE_STATIC,aflags);
+      lazyNumCreated[i] = 0;
+      unsigned instID1 = rtcNewLazyInstance(scene1,objects[i],bounds,lazyCreateSphere,&lazyNumCreated[i]);
+      rtcSetTransform(scene1,instID1,RTC_MATRIX_COLUMN_MAJOR_ALIGNED16,(float*)&xfm);
+    }
+    rtcCommit (scene0);
+    rtcCommit (scene1);
+    AssertNoError();
+
+    /* all lazy instances of a scene have to use the same create function */
+    rtcNewLazyInstance(scene0,objects[0],bounds,nullptr,nullptr);
+    bool passed = rtcDeviceGetError(g_device) == RTC_INVALID_OPERATION;
+
+    /* committing the instancing scene creates no instanced scene */
+    for (size_t i=0; i<16; i++) passed &= lazyNumCreated[i] == 0;
+
+    /* threads concurrently reaching the first 8 instances create each of these exactly once */
+    size_t numThreads = min(getNumberOfLogicalThreads(),size_t(8));
+    std::vector<LazyInstanceTask> tasks(numThreads);
+    for (size_t t=0; t<numThreads; t++) {
+      LazyInstanceTask task = { scene0, scene1, 0, 8, true };
+      tasks[t] = task;
+      g_threads.push_back(createThread(lazyInstanceTrace,&tasks[t],DEFAULT_STACK_SIZE,t));
+    }
+    for (size_t t=0; t<g_threads.size(); t++)
+      join(g_threads[t]);
+    g_threads.clear();
+    for (size_t t=0; t<numThreads; t++) passed &= tasks[t].passed;
+    for (size_t i=0; i<16; i++) passed &= lazyNumCreated[i] == (i < 8);
+    AssertNoError();
+
+    /* instances reached since the previous eviction stay resident */
+    const ssize_t bytes0 = rtcDeviceGetParameter1i(g_device,RTC_MEMORY_USED);
+    rtcEvictLazyInstances(scene1,0);
+    passed &= rtcDeviceGetParameter1i(g_device,RTC_MEMORY_USED) == bytes0;
+
+    /* instances not reached since then get evicted and are created again when reached */
+    LazyInstanceTask task = { scene0, scene1, 8, 16, true };
+    lazyInstanceTrace(&task);
+    const ssize_t bytes1 = rtcDeviceGetParameter1i(g_device,RTC_MEMORY_USED);
+    rtcEvictLazyInstances(scene1,0);
+    passed &= rtcDeviceGetParameter1i(g_device,RTC_MEMORY_USED) < bytes1;
+    task.begin = 0; task.end = 16;
+    lazyInstanceTrace(&task);
+    passed &= task.passed;
+    for (size_t i=0; i<16; i++) passed &= lazyNumCreated[i] == 1 + (i < 8);
+    AssertNoError();
+
+    scene1 = nullptr;
+    for (size_t i=0; i<16; i++) rtcDeleteScene(objects[i]);
+    return passed;
+  }
+
+  volatile bool lazyFailAllocations = false;
+  bool lazyFailMonitorFunction(ssize_t bytes, bool post) {
+    return bytes <= 0 || !lazyFailAllocations;
+  }
+
+  /* the first build of the created sphere runs out of memory */
+  void lazyCreateFailingSphere(void* ptr, RTCScene hscene)
+  {
+    lazyCreateSphere(ptr,hscene);
+    lazyFailAllocations = *(atomic_t*)ptr == 1;
+  }
+
+  bool rtcore_lazy_instance_build_error()
+  {
+    ClearBuffers clear_before_return;
+    RTCDevice device = rtcNewDevice(nullptr);
+    bool passed = true;
+    {
+      RTCSceneRef scene = rtcDeviceNewScene(device,RTC_SCENE_STATIC,aflags);
+      RTCScene object = rtcDeviceNewScene(device,RTC_SCENE_STATIC,aflags);
+      const RTCBounds bounds = { -1.0f,-1.0f,-1.0f,0.0f, 1.0f,1.0f,1.0f,0.0f };
+      atomic_t numCreated = 0;
+      rtcNewLazyInstance(scene,object,bounds,lazyCreateFailingSphere,&numCreated);
+      rtcCommit (scene);
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+      rtcDeviceSetMemoryMonitorFunction(device,lazyFailMonitorFunction);
+
+      /* the ray reaching the instance first misses it as the build fails */
+      RTCRay ray0 = makeRay(Vec3fa(0,10,0),Vec3fa(0,-1,0)); rtcIntersect(scene,ray0);
+      passed &= ray0.geomID == RTC_INVALID_GEOMETRY_ID && numCreated == 1;
+      passed &= rtcDeviceGetError(device) == RTC_OUT_OF_MEMORY;
+      lazyFailAllocations = false;
+
+      /* the next ray creates the instanced scene again and hits it */
+      RTCRay ray1 = makeRay(Vec3fa(0,10,0),Vec3fa(0,-1,0)); rtcIntersect(scene,ray1);
+      passed &= ray1.geomID == 0 && ray1.instID == 0 && numCreated == 2;
+      RTCRay ray2 = makeRay(Vec3fa(0,10,0),Vec3fa(0,-1,0)); rtcIntersect(scene,ray2);
+      passed &= ray2.geomID == 0 && ray2.tfar == ray1.tfar && numCreated == 2;
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+
+      rtcDeviceSetMemoryMonitorFunction(device,nullptr);
+      scene = nullptr;
+      rtcDeleteScene(object);
+    }
+    rtcDeleteDevice(device);
+    return passed;
+  }
+
+  /* sets the level buffer to the pixel footprint of each edge as seen from the origin */
+  void setFootprintLevels (const RTCSceneRef& scene, unsigned geomID, size_t numFaces, float scale)
+  {
+    const Vec3fa* vertices = (const Vec3fa*) rtcMapBuffer(scene,geomID,RTC_VERTEX_BUFFER);
+    const int* indices = (const int*) rtcMapBuffer(scene,geomID,RTC_INDEX_BUFFER);
+    const int* faces = (const int*) rtcMapBuffer(scene,geomID,RTC_FACE_BUFFER);
+    float* levels = (float*) rtcMapBuffer(scene,geomID,RTC_LEVEL_BUFFER);
+    for (size_t f=0, e=0; f<numFaces; e+=faces[f++]) 
+    {
+      for (size_t i=0; i<faces[f]; i++) {
+        const Vec3fa v0 = vertices[indices[e+i]];
+        const Vec3fa v1 = vertices[indices[e+(i+1)%faces[f]]];
+        levels[e+i] = clamp(length(v1-v0)/length(0.5f*(v0+v1))*scale,1.0f,4096.0f);
+      }
+    }
+    rtcUnmapBuffer(scene,geomID,RTC_VERTEX_BUFFER);
+    rtcUnmapBuffer(scene,geomID,RTC_INDEX_BUFFER);
+    rtcUnmapBuffer(scene,geomID,RTC_FACE_BUFFER);
+    rtcUnmapBuffer(scene,geomID,RTC_LEVEL_BUFFER);
+  }
+
+  /* compares the hits of rays from the origin through a grid of pixels */
+  bool compareCameraHits (const RTCSceneRef& scene0, const RTCSceneRef& scene1, const RTCCamera& camera, size_t N)
+  {
+    const Vec3fa vx(camera.vx[0],camera.vx[1],camera.vx[2]);
+    const Vec3fa vy(camera.vy[0],camera.vy[1],camera.vy[2]);
+    const Vec3fa vz(camera.vz[0],camera.vz[1],camera.vz[2]);
+    size_t numHits = 0;
+    for (size_t y=0; y<N; y++) {
+      for (size_t x=0; x<N; x++) {
+        const Vec3fa dir = vz + (float(x)+0.5f)*vx + (float(y)+0.5f)*vy;
+        RTCRay ray0 = makeRay(zero,dir); rtcIntersect(scene0,ray0);
+        RTCRay ray1 = makeRay(zero,dir); rtcIntersect(scene1,ray1);
+        if (ray0.geomID != ray1.geomID) return false;
+        if (ray0.geomID == RTC_INVALID_GEOMETRY_ID) continue;
+        if (abs(ray0.tfar-ray1.tfar) > 1E-4f*ray1.tfar) return false;
+        numHits++;
+      }
+    }
+    return numHits > 0;
+  }
+
+  bool rtcore_tessellation_camera()
+  {
+    ClearBuffers clear_before_return;
+    const size_t N = 256;
+    const float pixelsPerEdge = 2.0f;
+    const float scale = 1.0f/(2.0f/float(N)*pixelsPerEdge);
+    RTCCamera camera;
+    memset(&camera,0,sizeof(camera));
+    camera.vx[0] = 2.0f/float(N);
+    camera.vy[1] = -2.0f/float(N);
+    camera.vz[0] = -1.0f; camera.vz[1] = 1.0f; camera.vz[2] = 1.0f;
+    camera.tfar = inf;
+    camera.mask = -1;
+
+    /* the reference mesh gets the levels calculated by the application */
+    RTCSceneRef scene0 = rtcDeviceNewScene(g_device,RTC_SCENE_DYNAMIC,aflags);
+    RTCSceneRef scene1 = rtcDeviceNewScene(g_device,RTC_SCENE_DYNAMIC,aflags);
+    srand(23); srand48(23); unsigned geom0 = addSubdivSphere(scene0,RTC_GEOMETRY_DEFORMABLE,Vec3fa(0.3f,0.2f,4.0f),1.0f,8,4);
+    srand(23); srand48(23); unsigned geom1 = addSubdivSphere(scene1,RTC_GEOMETRY_DEFORMABLE,Vec3fa(0.3f,0.2f,4.0f),1.0f,8,4);
+    const size_t numFaces = 2*8*8, numEdges = 4*2*8*6 + 3*2*8*2;
+    AssertNoError();
+
+    rtcSetTessellationCamera(scene0,geom0,&camera,pixelsPerEdge);
+    setFootprintLevels(scene1,geom1,numFaces,scale);
+    rtcCommit(scene0);
+    rtcCommit(scene1);
+    AssertNoError();
+    bool passed = compareCameraHits(scene0,scene1,camera,N);
+
+    /* moving the mesh away reduces the levels at the next commit */
+    for (size_t i=0; i<2; i++) {
+      const RTCSceneRef& scene = i ? scene1 : scene0;
+      const unsigned geomID = i ? geom1 : geom0;
+      Vec3fa* vertices = (Vec3fa*) rtcMapBuffer(scene,geomID,RTC_VERTEX_BUFFER);
+      for (size_t j=0; j<2*8*9; j++) vertices[j].z += 3.0f;
+      rtcUnmapBuffer(scene,geomID,RTC_VERTEX_BUFFER);
+      rtcUpdate(scene,geomID);
+    }
+    setFootprintLevels(scene1,geom1,numFaces,scale);
+    rtcCommit(scene0);
+    rtcCommit(scene1);
+    AssertNoError();
+    passed &= compareCameraHits(scene0,scene1,camera,N);
+
+    /* without camera the level buffer is used again */
+    rtcSetTessellationCamera(scene0,geom0,nullptr,0.0f);
+    float* levels = (float*) rtcMapBuffer(scene1,geom1,RTC_LEVEL_BUFFER);
+    for (size_t i=0; i<numEdges; i++) levels[i] = 4.0f;
+    rtcUnmapBuffer(scene1,geom1,RTC_LEVEL_BUFFER);
+    rtcCommit(scene0);
+    rtcCommit(scene1);
+    AssertNoError();
+    passed &= compareCameraHits(scene0,scene1,camera,N);
+
+    /* invalid arguments and geometries without edge levels */
+    rtcSetTessellationCamera(scene0,geom0,&camera,0.0f);
+    AssertError(RTC_INVALID_ARGUMENT);
+    RTCCamera degenerated = camera; degenerated.vy[1] = 0.0f;
+    rtcSetTessellationCamera(scene0,geom0,&degenerated,pixelsPerEdge);
+    AssertError(RTC_INVALID_ARGUMENT);
+    unsigned geom2 = addSphere(scene0,RTC_GEOMETRY_STATIC,zero,1.0f,10);
+    rtcSetTessellationCamera(scene0,geom2,&camera,pixelsPerEdge);
+    AssertError(RTC_INVALID_OPERATION);
+    return passed;
+  }
+
+  /* displaces along the normal by an amount depending on the patch coordinates */
+  __forceinline float displacementHeight(float u, float v) {
+    return 0.1f*u + 0.05f*v;
+  }
+
+  void displacementFunc1(void* ptr, unsigned geomID, unsigned primID, 
+                         const float* u, const float* v, const float* nx, const float* ny, const float* nz,
+                         float* px, float* py, float* pz, size_t N)
+  {
+    for (size_t i=0; i<N; i++) {
+      const float h = displacementHeight(u[i],v[i]);
+      px[i] += h*nx[i]; py[i] += h*ny[i]; pz[i] += h*nz[i];
+    }
+  }
+
+  atomic_t displacementCallsN = 0;
+  atomic_t displacementErrorsN = 0;
+  atomic_t displacementPointsN = 0;
+
+  void displacementFuncN(RTCDisplacementArguments* args)
+  {
+    atomic_add(&displacementCallsN,1);
+    atomic_add(&displacementPointsN,args->N);
+    if (args->dPdu_x == nullptr || args->dPdv_x == nullptr || args->simdWidth == 0 || (size_t)args->px % 64) {
+      atomic_add(&displacementErrorsN,1);
+      return;
+    }
+
+    /* the normal has to be perpendicular to the derivatives */
+    for (size_t i=0; i<args->N; i++) 
+    {
+      const Vec3fa dPdu(args->dPdu_x[i],args->dPdu_y[i],args->dPdu_z[i]);
+      const Vec3fa dPdv(args->dPdv_x[i],args->dPdv_y[i],args->dPdv_z[i]);
+      const Vec3fa Ng(args->nx[i],args->ny[i],args->nz[i]);
+      const Vec3fa Nd = cross(dPdu,dPdv);
+      if (length(Nd) > 1E-4f && abs(dot(normalize(Nd),Ng)) < 0.9f)
+        atomic_add(&displacementErrorsN,1);
+    }
+
+    /* displace including the padding and report enlarged bounds */
+    BBox3fa bounds(empty);
+    for (size_t i=0; i<(args->N+args->simdWidth-1)/args->simdWidth*args->simdWidth; i++) 
+    {
+      const float h = displacementHeight(args->u[i],args->v[i]);
+      args->px[i] += h*args->nx[i]; args->py[i] += h*args->ny[i]; args->pz[i] += h*args->nz[i];
+      bounds.extend(Vec3fa(args->px[i],args->py[i],args->pz[i]));
+    }
+    for (size_t i=0; i<3; i++) {
+      args->lower[i] = bounds.lower[i]-0.25f;
+      args->upper[i] = bounds.upper[i]+0.25f;
+    }
+  }
+
+  bool rtcore_displacement_function_N(const char* cfg, bool lazy)
+  {
+    ClearBuffers clear_before_return;
+    RTCDevice device = rtcNewDevice(cfg);
+    bool passed = true;
+    displacementCallsN = displacementErrorsN = displacementPointsN = 0;
+    {
+      /* the reference uses the displacement function for single points */
+      RTCSceneRef scene0 = rtcDeviceNewScene(device,RTC_SCENE_STATIC,aflags);
+      RTCSceneRef scene1 = rtcDeviceNewScene(device,RTC_SCENE_STATIC,aflags);
+      srand(31); srand48(31); unsigned geom0 = addSubdivSphere(scene0,RTC_GEOMETRY_STATIC,zero,1.0f,6,4);
+      srand(31); srand48(31); unsigned geom1 = addSubdivSphere(scene1,RTC_GEOMETRY_STATIC,zero,1.0f,6,4);
+      rtcSetDisplacementFunction(scene0,geom0,displacementFunc1,nullptr);
+      rtcSetDisplacementFunctionN(scene1,geom1,displacementFuncN,RTC_DISPLACEMENT_DERIVATIVES);
+      rtcCommit(scene0);
+      rtcCommit(scene1);
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+
+      /* the lazy builder uses the bounds reported by the function */
+      RTCBounds bounds0; rtcGetBounds(scene0,bounds0);
+      RTCBounds bounds1; rtcGetBounds(scene1,bounds1);
+      if (lazy) passed &= bounds1.lower_x < bounds0.lower_x-0.2f && bounds1.upper_y > bounds0.upper_y+0.2f;
+      else      passed &= bounds1.lower_x <= bounds0.lower_x && bounds1.upper_y >= bounds0.upper_y;
+
+      size_t numHits = 0;
+      for (size_t y=0; y<32; y++) {
+        for (size_t x=0; x<32; x++) {
+          const Vec3fa org(-1.2f+2.4f*(x+0.5f)/32.0f,-1.2f+2.4f*(y+0.5f)/32.0f,-5.0f);
+          RTCRay ray0 = makeRay(org,Vec3fa(0,0,1)); rtcIntersect(scene0,ray0);
+          RTCRay ray1 = makeRay(org,Vec3fa(0,0,1)); rtcIntersect(scene1,ray1);
+          passed &= ray0.geomID == ray1.geomID && ray0.primID == ray1.primID;
+          if (ray0.geomID == RTC_INVALID_GEOMETRY_ID) continue;
+          passed &= abs(ray0.tfar-ray1.tfar) < 1E-4f;
+          numHits++;
+        }
+      }
+      passed &= numHits > 500;
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+    }
+    rtcDeleteDevice(device);
+    passed &= displacementCallsN > 0 && displacementErrorsN <= displacementPointsN/100;
+    return passed;
+  }
+  /* creates index and face buffers of a grid of num*num quads, and the vertices of a wavy plane at position x0 */
+  void makeSubdivGrid(size_t num, float x0, std::vector<int>& indices, std::vector<int>& faces, std::vector<Vec3fa>& vertices)
+  {
+    indices.clear(); faces.clear(); vertices.clear();
+    for (size_t y=0; y<=num; y++) {
+      for (size_t x=0; x<=num; x++) {
+        const float fx = float(x)/float(num), fy = float(y)/float(num);
+        vertices.push_back(Vec3fa(x0+2.0f*fx,2.0f*fy-1.0f,0.3f*sinf(7.0f*fx)*cosf(5.0f*fy)));
+      }
+    }
+    for (size_t y=0; y<num; y++) {
+      for (size_t x=0; x<num; x++) {
+        indices.push_back((y+0)*(num+1)+(x+0));
+        indices.push_back((y+0)*(num+1)+(x+1));
+        indices.push_back((y+1)*(num+1)+(x+1));
+        indices.push_back((y+1)*(num+1)+(x+0));
+        faces.push_back(4);
+      }
+    }
+  }
+
+  /* adds a subdivision mesh with own topology, and one with the shared topology */
+  void addTopologyMeshes(const RTCSceneRef& scene0, const RTCSceneRef& scene1, RTCSubdivTopology topology, size_t num, float x0, float rate, bool levels)
+  {
+    std::vector<int> indices, faces; std::vector<Vec3fa> vertices;
+    makeSubdivGrid(num,x0,indices,faces,vertices);
+
+    unsigned geom0 = rtcNewSubdivisionMesh(scene0,RTC_GEOMETRY_STATIC,faces.size(),indices.size(),vertices.size(),0,0,0);
+    memcpy(rtcMapBuffer(scene0,geom0,RTC_INDEX_BUFFER),indices.data(),indices.size()*sizeof(int));
+    memcpy(rtcMapBuffer(scene0,geom0,RTC_FACE_BUFFER),faces.data(),faces.size()*sizeof(int));
+    rtcUnmapBuffer(scene0,geom0,RTC_INDEX_BUFFER);
+    rtcUnmapBuffer(scene0,geom0,RTC_FACE_BUFFER);
+    rtcSetBoundaryMode(scene0,geom0,RTC_BOUNDARY_EDGE_AND_CORNER);
+
+    unsigned geom1 = rtcNewSubdivisionMeshWithTopology(scene1,RTC_GEOMETRY_STATIC,topology);
+
+    const RTCSceneRef* scenes[2] = { &scene0, &scene1 };
+    const unsigned geomIDs[2] = { geom0, geom1 };
+    for (size_t i=0; i<2; i++) 
+    {
+      const RTCSceneRef& scene = *scenes[i];
+      memcpy(rtcMapBuffer(scene,geomIDs[i],RTC_VERTEX_BUFFER),vertices.data(),vertices.size()*sizeof(Vec3fa));
+      rtcUnmapBuffer(scene,geomIDs[i],RTC_VERTEX_BUFFER);
+      rtcSetTessellationRate(scene,geomIDs[i],rate);
+      if (!levels) continue;
+      float* level = (float*) rtcMapBuffer(scene,geomIDs[i],RTC_LEVEL_BUFFER);
+      for (size_t j=0; j<indices.size(); j++) level[j] = 1.0f + float(j%5);
+      rtcUnmapBuffer(scene,geomIDs[i],RTC_LEVEL_BUFFER);
+    }
+  }
+
+  /* compares meshes with own and shared topology */
+  bool compareTopologyMeshes(RTCDevice device)
+  {
+    const size_t num = 8;
+    std::vector<int> indices, faces; std::vector<Vec3fa> vertices;
+    makeSubdivGrid(num,0.0f,indices,faces,vertices);
+    RTCSubdivTopology topology = rtcDeviceNewSubdivTopology(device,faces.size(),indices.size(),vertices.size(),0,0,0);
+    rtcSetSubdivTopologyBuffer(topology,RTC_INDEX_BUFFER,indices.data(),0,sizeof(int));
+    rtcSetSubdivTopologyBuffer(topology,RTC_FACE_BUFFER,faces.data(),0,sizeof(int));
+    rtcSetSubdivTopologyBoundaryMode(topology,RTC_BOUNDARY_EDGE_AND_CORNER);
+    rtcCommitSubdivTopology(topology);
+
+    bool passed = true;
+    {
+      /* meshes with the same uniform rate share their half edges, the mesh with levels has its own copy */
+      RTCSceneRef scene0 = rtcDeviceNewScene(device,RTC_SCENE_STATIC,aflags);
+      RTCSceneRef scene1 = rtcDeviceNewScene(device,RTC_SCENE_STATIC,aflags);
+      addTopologyMeshes(scene0,scene1,topology,num,-6.0f,2.0f,false);
+      addTopologyMeshes(scene0,scene1,topology,num,-3.0f,2.0f,false);
+      addTopologyMeshes(scene0,scene1,topology,num, 0.0f,5.0f,false);
+      addTopologyMeshes(scene0,scene1,topology,num, 3.0f,1.0f,true);
+
+      /* the meshes keep the topology alive */
+      rtcDeleteSubdivTopology(topology);
+      rtcCommit(scene0);
+      rtcCommit(scene1);
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+
+      size_t numHits = 0;
+      for (size_t y=0; y<32; y++) {
+        for (size_t x=0; x<128; x++) {
+          const Vec3fa org(-6.0f+11.0f*(x+0.5f)/128.0f,-1.0f+2.0f*(y+0.5f)/32.0f,-5.0f);
+          RTCRay ray0 = makeRay(org,Vec3fa(0,0,1)); rtcIntersect(scene0,ray0);
+          RTCRay ray1 = makeRay(org,Vec3fa(0,0,1)); rtcIntersect(scene1,ray1);
+          passed &= ray0.geomID == ray1.geomID && ray0.primID == ray1.primID;
+          if (ray0.geomID == RTC_INVALID_GEOMETRY_ID) continue;
+          passed &= abs(ray0.tfar-ray1.tfar) < 1E-4f;
+          numHits++;
+        }
+      }
+      passed &= numHits > 2000;
+    }
+    return passed;
+  }
+
+  bool rtcore_subdiv_topology()
+  {
+    ClearBuffers clear_before_return;
+    bool passed = compareTopologyMeshes(g_device);
+    RTCDevice device = rtcNewDevice("subdiv_accel=bvh4.grid.eager");
+    passed &= compareTopologyMeshes(device);
+    rtcDeleteDevice(device);
+    if (!passed) return false;
+
+    std::vector<int> indices, faces; std::vector<Vec3fa> vertices;
+    makeSubdivGrid(2,0.0f,indices,faces,vertices);
+    RTCSceneRef scene = rtcDeviceNewScene(g_device,RTC_SCENE_DYNAMIC,aflags);
+    RTCSubdivTopology topology = rtcDeviceNewSubdivTopology(g_device,faces.size(),indices.size(),vertices.size(),0,0,0);
+    AssertNoError();
+
+    /* the topology has to get committed before use */
+    rtcNewSubdivisionMeshWithTopology(scene,RTC_GEOMETRY_STATIC,topology);
+    AssertError(RTC_INVALID_OPERATION);
+
+    /* out of range indices are detected at commit */
+    indices[3] = (int) vertices.size();
+    rtcSetSubdivTopologyBuffer(topology,RTC_INDEX_BUFFER,indices.data(),0,sizeof(int));
+    rtcSetSubdivTopologyBuffer(topology,RTC_FACE_BUFFER,faces.data(),0,sizeof(int));
+    rtcCommitSubdivTopology(topology);
+    AssertError(RTC_INVALID_ARGUMENT);
+    indices[3] = 0;
+    rtcCommitSubdivTopology(topology);
+    AssertNoError();
+    rtcSetSubdivTopologyBuffer(topology,RTC_INDEX_BUFFER,indices.data(),0,sizeof(int));
+    AssertError(RTC_INVALID_OPERATION);
+
+    /* the topology buffers and boundary mode cannot get modified through the mesh */
+    unsigned geomID = rtcNewSubdivisionMeshWithTopology(scene,RTC_GEOMETRY_STATIC,topology);
+    AssertNoError();
+    rtcSetBuffer(scene,geomID,RTC_INDEX_BUFFER,indices.data(),0,sizeof(int));
+    AssertError(RTC_INVALID_OPERATION);
+    rtcMapBuffer(scene,geomID,RTC_FACE_BUFFER);
+    AssertError(RTC_INVALID_OPERATION);
+    rtcSetBoundaryMode(scene,geomID,RTC_BOUNDARY_NONE);
+    AssertError(RTC_INVALID_OPERATION);
+    rtcSetBuffer(scene,geomID,RTC_VERTEX_BUFFER,vertices.data(),0,sizeof(Vec3fa));
+    rtcCommit(scene);
+    AssertNoError();
+    rtcDeleteSubdivTopology(topology);
+    AssertNoError();
+    return true;
+  }
+
+
+  /* adds a plane [x0,x0+2]x[-1,1] that moves along z through the specified positions */
+  unsigned addMovingPlane (const RTCSceneRef& scene, bool quads, float x0, const std::vector<float>& z)
+  {
+    const size_t numTimeSteps = z.size();
+    unsigned geomID = quads ?
+      rtcNewQuadMesh(scene,RTC_GEOMETRY_STATIC,1,4,numTimeSteps) :
+      rtcNewTriangleMesh(scene,RTC_GEOMETRY_STATIC,2,4,numTimeSteps);
+    int* indices = (int*) rtcMapBuffer(scene,geomID,RTC_INDEX_BUFFER);
+    if (quads) { indices[0] = 0; indices[1] = 1; indices[2] = 2; indices[3] = 3; }
+    else       { indices[0] = 0; indices[1] = 1; indices[2] = 2; indices[3] = 0; indices[4] = 2; indices[5] = 3; }
+    rtcUnmapBuffer(scene,geomID,RTC_INDEX_BUFFER);
+    for (size_t t=0; t<numTimeSteps; t++)
+    {
+      const RTCBufferType type = (RTCBufferType) (RTC_VERTEX_BUFFER0+t);
+      Vec3fa* vertices = (Vec3fa*) rtcMapBuffer(scene,geomID,type);
+      vertices[0] = Vec3fa(x0+0.0f,-1.0f,z[t]);
+      vertices[1] = Vec3fa(x0+2.0f,-1.0f,z[t]);
+      vertices[2] = Vec3fa(x0+2.0f,+1.0f,z[t]);
+      vertices[3] = Vec3fa(x0+0.0f,+1.0f,z[t]);
+      rtcUnmapBuffer(scene,geomID,type);
+    }
+    return geomID;
+  }
+
+  /* position of a moving plane at the specified time */
+  float movingPlaneZ (const std::vector<float>& z, float time)
+  {
+    const float s = time*float(z.size()-1);
+    const size_t i = min(size_t(s),z.size()-2);
+    const float f = s-float(i);
+    return (1.0f-f)*z[i] + f*z[i+1];
+  }
+
+  bool rtcore_motion_blur_time_steps()
+  {
+    ClearBuffers clear_before_return;
+    RTCSceneRef scene = rtcDeviceNewScene(g_device,RTC_SCENE_STATIC,aflags);
+    AssertNoError();
+
+    const float x0[5] = { -10.0f, -6.0f, -2.0f, 2.0f, 6.0f };
+    std::vector<float> z[5];
+    z[0] = { 0.0f, 5.0f, -3.0f, 2.0f, 7.0f };
+    z[1] = { 0.0f, 5.0f, -3.0f, 2.0f, 7.0f };
+    z[2] = { 1.0f, 3.0f };
+    z[3] = { 0.0f, 4.0f, 0.0f };
+    z[4] = { 2.0f, -2.0f, 6.0f };
+    addMovingPlane(scene,false,x0[0],z[0]);
+    addMovingPlane(scene,true ,x0[1],z[1]);
+    addMovingPlane(scene,false,x0[2],z[2]);
+    addMovingPlane(scene,false,x0[3],z[3]);
+    addMovingPlane(scene,true ,x0[4],z[4]);
+    rtcCommit (scene);
+    AssertNoError();
+
+    bool passed = true;
+    for (size_t i=0; i<1000; i++)
+    {
+      const size_t g = i%5;
+      const float time = float(drand48());
+      const float tfar = 100.0f+movingPlaneZ(z[g],time);
+      RTCRay ray = makeRay(Vec3fa(x0[g]+1.0f,0.3f,-100.0f),Vec3fa(0,0,1));
+      ray.time = time;
+      rtcIntersect(scene,ray);
+      passed &= ray.geomID == g && fabs(ray.tfar-tfar) < 1E-3f;
+
+      RTCRay shadow0 = makeRay(Vec3fa(x0[g]+1.0f,0.3f,-100.0f),Vec3fa(0,0,1),0.0f,tfar-0.01f);
+      RTCRay shadow1 = makeRay(Vec3fa(x0[g]+1.0f,0.3f,-100.0f),Vec3fa(0,0,1),0.0f,tfar+0.01f);
+      shadow0.time = shadow1.time = time;
+      rtcOccluded(scene,shadow0);
+      rtcOccluded(scene,shadow1);
+      passed &= shadow0.geomID == -1 && shadow1.geomID == 0;
+    }
+
+#if HAS_INTERSECT4
+    /* rays of a packet hit different time segments */
+    for (size_t i=0; i<250; i++)
+    {
+      RTCRay4 ray4; memset(&ray4,0,sizeof(ray4));
+      size_t g[4]; float tfar[4];
+      for (size_t k=0; k<4; k++)
+      {
+        g[k] = (i+k)%5;
+        RTCRay ray = makeRay(Vec3fa(x0[g[k]]+1.0f,0.3f,-100.0f),Vec3fa(0,0,1));
+        ray.time = float(drand48());
+        tfar[k] = 100.0f+movingPlaneZ(z[g[k]],ray.time);
+        setRay(ray4,k,ray);
+      }
+      __aligned(16) int valid4[4] = { -1,-1,-1,-1 };
+      rtcIntersect4(valid4,scene,ray4);
+      for (size_t k=0; k<4; k++)
+        passed &= ray4.geomID[k] == g[k] && fabs(ray4.tfar[k]-tfar[k]) < 1E-3f;
+    }
+#endif
+    AssertNoError();
+    return passed;
+  }
+
+  bool rtcore_motion_blur_non_dividing_time_steps()
+  {
+    ClearBuffers clear_before_return;
+    RTCSceneRef scene = rtcDeviceNewScene(g_device,RTC_SCENE_STATIC,aflags);
+    AssertNoError();
+
+    /* the 3 and 2 time segments of the last meshes do not divide the 4 time segments of the first mesh */
+    const float x0[3] = { -6.0f, -2.0f, 2.0f };
+    std::vector<float> z[3];
+    z[0] = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f };
+    z[1] = { 0.0f, 8.0f, -4.0f, 4.0f };
+    z[2] = { 0.0f, 12.0f };
+    addMovingPlane(scene,false,x0[0],z[0]);
+    addMovingPlane(scene,false,x0[1],z[1]);
+    addMovingPlane(scene,false,x0[2],z[2]);
+    rtcCommit (scene);
+    AssertNoError();
+
+    bool passed = true;
+    for (size_t i=0; i<1000; i++)
+    {
+      const size_t g = i%3;
+      const float time = i < 6 ? float(i/3)/3.0f : float(drand48()); // also hit the timesteps of the second mesh
+      const float tfar = 100.0f+movingPlaneZ(z[g],time);
+      RTCRay ray = makeRay(Vec3fa(x0[g]+1.0f,0.3f,-100.0f),Vec3fa(0,0,1));
+      ray.time = time;
+      rtcIntersect(scene,ray);
+      passed &= ray.geomID == g && fabs(ray.tfar-tfar) < 1E-3f;
+
+      RTCRay shadow0 = makeRay(Vec3fa(x0[g]+1.0f,0.3f,-100.0f),Vec3fa(0,0,1),0.0f,tfar-0.01f);
+      RTCRay shadow1 = makeRay(Vec3fa(x0[g]+1.0f,0.3f,-100.0f),Vec3fa(0,0,1),0.0f,tfar+0.01f);
+      shadow0.time = shadow1.time = time;
+      rtcOccluded(scene,shadow0);
+      rtcOccluded(scene,shadow1);
+      passed &= shadow0.geomID == -1 && shadow1.geomID == 0;
+    }
+
+#if HAS_INTERSECT4
+    for (size_t i=0; i<250; i++)
+    {
+      RTCRay4 ray4; memset(&ray4,0,sizeof(ray4));
+      size_t g[4]; float tfar[4];
+      for (size_t k=0; k<4; k++)
+      {
+        g[k] = (i+k)%3;
+        RTCRay ray = makeRay(Vec3fa(x0[g[k]]+1.0f,0.3f,-100.0f),Vec3fa(0,0,1));
+        ray.time = float(drand48());
+        tfar[k] = 100.0f+movingPlaneZ(z[g[k]],ray.time);
+        setRay(ray4,k,ray);
+      }
+      __aligned(16) int valid4[4] = { -1,-1,-1,-1 };
+      rtcIntersect4(valid4,scene,ray4);
+      for (size_t k=0; k<4; k++)
+        passed &= ray4.geomID[k] == g[k] && fabs(ray4.tfar[k]-tfar[k]) < 1E-3f;
+    }
+#endif
+    AssertNoError();
+    return passed;
+  }
+
+  /* builds a forest -> tree -> branch -> leaf hierarchy of nested scene instances */
+  RTCScene addNestedInstances(RTCSceneRef* scenes, RTCSceneFlags sflags)
+  {
+    scenes[0] = rtcDeviceNewScene(g_device,sflags,aflags);
+    addSphere(scenes[0],RTC_GEOMETRY_STATIC,zero,0.5f,10);
+    rtcCommit (scenes[0]);
+
+    for (size_t l=1; l<4; l++)
+    {
+      scenes[l] = rtcDeviceNewScene(g_device,sflags,aflags);
+      addSphere(scenes[l],RTC_GEOMETRY_STATIC,zero,0.3f,10);
+      for (size_t k=0; k<3; k++) 
+      {
+        const AffineSpace3fa xfm = AffineSpace3fa::translate(Vec3fa(float(k)-1.0f,0.5f,0.0f)) 
+          * AffineSpace3fa::rotate(Vec3fa(0,1,0),float(k+l)) * AffineSpace3fa::scale(Vec3fa(0.4f));
+        unsigned instID = rtcNewInstance2(scenes[l],scenes[l-1]);
+        rtcSetTransform2(scenes[l],instID,RTC_MATRIX_COLUMN_MAJOR_ALIGNED16,(float*)&xfm);
+      }
+      rtcCommit (scenes[l]);
+    }
+    return scenes[3];
+  }
+
+  bool rtcore_nested_instancing()
+  {
+    ClearBuffers clear_before_return;
+    RTCSceneRef scenes0[4] = { nullptr, nullptr, nullptr, nullptr };
+    RTCSceneRef scenes1[4] = { nullptr, nullptr, nullptr, nullptr };
+    RTCScene scene0 = addNestedInstances(scenes0,RTC_SCENE_STATIC);
+    RTCScene scene1 = addNestedInstances(scenes1,RTCSceneFlags(RTC_SCENE_STATIC | RTC_SCENE_INSTANCED));
+    AssertNoError();
+
+    /* native traversal has to give the same hits as traversal through instance callbacks */
+    bool passed = true;
+    for (size_t i=0; i<1000; i++)
+    {
+      const Vec3fa org(2.0f*drand48()-1.0f,2.0f*drand48()-1.0f,-2.0f);
+      const Vec3fa dir(0.5f*drand48()-0.25f,0.5f*drand48()-0.25f,1.0f);
+      RTCRay ray0 = makeRay(org,dir); rtcIntersect(scene0,ray0);
+      RTCRay ray1 = makeRay(org,dir); rtcIntersect(scene1,ray1);
+      passed &= ray0.geomID == ray1.geomID && ray0.primID == ray1.primID && ray0.instID == ray1.instID;
+      passed &= ray0.geomID == -1 || fabs(ray0.tfar-ray1.tfar) < 1E-4f;
+
+      RTCRay shadow0 = makeRay(org,dir); rtcOccluded(scene0,shadow0);
+      RTCRay shadow1 = makeRay(org,dir); rtcOccluded(scene1,shadow1);
+      passed &= shadow0.geomID == shadow1.geomID;
+    }
+
+#if HAS_INTERSECT4
+    for (size_t i=0; i<250; i++)
+    {
+      RTCRay4 ray4; memset(&ray4,0,sizeof(ray4));
+      RTCRay rays[4];
+      for (size_t k=0; k<4; k++)
+      {
+        const Vec3fa org(2.0f*drand48()-1.0f,2.0f*drand48()-1.0f,-2.0f);
+        const Vec3fa dir(0.5f*drand48()-0.25f,0.5f*drand48()-0.25f,1.0f);
+        rays[k] = makeRay(org,dir); rtcIntersect(scene0,rays[k]);
+        setRay(ray4,k,makeRay(org,dir));
+      }
+      __aligned(16) int valid4[4] = { -1,-1,-1,-1 };
+      rtcIntersect4(valid4,scene1,ray4);
+      for (size_t k=0; k<4; k++) {
+        passed &= ray4.geomID[k] == rays[k].geomID && ray4.primID[k] == rays[k].primID && ray4.instID[k] == rays[k].instID;
+        passed &= rays[k].geomID == -1 || fabs(ray4.tfar[k]-rays[k].tfar) < 1E-4f;
+      }
+    }
+#endif
+    AssertNoError();
+    return passed;
+  }
+
   bool rtcore_buffer_stride()
   {
     ClearBuffers clear_before_return;
@@ -1439,107 +2442,625 @@ namespace embree
     rtcUpdate(scene,mesh);
   }
 
-  void move_mesh_vec3fa(const RTCSceneRef& scene, unsigned mesh, size_t numVertices, Vec3fa& pos) 
+  void move_mesh_vec3fa(const RTCSceneRef& scene, unsigned mesh, size_t numVertices, Vec3fa& pos) 
+  {
+    Vertex3fa* vertices = (Vertex3fa*) rtcMapBuffer(scene,mesh,RTC_VERTEX_BUFFER); 
+    for (size_t i=0; i<numVertices; i++) vertices[i] += Vertex3fa(pos);
+    rtcUnmapBuffer(scene,mesh,RTC_VERTEX_BUFFER);
+    rtcUpdate(scene,mesh);
+  }
+  
+  bool rtcore_update(RTCGeometryFlags flags)
+  {
+    ClearBuffers clear_before_return;
+    RTCSceneRef scene = rtcDeviceNewScene(g_device,RTC_SCENE_DYNAMIC,aflags);
+    AssertNoError();
+    size_t numPhi = 50;
+    size_t numVertices = 2*numPhi*(numPhi+1);
+    Vec3fa pos0 = Vec3fa(-10,0,-10);
+    Vec3fa pos1 = Vec3fa(-10,0,+10);
+    Vec3fa pos2 = Vec3fa(+10,0,-10);
+    Vec3fa pos3 = Vec3fa(+10,0,+10);
+    unsigned geom0 = addSphere(scene,flags,pos0,1.0f,numPhi);
+    unsigned geom1 = addHair  (scene,flags,pos1,1.0f,1.0f,1);
+    unsigned geom2 = addSphere(scene,flags,pos2,1.0f,numPhi);
+    unsigned geom3 = addHair  (scene,flags,pos3,1.0f,1.0f,1);
+    AssertNoError();
+    
+    for (size_t i=0; i<16; i++) 
+    {
+      bool move0 = i & 1, move1 = i & 2, move2 = i & 4, move3 = i & 8;
+      Vec3fa ds(2,0.1f,2);
+      if (move0) { move_mesh_vec3f (scene,geom0,numVertices,ds); pos0 += ds; }
+      if (move1) { move_mesh_vec3fa(scene,geom1,4,ds); pos1 += ds; }
+      if (move2) { move_mesh_vec3f (scene,geom2,numVertices,ds); pos2 += ds; }
+      if (move3) { move_mesh_vec3fa(scene,geom3,4,ds); pos3 += ds; }
+      rtcCommit (scene);
+      AssertNoError();
+      {
+        RTCRay ray0 = makeRay(pos0+Vec3fa(0,10,0),Vec3fa(0,-1,0)); 
+        RTCRay ray1 = makeRay(pos1+Vec3fa(0,10,0),Vec3fa(0,-1,0)); 
+        RTCRay ray2 = makeRay(pos2+Vec3fa(0,10,0),Vec3fa(0,-1,0)); 
+        RTCRay ray3 = makeRay(pos3+Vec3fa(0,10,0),Vec3fa(0,-1,0)); 
+        rtcIntersect(scene,ray0);
+        rtcIntersect(scene,ray1);
+        rtcIntersect(scene,ray2);
+        rtcIntersect(scene,ray3);
+        if (ray0.geomID != 0 || 
+            ray1.geomID != 1 || 
+            ray2.geomID != 2 || 
+            ray3.geomID != 3) return false;
+
+#if HAS_INTERSECT4
+        RTCRay4 ray4; memset(&ray4,0,sizeof(ray4));
+        setRay(ray4,0,ray0);
+        setRay(ray4,1,ray1);
+        setRay(ray4,2,ray2);
+        setRay(ray4,3,ray3);
+        __aligned(16) int valid4[4] = { -1,-1,-1,-1 };
+        rtcIntersect4(valid4,scene,ray4);
+        if (ray4.geomID[0] != 0 || 
+            ray4.geomID[1] != 1 || 
+            ray4.geomID[2] != 2 || 
+            ray4.geomID[3] != 3) return false;
+#endif
+
+#if HAS_INTERSECT8
+        if (hasISA(AVX)) 
+        {
+          RTCRay8 ray8; memset(&ray8,0,sizeof(ray8));
+          setRay(ray8,0,ray0);
+          setRay(ray8,1,ray1);
+          setRay(ray8,2,ray2);
+          setRay(ray8,3,ray3);
+          __aligned(32) int valid8[8] = { -1,-1,-1,-1, 0, 0, 0, 0 };
+          rtcIntersect8(valid8,scene,ray8);
+          if (ray8.geomID[0] != 0 || 
+              ray8.geomID[1] != 1 || 
+              ray8.geomID[2] != 2 || 
+              ray8.geomID[3] != 3) return false;
+        }
+#endif
+
+#if HAS_INTERSECT16
+        if (hasISA(AVX512KNL) || hasISA(KNC)) 
+        {
+          RTCRay16 ray16; memset(&ray16,0,sizeof(ray16));
+          setRay(ray16,0,ray0);
+          setRay(ray16,1,ray1);
+          setRay(ray16,2,ray2);
+          setRay(ray16,3,ray3);
+          __aligned(64) int valid16[16] = { -1,-1,-1,-1,+0,+0,+0,+0, 
+                                            +0,+0,+0,+0,+0,+0,+0,+0 };
+          rtcIntersect16(valid16,scene,ray16);
+          if (ray16.geomID[0] != 0 || 
+              ray16.geomID[1] != 1 || 
+              ray16.geomID[2] != 2 || 
+              ray16.geomID[3] != 3) return false;
+        }
+#endif
+      }
+    }
+    scene = nullptr;
+    return true;
+  }
+
+  bool rtcore_update_many(RTCGeometryFlags flags)
+  {
+    ClearBuffers clear_before_return;
+    RTCSceneRef scene = rtcDeviceNewScene(g_device,RTC_SCENE_DYNAMIC,aflags);
+    AssertNoError();
+    size_t numPhi = 5;
+    size_t numVertices = 2*numPhi*(numPhi+1);
+    Vec3fa pos[64];
+    for (size_t i=0; i<64; i++) {
+      pos[i] = Vec3fa(4.0f*(i%8),0.0f,4.0f*(i/8));
+      addSphere(scene,flags,pos[i],1.0f,numPhi);
+    }
+    rtcCommit (scene);
+    AssertNoError();
+
+    /* move few objects per commit, sometimes across the scene to degrade the toplevel hierarchy */
+    for (size_t i=0; i<32; i++) 
+    {
+      const unsigned geomID = (7*i)%64;
+      Vec3fa ds(0.5f,0.1f,-0.5f);
+      if (i%4 == 3) ds = Vec3fa(30.0f-2.0f*pos[geomID].x,0.0f,30.0f-2.0f*pos[geomID].z);
+      move_mesh_vec3f(scene,geomID,numVertices,ds); pos[geomID] += ds;
+      rtcCommit (scene);
+      AssertNoError();
+
+      for (size_t j=0; j<64; j++) {
+        RTCRay ray = makeRay(pos[j]+Vec3fa(0,10,0),Vec3fa(0,-1,0));
+        rtcIntersect(scene,ray);
+        if (ray.geomID != j) return false;
+      }
+    }
+    scene = nullptr;
+    return true;
+  }
+
+  struct CommitAsyncState 
+  {
+    volatile atomic_t done;
+    RTCError error;
+  };
+
+  void commitAsyncComplete(void* ptr, RTCScene scene, RTCError error)
+  {
+    CommitAsyncState* state = (CommitAsyncState*) ptr;
+    state->error = error;
+    __memory_barrier();
+    state->done = 1;
+  }
+
+  bool rtcore_commit_async(RTCSceneFlags sflags, RTCGeometryFlags gflags)
+  {
+    ClearBuffers clear_before_return;
+    RTCSceneRef scene = rtcDeviceNewScene(g_device,sflags,aflags);
+    AssertNoError();
+    size_t numPhi = 20;
+    size_t numVertices = 2*numPhi*(numPhi+1);
+    Vec3fa pos[16];
+    for (size_t i=0; i<16; i++) {
+      pos[i] = Vec3fa(4.0f*(i%4),0.0f,4.0f*(i/4));
+      addSphere(scene,gflags,pos[i],1.0f,numPhi);
+    }
+
+    /* first commit builds the scene in place */
+    CommitAsyncState state; state.done = 0; state.error = RTC_UNKNOWN_ERROR;
+    rtcCommitAsync(scene,commitAsyncComplete,&state);
+    AssertNoError();
+    while (!state.done) yield();
+    if (state.error != RTC_NO_ERROR) return false;
+    
+    for (size_t i=0; i<(sflags == RTC_SCENE_STATIC ? 0 : 8); i++)
+    {
+      const unsigned geomID = (5*i)%16;
+      Vec3fa ds(0.0f,0.0f,100.0f);
+      move_mesh_vec3f(scene,geomID,numVertices,ds); 
+      state.done = 0; state.error = RTC_UNKNOWN_ERROR;
+      rtcCommitAsync(scene,commitAsyncComplete,&state);
+      AssertNoError();
+
+      /* the previously committed scene stays traceable during the build */
+      while (!state.done) 
+      {
+        for (size_t j=0; j<16; j++) {
+          RTCRay ray = makeRay(pos[j]+Vec3fa(0,10,0),Vec3fa(0,-1,0));
+          rtcIntersect(scene,ray);
+          if (j != geomID && ray.geomID != j) return false;
+          if (j == geomID && ray.geomID != j && ray.geomID != -1) return false;
+        }
+      }
+      if (state.error != RTC_NO_ERROR) return false;
+      pos[geomID] += ds;
+      
+      for (size_t j=0; j<16; j++) {
+        RTCRay ray = makeRay(pos[j]+Vec3fa(0,10,0),Vec3fa(0,-1,0));
+        rtcIntersect(scene,ray);
+        if (ray.geomID != j) return false;
+      }
+    }
+
+    /* a deleted geometry stays valid for the previous scene until the commit finished */
+    if (sflags != RTC_SCENE_STATIC)
+    {
+      const unsigned geomID = 7;
+      rtcDeleteGeometry(scene,geomID);
+      AssertNoError();
+      state.done = 0; state.error = RTC_UNKNOWN_ERROR;
+      rtcCommitAsync(scene,commitAsyncComplete,&state);
+      AssertNoError();
+      while (!state.done)
+      {
+        for (size_t j=0; j<16; j++) {
+          RTCRay ray = makeRay(pos[j]+Vec3fa(0,10,0),Vec3fa(0,-1,0));
+          rtcIntersect(scene,ray);
+          if (j != geomID && ray.geomID != j) return false;
+        }
+      }
+      if (state.error != RTC_NO_ERROR) return false;
+
+      for (size_t j=0; j<16; j++) {
+        RTCRay ray = makeRay(pos[j]+Vec3fa(0,10,0),Vec3fa(0,-1,0));
+        rtcIntersect(scene,ray);
+        if (ray.geomID != (j == geomID ? RTC_INVALID_GEOMETRY_ID : j)) return false;
+      }
+    }
+
+    /* synchronous commit after an asynchronous one */
+    rtcCommit (scene);
+    AssertNoError();
+    scene = nullptr;
+    return true;
+  }
+
+  bool rtcore_compressed_triangles_commit_async()
+  {
+    ClearBuffers clear_before_return;
+    RTCDevice device0 = rtcNewDevice("tri_accel=bvh4.triangle4i");
+    RTCDevice device = rtcNewDevice("tri_accel=bvh4.triangle4c");
+    bool passed = true;
+    {
+      const size_t numTriangles = 2*299*239;
+      RTCSceneRef scene0 = rtcDeviceNewScene(device0,RTC_SCENE_DYNAMIC,aflags);
+      RTCSceneRef scene1 = rtcDeviceNewScene(device,RTC_SCENE_DYNAMIC,aflags);
+      srand48(17); unsigned grid0 = addShuffledGrid(scene0,RTC_GEOMETRY_DYNAMIC,300,240);
+      srand48(17); unsigned grid1 = addShuffledGrid(scene1,RTC_GEOMETRY_DYNAMIC,300,240);
+      rtcCommit (scene0);
+      rtcCommit (scene1);
+
+      for (size_t iter=0; iter<4 && passed; iter++)
+      {
+        /* the build encodes the reversed index buffer while the previous encoding stays traceable */
+        Triangle* triangles1 = (Triangle*) rtcMapBuffer(scene1,grid1,RTC_INDEX_BUFFER);
+        std::reverse(triangles1,triangles1+numTriangles);
+        rtcUnmapBuffer(scene1,grid1,RTC_INDEX_BUFFER);
+        rtcUpdateBuffer(scene1,grid1,RTC_INDEX_BUFFER);
+        CommitAsyncState state; state.done = 0; state.error = RTC_UNKNOWN_ERROR;
+        rtcCommitAsync(scene1,commitAsyncComplete,&state);
+
+        /* rays traced during the build have to see either the previous or the new triangles */
+        std::vector<RTCRay> rays, hits;
+        std::vector<bool> previous;
+        while (!state.done)
+        {
+          if (rays.size() >= 100000) continue;
+          const Vec3fa org(2.0f*drand48()-1.0f,2.0f*drand48()-1.0f,2.0f);
+          const Vec3fa dir(0.5f*drand48()-0.25f,0.5f*drand48()-0.25f,-1.0f);
+          RTCRay ray0 = makeRay(org,dir); rtcIntersect(scene0,ray0);
+          RTCRay ray1 = makeRay(org,dir); rtcIntersect(scene1,ray1);
+          rays.push_back(makeRay(org,dir)); hits.push_back(ray1);
+          previous.push_back(ray0.geomID == ray1.geomID && ray0.primID == ray1.primID && ray0.tfar == ray1.tfar);
+        }
+        passed &= state.error == RTC_NO_ERROR;
+
+        Triangle* triangles0 = (Triangle*) rtcMapBuffer(scene0,grid0,RTC_INDEX_BUFFER);
+        std::reverse(triangles0,triangles0+numTriangles);
+        rtcUnmapBuffer(scene0,grid0,RTC_INDEX_BUFFER);
+        rtcUpdateBuffer(scene0,grid0,RTC_INDEX_BUFFER);
+        rtcCommit (scene0);
+
+        /* once a ray saw the new triangles all later rays have to see them too, only 
+         * rays traced while the encoding and the acceleration structures get swapped 
+         * may see a mix of both */
+        bool swapped = false;
+        size_t numMixed = 0;
+        for (size_t i=0; i<rays.size(); i++) 
+        {
+          RTCRay ray0 = rays[i]; rtcIntersect(scene0,ray0);
+          const bool current = ray0.geomID == hits[i].geomID && ray0.primID == hits[i].primID && ray0.tfar == hits[i].tfar;
+          numMixed += !previous[i] && !current;
+          passed &= !swapped || current;
+          swapped |= current && !previous[i];
+        }
+        passed &= numMixed <= 2;
+
+        for (size_t i=0; i<1000; i++)
+        {
+          const Vec3fa org(2.0f*drand48()-1.0f,2.0f*drand48()-1.0f,2.0f);
+          const Vec3fa dir(0.5f*drand48()-0.25f,0.5f*drand48()-0.25f,-1.0f);
+          RTCRay ray0 = makeRay(org,dir); rtcIntersect(scene0,ray0);
+          RTCRay ray1 = makeRay(org,dir); rtcIntersect(scene1,ray1);
+          passed &= ray0.geomID == ray1.geomID && ray0.primID == ray1.primID && ray0.tfar == ray1.tfar;
+        }
+      }
+      passed &= rtcDeviceGetError(device0) == RTC_NO_ERROR;
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+    }
+    rtcDeleteDevice(device0);
+    rtcDeleteDevice(device);
+    return passed;
+  }
+
+  bool rtcore_stream_reorder(RTCSceneFlags sflags)
+  {
+    ClearBuffers clear_before_return;
+    RTCSceneRef scene = rtcDeviceNewScene(g_device,sflags,RTCAlgorithmFlags(aflags | RTC_INTERSECTN));
+    AssertNoError();
+    srand48(4235);
+    for (size_t i=0; i<16; i++) {
+      const Vec3fa pos = 16.0f*Vec3fa(drand48(),drand48(),drand48())-Vec3fa(8.0f);
+      addSphere(scene,RTC_GEOMETRY_STATIC,pos,1.0f+float(drand48()),20);
+    }
+    rtcCommit (scene);
+    AssertNoError();
+
+    /* incoherent rays, some of them invalid */
+    const size_t N = 2500;
+    RTCRay* rays = (RTCRay*) alignedMalloc(N*sizeof(RTCRay));
+    RTCRay* reference = (RTCRay*) alignedMalloc(N*sizeof(RTCRay));
+    for (size_t i=0; i<N; i++) {
+      const Vec3fa org = 20.0f*Vec3fa(drand48(),drand48(),drand48())-Vec3fa(10.0f);
+      const Vec3fa dir = 2.0f*Vec3fa(drand48(),drand48(),drand48())-Vec3fa(1.0f);
+      reference[i] = i%17 == 0 ? makeRay(org,dir,1.0f,0.0f) : makeRay(org,dir);
+    }
+
+    bool passed = true;
+    for (size_t intersect=0; intersect<2 && passed; intersect++)
+    {
+      /* AOS stream */
+      for (size_t i=0; i<N; i++) rays[i] = reference[i];
+      if (intersect) rtcIntersectN(scene,rays,N,sizeof(RTCRay),RTC_RAYN_REORDER);
+      else           rtcOccludedN (scene,rays,N,sizeof(RTCRay),RTC_RAYN_REORDER);
+      AssertNoError();
+
+      /* SOA layout with 2 streams */
+      std::vector<float> orgx(N), orgy(N), orgz(N), dirx(N), diry(N), dirz(N), tnear(N), tfar(N), time(N), Ngx(N), Ngy(N), Ngz(N), u(N), v(N);
+      std::vector<unsigned> mask(N), geomID(N), primID(N), instID(N);
+      for (size_t i=0; i<N; i++) {
+        orgx[i] = reference[i].org[0]; orgy[i] = reference[i].org[1]; orgz[i] = reference[i].org[2];
+        dirx[i] = reference[i].dir[0]; diry[i] = reference[i].dir[1]; dirz[i] = reference[i].dir[2];
+        tnear[i] = reference[i].tnear; tfar[i] = reference[i].tfar; time[i] = 0.0f; mask[i] = -1;
+        geomID[i] = primID[i] = instID[i] = -1;
+      }
+      RTCRaySOA soa;
+      soa.orgx = orgx.data(); soa.orgy = orgy.data(); soa.orgz = orgz.data(); 
+      soa.dirx = dirx.data(); soa.diry = diry.data(); soa.dirz = dirz.data(); 
+      soa.tnear = tnear.data(); soa.tfar = tfar.data(); soa.time = time.data(); soa.mask = mask.data();
+      soa.Ngx = Ngx.data(); soa.Ngy = Ngy.data(); soa.Ngz = Ngz.data(); soa.u = u.data(); soa.v = v.data();
+      soa.geomID = geomID.data(); soa.primID = primID.data(); soa.instID = instID.data();
+      if (intersect) rtcIntersectN_SOA(scene,soa,N/2,2,N/2*sizeof(float),RTC_RAYN_REORDER);
+      else           rtcOccludedN_SOA (scene,soa,N/2,2,N/2*sizeof(float),RTC_RAYN_REORDER);
+      AssertNoError();
+
+      /* results have to land at the original ray locations */
+      for (size_t i=0; i<N; i++) 
+      {
+        RTCRay ray = reference[i];
+        if (intersect) rtcIntersect(scene,ray);
+        else           rtcOccluded (scene,ray);
+        if (intersect) {
+          passed &= rays[i].geomID == ray.geomID && rays[i].primID == ray.primID;
+          passed &= geomID[i] == ray.geomID && primID[i] == ray.primID;
+          if (ray.geomID != RTC_INVALID_GEOMETRY_ID) {
+            passed &= abs(rays[i].tfar-ray.tfar) <= 1E-4f*ray.tfar;
+            passed &= abs(tfar[i]-ray.tfar) <= 1E-4f*ray.tfar;
+          }
+        } else {
+          passed &= (rays[i].geomID == 0) == (ray.geomID == 0);
+          passed &= (geomID[i] == 0) == (ray.geomID == 0);
+        }
+      }
+    }
+    
+    alignedFree(rays);
+    alignedFree(reference);
+    scene = nullptr;
+    return passed;
+  }
+
+  bool rtcore_persistent_tessellation_cache()
+  {
+    ClearBuffers clear_before_return;
+    const char* filename = "verify_tessellation_cache.bin";
+    remove(filename);
+
+    /* first device fills the cache file, the second one restores all grids from it */
+    const std::string cfg = std::string("subdiv_accel=bvh4.subdivpatch1cached,tessellation_cache_size=1,tessellation_cache_file=\"") + filename + "\",tessellation_cache_file_size=64";
+    RTCDevice device0 = rtcNewDevice("subdiv_accel=bvh4.subdivpatch1cached");
+    RTCDevice devices[2] = { rtcNewDevice(cfg.c_str()), nullptr };
+    bool passed = devices[0] != nullptr;
+    for (size_t d=0; d<2 && passed; d++)
+    {
+      if (d == 1) {
+        rtcDeleteDevice(devices[0]); devices[0] = nullptr;
+        devices[1] = rtcNewDevice(cfg.c_str());
+        passed &= devices[1] != nullptr;
+        if (!passed) break;
+      }
+      RTCDevice device = devices[d];
+
+      /* the second plane uses the default tessellation rate and thus grids consisting of a single leaf */
+      RTCSceneRef scenes[2] = { rtcDeviceNewScene(device0,RTC_SCENE_STATIC,aflags), rtcDeviceNewScene(device,RTC_SCENE_STATIC,aflags) };
+      for (size_t i=0; i<2; i++)
+      {
+        unsigned geomID = addSubdivPlane(scenes[i],RTC_GEOMETRY_STATIC,8,Vec3fa(-1.0f,-1.0f,0.0f),Vec3fa(2.0f,0.0f,0.5f),Vec3fa(0.0f,2.0f,0.5f));
+        rtcSetTessellationRate(scenes[i],geomID,16.0f);
+        addSubdivPlane(scenes[i],RTC_GEOMETRY_STATIC,4,Vec3fa(-1.0f,-1.0f,-0.5f),Vec3fa(2.0f,0.0f,0.0f),Vec3fa(0.0f,2.0f,0.0f));
+        rtcCommit (scenes[i]);
+      }
+      RTCSceneRef& scene0 = scenes[0];
+      RTCSceneRef& scene1 = scenes[1];
+      passed &= rtcDeviceGetError(device0) == RTC_NO_ERROR;
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+
+      for (size_t i=0; i<1000; i++)
+      {
+        const Vec3fa org(4.0f*drand48()-2.0f,4.0f*drand48()-2.0f,4.0f*drand48()-2.0f);
+        const Vec3fa dir(2.0f*drand48()-1.0f,2.0f*drand48()-1.0f,2.0f*drand48()-1.0f);
+        RTCRay ray0 = makeRay(org,dir); rtcIntersect(scene0,ray0);
+        RTCRay ray1 = makeRay(org,dir); rtcIntersect(scene1,ray1);
+        passed &= ray0.geomID == ray1.geomID && ray0.primID == ray1.primID && ray0.tfar == ray1.tfar;
+      }
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+    }
+    if (devices[0]) rtcDeleteDevice(devices[0]);
+    if (devices[1]) rtcDeleteDevice(devices[1]);
+    rtcDeleteDevice(device0);
+    remove(filename);
+    return passed;
+  }
+
+  bool rtcore_morton64_builder()
+  {
+    ClearBuffers clear_before_return;
+    RTCDevice device = rtcNewDevice("tri_accel=bvh4.triangle4,tri_builder=morton64");
+    bool passed = device != nullptr;
+    {
+      /* the small sphere inside the large one produces many primitives with identical 32 bit codes */
+      RTCSceneRef scenes[2] = { rtcDeviceNewScene(g_device,RTC_SCENE_STATIC,aflags), rtcDeviceNewScene(device,RTC_SCENE_STATIC,aflags) };
+      for (size_t i=0; i<2; i++) {
+        addSphere(scenes[i],RTC_GEOMETRY_STATIC,Vec3fa(0.0f,0.0f,0.0f),1000.0f,100);
+        addSphere(scenes[i],RTC_GEOMETRY_STATIC,Vec3fa(1.0f,0.0f,0.0f),0.01f,200);
+        rtcCommit (scenes[i]);
+      }
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+
+      for (size_t i=0; i<1000; i++)
+      {
+        const Vec3fa org(1.0f+0.02f*drand48()-0.01f,0.02f*drand48()-0.01f,-1.0f);
+        const Vec3fa dir(0.01f*drand48()-0.005f,0.01f*drand48()-0.005f,1.0f);
+        RTCRay ray0 = makeRay(org,dir); rtcIntersect(scenes[0],ray0);
+        RTCRay ray1 = makeRay(org,dir); rtcIntersect(scenes[1],ray1);
+        passed &= ray0.geomID == ray1.geomID && ray0.primID == ray1.primID && ray0.tfar == ray1.tfar;
+      }
+    }
+    rtcDeleteDevice(device);
+    return passed;
+  }
+
+  bool rtcore_numa_replication()
   {
-    Vertex3fa* vertices = (Vertex3fa*) rtcMapBuffer(scene,mesh,RTC_VERTEX_BUFFER); 
-    for (size_t i=0; i<numVertices; i++) vertices[i] += Vertex3fa(pos);
-    rtcUnmapBuffer(scene,mesh,RTC_VERTEX_BUFFER);
-    rtcUpdate(scene,mesh);
+    ClearBuffers clear_before_return;
+    RTCDevice device = rtcNewDevice("numa_replication=2");
+    bool passed = device != nullptr;
+    {
+      /* more replicas than NUMA nodes get requested, thus traversal operates on replicas also on single node systems */
+      RTCSceneRef instanced[2] = { rtcDeviceNewScene(g_device,RTCSceneFlags(RTC_SCENE_STATIC | RTC_SCENE_INSTANCED),aflags), 
+                                   rtcDeviceNewScene(device,RTCSceneFlags(RTC_SCENE_STATIC | RTC_SCENE_INSTANCED),aflags) };
+      RTCSceneRef scenes[2] = { rtcDeviceNewScene(g_device,RTC_SCENE_STATIC,aflags), rtcDeviceNewScene(device,RTC_SCENE_STATIC,aflags) };
+      for (size_t i=0; i<2; i++) {
+        addSphere(scenes[i],RTC_GEOMETRY_STATIC,Vec3fa(-1.0f,0.0f,0.0f),1.0f,50);
+        addHair  (scenes[i],RTC_GEOMETRY_STATIC,Vec3fa(+1.0f,0.0f,0.0f),1.0f,1.0f,1);
+
+        /* hierarchies over native instances cannot get replicated and are traversed unreplicated */
+        addSphere(instanced[i],RTC_GEOMETRY_STATIC,zero,0.5f,20);
+        rtcCommit (instanced[i]);
+        const AffineSpace3fa xfm = AffineSpace3fa::translate(Vec3fa(0.0f,1.0f,0.0f)) * AffineSpace3fa::scale(Vec3fa(0.5f));
+        unsigned instID = rtcNewInstance2(scenes[i],instanced[i]);
+        rtcSetTransform2(scenes[i],instID,RTC_MATRIX_COLUMN_MAJOR_ALIGNED16,(float*)&xfm);
+        rtcCommit (scenes[i]);
+      }
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+
+      for (size_t i=0; i<1000; i++)
+      {
+        const Vec3fa org(4.0f*drand48()-2.0f,3.0f*drand48()-1.0f,-5.0f);
+        const Vec3fa dir(0.0f,0.0f,1.0f);
+        RTCRay ray0 = makeRay(org,dir); rtcIntersect(scenes[0],ray0);
+        RTCRay ray1 = makeRay(org,dir); rtcIntersect(scenes[1],ray1);
+        passed &= ray0.geomID == ray1.geomID && ray0.primID == ray1.primID && ray0.instID == ray1.instID && ray0.tfar == ray1.tfar;
+        RTCRay shadow0 = makeRay(org,dir); rtcOccluded(scenes[0],shadow0);
+        RTCRay shadow1 = makeRay(org,dir); rtcOccluded(scenes[1],shadow1);
+        passed &= shadow0.geomID == shadow1.geomID;
+      }
+    }
+    rtcDeleteDevice(device);
+    return passed;
   }
-  
-  bool rtcore_update(RTCGeometryFlags flags)
+
+  bool rtcore_bezier_multi_curve(const char* ref_cfg, const char* cfg)
   {
     ClearBuffers clear_before_return;
-    RTCSceneRef scene = rtcDeviceNewScene(g_device,RTC_SCENE_DYNAMIC,aflags);
-    AssertNoError();
-    size_t numPhi = 50;
-    size_t numVertices = 2*numPhi*(numPhi+1);
-    Vec3fa pos0 = Vec3fa(-10,0,-10);
-    Vec3fa pos1 = Vec3fa(-10,0,+10);
-    Vec3fa pos2 = Vec3fa(+10,0,-10);
-    Vec3fa pos3 = Vec3fa(+10,0,+10);
-    unsigned geom0 = addSphere(scene,flags,pos0,1.0f,numPhi);
-    unsigned geom1 = addHair  (scene,flags,pos1,1.0f,1.0f,1);
-    unsigned geom2 = addSphere(scene,flags,pos2,1.0f,numPhi);
-    unsigned geom3 = addHair  (scene,flags,pos3,1.0f,1.0f,1);
-    AssertNoError();
-    
-    for (size_t i=0; i<16; i++) 
+    RTCDevice device0 = rtcNewDevice(ref_cfg);
+    RTCDevice device1 = rtcNewDevice(cfg);
+    bool passed = device0 != nullptr && device1 != nullptr;
+    if (passed)
     {
-      bool move0 = i & 1, move1 = i & 2, move2 = i & 4, move3 = i & 8;
-      Vec3fa ds(2,0.1f,2);
-      if (move0) { move_mesh_vec3f (scene,geom0,numVertices,ds); pos0 += ds; }
-      if (move1) { move_mesh_vec3fa(scene,geom1,4,ds); pos1 += ds; }
-      if (move2) { move_mesh_vec3f (scene,geom2,numVertices,ds); pos2 += ds; }
-      if (move3) { move_mesh_vec3fa(scene,geom3,4,ds); pos3 += ds; }
-      rtcCommit (scene);
-      AssertNoError();
-      {
-        RTCRay ray0 = makeRay(pos0+Vec3fa(0,10,0),Vec3fa(0,-1,0)); 
-        RTCRay ray1 = makeRay(pos1+Vec3fa(0,10,0),Vec3fa(0,-1,0)); 
-        RTCRay ray2 = makeRay(pos2+Vec3fa(0,10,0),Vec3fa(0,-1,0)); 
-        RTCRay ray3 = makeRay(pos3+Vec3fa(0,10,0),Vec3fa(0,-1,0)); 
-        rtcIntersect(scene,ray0);
-        rtcIntersect(scene,ray1);
-        rtcIntersect(scene,ray2);
-        rtcIntersect(scene,ray3);
-        if (ray0.geomID != 0 || 
-            ray1.geomID != 1 || 
-            ray2.geomID != 2 || 
-            ray3.geomID != 3) return false;
+      /* many curves per leaf with different tessellation rates */
+      RTCSceneRef scenes[2] = { rtcDeviceNewScene(device0,RTC_SCENE_STATIC,aflags), rtcDeviceNewScene(device1,RTC_SCENE_STATIC,aflags) };
+      for (size_t i=0; i<2; i++) {
+        addHair(scenes[i],RTC_GEOMETRY_STATIC,Vec3fa(0.0f,0.0f,0.0f),1.0f,0.2f,100);
+        unsigned geomID = addHair(scenes[i],RTC_GEOMETRY_STATIC,Vec3fa(0.5f,0.0f,0.0f),1.0f,0.1f,100);
+        rtcSetTessellationRate(scenes[i],geomID,9.0f);
+        rtcCommit (scenes[i]);
+      }
+      passed &= rtcDeviceGetError(device0) == RTC_NO_ERROR;
+      passed &= rtcDeviceGetError(device1) == RTC_NO_ERROR;
 
-#if HAS_INTERSECT4
-        RTCRay4 ray4; memset(&ray4,0,sizeof(ray4));
-        setRay(ray4,0,ray0);
-        setRay(ray4,1,ray1);
-        setRay(ray4,2,ray2);
-        setRay(ray4,3,ray3);
-        __aligned(16) int valid4[4] = { -1,-1,-1,-1 };
-        rtcIntersect4(valid4,scene,ray4);
-        if (ray4.geomID[0] != 0 || 
-            ray4.geomID[1] != 1 || 
-            ray4.geomID[2] != 2 || 
-            ray4.geomID[3] != 3) return false;
-#endif
+      /* rays grazing a curve may differ due to rounding, thus tolerate a few mismatches */
+      size_t numMismatches = 0;
+      for (size_t i=0; i<1000; i++)
+      {
+        const Vec3fa org(9.0f*drand48()-1.0f,15.0f*drand48()-1.0f,-5.0f);
+        const Vec3fa dir(0.2f*drand48()-0.1f,0.2f*drand48()-0.1f,1.0f);
+        RTCRay ray0 = makeRay(org,dir); rtcIntersect(scenes[0],ray0);
+        RTCRay ray1 = makeRay(org,dir); rtcIntersect(scenes[1],ray1);
+        bool equal = ray0.geomID == ray1.geomID && ray0.primID == ray1.primID;
+        if (ray0.geomID != RTC_INVALID_GEOMETRY_ID) equal &= abs(ray0.tfar-ray1.tfar) <= 1E-4f*ray0.tfar;
+        RTCRay shadow0 = makeRay(org,dir); rtcOccluded(scenes[0],shadow0);
+        RTCRay shadow1 = makeRay(org,dir); rtcOccluded(scenes[1],shadow1);
+        equal &= shadow0.geomID == shadow1.geomID;
+        numMismatches += !equal;
+      }
+      passed &= numMismatches <= 10;
+    }
+    if (device0) rtcDeleteDevice(device0);
+    if (device1) rtcDeleteDevice(device1);
+    return passed;
+  }
 
-#if HAS_INTERSECT8
-        if (hasISA(AVX)) 
-        {
-          RTCRay8 ray8; memset(&ray8,0,sizeof(ray8));
-          setRay(ray8,0,ray0);
-          setRay(ray8,1,ray1);
-          setRay(ray8,2,ray2);
-          setRay(ray8,3,ray3);
-          __aligned(32) int valid8[8] = { -1,-1,-1,-1, 0, 0, 0, 0 };
-          rtcIntersect8(valid8,scene,ray8);
-          if (ray8.geomID[0] != 0 || 
-              ray8.geomID[1] != 1 || 
-              ray8.geomID[2] != 2 || 
-              ray8.geomID[3] != 3) return false;
+  bool rtcore_curve_basis(const char* cfg, RTCCurveBasis basis)
+  {
+    ClearBuffers clear_before_return;
+    RTCDevice device = rtcNewDevice(cfg);
+    bool passed = device != nullptr;
+    if (passed)
+    {
+      /* the reference scene stores the strands converted into bezier curves */
+      const size_t numStrands = 20, numPoints = 8, numSegments = numPoints-3;
+      RTCSceneRef scenes[2] = { rtcDeviceNewScene(device,RTC_SCENE_STATIC,aflags), rtcDeviceNewScene(device,RTC_SCENE_STATIC,aflags) };
+      unsigned geom0 = rtcNewHairGeometry(scenes[0],RTC_GEOMETRY_STATIC,numStrands*numSegments,4*numStrands*numSegments);
+      unsigned geom1 = rtcNewHairGeometry(scenes[1],RTC_GEOMETRY_STATIC,numStrands*numSegments,numStrands*numPoints);
+      rtcSetCurveBasis(scenes[1],geom1,basis);
+      Vec3fa* vertices0 = (Vec3fa*) rtcMapBuffer(scenes[0],geom0,RTC_VERTEX_BUFFER);
+      Vec3fa* vertices1 = (Vec3fa*) rtcMapBuffer(scenes[1],geom1,RTC_VERTEX_BUFFER);
+      int* indices0 = (int*) rtcMapBuffer(scenes[0],geom0,RTC_INDEX_BUFFER);
+      int* indices1 = (int*) rtcMapBuffer(scenes[1],geom1,RTC_INDEX_BUFFER);
+      for (size_t s=0; s<numStrands; s++)
+      {
+        const Vec3fa pos = Vec3fa(float(s%5),float(s/5),0.0f);
+        for (size_t i=0; i<numPoints; i++) {
+          vertices1[s*numPoints+i] = pos + Vec3fa(0.3f*sinf(float(i)),0.3f*cosf(float(i)),0.5f*float(i));
+          vertices1[s*numPoints+i].w = 0.1f;
         }
-#endif
-
-#if HAS_INTERSECT16
-        if (hasISA(AVX512KNL) || hasISA(KNC)) 
+        for (size_t i=0; i<numSegments; i++)
         {
-          RTCRay16 ray16; memset(&ray16,0,sizeof(ray16));
-          setRay(ray16,0,ray0);
-          setRay(ray16,1,ray1);
-          setRay(ray16,2,ray2);
-          setRay(ray16,3,ray3);
-          __aligned(64) int valid16[16] = { -1,-1,-1,-1,+0,+0,+0,+0, 
-                                            +0,+0,+0,+0,+0,+0,+0,+0 };
-          rtcIntersect16(valid16,scene,ray16);
-          if (ray16.geomID[0] != 0 || 
-              ray16.geomID[1] != 1 || 
-              ray16.geomID[2] != 2 || 
-              ray16.geomID[3] != 3) return false;
+          const size_t prim = s*numSegments+i;
+          const Vec3fa* p = &vertices1[s*numPoints+i];
+          Vec3fa* b = &vertices0[4*prim];
+          if (basis == RTC_BASIS_BSPLINE) {
+            b[0] = (1.0f/6.0f)*p[0] + (2.0f/3.0f)*p[1] + (1.0f/6.0f)*p[2];
+            b[1] = (2.0f/3.0f)*p[1] + (1.0f/3.0f)*p[2];
+            b[2] = (1.0f/3.0f)*p[1] + (2.0f/3.0f)*p[2];
+            b[3] = (1.0f/6.0f)*p[1] + (2.0f/3.0f)*p[2] + (1.0f/6.0f)*p[3];
+          } else {
+            b[0] = p[1];
+            b[1] = p[1] + (1.0f/6.0f)*(p[2]-p[0]);
+            b[2] = p[2] - (1.0f/6.0f)*(p[3]-p[1]);
+            b[3] = p[2];
+          }
+          indices0[prim] = 4*prim;
+          indices1[prim] = s*numPoints+i;
         }
-#endif
       }
+      rtcUnmapBuffer(scenes[0],geom0,RTC_VERTEX_BUFFER);
+      rtcUnmapBuffer(scenes[1],geom1,RTC_VERTEX_BUFFER);
+      rtcUnmapBuffer(scenes[0],geom0,RTC_INDEX_BUFFER);
+      rtcUnmapBuffer(scenes[1],geom1,RTC_INDEX_BUFFER);
+      rtcCommit (scenes[0]);
+      rtcCommit (scenes[1]);
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+
+      /* rays grazing a curve may differ due to rounding, thus tolerate a few mismatches */
+      size_t numHits = 0, numMismatches = 0;
+      for (size_t i=0; i<1000; i++)
+      {
+        const Vec3fa org(-2.0f,5.0f*drand48()-0.5f,4.0f*drand48());
+        const Vec3fa dir(1.0f,0.2f*drand48()-0.1f,0.2f*drand48()-0.1f);
+        RTCRay ray0 = makeRay(org,dir); rtcIntersect(scenes[0],ray0);
+        RTCRay ray1 = makeRay(org,dir); rtcIntersect(scenes[1],ray1);
+        bool equal = ray0.geomID == ray1.geomID && ray0.primID == ray1.primID;
+        if (ray0.geomID != RTC_INVALID_GEOMETRY_ID) equal &= abs(ray0.tfar-ray1.tfar) <= 1E-4f*ray0.tfar;
+        numHits += ray0.geomID != RTC_INVALID_GEOMETRY_ID;
+        numMismatches += !equal;
+      }
+      passed &= numHits > 100 && numMismatches <= 10;
     }
-    scene = nullptr;
-    return true;
+    if (device) rtcDeleteDevice(device);
+    return passed;
   }
 
   bool rtcore_ray_masks_intersect(RTCSceneFlags sflags, RTCGeometryFlags gflags)
@@ -2055,6 +3576,380 @@ namespace embree
     numFailedTests += !passed;
   }
 
+  bool rtcore_filter_batching()
+  {
+    ClearBuffers clear_before_return;
+    bool passed = true;
+
+    /* the reference scene filters single rays one hit at a time, the other scene uses batched packet filters only */
+    RTCSceneRef scenes[2] = { rtcDeviceNewScene(g_device,RTC_SCENE_STATIC,aflags), rtcDeviceNewScene(g_device,RTC_SCENE_STATIC,aflags) };
+    unsigned geom0 = addSphere(scenes[0],RTC_GEOMETRY_STATIC,zero,1.0f,50);
+    unsigned geom1 = addSphere(scenes[1],RTC_GEOMETRY_STATIC,zero,1.0f,50);
+    rtcSetUserData(scenes[0],geom0,(void*)123);
+    rtcSetUserData(scenes[1],geom1,(void*)123);
+    rtcSetIntersectionFilterFunction(scenes[0],geom0,intersectionFilter1);
+    rtcSetOcclusionFilterFunction   (scenes[0],geom0,intersectionFilter1);
+    rtcSetIntersectionFilterFunction4 (scenes[1],geom1,intersectionFilter4);
+    rtcSetIntersectionFilterFunction8 (scenes[1],geom1,intersectionFilter8);
+    rtcSetIntersectionFilterFunction16(scenes[1],geom1,intersectionFilter16);
+    rtcSetOcclusionFilterFunction4 (scenes[1],geom1,intersectionFilter4);
+    rtcSetOcclusionFilterFunction8 (scenes[1],geom1,intersectionFilter8);
+    rtcSetOcclusionFilterFunction16(scenes[1],geom1,intersectionFilter16);
+    rtcSetFilterBatching(scenes[1],geom1,true);
+    rtcCommit (scenes[0]);
+    rtcCommit (scenes[1]);
+    AssertNoError();
+
+    for (size_t i=0; i<1000; i++)
+    {
+      const Vec3fa org(2.0f*drand48()-1.0f,2.0f*drand48()-1.0f,-2.0f);
+      const Vec3fa dir(0.2f*drand48()-0.1f,0.2f*drand48()-0.1f,1.0f);
+      RTCRay ray0 = makeRay(org,dir); rtcIntersect(scenes[0],ray0);
+      RTCRay ray1 = makeRay(org,dir); rtcIntersect(scenes[1],ray1);
+      passed &= ray0.geomID == ray1.geomID && ray0.primID == ray1.primID && ray0.tfar == ray1.tfar;
+      passed &= ray1.geomID == RTC_INVALID_GEOMETRY_ID || (ray1.primID & 2) == 0;
+
+      RTCRay shadow0 = makeRay(org,dir); rtcOccluded(scenes[0],shadow0);
+      RTCRay shadow1 = makeRay(org,dir); rtcOccluded(scenes[1],shadow1);
+      passed &= shadow0.geomID == shadow1.geomID;
+    }
+    return passed;
+  }
+
+  /* opacity micro map of level 2, 4 bytes per triangle */
+  static unsigned char* g_opacity_states = nullptr;
+  static bool g_opacity_known_state_filtered = false;
+
+  int opacityMicroMapState(unsigned primID, float u, float v)
+  {
+    const int N = 4;
+    const float fu = u*float(N), fv = v*float(N);
+    const int y = min(max(int(fv),0),N-1);
+    const int x = min(max(int(fu),0),N-1-y);
+    const int upper = (fu-float(x))+(fv-float(y)) > 1.0f && x+y < N-1;
+    const int k = y*(2*N-y) + 2*x + upper;
+    return (g_opacity_states[4*primID+(k>>2)] >> (2*(k&3))) & 3;
+  }
+
+  /* the reference filter (ptr == 1) resolves the opacity states itself */
+  bool opacityMicroMapReject(void* ptr, unsigned primID, float u, float v)
+  {
+    const int state = opacityMicroMapState(primID,u,v);
+    if ((size_t)ptr == 1) {
+      if (state == RTC_OPACITY_TRANSPARENT) return true;
+      if (state == RTC_OPACITY_OPAQUE) return false;
+    }
+    else if (state == RTC_OPACITY_TRANSPARENT || state == RTC_OPACITY_OPAQUE)
+      g_opacity_known_state_filtered = true;
+    return (primID + int(8.0f*u)) & 1;
+  }
+
+  void opacityMicroMapFilter1(void* ptr, RTCRay& ray) 
+  {
+    if (opacityMicroMapReject(ptr,ray.primID,ray.u,ray.v))
+      ray.geomID = -1;
+  }
+
+  void opacityMicroMapFilter4(const void* valid_i, void* ptr, RTCRay4& ray) 
+  {
+    int* valid = (int*)valid_i;
+    for (size_t i=0; i<4; i++)
+      if (valid[i] == -1 && opacityMicroMapReject(ptr,ray.primID[i],ray.u[i],ray.v[i]))
+        ray.geomID[i] = -1;
+  }
+
+  bool rtcore_opacity_micro_map()
+  {
+    ClearBuffers clear_before_return;
+    bool passed = true;
+
+    /* the reference scene resolves the opacity states inside the filter function */
+    RTCSceneRef scenes[2] = { rtcDeviceNewScene(g_device,RTC_SCENE_STATIC,aflags), rtcDeviceNewScene(g_device,RTC_SCENE_STATIC,aflags) };
+    std::vector<unsigned char> states(4*2*4*4);
+    for (size_t i=0; i<states.size(); i++) states[i] = (unsigned char) (256.0*drand48());
+    g_opacity_states = states.data();
+    g_opacity_known_state_filtered = false;
+
+    for (size_t j=0; j<2; j++)
+    {
+      unsigned geom0 = addPlane(scenes[j],RTC_GEOMETRY_STATIC,4,Vec3fa(-2.0f,-2.0f,-10.0f),Vec3fa(4,0,0),Vec3fa(0,4,0));
+      addPlane(scenes[j],RTC_GEOMETRY_STATIC,1,Vec3fa(-2.0f,-2.0f,-20.0f),Vec3fa(4,0,0),Vec3fa(0,4,0));
+      rtcSetUserData(scenes[j],geom0,(void*)(j+1));
+      rtcSetIntersectionFilterFunction(scenes[j],geom0,opacityMicroMapFilter1);
+      rtcSetOcclusionFilterFunction   (scenes[j],geom0,opacityMicroMapFilter1);
+#if HAS_INTERSECT4
+      rtcSetIntersectionFilterFunction4(scenes[j],geom0,opacityMicroMapFilter4);
+      rtcSetOcclusionFilterFunction4   (scenes[j],geom0,opacityMicroMapFilter4);
+#endif
+      if (j == 1) {
+        rtcSetOpacityMicroMapLevel(scenes[j],geom0,2);
+        unsigned char* opacity = (unsigned char*) rtcMapBuffer(scenes[j],geom0,RTC_OPACITY_BUFFER);
+        memcpy(opacity,states.data(),states.size());
+        rtcUnmapBuffer(scenes[j],geom0,RTC_OPACITY_BUFFER);
+      }
+      rtcCommit (scenes[j]);
+    }
+    AssertNoError();
+
+    size_t numFront = 0;
+    for (size_t i=0; i<1000; i++)
+    {
+      const Vec3fa org(3.8f*drand48()-1.9f,3.8f*drand48()-1.9f,0.0f);
+      const Vec3fa dir(0,0,-1);
+      RTCRay ray0 = makeRay(org,dir); rtcIntersect(scenes[0],ray0);
+      RTCRay ray1 = makeRay(org,dir); rtcIntersect(scenes[1],ray1);
+      passed &= ray0.geomID == ray1.geomID && ray0.primID == ray1.primID && ray0.tfar == ray1.tfar;
+      numFront += ray1.geomID == 0;
+
+      /* shadow rays end between both planes */
+      RTCRay shadow0 = makeRay(org,dir,0.0f,15.0f); rtcOccluded(scenes[0],shadow0);
+      RTCRay shadow1 = makeRay(org,dir,0.0f,15.0f); rtcOccluded(scenes[1],shadow1);
+      passed &= shadow0.geomID == shadow1.geomID;
+
+#if HAS_INTERSECT4
+      RTCRay4 ray4[2]; memset(ray4,0,sizeof(ray4));
+      RTCRay4 shadow4[2]; memset(shadow4,0,sizeof(shadow4));
+      for (size_t j=0; j<2; j++) 
+      {
+        for (size_t k=0; k<4; k++) {
+          const Vec3fa orgk(org.x+0.01f*k,org.y,org.z);
+          setRay(ray4[j],k,makeRay(orgk,dir));
+          setRay(shadow4[j],k,makeRay(orgk,dir,0.0f,15.0f));
+        }
+        __aligned(16) int valid4[4] = { -1,-1,-1,-1 };
+        rtcIntersect4(valid4,scenes[j],ray4[j]);
+        rtcOccluded4 (valid4,scenes[j],shadow4[j]);
+      }
+      for (size_t k=0; k<4; k++) {
+        passed &= ray4[0].geomID[k] == ray4[1].geomID[k] && ray4[0].primID[k] == ray4[1].primID[k];
+        passed &= shadow4[0].geomID[k] == shadow4[1].geomID[k];
+      }
+#endif
+    }
+    passed &= numFront > 100 && numFront < 900;
+    passed &= !g_opacity_known_state_filtered;
+    g_opacity_states = nullptr;
+    return passed;
+  }
+
+  atomic_t memoryBudgetBytesUsed = 0;
+  atomic_t memoryBudgetBytesPeak = 0;
+  bool memoryBudgetMonitorFunction(ssize_t bytes, bool post)
+  {
+    const atomic_t used = atomic_add(&memoryBudgetBytesUsed,bytes) + bytes;
+    for (atomic_t peak = memoryBudgetBytesPeak; used > peak; peak = memoryBudgetBytesPeak)
+      if (atomic_cmpxchg(&memoryBudgetBytesPeak,peak,used) == peak) break;
+    return true;
+  }
+
+  bool rtcore_memory_budget()
+  {
+    ClearBuffers clear_before_return;
+    RTCDevice device = rtcNewDevice(nullptr);
+    const RTCSceneFlags sflags = RTCSceneFlags(RTC_SCENE_STATIC | RTC_SCENE_HIGH_QUALITY);
+    const ssize_t bytes0 = rtcDeviceGetParameter1i(device,RTC_MEMORY_USED);
+    bool passed = true;
+    {
+      /* measure peak memory consumption of the unconstrained build */
+      RTCSceneRef scene0 = rtcDeviceNewScene(device,sflags,aflags);
+      addSphere(scene0,RTC_GEOMETRY_STATIC,zero,1.0f,100);
+      memoryBudgetBytesUsed = memoryBudgetBytesPeak = 0;
+      rtcDeviceSetMemoryMonitorFunction(device,memoryBudgetMonitorFunction);
+      rtcCommit (scene0);
+      rtcDeviceSetMemoryMonitorFunction(device,nullptr);
+      const ssize_t peakBytes = memoryBudgetBytesPeak;
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR && peakBytes > 0;
+
+      /* search the smallest budget the build succeeds with, the build has to degrade below the unconstrained peak */
+      RTCSceneRef scene1 = nullptr;
+      size_t steps = 0;
+      for (; steps<=16 && scene1 == nullptr; steps++)
+      {
+        RTCSceneRef scene = rtcDeviceNewScene(device,sflags,aflags);
+        addSphere(scene,RTC_GEOMETRY_STATIC,zero,1.0f,100);
+        const ssize_t budget = rtcDeviceGetParameter1i(device,RTC_MEMORY_USED) + steps*peakBytes/16;
+        rtcDeviceSetParameter1i(device,RTC_MEMORY_BUDGET,budget);
+        passed &= rtcDeviceGetParameter1i(device,RTC_MEMORY_BUDGET) == budget;
+        rtcCommit (scene);
+        passed &= rtcDeviceGetParameter1i(device,RTC_MEMORY_USED) <= budget;
+        rtcDeviceSetParameter1i(device,RTC_MEMORY_BUDGET,0);
+        const RTCError error = rtcDeviceGetError(device);
+        if (error == RTC_NO_ERROR) scene1 = scene;
+        else passed &= error == RTC_OUT_OF_MEMORY;
+      }
+      passed &= steps > 1 && steps <= 16;
+
+      /* the degraded scene has to give the same hits, up to rounding differences of the compact primitive layout */
+      for (size_t i=0; i<1000 && scene1 != nullptr; i++)
+      {
+        const Vec3fa org(4.0f*drand48()-2.0f,4.0f*drand48()-2.0f,4.0f*drand48()-2.0f);
+        const Vec3fa dir(2.0f*drand48()-1.0f,2.0f*drand48()-1.0f,2.0f*drand48()-1.0f);
+        RTCRay ray0 = makeRay(org,dir); rtcIntersect(scene0,ray0);
+        RTCRay ray1 = makeRay(org,dir); rtcIntersect(scene1,ray1);
+        passed &= ray0.geomID == ray1.geomID && ray0.primID == ray1.primID;
+        passed &= ray0.geomID == RTC_INVALID_GEOMETRY_ID || abs(ray0.tfar-ray1.tfar) < 1E-4f;
+        RTCRay shadow = makeRay(org,dir); rtcOccluded(scene1,shadow);
+        passed &= (shadow.geomID == 0) == (ray0.geomID != RTC_INVALID_GEOMETRY_ID);
+      }
+    }
+    passed &= rtcDeviceGetParameter1i(device,RTC_MEMORY_USED) == bytes0;
+    passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+    rtcDeleteDevice(device);
+    return passed;
+  }
+
+  bool rtcore_memory_budget_dynamic()
+  {
+    ClearBuffers clear_before_return;
+    RTCDevice device = rtcNewDevice(nullptr);
+    const ssize_t bytes0 = rtcDeviceGetParameter1i(device,RTC_MEMORY_USED);
+    bool passed = true;
+    {
+      /* memory consumption of the unconstrained build */
+      RTCSceneRef scene0 = rtcDeviceNewScene(device,RTC_SCENE_DYNAMIC,aflags);
+      addSphere(scene0,RTC_GEOMETRY_STATIC,zero,1.0f,100);
+      rtcCommit (scene0);
+      const ssize_t fullBytes = rtcDeviceGetParameter1i(device,RTC_MEMORY_USED) - bytes0;
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+      scene0 = nullptr;
+
+      /* search the smallest budget the build succeeds with */
+      RTCSceneRef scene1 = nullptr;
+      ssize_t degradedBytes = 0;
+      for (size_t steps=1; steps<=16 && scene1 == nullptr; steps++)
+      {
+        RTCSceneRef scene = rtcDeviceNewScene(device,RTC_SCENE_DYNAMIC,aflags);
+        addSphere(scene,RTC_GEOMETRY_STATIC,zero,1.0f,100);
+        const ssize_t bytes = rtcDeviceGetParameter1i(device,RTC_MEMORY_USED);
+        rtcDeviceSetParameter1i(device,RTC_MEMORY_BUDGET,bytes + steps*fullBytes/16);
+        rtcCommit (scene);
+        rtcDeviceSetParameter1i(device,RTC_MEMORY_BUDGET,0);
+        const RTCError error = rtcDeviceGetError(device);
+        if (error == RTC_NO_ERROR) { scene1 = scene; degradedBytes = rtcDeviceGetParameter1i(device,RTC_MEMORY_USED) - bytes0; }
+        else passed &= error == RTC_OUT_OF_MEMORY;
+      }
+      passed &= scene1 != nullptr && degradedBytes < fullBytes;
+
+      /* the degradation only applies to the build that ran out of memory, later commits build the configuration of the scene again */
+      if (scene1 != nullptr) {
+        rtcUpdate(scene1,0);
+        rtcCommit (scene1);
+        passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+        passed &= rtcDeviceGetParameter1i(device,RTC_MEMORY_USED) - bytes0 > degradedBytes;
+      }
+    }
+    passed &= rtcDeviceGetParameter1i(device,RTC_MEMORY_USED) == bytes0;
+    passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+    rtcDeleteDevice(device);
+    return passed;
+  }
+
+  bool rtcore_intersect_camera(RTCAlgorithmFlags packetFlags, float lensRadius)
+  {
+    ClearBuffers clear_before_return;
+    RTCSceneRef scene = rtcDeviceNewScene(g_device,RTC_SCENE_STATIC,RTCAlgorithmFlags(RTC_INTERSECT1 | packetFlags));
+    addSphere(scene,RTC_GEOMETRY_STATIC,Vec3fa(-0.5f,0.0f,0.0f),0.8f,50);
+    addSphere(scene,RTC_GEOMETRY_STATIC,Vec3fa(+0.7f,0.2f,1.0f),0.6f,50);
+    rtcCommit (scene);
+    AssertNoError();
+
+    /* render an odd sized tile into a larger framebuffer to test partial packets */
+    const size_t W = 64, H = 48, X0 = 5, Y0 = 3, TW = 37, TH = 23;
+    const float s = 2.0f/W;
+    RTCCamera camera;
+    camera.org[0] = 0.0f; camera.org[1] = 0.0f; camera.org[2] = -3.0f;
+    camera.vx[0] = s;     camera.vx[1] = 0.0f;  camera.vx[2] = 0.0f;
+    camera.vy[0] = 0.0f;  camera.vy[1] = -s;    camera.vy[2] = 0.0f;
+    camera.vz[0] = -0.5f*W*s; camera.vz[1] = 0.5f*H*s; camera.vz[2] = 1.0f;
+    camera.lensRadius = lensRadius; camera.focalDistance = 3.0f;
+    camera.lensSample[0] = 0.3f; camera.lensSample[1] = 0.7f;
+    camera.pixelSample[0] = 0.5f; camera.pixelSample[1] = 0.5f;
+    camera.tnear = 0.0f; camera.tfar = inf; camera.time = 0.0f; camera.mask = -1;
+
+    std::vector<float> tfar(W*H,-1.0f);
+    std::vector<unsigned> geomID(W*H,-2), primID(W*H,-2);
+    RTCCameraHits hits;
+    memset(&hits,0,sizeof(hits));
+    hits.tfar = tfar.data(); hits.geomID = geomID.data(); hits.primID = primID.data();
+    hits.stride = W*sizeof(float);
+    rtcIntersectCamera(scene,camera,X0,Y0,TW,TH,hits);
+    AssertNoError();
+
+    /* compare against single rays, packets use approximate normalization thus allow a few differences at edges */
+    const Vec3fa vx(camera.vx[0],camera.vx[1],camera.vx[2]);
+    const Vec3fa vy(camera.vy[0],camera.vy[1],camera.vy[2]);
+    const Vec3fa vz(camera.vz[0],camera.vz[1],camera.vz[2]);
+    Vec3fa lensOffset = zero;
+    if (lensRadius > 0.0f) {
+      const float r = lensRadius*sqrtf(camera.lensSample[0]), phi = 2.0f*float(pi)*camera.lensSample[1];
+      lensOffset = r*cosf(phi)*normalize(vx) + r*sinf(phi)*normalize(vy);
+    }
+    const float scale = lensRadius > 0.0f ? camera.focalDistance : 1.0f;
+    const Vec3fa org = Vec3fa(camera.org[0],camera.org[1],camera.org[2]) + lensOffset;
+
+    size_t numHits = 0, numErrors = 0;
+    for (size_t y=0; y<H; y++)
+    {
+      for (size_t x=0; x<W; x++)
+      {
+        const size_t i = y*W+x;
+        if (x < X0 || x >= X0+TW || y < Y0 || y >= Y0+TH) {
+          numErrors += tfar[i] != -1.0f || geomID[i] != unsigned(-2) || primID[i] != unsigned(-2);
+          continue;
+        }
+        const Vec3fa dir = scale*((x+0.5f)*vx + (y+0.5f)*vy + vz) - lensOffset;
+        RTCRay ray = makeRay(org,normalize(dir));
+        rtcIntersect(scene,ray);
+        numHits += ray.geomID != RTC_INVALID_GEOMETRY_ID;
+        if (ray.geomID != geomID[i]) numErrors++;
+        else if (ray.geomID != RTC_INVALID_GEOMETRY_ID && (ray.primID != primID[i] || abs(ray.tfar-tfar[i]) > 1E-3f)) numErrors++;
+      }
+    }
+    return numHits > TW*TH/4 && numHits < TW*TH && numErrors <= TW*TH/100;
+  }
+
+  bool rtcore_statistics()
+  {
+    ClearBuffers clear_before_return;
+    RTCDevice device = rtcNewDevice("subdiv_accel=bvh4.subdivpatch1cached,statistics=1");
+    bool passed = rtcDeviceGetParameter1i(device,RTC_STATISTICS) == 1;
+    {
+      RTCSceneRef scene = rtcDeviceNewScene(device,RTC_SCENE_STATIC,aflags);
+      addSphere(scene,RTC_GEOMETRY_STATIC,Vec3fa(-1.0f,0.0f,0.0f),0.5f,50);
+      unsigned geomID = addSubdivPlane(scene,RTC_GEOMETRY_STATIC,4,Vec3fa(0.0f,-1.0f,0.0f),Vec3fa(2.0f,0.0f,0.0f),Vec3fa(0.0f,2.0f,0.0f));
+      rtcSetUserData(scene,geomID,(void*)123);
+      rtcSetIntersectionFilterFunction(scene,geomID,intersectionFilter1);
+      rtcCommit (scene);
+      
+      /* trace rays towards both objects and check that all counters were incremented */
+      rtcDeviceClearStatistics(device);
+      for (size_t i=0; i<64; i++) {
+        RTCRay ray0 = makeRay(Vec3fa(-1.0f+2.0f*(i%8)/8.0f,-0.5f+(i/8)/8.0f,-5.0f),Vec3fa(0,0,1));
+        rtcIntersect(scene,ray0);
+        RTCRay ray1 = makeRay(Vec3fa(-1.0f+2.0f*(i%8)/8.0f,-0.5f+(i/8)/8.0f,-5.0f),Vec3fa(0,0,1));
+        rtcOccluded(scene,ray1);
+      }
+      RTCStatistics stats;
+      rtcDeviceGetStatistics(device,&stats);
+      passed &= stats.nodes > 0 && stats.leaves > 0 && stats.primitives > 0;
+      passed &= stats.leafHits > 0 && stats.leafHits <= stats.leaves;
+      passed &= stats.filterCalls > 0;
+      passed &= stats.tessellationCacheHits + stats.tessellationCacheMisses > 0;
+
+      /* nothing gets counted after disabling statistics */
+      rtcDeviceSetParameter1i(device,RTC_STATISTICS,0);
+      passed &= rtcDeviceGetParameter1i(device,RTC_STATISTICS) == 0;
+      rtcDeviceClearStatistics(device);
+      RTCRay ray = makeRay(Vec3fa(-1.0f,0.0f,-5.0f),Vec3fa(0,0,1));
+      rtcIntersect(scene,ray);
+      rtcDeviceGetStatistics(device,&stats);
+      passed &= stats.nodes == 0 && stats.leaves == 0 && stats.filterCalls == 0;
+      passed &= rtcDeviceGetError(device) == RTC_NO_ERROR;
+    }
+    rtcDeleteDevice(device);
+    return passed;
+  }
+
   bool rtcore_packet_write_test(RTCSceneFlags sflags, RTCGeometryFlags gflags, int type)
   {
     bool passed = true;
@@ -3582,6 +5477,74 @@ namespace embree
     return passed;
   }
 
+  bool rtcore_interpolateN(size_t N)
+  {
+    const size_t numVertices = 64, numPrims = 20, numUVs = 13;
+    RTCSceneRef scene = rtcDeviceNewScene(g_device,RTC_SCENE_DYNAMIC,RTC_INTERPOLATE);
+    AssertNoError();
+
+    /* all geometries share the same vertices and user vertices */
+    std::vector<Vertex> vertices(numVertices);
+    for (size_t i=0; i<numVertices; i++) vertices[i] = Vertex(drand48(),drand48(),drand48(),0.1f);
+    std::vector<float> user_vertices(numVertices*N);
+    for (size_t i=0; i<numVertices*N; i++) user_vertices[i] = drand48();
+    std::vector<int> indices(4*numPrims);
+    for (size_t i=0; i<4*numPrims; i++) indices[i] = int(drand48()*(numVertices-4));
+
+    unsigned geomIDs[4];
+    geomIDs[0] = rtcNewTriangleMesh(scene,RTC_GEOMETRY_STATIC,numPrims,numVertices);
+    geomIDs[1] = rtcNewQuadMesh    (scene,RTC_GEOMETRY_STATIC,numPrims,numVertices);
+    geomIDs[2] = rtcNewLineSegments(scene,RTC_GEOMETRY_STATIC,numPrims,numVertices);
+    geomIDs[3] = rtcNewHairGeometry(scene,RTC_GEOMETRY_STATIC,numPrims,numVertices);
+    rtcSetBuffer(scene,geomIDs[0],RTC_INDEX_BUFFER,indices.data(),0,3*sizeof(int));
+    for (size_t g=1; g<4; g++) rtcSetBuffer(scene,geomIDs[g],RTC_INDEX_BUFFER,indices.data(),0,g == 1 ? 4*sizeof(int) : sizeof(int));
+    for (size_t g=0; g<4; g++) {
+      rtcSetBuffer(scene,geomIDs[g],RTC_VERTEX_BUFFER,vertices.data(),0,sizeof(Vertex));
+      rtcSetBuffer(scene,geomIDs[g],RTC_USER_VERTEX_BUFFER0,user_vertices.data(),0,N*sizeof(float));
+    }
+    rtcCommit(scene);
+    AssertNoError();
+
+    bool passed = true;
+    for (size_t g=0; g<4; g++)
+    {
+      int valid[numUVs]; unsigned primIDs[numUVs]; float u[numUVs], v[numUVs];
+      for (size_t i=0; i<numUVs; i++) {
+        valid[i] = i%3 ? -1 : 0;
+        primIDs[i] = unsigned(drand48()*numPrims);
+        u[i] = drand48(); v[i] = g == 0 ? (1.0f-u[i])*drand48() : drand48();
+      }
+
+      /* outputs of invalid hits have to stay untouched */
+      std::vector<float> P(N*numUVs,-1.0f), dPdu(N*numUVs,-1.0f), dPdv(N*numUVs,-1.0f);
+      std::vector<float> ddPdudu(N*numUVs,-1.0f), ddPdvdv(N*numUVs,-1.0f), ddPdudv(N*numUVs,-1.0f);
+      rtcInterpolateN2(scene,geomIDs[g],valid,primIDs,u,v,numUVs,RTC_USER_VERTEX_BUFFER0,
+                       P.data(),dPdu.data(),dPdv.data(),ddPdudu.data(),ddPdvdv.data(),ddPdudv.data(),N);
+      AssertNoError();
+
+      for (size_t i=0; i<numUVs; i++)
+      {
+        std::vector<float> P1(N), dPdu1(N), dPdv1(N), ddPdudu1(N), ddPdvdv1(N), ddPdudv1(N);
+        rtcInterpolate2(scene,geomIDs[g],primIDs[i],u[i],v[i],RTC_USER_VERTEX_BUFFER0,
+                        P1.data(),dPdu1.data(),dPdv1.data(),ddPdudu1.data(),ddPdvdv1.data(),ddPdudv1.data(),N);
+        for (size_t j=0; j<N; j++) 
+        {
+          if (!valid[i]) {
+            passed &= P[j*numUVs+i] == -1.0f && dPdu[j*numUVs+i] == -1.0f && ddPdudu[j*numUVs+i] == -1.0f;
+            continue;
+          }
+          passed &= fabs(P[j*numUVs+i]-P1[j]) < 1E-5f;
+          passed &= fabs(dPdu[j*numUVs+i]-dPdu1[j]) < 1E-5f;
+          passed &= fabs(ddPdudu[j*numUVs+i]-ddPdudu1[j]) < 1E-5f;
+          if (g >= 2) continue; // curves have no v derivatives
+          passed &= fabs(dPdv[j*numUVs+i]-dPdv1[j]) < 1E-5f;
+          passed &= ddPdvdv[j*numUVs+i] == 0.0f && ddPdudv[j*numUVs+i] == 0.0f;
+        }
+      }
+    }
+    return passed;
+  }
+
   /*********************************************************************************/
   /*********************************************************************************/
   /*********************************************************************************/
@@ -3704,6 +5667,13 @@ namespace embree
     //POSITIVE("deformable_geometry",       rtcore_deformable_geometry()); // FIXME
     POSITIVE("unmapped_before_commit",    rtcore_unmapped_before_commit());
     POSITIVE("get_bounds",                rtcore_rtcGetBounds());
+    POSITIVE("save_load_scene",           rtcore_save_load_scene());
+    POSITIVE("compressed_bvh",            rtcore_compressed_bvh());
+#if !defined(__MIC__)
+    POSITIVE("motion_blur_time_steps",    rtcore_motion_blur_time_steps());
+    POSITIVE("motion_blur_non_dividing_time_steps", rtcore_motion_blur_non_dividing_time_steps());
+    POSITIVE("nested_instancing",         rtcore_nested_instancing());
+#endif
 
 #if defined(RTCORE_BUFFER_STRIDE)
     POSITIVE("buffer_stride",             rtcore_buffer_stride());
@@ -3714,6 +5684,52 @@ namespace embree
 
     POSITIVE("update_deformable",         rtcore_update(RTC_GEOMETRY_DEFORMABLE));
     POSITIVE("update_dynamic",            rtcore_update(RTC_GEOMETRY_DYNAMIC));
+    POSITIVE("update_many_deformable",    rtcore_update_many(RTC_GEOMETRY_DEFORMABLE));
+    POSITIVE("update_many_dynamic",       rtcore_update_many(RTC_GEOMETRY_DYNAMIC));
+    POSITIVE("commit_async_static",       rtcore_commit_async(RTC_SCENE_STATIC,RTC_GEOMETRY_STATIC));
+    POSITIVE("commit_async_deformable",   rtcore_commit_async(RTC_SCENE_DYNAMIC,RTC_GEOMETRY_DEFORMABLE));
+    POSITIVE("commit_async_dynamic",      rtcore_commit_async(RTC_SCENE_DYNAMIC,RTC_GEOMETRY_DYNAMIC));
+    POSITIVE("stream_reorder_static",     rtcore_stream_reorder(RTC_SCENE_STATIC));
+    POSITIVE("stream_reorder_dynamic",    rtcore_stream_reorder(RTC_SCENE_DYNAMIC));
+    POSITIVE("persistent_tessellation_cache", rtcore_persistent_tessellation_cache());
+    POSITIVE("statistics",                rtcore_statistics());
+    POSITIVE("morton64_builder",          rtcore_morton64_builder());
+    POSITIVE("numa_replication",          rtcore_numa_replication());
+    POSITIVE("bezier_multi_curve_bvh4",   rtcore_bezier_multi_curve("hair_accel=bvh4obb.bezier1v","hair_accel=bvh4obb.bezier4v"));
+#if defined(__TARGET_AVX__)
+    if (hasISA(AVX)) {
+      POSITIVE("bezier_multi_curve_bvh8", rtcore_bezier_multi_curve("hair_accel=bvh8obb.bezier1v","hair_accel=bvh8obb.bezier8v"));
+    }
+#endif
+    POSITIVE("curve_basis_bspline",       rtcore_curve_basis("",RTC_BASIS_BSPLINE));
+    POSITIVE("curve_basis_catmull_rom",   rtcore_curve_basis("",RTC_BASIS_CATMULL_ROM));
+    POSITIVE("curve_basis_bezier1i",      rtcore_curve_basis("hair_accel=bvh4obb.bezier1i",RTC_BASIS_BSPLINE));
+#if defined(RTCORE_INTERSECTION_FILTER) && defined(RTCORE_RAY_PACKETS)
+    POSITIVE("filter_batching",           rtcore_filter_batching());
+#endif
+#if defined(RTCORE_INTERSECTION_FILTER)
+    POSITIVE("opacity_micro_map",         rtcore_opacity_micro_map());
+#endif
+    POSITIVE("memory_budget",             rtcore_memory_budget());
+    POSITIVE("memory_budget_dynamic",     rtcore_memory_budget_dynamic());
+#if defined(RTCORE_RAY_PACKETS)
+    POSITIVE("intersect_camera1",         rtcore_intersect_camera(RTCAlgorithmFlags(0),0.0f));
+    POSITIVE("intersect_camera4",         rtcore_intersect_camera(RTC_INTERSECT4,0.0f));
+    if (hasISA(AVX))
+      POSITIVE("intersect_camera8",       rtcore_intersect_camera(RTC_INTERSECT8,0.0f));
+    if (hasISA(AVX512KNL) || hasISA(KNC))
+      POSITIVE("intersect_camera16",      rtcore_intersect_camera(RTC_INTERSECT16,0.0f));
+    POSITIVE("intersect_camera_thin_lens",rtcore_intersect_camera(aflags,0.1f));
+#endif
+    POSITIVE("compressed_triangles",      rtcore_compressed_triangles());
+    POSITIVE("compressed_triangles_commit_async", rtcore_compressed_triangles_commit_async());
+    POSITIVE("update_buffer_range",       rtcore_update_buffer_range());
+    POSITIVE("lazy_instances",            rtcore_lazy_instances());
+    POSITIVE("lazy_instance_build_error", rtcore_lazy_instance_build_error());
+    POSITIVE("tessellation_camera",       rtcore_tessellation_camera());
+    POSITIVE("displacement_function_N_cached", rtcore_displacement_function_N("subdiv_accel=bvh4.subdivpatch1cached",true));
+    POSITIVE("displacement_function_N_eager",  rtcore_displacement_function_N("subdiv_accel=bvh4.grid.eager",false));
+    POSITIVE("subdiv_topology",           rtcore_subdiv_topology());
     POSITIVE("overlapping_triangles",     rtcore_overlapping_triangles(100000));
     POSITIVE("overlapping_hair",          rtcore_overlapping_hair(100000));
     POSITIVE("new_delete_geometry",       rtcore_new_delete_geometry());
@@ -3739,6 +5755,10 @@ namespace embree
     POSITIVE("interpolate_hair12",               rtcore_interpolate_hair(12));
     POSITIVE("interpolate_hair15",               rtcore_interpolate_hair(15));
 
+    POSITIVE("interpolateN1",                    rtcore_interpolateN(1));
+    POSITIVE("interpolateN3",                    rtcore_interpolateN(3));
+    POSITIVE("interpolateN7",                    rtcore_interpolateN(7));
+
     rtcore_build();
 
 #if defined(RTCORE_RAY_MASK)